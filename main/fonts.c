@@ -6,63 +6,193 @@
  */
 //#include "esp_common.h"
 #include "fonts.h"
+#include "sdkconfig.h"
+/*
+ * Terminus sizes that come in ISO8859-1 and KOI8-R share one bitmap if both are enabled, glyphs that look
+ * the same (ASCII, box drawing, Cyrillic letters that match Latin ones) are stored once.
+ */
+#ifdef CONFIG_OLED_FONT_BITOCRA_4X7_ASCII
 #include "font_bitocra_4x7_ascii.h"
+#endif
+#ifdef CONFIG_OLED_FONT_BITOCRA_6X11_ISO8859_1
 #include "font_bitocra_6x11_iso8859_1.h"
+#endif
+#ifdef CONFIG_OLED_FONT_BITOCRA_7X13_ISO8859_1
 #include "font_bitocra_7x13_iso8859_1.h"
+#endif
+#ifdef CONFIG_OLED_FONT_GLCD_5X7
 #include "font_glcd_5x7.h"
+#endif
+#ifdef CONFIG_OLED_FONT_ROBOTO_8PT
 #include "font_roboto_8pt.h"
+#endif
+#ifdef CONFIG_OLED_FONT_ROBOTO_10PT
 #include "font_roboto_10pt.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_6X12_ISO8859_1) && defined(CONFIG_OLED_FONT_TERMINUS_6X12_KOI8_R)
+#include "font_terminus_6x12_shared.h"
+#elif defined(CONFIG_OLED_FONT_TERMINUS_6X12_ISO8859_1)
 #include "font_terminus_6x12_iso8859_1.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_8X14_ISO8859_1) && defined(CONFIG_OLED_FONT_TERMINUS_8X14_KOI8_R)
+#include "font_terminus_8x14_shared.h"
+#elif defined(CONFIG_OLED_FONT_TERMINUS_8X14_ISO8859_1)
 #include "font_terminus_8x14_iso8859_1.h"
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_10X18_ISO8859_1
 #include "font_terminus_10x18_iso8859_1.h"
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_11X22_ISO8859_1
 #include "font_terminus_11x22_iso8859_1.h"
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_12X24_ISO8859_1
 #include "font_terminus_12x24_iso8859_1.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_14X28_ISO8859_1) && defined(CONFIG_OLED_FONT_TERMINUS_14X28_KOI8_R)
+#include "font_terminus_14x28_shared.h"
+#elif defined(CONFIG_OLED_FONT_TERMINUS_14X28_ISO8859_1)
 #include "font_terminus_14x28_iso8859_1.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_16X32_ISO8859_1) && defined(CONFIG_OLED_FONT_TERMINUS_16X32_KOI8_R)
+#include "font_terminus_16x32_shared.h"
+#elif defined(CONFIG_OLED_FONT_TERMINUS_16X32_ISO8859_1)
 #include "font_terminus_16x32_iso8859_1.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_BOLD_8X14_ISO8859_1) && defined(CONFIG_OLED_FONT_TERMINUS_BOLD_8X14_KOI8_R)
+#include "font_terminus_bold_8x14_shared.h"
+#elif defined(CONFIG_OLED_FONT_TERMINUS_BOLD_8X14_ISO8859_1)
 #include "font_terminus_bold_8x14_iso8859_1.h"
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_BOLD_10X18_ISO8859_1
 #include "font_terminus_bold_10x18_iso8859_1.h"
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_BOLD_11X22_ISO8859_1
 #include "font_terminus_bold_11x22_iso8859_1.h"
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_BOLD_12X24_ISO8859_1
 #include "font_terminus_bold_12x24_iso8859_1.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_BOLD_14X28_ISO8859_1) && defined(CONFIG_OLED_FONT_TERMINUS_BOLD_14X28_KOI8_R)
+#include "font_terminus_bold_14x28_shared.h"
+#elif defined(CONFIG_OLED_FONT_TERMINUS_BOLD_14X28_ISO8859_1)
 #include "font_terminus_bold_14x28_iso8859_1.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_BOLD_16X32_ISO8859_1) && defined(CONFIG_OLED_FONT_TERMINUS_BOLD_16X32_KOI8_R)
+#include "font_terminus_bold_16x32_shared.h"
+#elif defined(CONFIG_OLED_FONT_TERMINUS_BOLD_16X32_ISO8859_1)
 #include "font_terminus_bold_16x32_iso8859_1.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_6X12_KOI8_R) && !defined(CONFIG_OLED_FONT_TERMINUS_6X12_ISO8859_1)
 #include "font_terminus_6x12_koi8_r.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_8X14_KOI8_R) && !defined(CONFIG_OLED_FONT_TERMINUS_8X14_ISO8859_1)
 #include "font_terminus_8x14_koi8_r.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_14X28_KOI8_R) && !defined(CONFIG_OLED_FONT_TERMINUS_14X28_ISO8859_1)
 #include "font_terminus_14x28_koi8_r.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_16X32_KOI8_R) && !defined(CONFIG_OLED_FONT_TERMINUS_16X32_ISO8859_1)
 #include "font_terminus_16x32_koi8_r.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_BOLD_8X14_KOI8_R) && !defined(CONFIG_OLED_FONT_TERMINUS_BOLD_8X14_ISO8859_1)
 #include "font_terminus_bold_8x14_koi8_r.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_BOLD_14X28_KOI8_R) && !defined(CONFIG_OLED_FONT_TERMINUS_BOLD_14X28_ISO8859_1)
 #include "font_terminus_bold_14x28_koi8_r.h"
+#endif
+#if defined(CONFIG_OLED_FONT_TERMINUS_BOLD_16X32_KOI8_R) && !defined(CONFIG_OLED_FONT_TERMINUS_BOLD_16X32_ISO8859_1)
 #include "font_terminus_bold_16x32_koi8_r.h"
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_8X14_UNICODE
+#include "font_terminus_8x14_unicode.h"
+#endif
 
 
 extern const font_info_t glcd_5x7_font_info;
 extern const font_info_t tahoma_8pt_font_info;
 
+// Fonts disabled in menuconfig stay NULL, so indexes do not depend on the configuration
 const font_info_t * fonts[NUM_FONTS] =
 {
-    &_fonts_bitocra_4x7_ascii_info,
-    &_fonts_bitocra_6x11_iso8859_1_info,
-    &_fonts_bitocra_7x13_iso8859_1_info,
-    &_fonts_glcd_5x7_info,
-    &_fonts_roboto_8pt_info,
-    &_fonts_roboto_10pt_info,
-    &_fonts_terminus_6x12_iso8859_1_info,
-    &_fonts_terminus_8x14_iso8859_1_info,
-    &_fonts_terminus_10x18_iso8859_1_info,
-    &_fonts_terminus_11x22_iso8859_1_info,
-    &_fonts_terminus_12x24_iso8859_1_info,
-    &_fonts_terminus_14x28_iso8859_1_info,
-    &_fonts_terminus_16x32_iso8859_1_info,
-    &_fonts_terminus_bold_8x14_iso8859_1_info,
-    &_fonts_terminus_bold_10x18_iso8859_1_info,
-    &_fonts_terminus_bold_11x22_iso8859_1_info,
-    &_fonts_terminus_bold_12x24_iso8859_1_info,
-    &_fonts_terminus_bold_14x28_iso8859_1_info,
-    &_fonts_terminus_bold_16x32_iso8859_1_info,
-//    &_fonts_terminus_6x12_koi8_r_info,
-//    &_fonts_terminus_8x14_koi8_r_info,
-//    &_fonts_terminus_14x28_koi8_r_info,
-//    &_fonts_terminus_16x32_koi8_r_info,
-//    &_fonts_terminus_bold_8x14_koi8_r_info,
-//    &_fonts_terminus_bold_14x28_koi8_r_info,
-//    &_fonts_terminus_bold_16x32_koi8_r_info
+#ifdef CONFIG_OLED_FONT_BITOCRA_4X7_ASCII
+    [FONT_BITOCRA_4X7_ASCII] = &_fonts_bitocra_4x7_ascii_info,
+#endif
+#ifdef CONFIG_OLED_FONT_BITOCRA_6X11_ISO8859_1
+    [FONT_BITOCRA_6X11_ISO8859_1] = &_fonts_bitocra_6x11_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_BITOCRA_7X13_ISO8859_1
+    [FONT_BITOCRA_7X13_ISO8859_1] = &_fonts_bitocra_7x13_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_GLCD_5X7
+    [FONT_GLCD_5X7] = &_fonts_glcd_5x7_info,
+#endif
+#ifdef CONFIG_OLED_FONT_ROBOTO_8PT
+    [FONT_ROBOTO_8PT] = &_fonts_roboto_8pt_info,
+#endif
+#ifdef CONFIG_OLED_FONT_ROBOTO_10PT
+    [FONT_ROBOTO_10PT] = &_fonts_roboto_10pt_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_6X12_ISO8859_1
+    [FONT_TERMINUS_6X12_ISO8859_1] = &_fonts_terminus_6x12_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_8X14_ISO8859_1
+    [FONT_TERMINUS_8X14_ISO8859_1] = &_fonts_terminus_8x14_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_10X18_ISO8859_1
+    [FONT_TERMINUS_10X18_ISO8859_1] = &_fonts_terminus_10x18_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_11X22_ISO8859_1
+    [FONT_TERMINUS_11X22_ISO8859_1] = &_fonts_terminus_11x22_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_12X24_ISO8859_1
+    [FONT_TERMINUS_12X24_ISO8859_1] = &_fonts_terminus_12x24_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_14X28_ISO8859_1
+    [FONT_TERMINUS_14X28_ISO8859_1] = &_fonts_terminus_14x28_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_16X32_ISO8859_1
+    [FONT_TERMINUS_16X32_ISO8859_1] = &_fonts_terminus_16x32_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_BOLD_8X14_ISO8859_1
+    [FONT_TERMINUS_BOLD_8X14_ISO8859_1] = &_fonts_terminus_bold_8x14_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_BOLD_10X18_ISO8859_1
+    [FONT_TERMINUS_BOLD_10X18_ISO8859_1] = &_fonts_terminus_bold_10x18_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_BOLD_11X22_ISO8859_1
+    [FONT_TERMINUS_BOLD_11X22_ISO8859_1] = &_fonts_terminus_bold_11x22_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_BOLD_12X24_ISO8859_1
+    [FONT_TERMINUS_BOLD_12X24_ISO8859_1] = &_fonts_terminus_bold_12x24_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_BOLD_14X28_ISO8859_1
+    [FONT_TERMINUS_BOLD_14X28_ISO8859_1] = &_fonts_terminus_bold_14x28_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_BOLD_16X32_ISO8859_1
+    [FONT_TERMINUS_BOLD_16X32_ISO8859_1] = &_fonts_terminus_bold_16x32_iso8859_1_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_6X12_KOI8_R
+    [FONT_TERMINUS_6X12_KOI8_R] = &_fonts_terminus_6x12_koi8_r_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_8X14_KOI8_R
+    [FONT_TERMINUS_8X14_KOI8_R] = &_fonts_terminus_8x14_koi8_r_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_14X28_KOI8_R
+    [FONT_TERMINUS_14X28_KOI8_R] = &_fonts_terminus_14x28_koi8_r_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_16X32_KOI8_R
+    [FONT_TERMINUS_16X32_KOI8_R] = &_fonts_terminus_16x32_koi8_r_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_BOLD_8X14_KOI8_R
+    [FONT_TERMINUS_BOLD_8X14_KOI8_R] = &_fonts_terminus_bold_8x14_koi8_r_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_BOLD_14X28_KOI8_R
+    [FONT_TERMINUS_BOLD_14X28_KOI8_R] = &_fonts_terminus_bold_14x28_koi8_r_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_BOLD_16X32_KOI8_R
+    [FONT_TERMINUS_BOLD_16X32_KOI8_R] = &_fonts_terminus_bold_16x32_koi8_r_info,
+#endif
+#ifdef CONFIG_OLED_FONT_TERMINUS_8X14_UNICODE
+    [FONT_TERMINUS_8X14_UNICODE] = &_fonts_terminus_8x14_unicode_info,
+#endif
 };
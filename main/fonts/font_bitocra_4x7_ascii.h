@@ -881,113 +881,17 @@ static const uint8_t _fonts_bitocra_4x7_ascii_bitmaps[] = {
     0x00, /* ........ */
 };
 
-const font_char_desc_t _fonts_bitocra_4x7_ascii_descriptors[] = {
-    { 0x04, 0x0000 }, /* Index: 0x00, char: \x20 */
-    { 0x04, 0x0007 }, /* Index: 0x01, char: \x21 */
-    { 0x04, 0x000e }, /* Index: 0x02, char: \x22 */
-    { 0x04, 0x0015 }, /* Index: 0x03, char: \x23 */
-    { 0x04, 0x001c }, /* Index: 0x04, char: \x24 */
-    { 0x04, 0x0023 }, /* Index: 0x05, char: \x25 */
-    { 0x04, 0x002a }, /* Index: 0x06, char: \x26 */
-    { 0x04, 0x0031 }, /* Index: 0x07, char: \x27 */
-    { 0x04, 0x0038 }, /* Index: 0x08, char: \x28 */
-    { 0x04, 0x003f }, /* Index: 0x09, char: \x29 */
-    { 0x04, 0x0046 }, /* Index: 0x0a, char: \x2a */
-    { 0x04, 0x004d }, /* Index: 0x0b, char: \x2b */
-    { 0x04, 0x0054 }, /* Index: 0x0c, char: \x2c */
-    { 0x04, 0x005b }, /* Index: 0x0d, char: \x2d */
-    { 0x04, 0x0062 }, /* Index: 0x0e, char: \x2e */
-    { 0x04, 0x0069 }, /* Index: 0x0f, char: \x2f */
-    { 0x04, 0x0070 }, /* Index: 0x10, char: \x30 */
-    { 0x04, 0x0077 }, /* Index: 0x11, char: \x31 */
-    { 0x04, 0x007e }, /* Index: 0x12, char: \x32 */
-    { 0x04, 0x0085 }, /* Index: 0x13, char: \x33 */
-    { 0x04, 0x008c }, /* Index: 0x14, char: \x34 */
-    { 0x04, 0x0093 }, /* Index: 0x15, char: \x35 */
-    { 0x04, 0x009a }, /* Index: 0x16, char: \x36 */
-    { 0x04, 0x00a1 }, /* Index: 0x17, char: \x37 */
-    { 0x04, 0x00a8 }, /* Index: 0x18, char: \x38 */
-    { 0x04, 0x00af }, /* Index: 0x19, char: \x39 */
-    { 0x04, 0x00b6 }, /* Index: 0x1a, char: \x3a */
-    { 0x04, 0x00bd }, /* Index: 0x1b, char: \x3b */
-    { 0x04, 0x00c4 }, /* Index: 0x1c, char: \x3c */
-    { 0x04, 0x00cb }, /* Index: 0x1d, char: \x3d */
-    { 0x04, 0x00d2 }, /* Index: 0x1e, char: \x3e */
-    { 0x04, 0x00d9 }, /* Index: 0x1f, char: \x3f */
-    { 0x04, 0x00e0 }, /* Index: 0x20, char: \x40 */
-    { 0x04, 0x00e7 }, /* Index: 0x21, char: \x41 */
-    { 0x04, 0x00ee }, /* Index: 0x22, char: \x42 */
-    { 0x04, 0x00f5 }, /* Index: 0x23, char: \x43 */
-    { 0x04, 0x00fc }, /* Index: 0x24, char: \x44 */
-    { 0x04, 0x0103 }, /* Index: 0x25, char: \x45 */
-    { 0x04, 0x010a }, /* Index: 0x26, char: \x46 */
-    { 0x04, 0x0111 }, /* Index: 0x27, char: \x47 */
-    { 0x04, 0x0118 }, /* Index: 0x28, char: \x48 */
-    { 0x04, 0x011f }, /* Index: 0x29, char: \x49 */
-    { 0x04, 0x0126 }, /* Index: 0x2a, char: \x4a */
-    { 0x04, 0x012d }, /* Index: 0x2b, char: \x4b */
-    { 0x04, 0x0134 }, /* Index: 0x2c, char: \x4c */
-    { 0x04, 0x013b }, /* Index: 0x2d, char: \x4d */
-    { 0x04, 0x0142 }, /* Index: 0x2e, char: \x4e */
-    { 0x04, 0x0149 }, /* Index: 0x2f, char: \x4f */
-    { 0x04, 0x0150 }, /* Index: 0x30, char: \x50 */
-    { 0x04, 0x0157 }, /* Index: 0x31, char: \x51 */
-    { 0x04, 0x015e }, /* Index: 0x32, char: \x52 */
-    { 0x04, 0x0165 }, /* Index: 0x33, char: \x53 */
-    { 0x04, 0x016c }, /* Index: 0x34, char: \x54 */
-    { 0x04, 0x0173 }, /* Index: 0x35, char: \x55 */
-    { 0x04, 0x017a }, /* Index: 0x36, char: \x56 */
-    { 0x04, 0x0181 }, /* Index: 0x37, char: \x57 */
-    { 0x04, 0x0188 }, /* Index: 0x38, char: \x58 */
-    { 0x04, 0x018f }, /* Index: 0x39, char: \x59 */
-    { 0x04, 0x0196 }, /* Index: 0x3a, char: \x5a */
-    { 0x04, 0x019d }, /* Index: 0x3b, char: \x5b */
-    { 0x04, 0x01a4 }, /* Index: 0x3c, char: \x5c */
-    { 0x04, 0x01ab }, /* Index: 0x3d, char: \x5d */
-    { 0x04, 0x01b2 }, /* Index: 0x3e, char: \x5e */
-    { 0x04, 0x01b9 }, /* Index: 0x3f, char: \x5f */
-    { 0x04, 0x01c0 }, /* Index: 0x40, char: \x60 */
-    { 0x04, 0x01c7 }, /* Index: 0x41, char: \x61 */
-    { 0x04, 0x01ce }, /* Index: 0x42, char: \x62 */
-    { 0x04, 0x01d5 }, /* Index: 0x43, char: \x63 */
-    { 0x04, 0x01dc }, /* Index: 0x44, char: \x64 */
-    { 0x04, 0x01e3 }, /* Index: 0x45, char: \x65 */
-    { 0x04, 0x01ea }, /* Index: 0x46, char: \x66 */
-    { 0x04, 0x01f1 }, /* Index: 0x47, char: \x67 */
-    { 0x04, 0x01f8 }, /* Index: 0x48, char: \x68 */
-    { 0x04, 0x01ff }, /* Index: 0x49, char: \x69 */
-    { 0x04, 0x0206 }, /* Index: 0x4a, char: \x6a */
-    { 0x04, 0x020d }, /* Index: 0x4b, char: \x6b */
-    { 0x04, 0x0214 }, /* Index: 0x4c, char: \x6c */
-    { 0x04, 0x021b }, /* Index: 0x4d, char: \x6d */
-    { 0x04, 0x0222 }, /* Index: 0x4e, char: \x6e */
-    { 0x04, 0x0229 }, /* Index: 0x4f, char: \x6f */
-    { 0x04, 0x0230 }, /* Index: 0x50, char: \x70 */
-    { 0x04, 0x0237 }, /* Index: 0x51, char: \x71 */
-    { 0x04, 0x023e }, /* Index: 0x52, char: \x72 */
-    { 0x04, 0x0245 }, /* Index: 0x53, char: \x73 */
-    { 0x04, 0x024c }, /* Index: 0x54, char: \x74 */
-    { 0x04, 0x0253 }, /* Index: 0x55, char: \x75 */
-    { 0x04, 0x025a }, /* Index: 0x56, char: \x76 */
-    { 0x04, 0x0261 }, /* Index: 0x57, char: \x77 */
-    { 0x04, 0x0268 }, /* Index: 0x58, char: \x78 */
-    { 0x04, 0x026f }, /* Index: 0x59, char: \x79 */
-    { 0x04, 0x0276 }, /* Index: 0x5a, char: \x7a */
-    { 0x04, 0x027d }, /* Index: 0x5b, char: \x7b */
-    { 0x04, 0x0284 }, /* Index: 0x5c, char: \x7c */
-    { 0x04, 0x028b }, /* Index: 0x5d, char: \x7d */
-    { 0x04, 0x0292 }, /* Index: 0x5e, char: \x7e */
-    { 0x04, 0x0299 }, /* Index: 0x5f, char: \x7f */
-};
-
 const font_info_t _fonts_bitocra_4x7_ascii_info =
 {
     .height           = 7, /* Character height */
     .c                = 0, /* C */
     .char_start       = 32, /* Start character */
     .char_end         = 127, /* End character */
-    .char_descriptors = _fonts_bitocra_4x7_ascii_descriptors, /* Character descriptor array */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
     .bitmap           = _fonts_bitocra_4x7_ascii_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 4, /* Glyph width */
+    .stride           = 7, /* Bytes per glyph */
 };
 
 #endif /* _EXTRAS_FONTS_FONT_BITOCRA_4X7_ASCII_H_ */
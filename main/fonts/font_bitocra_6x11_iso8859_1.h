@@ -2929,241 +2929,17 @@ static const uint8_t _fonts_bitocra_6x11_iso8859_1_bitmaps[] = {
     0x00, /* ........ */
 };
 
-const font_char_desc_t _fonts_bitocra_6x11_iso8859_1_descriptors[] = {
-    { 0x06, 0x0000 }, /* Index: 0x00, char: \x20 */
-    { 0x06, 0x000b }, /* Index: 0x01, char: \x21 */
-    { 0x06, 0x0016 }, /* Index: 0x02, char: \x22 */
-    { 0x06, 0x0021 }, /* Index: 0x03, char: \x23 */
-    { 0x06, 0x002c }, /* Index: 0x04, char: \x24 */
-    { 0x06, 0x0037 }, /* Index: 0x05, char: \x25 */
-    { 0x06, 0x0042 }, /* Index: 0x06, char: \x26 */
-    { 0x06, 0x004d }, /* Index: 0x07, char: \x27 */
-    { 0x06, 0x0058 }, /* Index: 0x08, char: \x28 */
-    { 0x06, 0x0063 }, /* Index: 0x09, char: \x29 */
-    { 0x06, 0x006e }, /* Index: 0x0a, char: \x2a */
-    { 0x06, 0x0079 }, /* Index: 0x0b, char: \x2b */
-    { 0x06, 0x0084 }, /* Index: 0x0c, char: \x2c */
-    { 0x06, 0x008f }, /* Index: 0x0d, char: \x2d */
-    { 0x06, 0x009a }, /* Index: 0x0e, char: \x2e */
-    { 0x06, 0x00a5 }, /* Index: 0x0f, char: \x2f */
-    { 0x06, 0x00b0 }, /* Index: 0x10, char: \x30 */
-    { 0x06, 0x00bb }, /* Index: 0x11, char: \x31 */
-    { 0x06, 0x00c6 }, /* Index: 0x12, char: \x32 */
-    { 0x06, 0x00d1 }, /* Index: 0x13, char: \x33 */
-    { 0x06, 0x00dc }, /* Index: 0x14, char: \x34 */
-    { 0x06, 0x00e7 }, /* Index: 0x15, char: \x35 */
-    { 0x06, 0x00f2 }, /* Index: 0x16, char: \x36 */
-    { 0x06, 0x00fd }, /* Index: 0x17, char: \x37 */
-    { 0x06, 0x0108 }, /* Index: 0x18, char: \x38 */
-    { 0x06, 0x0113 }, /* Index: 0x19, char: \x39 */
-    { 0x06, 0x011e }, /* Index: 0x1a, char: \x3a */
-    { 0x06, 0x0129 }, /* Index: 0x1b, char: \x3b */
-    { 0x06, 0x0134 }, /* Index: 0x1c, char: \x3c */
-    { 0x06, 0x013f }, /* Index: 0x1d, char: \x3d */
-    { 0x06, 0x014a }, /* Index: 0x1e, char: \x3e */
-    { 0x06, 0x0155 }, /* Index: 0x1f, char: \x3f */
-    { 0x06, 0x0160 }, /* Index: 0x20, char: \x40 */
-    { 0x06, 0x016b }, /* Index: 0x21, char: \x41 */
-    { 0x06, 0x0176 }, /* Index: 0x22, char: \x42 */
-    { 0x06, 0x0181 }, /* Index: 0x23, char: \x43 */
-    { 0x06, 0x018c }, /* Index: 0x24, char: \x44 */
-    { 0x06, 0x0197 }, /* Index: 0x25, char: \x45 */
-    { 0x06, 0x01a2 }, /* Index: 0x26, char: \x46 */
-    { 0x06, 0x01ad }, /* Index: 0x27, char: \x47 */
-    { 0x06, 0x01b8 }, /* Index: 0x28, char: \x48 */
-    { 0x06, 0x01c3 }, /* Index: 0x29, char: \x49 */
-    { 0x06, 0x01ce }, /* Index: 0x2a, char: \x4a */
-    { 0x06, 0x01d9 }, /* Index: 0x2b, char: \x4b */
-    { 0x06, 0x01e4 }, /* Index: 0x2c, char: \x4c */
-    { 0x06, 0x01ef }, /* Index: 0x2d, char: \x4d */
-    { 0x06, 0x01fa }, /* Index: 0x2e, char: \x4e */
-    { 0x06, 0x0205 }, /* Index: 0x2f, char: \x4f */
-    { 0x06, 0x0210 }, /* Index: 0x30, char: \x50 */
-    { 0x06, 0x021b }, /* Index: 0x31, char: \x51 */
-    { 0x06, 0x0226 }, /* Index: 0x32, char: \x52 */
-    { 0x06, 0x0231 }, /* Index: 0x33, char: \x53 */
-    { 0x06, 0x023c }, /* Index: 0x34, char: \x54 */
-    { 0x06, 0x0247 }, /* Index: 0x35, char: \x55 */
-    { 0x06, 0x0252 }, /* Index: 0x36, char: \x56 */
-    { 0x06, 0x025d }, /* Index: 0x37, char: \x57 */
-    { 0x06, 0x0268 }, /* Index: 0x38, char: \x58 */
-    { 0x06, 0x0273 }, /* Index: 0x39, char: \x59 */
-    { 0x06, 0x027e }, /* Index: 0x3a, char: \x5a */
-    { 0x06, 0x0289 }, /* Index: 0x3b, char: \x5b */
-    { 0x06, 0x0294 }, /* Index: 0x3c, char: \x5c */
-    { 0x06, 0x029f }, /* Index: 0x3d, char: \x5d */
-    { 0x06, 0x02aa }, /* Index: 0x3e, char: \x5e */
-    { 0x06, 0x02b5 }, /* Index: 0x3f, char: \x5f */
-    { 0x06, 0x02c0 }, /* Index: 0x40, char: \x60 */
-    { 0x06, 0x02cb }, /* Index: 0x41, char: \x61 */
-    { 0x06, 0x02d6 }, /* Index: 0x42, char: \x62 */
-    { 0x06, 0x02e1 }, /* Index: 0x43, char: \x63 */
-    { 0x06, 0x02ec }, /* Index: 0x44, char: \x64 */
-    { 0x06, 0x02f7 }, /* Index: 0x45, char: \x65 */
-    { 0x06, 0x0302 }, /* Index: 0x46, char: \x66 */
-    { 0x06, 0x030d }, /* Index: 0x47, char: \x67 */
-    { 0x06, 0x0318 }, /* Index: 0x48, char: \x68 */
-    { 0x06, 0x0323 }, /* Index: 0x49, char: \x69 */
-    { 0x06, 0x032e }, /* Index: 0x4a, char: \x6a */
-    { 0x06, 0x0339 }, /* Index: 0x4b, char: \x6b */
-    { 0x06, 0x0344 }, /* Index: 0x4c, char: \x6c */
-    { 0x06, 0x034f }, /* Index: 0x4d, char: \x6d */
-    { 0x06, 0x035a }, /* Index: 0x4e, char: \x6e */
-    { 0x06, 0x0365 }, /* Index: 0x4f, char: \x6f */
-    { 0x06, 0x0370 }, /* Index: 0x50, char: \x70 */
-    { 0x06, 0x037b }, /* Index: 0x51, char: \x71 */
-    { 0x06, 0x0386 }, /* Index: 0x52, char: \x72 */
-    { 0x06, 0x0391 }, /* Index: 0x53, char: \x73 */
-    { 0x06, 0x039c }, /* Index: 0x54, char: \x74 */
-    { 0x06, 0x03a7 }, /* Index: 0x55, char: \x75 */
-    { 0x06, 0x03b2 }, /* Index: 0x56, char: \x76 */
-    { 0x06, 0x03bd }, /* Index: 0x57, char: \x77 */
-    { 0x06, 0x03c8 }, /* Index: 0x58, char: \x78 */
-    { 0x06, 0x03d3 }, /* Index: 0x59, char: \x79 */
-    { 0x06, 0x03de }, /* Index: 0x5a, char: \x7a */
-    { 0x06, 0x03e9 }, /* Index: 0x5b, char: \x7b */
-    { 0x06, 0x03f4 }, /* Index: 0x5c, char: \x7c */
-    { 0x06, 0x03ff }, /* Index: 0x5d, char: \x7d */
-    { 0x06, 0x040a }, /* Index: 0x5e, char: \x7e */
-    { 0x06, 0x0415 }, /* Index: 0x5f, char: \x7f */
-    { 0x06, 0x0420 }, /* Index: 0x60, char: \x80 */
-    { 0x06, 0x042b }, /* Index: 0x61, char: \x81 */
-    { 0x06, 0x0436 }, /* Index: 0x62, char: \x82 */
-    { 0x06, 0x0441 }, /* Index: 0x63, char: \x83 */
-    { 0x06, 0x044c }, /* Index: 0x64, char: \x84 */
-    { 0x06, 0x0457 }, /* Index: 0x65, char: \x85 */
-    { 0x06, 0x0462 }, /* Index: 0x66, char: \x86 */
-    { 0x06, 0x046d }, /* Index: 0x67, char: \x87 */
-    { 0x06, 0x0478 }, /* Index: 0x68, char: \x88 */
-    { 0x06, 0x0483 }, /* Index: 0x69, char: \x89 */
-    { 0x06, 0x048e }, /* Index: 0x6a, char: \x8a */
-    { 0x06, 0x0499 }, /* Index: 0x6b, char: \x8b */
-    { 0x06, 0x04a4 }, /* Index: 0x6c, char: \x8c */
-    { 0x06, 0x04af }, /* Index: 0x6d, char: \x8d */
-    { 0x06, 0x04ba }, /* Index: 0x6e, char: \x8e */
-    { 0x06, 0x04c5 }, /* Index: 0x6f, char: \x8f */
-    { 0x06, 0x04d0 }, /* Index: 0x70, char: \x90 */
-    { 0x06, 0x04db }, /* Index: 0x71, char: \x91 */
-    { 0x06, 0x04e6 }, /* Index: 0x72, char: \x92 */
-    { 0x06, 0x04f1 }, /* Index: 0x73, char: \x93 */
-    { 0x06, 0x04fc }, /* Index: 0x74, char: \x94 */
-    { 0x06, 0x0507 }, /* Index: 0x75, char: \x95 */
-    { 0x06, 0x0512 }, /* Index: 0x76, char: \x96 */
-    { 0x06, 0x051d }, /* Index: 0x77, char: \x97 */
-    { 0x06, 0x0528 }, /* Index: 0x78, char: \x98 */
-    { 0x06, 0x0533 }, /* Index: 0x79, char: \x99 */
-    { 0x06, 0x053e }, /* Index: 0x7a, char: \x9a */
-    { 0x06, 0x0549 }, /* Index: 0x7b, char: \x9b */
-    { 0x06, 0x0554 }, /* Index: 0x7c, char: \x9c */
-    { 0x06, 0x055f }, /* Index: 0x7d, char: \x9d */
-    { 0x06, 0x056a }, /* Index: 0x7e, char: \x9e */
-    { 0x06, 0x0575 }, /* Index: 0x7f, char: \x9f */
-    { 0x06, 0x0580 }, /* Index: 0x80, char: \xa0 */
-    { 0x06, 0x058b }, /* Index: 0x81, char: \xa1 */
-    { 0x06, 0x0596 }, /* Index: 0x82, char: \xa2 */
-    { 0x06, 0x05a1 }, /* Index: 0x83, char: \xa3 */
-    { 0x06, 0x05ac }, /* Index: 0x84, char: \xa4 */
-    { 0x06, 0x05b7 }, /* Index: 0x85, char: \xa5 */
-    { 0x06, 0x05c2 }, /* Index: 0x86, char: \xa6 */
-    { 0x06, 0x05cd }, /* Index: 0x87, char: \xa7 */
-    { 0x06, 0x05d8 }, /* Index: 0x88, char: \xa8 */
-    { 0x06, 0x05e3 }, /* Index: 0x89, char: \xa9 */
-    { 0x06, 0x05ee }, /* Index: 0x8a, char: \xaa */
-    { 0x06, 0x05f9 }, /* Index: 0x8b, char: \xab */
-    { 0x06, 0x0604 }, /* Index: 0x8c, char: \xac */
-    { 0x06, 0x060f }, /* Index: 0x8d, char: \xad */
-    { 0x06, 0x061a }, /* Index: 0x8e, char: \xae */
-    { 0x06, 0x0625 }, /* Index: 0x8f, char: \xaf */
-    { 0x06, 0x0630 }, /* Index: 0x90, char: \xb0 */
-    { 0x06, 0x063b }, /* Index: 0x91, char: \xb1 */
-    { 0x06, 0x0646 }, /* Index: 0x92, char: \xb2 */
-    { 0x06, 0x0651 }, /* Index: 0x93, char: \xb3 */
-    { 0x06, 0x065c }, /* Index: 0x94, char: \xb4 */
-    { 0x06, 0x0667 }, /* Index: 0x95, char: \xb5 */
-    { 0x06, 0x0672 }, /* Index: 0x96, char: \xb6 */
-    { 0x06, 0x067d }, /* Index: 0x97, char: \xb7 */
-    { 0x06, 0x0688 }, /* Index: 0x98, char: \xb8 */
-    { 0x06, 0x0693 }, /* Index: 0x99, char: \xb9 */
-    { 0x06, 0x069e }, /* Index: 0x9a, char: \xba */
-    { 0x06, 0x06a9 }, /* Index: 0x9b, char: \xbb */
-    { 0x06, 0x06b4 }, /* Index: 0x9c, char: \xbc */
-    { 0x06, 0x06bf }, /* Index: 0x9d, char: \xbd */
-    { 0x06, 0x06ca }, /* Index: 0x9e, char: \xbe */
-    { 0x06, 0x06d5 }, /* Index: 0x9f, char: \xbf */
-    { 0x06, 0x06e0 }, /* Index: 0xa0, char: \xc0 */
-    { 0x06, 0x06eb }, /* Index: 0xa1, char: \xc1 */
-    { 0x06, 0x06f6 }, /* Index: 0xa2, char: \xc2 */
-    { 0x06, 0x0701 }, /* Index: 0xa3, char: \xc3 */
-    { 0x06, 0x070c }, /* Index: 0xa4, char: \xc4 */
-    { 0x06, 0x0717 }, /* Index: 0xa5, char: \xc5 */
-    { 0x06, 0x0722 }, /* Index: 0xa6, char: \xc6 */
-    { 0x06, 0x072d }, /* Index: 0xa7, char: \xc7 */
-    { 0x06, 0x0738 }, /* Index: 0xa8, char: \xc8 */
-    { 0x06, 0x0743 }, /* Index: 0xa9, char: \xc9 */
-    { 0x06, 0x074e }, /* Index: 0xaa, char: \xca */
-    { 0x06, 0x0759 }, /* Index: 0xab, char: \xcb */
-    { 0x06, 0x0764 }, /* Index: 0xac, char: \xcc */
-    { 0x06, 0x076f }, /* Index: 0xad, char: \xcd */
-    { 0x06, 0x077a }, /* Index: 0xae, char: \xce */
-    { 0x06, 0x0785 }, /* Index: 0xaf, char: \xcf */
-    { 0x06, 0x0790 }, /* Index: 0xb0, char: \xd0 */
-    { 0x06, 0x079b }, /* Index: 0xb1, char: \xd1 */
-    { 0x06, 0x07a6 }, /* Index: 0xb2, char: \xd2 */
-    { 0x06, 0x07b1 }, /* Index: 0xb3, char: \xd3 */
-    { 0x06, 0x07bc }, /* Index: 0xb4, char: \xd4 */
-    { 0x06, 0x07c7 }, /* Index: 0xb5, char: \xd5 */
-    { 0x06, 0x07d2 }, /* Index: 0xb6, char: \xd6 */
-    { 0x06, 0x07dd }, /* Index: 0xb7, char: \xd7 */
-    { 0x06, 0x07e8 }, /* Index: 0xb8, char: \xd8 */
-    { 0x06, 0x07f3 }, /* Index: 0xb9, char: \xd9 */
-    { 0x06, 0x07fe }, /* Index: 0xba, char: \xda */
-    { 0x06, 0x0809 }, /* Index: 0xbb, char: \xdb */
-    { 0x06, 0x0814 }, /* Index: 0xbc, char: \xdc */
-    { 0x06, 0x081f }, /* Index: 0xbd, char: \xdd */
-    { 0x06, 0x082a }, /* Index: 0xbe, char: \xde */
-    { 0x06, 0x0835 }, /* Index: 0xbf, char: \xdf */
-    { 0x06, 0x0840 }, /* Index: 0xc0, char: \xe0 */
-    { 0x06, 0x084b }, /* Index: 0xc1, char: \xe1 */
-    { 0x06, 0x0856 }, /* Index: 0xc2, char: \xe2 */
-    { 0x06, 0x0861 }, /* Index: 0xc3, char: \xe3 */
-    { 0x06, 0x086c }, /* Index: 0xc4, char: \xe4 */
-    { 0x06, 0x0877 }, /* Index: 0xc5, char: \xe5 */
-    { 0x06, 0x0882 }, /* Index: 0xc6, char: \xe6 */
-    { 0x06, 0x088d }, /* Index: 0xc7, char: \xe7 */
-    { 0x06, 0x0898 }, /* Index: 0xc8, char: \xe8 */
-    { 0x06, 0x08a3 }, /* Index: 0xc9, char: \xe9 */
-    { 0x06, 0x08ae }, /* Index: 0xca, char: \xea */
-    { 0x06, 0x08b9 }, /* Index: 0xcb, char: \xeb */
-    { 0x06, 0x08c4 }, /* Index: 0xcc, char: \xec */
-    { 0x06, 0x08cf }, /* Index: 0xcd, char: \xed */
-    { 0x06, 0x08da }, /* Index: 0xce, char: \xee */
-    { 0x06, 0x08e5 }, /* Index: 0xcf, char: \xef */
-    { 0x06, 0x08f0 }, /* Index: 0xd0, char: \xf0 */
-    { 0x06, 0x08fb }, /* Index: 0xd1, char: \xf1 */
-    { 0x06, 0x0906 }, /* Index: 0xd2, char: \xf2 */
-    { 0x06, 0x0911 }, /* Index: 0xd3, char: \xf3 */
-    { 0x06, 0x091c }, /* Index: 0xd4, char: \xf4 */
-    { 0x06, 0x0927 }, /* Index: 0xd5, char: \xf5 */
-    { 0x06, 0x0932 }, /* Index: 0xd6, char: \xf6 */
-    { 0x06, 0x093d }, /* Index: 0xd7, char: \xf7 */
-    { 0x06, 0x0948 }, /* Index: 0xd8, char: \xf8 */
-    { 0x06, 0x0953 }, /* Index: 0xd9, char: \xf9 */
-    { 0x06, 0x095e }, /* Index: 0xda, char: \xfa */
-    { 0x06, 0x0969 }, /* Index: 0xdb, char: \xfb */
-    { 0x06, 0x0974 }, /* Index: 0xdc, char: \xfc */
-    { 0x06, 0x097f }, /* Index: 0xdd, char: \xfd */
-    { 0x06, 0x098a }, /* Index: 0xde, char: \xfe */
-    { 0x06, 0x0995 }, /* Index: 0xdf, char: \xff */
-};
-
 const font_info_t _fonts_bitocra_6x11_iso8859_1_info =
 {
     .height           = 11, /* Character height */
     .c                = 0, /* C */
     .char_start       = 32, /* Start character */
     .char_end         = 255, /* End character */
-    .char_descriptors = _fonts_bitocra_6x11_iso8859_1_descriptors, /* Character descriptor array */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
     .bitmap           = _fonts_bitocra_6x11_iso8859_1_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 6, /* Glyph width */
+    .stride           = 11, /* Bytes per glyph */
 };
 
 #endif /* _EXTRAS_FONTS_FONT_BITOCRA_6X11_ISO8859_1_H_ */
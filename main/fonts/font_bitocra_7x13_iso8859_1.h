@@ -3377,241 +3377,17 @@ static const uint8_t _fonts_bitocra_7x13_iso8859_1_bitmaps[] = {
     0xf8, /* #####... */
 };
 
-const font_char_desc_t _fonts_bitocra_7x13_iso8859_1_descriptors[] = {
-    { 0x07, 0x0000 }, /* Index: 0x00, char: \x20 */
-    { 0x07, 0x000d }, /* Index: 0x01, char: \x21 */
-    { 0x07, 0x001a }, /* Index: 0x02, char: \x22 */
-    { 0x07, 0x0027 }, /* Index: 0x03, char: \x23 */
-    { 0x07, 0x0034 }, /* Index: 0x04, char: \x24 */
-    { 0x07, 0x0041 }, /* Index: 0x05, char: \x25 */
-    { 0x07, 0x004e }, /* Index: 0x06, char: \x26 */
-    { 0x07, 0x005b }, /* Index: 0x07, char: \x27 */
-    { 0x07, 0x0068 }, /* Index: 0x08, char: \x28 */
-    { 0x07, 0x0075 }, /* Index: 0x09, char: \x29 */
-    { 0x07, 0x0082 }, /* Index: 0x0a, char: \x2a */
-    { 0x07, 0x008f }, /* Index: 0x0b, char: \x2b */
-    { 0x07, 0x009c }, /* Index: 0x0c, char: \x2c */
-    { 0x07, 0x00a9 }, /* Index: 0x0d, char: \x2d */
-    { 0x07, 0x00b6 }, /* Index: 0x0e, char: \x2e */
-    { 0x07, 0x00c3 }, /* Index: 0x0f, char: \x2f */
-    { 0x07, 0x00d0 }, /* Index: 0x10, char: \x30 */
-    { 0x07, 0x00dd }, /* Index: 0x11, char: \x31 */
-    { 0x07, 0x00ea }, /* Index: 0x12, char: \x32 */
-    { 0x07, 0x00f7 }, /* Index: 0x13, char: \x33 */
-    { 0x07, 0x0104 }, /* Index: 0x14, char: \x34 */
-    { 0x07, 0x0111 }, /* Index: 0x15, char: \x35 */
-    { 0x07, 0x011e }, /* Index: 0x16, char: \x36 */
-    { 0x07, 0x012b }, /* Index: 0x17, char: \x37 */
-    { 0x07, 0x0138 }, /* Index: 0x18, char: \x38 */
-    { 0x07, 0x0145 }, /* Index: 0x19, char: \x39 */
-    { 0x07, 0x0152 }, /* Index: 0x1a, char: \x3a */
-    { 0x07, 0x015f }, /* Index: 0x1b, char: \x3b */
-    { 0x07, 0x016c }, /* Index: 0x1c, char: \x3c */
-    { 0x07, 0x0179 }, /* Index: 0x1d, char: \x3d */
-    { 0x07, 0x0186 }, /* Index: 0x1e, char: \x3e */
-    { 0x07, 0x0193 }, /* Index: 0x1f, char: \x3f */
-    { 0x07, 0x01a0 }, /* Index: 0x20, char: \x40 */
-    { 0x07, 0x01ad }, /* Index: 0x21, char: \x41 */
-    { 0x07, 0x01ba }, /* Index: 0x22, char: \x42 */
-    { 0x07, 0x01c7 }, /* Index: 0x23, char: \x43 */
-    { 0x07, 0x01d4 }, /* Index: 0x24, char: \x44 */
-    { 0x07, 0x01e1 }, /* Index: 0x25, char: \x45 */
-    { 0x07, 0x01ee }, /* Index: 0x26, char: \x46 */
-    { 0x07, 0x01fb }, /* Index: 0x27, char: \x47 */
-    { 0x07, 0x0208 }, /* Index: 0x28, char: \x48 */
-    { 0x07, 0x0215 }, /* Index: 0x29, char: \x49 */
-    { 0x07, 0x0222 }, /* Index: 0x2a, char: \x4a */
-    { 0x07, 0x022f }, /* Index: 0x2b, char: \x4b */
-    { 0x07, 0x023c }, /* Index: 0x2c, char: \x4c */
-    { 0x07, 0x0249 }, /* Index: 0x2d, char: \x4d */
-    { 0x07, 0x0256 }, /* Index: 0x2e, char: \x4e */
-    { 0x07, 0x0263 }, /* Index: 0x2f, char: \x4f */
-    { 0x07, 0x0270 }, /* Index: 0x30, char: \x50 */
-    { 0x07, 0x027d }, /* Index: 0x31, char: \x51 */
-    { 0x07, 0x028a }, /* Index: 0x32, char: \x52 */
-    { 0x07, 0x0297 }, /* Index: 0x33, char: \x53 */
-    { 0x07, 0x02a4 }, /* Index: 0x34, char: \x54 */
-    { 0x07, 0x02b1 }, /* Index: 0x35, char: \x55 */
-    { 0x07, 0x02be }, /* Index: 0x36, char: \x56 */
-    { 0x07, 0x02cb }, /* Index: 0x37, char: \x57 */
-    { 0x07, 0x02d8 }, /* Index: 0x38, char: \x58 */
-    { 0x07, 0x02e5 }, /* Index: 0x39, char: \x59 */
-    { 0x07, 0x02f2 }, /* Index: 0x3a, char: \x5a */
-    { 0x07, 0x02ff }, /* Index: 0x3b, char: \x5b */
-    { 0x07, 0x030c }, /* Index: 0x3c, char: \x5c */
-    { 0x07, 0x0319 }, /* Index: 0x3d, char: \x5d */
-    { 0x07, 0x0326 }, /* Index: 0x3e, char: \x5e */
-    { 0x07, 0x0333 }, /* Index: 0x3f, char: \x5f */
-    { 0x07, 0x0340 }, /* Index: 0x40, char: \x60 */
-    { 0x07, 0x034d }, /* Index: 0x41, char: \x61 */
-    { 0x07, 0x035a }, /* Index: 0x42, char: \x62 */
-    { 0x07, 0x0367 }, /* Index: 0x43, char: \x63 */
-    { 0x07, 0x0374 }, /* Index: 0x44, char: \x64 */
-    { 0x07, 0x0381 }, /* Index: 0x45, char: \x65 */
-    { 0x07, 0x038e }, /* Index: 0x46, char: \x66 */
-    { 0x07, 0x039b }, /* Index: 0x47, char: \x67 */
-    { 0x07, 0x03a8 }, /* Index: 0x48, char: \x68 */
-    { 0x07, 0x03b5 }, /* Index: 0x49, char: \x69 */
-    { 0x07, 0x03c2 }, /* Index: 0x4a, char: \x6a */
-    { 0x07, 0x03cf }, /* Index: 0x4b, char: \x6b */
-    { 0x07, 0x03dc }, /* Index: 0x4c, char: \x6c */
-    { 0x07, 0x03e9 }, /* Index: 0x4d, char: \x6d */
-    { 0x07, 0x03f6 }, /* Index: 0x4e, char: \x6e */
-    { 0x07, 0x0403 }, /* Index: 0x4f, char: \x6f */
-    { 0x07, 0x0410 }, /* Index: 0x50, char: \x70 */
-    { 0x07, 0x041d }, /* Index: 0x51, char: \x71 */
-    { 0x07, 0x042a }, /* Index: 0x52, char: \x72 */
-    { 0x07, 0x0437 }, /* Index: 0x53, char: \x73 */
-    { 0x07, 0x0444 }, /* Index: 0x54, char: \x74 */
-    { 0x07, 0x0451 }, /* Index: 0x55, char: \x75 */
-    { 0x07, 0x045e }, /* Index: 0x56, char: \x76 */
-    { 0x07, 0x046b }, /* Index: 0x57, char: \x77 */
-    { 0x07, 0x0478 }, /* Index: 0x58, char: \x78 */
-    { 0x07, 0x0485 }, /* Index: 0x59, char: \x79 */
-    { 0x07, 0x0492 }, /* Index: 0x5a, char: \x7a */
-    { 0x07, 0x049f }, /* Index: 0x5b, char: \x7b */
-    { 0x07, 0x04ac }, /* Index: 0x5c, char: \x7c */
-    { 0x07, 0x04b9 }, /* Index: 0x5d, char: \x7d */
-    { 0x07, 0x04c6 }, /* Index: 0x5e, char: \x7e */
-    { 0x07, 0x04d3 }, /* Index: 0x5f, char: \x7f */
-    { 0x07, 0x04e0 }, /* Index: 0x60, char: \x80 */
-    { 0x07, 0x04ed }, /* Index: 0x61, char: \x81 */
-    { 0x07, 0x04fa }, /* Index: 0x62, char: \x82 */
-    { 0x07, 0x0507 }, /* Index: 0x63, char: \x83 */
-    { 0x07, 0x0514 }, /* Index: 0x64, char: \x84 */
-    { 0x07, 0x0521 }, /* Index: 0x65, char: \x85 */
-    { 0x07, 0x052e }, /* Index: 0x66, char: \x86 */
-    { 0x07, 0x053b }, /* Index: 0x67, char: \x87 */
-    { 0x07, 0x0548 }, /* Index: 0x68, char: \x88 */
-    { 0x07, 0x0555 }, /* Index: 0x69, char: \x89 */
-    { 0x07, 0x0562 }, /* Index: 0x6a, char: \x8a */
-    { 0x07, 0x056f }, /* Index: 0x6b, char: \x8b */
-    { 0x07, 0x057c }, /* Index: 0x6c, char: \x8c */
-    { 0x07, 0x0589 }, /* Index: 0x6d, char: \x8d */
-    { 0x07, 0x0596 }, /* Index: 0x6e, char: \x8e */
-    { 0x07, 0x05a3 }, /* Index: 0x6f, char: \x8f */
-    { 0x07, 0x05b0 }, /* Index: 0x70, char: \x90 */
-    { 0x07, 0x05bd }, /* Index: 0x71, char: \x91 */
-    { 0x07, 0x05ca }, /* Index: 0x72, char: \x92 */
-    { 0x07, 0x05d7 }, /* Index: 0x73, char: \x93 */
-    { 0x07, 0x05e4 }, /* Index: 0x74, char: \x94 */
-    { 0x07, 0x05f1 }, /* Index: 0x75, char: \x95 */
-    { 0x07, 0x05fe }, /* Index: 0x76, char: \x96 */
-    { 0x07, 0x060b }, /* Index: 0x77, char: \x97 */
-    { 0x07, 0x0618 }, /* Index: 0x78, char: \x98 */
-    { 0x07, 0x0625 }, /* Index: 0x79, char: \x99 */
-    { 0x07, 0x0632 }, /* Index: 0x7a, char: \x9a */
-    { 0x07, 0x063f }, /* Index: 0x7b, char: \x9b */
-    { 0x07, 0x064c }, /* Index: 0x7c, char: \x9c */
-    { 0x07, 0x0659 }, /* Index: 0x7d, char: \x9d */
-    { 0x07, 0x0666 }, /* Index: 0x7e, char: \x9e */
-    { 0x07, 0x0673 }, /* Index: 0x7f, char: \x9f */
-    { 0x07, 0x0680 }, /* Index: 0x80, char: \xa0 */
-    { 0x07, 0x068d }, /* Index: 0x81, char: \xa1 */
-    { 0x07, 0x069a }, /* Index: 0x82, char: \xa2 */
-    { 0x07, 0x06a7 }, /* Index: 0x83, char: \xa3 */
-    { 0x07, 0x06b4 }, /* Index: 0x84, char: \xa4 */
-    { 0x07, 0x06c1 }, /* Index: 0x85, char: \xa5 */
-    { 0x07, 0x06ce }, /* Index: 0x86, char: \xa6 */
-    { 0x07, 0x06db }, /* Index: 0x87, char: \xa7 */
-    { 0x07, 0x06e8 }, /* Index: 0x88, char: \xa8 */
-    { 0x07, 0x06f5 }, /* Index: 0x89, char: \xa9 */
-    { 0x07, 0x0702 }, /* Index: 0x8a, char: \xaa */
-    { 0x07, 0x070f }, /* Index: 0x8b, char: \xab */
-    { 0x07, 0x071c }, /* Index: 0x8c, char: \xac */
-    { 0x07, 0x0729 }, /* Index: 0x8d, char: \xad */
-    { 0x07, 0x0736 }, /* Index: 0x8e, char: \xae */
-    { 0x07, 0x0743 }, /* Index: 0x8f, char: \xaf */
-    { 0x07, 0x0750 }, /* Index: 0x90, char: \xb0 */
-    { 0x07, 0x075d }, /* Index: 0x91, char: \xb1 */
-    { 0x07, 0x076a }, /* Index: 0x92, char: \xb2 */
-    { 0x07, 0x0777 }, /* Index: 0x93, char: \xb3 */
-    { 0x07, 0x0784 }, /* Index: 0x94, char: \xb4 */
-    { 0x07, 0x0791 }, /* Index: 0x95, char: \xb5 */
-    { 0x07, 0x079e }, /* Index: 0x96, char: \xb6 */
-    { 0x07, 0x07ab }, /* Index: 0x97, char: \xb7 */
-    { 0x07, 0x07b8 }, /* Index: 0x98, char: \xb8 */
-    { 0x07, 0x07c5 }, /* Index: 0x99, char: \xb9 */
-    { 0x07, 0x07d2 }, /* Index: 0x9a, char: \xba */
-    { 0x07, 0x07df }, /* Index: 0x9b, char: \xbb */
-    { 0x07, 0x07ec }, /* Index: 0x9c, char: \xbc */
-    { 0x07, 0x07f9 }, /* Index: 0x9d, char: \xbd */
-    { 0x07, 0x0806 }, /* Index: 0x9e, char: \xbe */
-    { 0x07, 0x0813 }, /* Index: 0x9f, char: \xbf */
-    { 0x07, 0x0820 }, /* Index: 0xa0, char: \xc0 */
-    { 0x07, 0x082d }, /* Index: 0xa1, char: \xc1 */
-    { 0x07, 0x083a }, /* Index: 0xa2, char: \xc2 */
-    { 0x07, 0x0847 }, /* Index: 0xa3, char: \xc3 */
-    { 0x07, 0x0854 }, /* Index: 0xa4, char: \xc4 */
-    { 0x07, 0x0861 }, /* Index: 0xa5, char: \xc5 */
-    { 0x07, 0x086e }, /* Index: 0xa6, char: \xc6 */
-    { 0x07, 0x087b }, /* Index: 0xa7, char: \xc7 */
-    { 0x07, 0x0888 }, /* Index: 0xa8, char: \xc8 */
-    { 0x07, 0x0895 }, /* Index: 0xa9, char: \xc9 */
-    { 0x07, 0x08a2 }, /* Index: 0xaa, char: \xca */
-    { 0x07, 0x08af }, /* Index: 0xab, char: \xcb */
-    { 0x07, 0x08bc }, /* Index: 0xac, char: \xcc */
-    { 0x07, 0x08c9 }, /* Index: 0xad, char: \xcd */
-    { 0x07, 0x08d6 }, /* Index: 0xae, char: \xce */
-    { 0x07, 0x08e3 }, /* Index: 0xaf, char: \xcf */
-    { 0x07, 0x08f0 }, /* Index: 0xb0, char: \xd0 */
-    { 0x07, 0x08fd }, /* Index: 0xb1, char: \xd1 */
-    { 0x07, 0x090a }, /* Index: 0xb2, char: \xd2 */
-    { 0x07, 0x0917 }, /* Index: 0xb3, char: \xd3 */
-    { 0x07, 0x0924 }, /* Index: 0xb4, char: \xd4 */
-    { 0x07, 0x0931 }, /* Index: 0xb5, char: \xd5 */
-    { 0x07, 0x093e }, /* Index: 0xb6, char: \xd6 */
-    { 0x07, 0x094b }, /* Index: 0xb7, char: \xd7 */
-    { 0x07, 0x0958 }, /* Index: 0xb8, char: \xd8 */
-    { 0x07, 0x0965 }, /* Index: 0xb9, char: \xd9 */
-    { 0x07, 0x0972 }, /* Index: 0xba, char: \xda */
-    { 0x07, 0x097f }, /* Index: 0xbb, char: \xdb */
-    { 0x07, 0x098c }, /* Index: 0xbc, char: \xdc */
-    { 0x07, 0x0999 }, /* Index: 0xbd, char: \xdd */
-    { 0x07, 0x09a6 }, /* Index: 0xbe, char: \xde */
-    { 0x07, 0x09b3 }, /* Index: 0xbf, char: \xdf */
-    { 0x07, 0x09c0 }, /* Index: 0xc0, char: \xe0 */
-    { 0x07, 0x09cd }, /* Index: 0xc1, char: \xe1 */
-    { 0x07, 0x09da }, /* Index: 0xc2, char: \xe2 */
-    { 0x07, 0x09e7 }, /* Index: 0xc3, char: \xe3 */
-    { 0x07, 0x09f4 }, /* Index: 0xc4, char: \xe4 */
-    { 0x07, 0x0a01 }, /* Index: 0xc5, char: \xe5 */
-    { 0x07, 0x0a0e }, /* Index: 0xc6, char: \xe6 */
-    { 0x07, 0x0a1b }, /* Index: 0xc7, char: \xe7 */
-    { 0x07, 0x0a28 }, /* Index: 0xc8, char: \xe8 */
-    { 0x07, 0x0a35 }, /* Index: 0xc9, char: \xe9 */
-    { 0x07, 0x0a42 }, /* Index: 0xca, char: \xea */
-    { 0x07, 0x0a4f }, /* Index: 0xcb, char: \xeb */
-    { 0x07, 0x0a5c }, /* Index: 0xcc, char: \xec */
-    { 0x07, 0x0a69 }, /* Index: 0xcd, char: \xed */
-    { 0x07, 0x0a76 }, /* Index: 0xce, char: \xee */
-    { 0x07, 0x0a83 }, /* Index: 0xcf, char: \xef */
-    { 0x07, 0x0a90 }, /* Index: 0xd0, char: \xf0 */
-    { 0x07, 0x0a9d }, /* Index: 0xd1, char: \xf1 */
-    { 0x07, 0x0aaa }, /* Index: 0xd2, char: \xf2 */
-    { 0x07, 0x0ab7 }, /* Index: 0xd3, char: \xf3 */
-    { 0x07, 0x0ac4 }, /* Index: 0xd4, char: \xf4 */
-    { 0x07, 0x0ad1 }, /* Index: 0xd5, char: \xf5 */
-    { 0x07, 0x0ade }, /* Index: 0xd6, char: \xf6 */
-    { 0x07, 0x0aeb }, /* Index: 0xd7, char: \xf7 */
-    { 0x07, 0x0af8 }, /* Index: 0xd8, char: \xf8 */
-    { 0x07, 0x0b05 }, /* Index: 0xd9, char: \xf9 */
-    { 0x07, 0x0b12 }, /* Index: 0xda, char: \xfa */
-    { 0x07, 0x0b1f }, /* Index: 0xdb, char: \xfb */
-    { 0x07, 0x0b2c }, /* Index: 0xdc, char: \xfc */
-    { 0x07, 0x0b39 }, /* Index: 0xdd, char: \xfd */
-    { 0x07, 0x0b46 }, /* Index: 0xde, char: \xfe */
-    { 0x07, 0x0b53 }, /* Index: 0xdf, char: \xff */
-};
-
 const font_info_t _fonts_bitocra_7x13_iso8859_1_info =
 {
     .height           = 13, /* Character height */
     .c                = 0, /* C */
     .char_start       = 32, /* Start character */
     .char_end         = 255, /* End character */
-    .char_descriptors = _fonts_bitocra_7x13_iso8859_1_descriptors, /* Character descriptor array */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
     .bitmap           = _fonts_bitocra_7x13_iso8859_1_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 7, /* Glyph width */
+    .stride           = 13, /* Bytes per glyph */
 };
 
 #endif /* _EXTRAS_FONTS_FONT_BITOCRA_7X13_ISO8859_1_H_ */
@@ -2347,268 +2347,6 @@ static const uint8_t _fonts_glcd_5x7_bitmaps[] =
 
 };
 
-/* Character descriptors for glcd 5x7 */
-/* { [Char width in bits], [Offset into glcd_5x7_bitmaps in bytes] } */
-const font_char_desc_t _fonts_glcd_5x7_descriptors[] =
-{
-        {5, 0},     /* \x00 */
-        {5, 7},     /* \x01 */
-        {5, 14},    /* \x02 */
-        {5, 21},    /* \x03 */
-        {5, 28},    /* \x04 */
-        {5, 35},    /* \x05 */
-        {5, 42},    /* \x06 */
-        {5, 49},    /* \x07 */
-        {5, 56},    /* \x08 */
-        {5, 63},    /* \x09 */
-        {5, 70},    /* \x0A */
-        {5, 77},    /* \x0B */
-        {5, 84},    /* \x0C */
-        {5, 91},    /* \x0D */
-        {5, 98},    /* \x0E */
-        {5, 105},   /* \x0F */
-        {5, 112},   /* \x10 */
-        {5, 119},   /* \x11 */
-        {5, 126},   /* \x12 */
-        {5, 133},   /* \x13 */
-        {5, 140},   /* \x14 */
-        {5, 147},   /* \x15 */
-        {5, 154},   /* \x16 */
-        {5, 161},   /* \x17 */
-        {5, 168},   /* \x18 */
-        {5, 175},   /* \x19 */
-        {5, 182},   /* \x1A */
-        {5, 189},   /* \x1B */
-        {5, 196},   /* \x1C */
-        {5, 203},   /* \x1D */
-        {5, 210},   /* \x1E */
-        {5, 217},   /* \x1F */
-        {5, 224},   /*      */
-        {5, 231},   /*   !  */
-        {5, 238},   /*   "  */
-        {5, 245},   /*   #  */
-        {5, 252},   /*   $  */
-        {5, 259},   /*   %  */
-        {5, 266},   /*   &  */
-        {5, 273},   /*   '  */
-        {5, 280},   /*   (  */
-        {5, 287},   /*   )  */
-        {5, 294},   /*   *  */
-        {5, 301},   /*   +  */
-        {5, 308},   /*   ,  */
-        {5, 315},   /*   -  */
-        {5, 322},   /*   .  */
-        {5, 329},   /*   /  */
-        {5, 336},   /*   0  */
-        {5, 343},   /*   1  */
-        {5, 350},   /*   2  */
-        {5, 357},   /*   3  */
-        {5, 364},   /*   4  */
-        {5, 371},   /*   5  */
-        {5, 378},   /*   6  */
-        {5, 385},   /*   7  */
-        {5, 392},   /*   8  */
-        {5, 399},   /*   9  */
-        {5, 406},   /*   :  */
-        {5, 413},   /*   ;  */
-        {5, 420},   /*   <  */
-        {5, 427},   /*   =  */
-        {5, 434},   /*   >  */
-        {5, 441},   /*   ?  */
-        {5, 448},   /*   @  */
-        {5, 455},   /*   A  */
-        {5, 462},   /*   B  */
-        {5, 469},   /*   C  */
-        {5, 476},   /*   D  */
-        {5, 483},   /*   E  */
-        {5, 490},   /*   F  */
-        {5, 497},   /*   G  */
-        {5, 504},   /*   H  */
-        {5, 511},   /*   I  */
-        {5, 518},   /*   J  */
-        {5, 525},   /*   K  */
-        {5, 532},   /*   L  */
-        {5, 539},   /*   M  */
-        {5, 546},   /*   N  */
-        {5, 553},   /*   O  */
-        {5, 560},   /*   P  */
-        {5, 567},   /*   Q  */
-        {5, 574},   /*   R  */
-        {5, 581},   /*   S  */
-        {5, 588},   /*   T  */
-        {5, 595},   /*   U  */
-        {5, 602},   /*   V  */
-        {5, 609},   /*   W  */
-        {5, 616},   /*   X  */
-        {5, 623},   /*   Y  */
-        {5, 630},   /*   Z  */
-        {5, 637},   /*   [  */
-        {5, 644},   /*   \  */
-        {5, 651},   /*   ]  */
-        {5, 658},   /*   ^  */
-        {5, 665},   /*   _  */
-        {5, 672},   /*   `  */
-        {5, 679},   /*   a  */
-        {5, 686},   /*   b  */
-        {5, 693},   /*   c  */
-        {5, 700},   /*   d  */
-        {5, 707},   /*   e  */
-        {5, 714},   /*   f  */
-        {5, 721},   /*   g  */
-        {5, 728},   /*   h  */
-        {5, 735},   /*   i  */
-        {5, 742},   /*   j  */
-        {5, 749},   /*   k  */
-        {5, 756},   /*   l  */
-        {5, 763},   /*   m  */
-        {5, 770},   /*   n  */
-        {5, 777},   /*   o  */
-        {5, 784},   /*   p  */
-        {5, 791},   /*   q  */
-        {5, 798},   /*   r  */
-        {5, 805},   /*   s  */
-        {5, 812},   /*   t  */
-        {5, 819},   /*   u  */
-        {5, 826},   /*   v  */
-        {5, 833},   /*   w  */
-        {5, 840},   /*   x  */
-        {5, 847},   /*   y  */
-        {5, 854},   /*   z  */
-        {5, 861},   /*   {  */
-        {5, 868},   /*   |  */
-        {5, 875},   /*   }  */
-        {5, 882},   /*   ~  */
-        {5, 889},   /* \x7F */
-        {5, 896},   /* \x80 */
-        {5, 903},   /* \x81 */
-        {5, 910},   /* \x82 */
-        {5, 917},   /* \x83 */
-        {5, 924},   /* \x84 */
-        {5, 931},   /* \x85 */
-        {5, 938},   /* \x86 */
-        {5, 945},   /* \x87 */
-        {5, 952},   /* \x88 */
-        {5, 959},   /* \x89 */
-        {5, 966},   /* \x8A */
-        {5, 973},   /* \x8B */
-        {5, 980},   /* \x8C */
-        {5, 987},   /* \x8D */
-        {5, 994},   /* \x8E */
-        {5, 1001},  /* \x8F */
-        {5, 1008},  /* \x90 */
-        {5, 1015},  /* \x91 */
-        {5, 1022},  /* \x92 */
-        {5, 1029},  /* \x93 */
-        {5, 1036},  /* \x94 */
-        {5, 1043},  /* \x95 */
-        {5, 1050},  /* \x96 */
-        {5, 1057},  /* \x97 */
-        {5, 1064},  /* \x98 */
-        {5, 1071},  /* \x99 */
-        {5, 1078},  /* \x9A */
-        {5, 1085},  /* \x9B */
-        {5, 1092},  /* \x9C */
-        {5, 1099},  /* \x9D */
-        {5, 1106},  /* \x9E */
-        {5, 1113},  /* \x9F */
-        {5, 1120},  /* \xA0 */
-        {5, 1127},  /* \xA1 */
-        {5, 1134},  /* \xA2 */
-        {5, 1141},  /* \xA3 */
-        {5, 1148},  /* \xA4 */
-        {5, 1155},  /* \xA5 */
-        {5, 1162},  /* \xA6 */
-        {5, 1169},  /* \xA7 */
-        {5, 1176},  /* \xA8 */
-        {5, 1183},  /* \xA9 */
-        {5, 1190},  /* \xAA */
-        {5, 1197},  /* \xAB */
-        {5, 1204},  /* \xAC */
-        {5, 1211},  /* \xAD */
-        {5, 1218},  /* \xAE */
-        {5, 1225},  /* \xAF */
-        {5, 1232},  /* \xB0 */
-        {5, 1239},  /* \xB1 */
-        {5, 1246},  /* \xB2 */
-        {5, 1253},  /* \xB3 */
-        {5, 1260},  /* \xB4 */
-        {5, 1267},  /* \xB5 */
-        {5, 1274},  /* \xB6 */
-        {5, 1281},  /* \xB7 */
-        {5, 1288},  /* \xB8 */
-        {5, 1295},  /* \xB9 */
-        {5, 1302},  /* \xBA */
-        {5, 1309},  /* \xBB */
-        {5, 1316},  /* \xBC */
-        {5, 1323},  /* \xBD */
-        {5, 1330},  /* \xBE */
-        {5, 1337},  /* \xBF */
-        {5, 1344},  /* \xC0 */
-        {5, 1351},  /* \xC1 */
-        {5, 1358},  /* \xC2 */
-        {5, 1365},  /* \xC3 */
-        {5, 1372},  /* \xC4 */
-        {5, 1379},  /* \xC5 */
-        {5, 1386},  /* \xC6 */
-        {5, 1393},  /* \xC7 */
-        {5, 1400},  /* \xC8 */
-        {5, 1407},  /* \xC9 */
-        {5, 1414},  /* \xCA */
-        {5, 1421},  /* \xCB */
-        {5, 1428},  /* \xCC */
-        {5, 1435},  /* \xCD */
-        {5, 1442},  /* \xCE */
-        {5, 1449},  /* \xCF */
-        {5, 1456},  /* \xD0 */
-        {5, 1463},  /* \xD1 */
-        {5, 1470},  /* \xD2 */
-        {5, 1477},  /* \xD3 */
-        {5, 1484},  /* \xD4 */
-        {5, 1491},  /* \xD5 */
-        {5, 1498},  /* \xD6 */
-        {5, 1505},  /* \xD7 */
-        {5, 1512},  /* \xD8 */
-        {5, 1519},  /* \xD9 */
-        {5, 1526},  /* \xDA */
-        {5, 1533},  /* \xDB */
-        {5, 1540},  /* \xDC */
-        {5, 1547},  /* \xDD */
-        {5, 1554},  /* \xDE */
-        {5, 1561},  /* \xDF */
-        {5, 1568},  /* \xE0 */
-        {5, 1575},  /* \xE1 */
-        {5, 1582},  /* \xE2 */
-        {5, 1589},  /* \xE3 */
-        {5, 1596},  /* \xE4 */
-        {5, 1603},  /* \xE5 */
-        {5, 1610},  /* \xE6 */
-        {5, 1617},  /* \xE7 */
-        {5, 1624},  /* \xE8 */
-        {5, 1631},  /* \xE9 */
-        {5, 1638},  /* \xEA */
-        {5, 1645},  /* \xEB */
-        {5, 1652},  /* \xEC */
-        {5, 1659},  /* \xED */
-        {5, 1666},  /* \xEE */
-        {5, 1673},  /* \xEF */
-        {5, 1680},  /* \xF0 */
-        {5, 1687},  /* \xF1 */
-        {5, 1694},  /* \xF2 */
-        {5, 1701},  /* \xF3 */
-        {5, 1708},  /* \xF4 */
-        {5, 1715},  /* \xF5 */
-        {5, 1722},  /* \xF6 */
-        {5, 1729},  /* \xF7 */
-        {5, 1736},  /* \xF8 */
-        {5, 1743},  /* \xF9 */
-        {5, 1750},  /* \xFA */
-        {5, 1757},  /* \xFB */
-        {5, 1764},  /* \xFC */
-        {5, 1771},  /* \xFD */
-        {5, 1778},  /* \xFE */
-        {5, 1785},  /* \xFF */
-};
-
 /* Font information for glcd 5x7 */
 
 const font_info_t _fonts_glcd_5x7_info =
@@ -2617,8 +2355,11 @@ const font_info_t _fonts_glcd_5x7_info =
     .c                = 1,                           /* C */
     .char_start       = 0,                           /* Start character */
     .char_end         = 255,                         /* End character */
-    .char_descriptors = _fonts_glcd_5x7_descriptors, /* Character descriptor array */
+    .char_descriptors = NULL,                        /* No descriptors, see FONT_FLAG_MONO */
     .bitmap           = _fonts_glcd_5x7_bitmaps,     /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO,              /* Flags */
+    .width            = 5,                           /* Glyph width */
+    .stride           = 7,                           /* Bytes per glyph */
 };
 
 #endif /* _EXTRAS_FONTS_FONT_GLCD_5X7_H_ */
@@ -1,1630 +1,2260 @@
-/*
- *  Font data for Roboto 10pt
+/**
+ * This file contains generated binary font data.
  *
- *  FIXME: Add license information
+ * Font:    roboto_10pt
+ * Height:  14
+ * Layout:  page-native
+ * 95 characters (32..126)
+ * 237 kerning pairs of 52 left characters
  *
- *      Author: zaltora
+ * Roboto 10 pt, converted from TheDotFactory tables by zaltora
+ * FIXME: Add license information
+ *
+ * Source:  ../../main/fonts/src/roboto_10pt.bdf
+ * Generated by tools/fontc, do not edit. Command:
+ *     fontc -n roboto_10pt -c 1 --kern 2 -o ../../main/fonts/font_roboto_10pt.h ../../main/fonts/src/roboto_10pt.bdf
  */
 #ifndef _EXTRAS_FONTS_FONT_ROBOTO_10PT_H_
 #define _EXTRAS_FONTS_FONT_ROBOTO_10PT_H_
 
-// Character bitmaps for Roboto 10pt
-const uint8_t _fonts_roboto_10pt_bitmaps[] =
-{
-	// @0 '!' (1 pixels wide)
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x00, //  
-
-	// @14 '"' (3 pixels wide)
-	0x00, //    
-	0x00, //    
-	0xA0, // # #
-	0xA0, // # #
-	0xA0, // # #
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-
-	// @28 '#' (8 pixels wide)
-	0x00, //         
-	0x00, //         
-	0x12, //    #  # 
-	0x14, //    # #  
-	0x7F, //  #######
-	0x24, //   #  #  
-	0x24, //   #  #  
-	0xFE, // ####### 
-	0x28, //   # #   
-	0x28, //   # #   
-	0x08, //     #   
-	0x00, //         
-	0x00, //         
-	0x00, //         
-
-	// @42 '$' (6 pixels wide)
-	0x20, //   #   
-	0x30, //   ##  
-	0x58, //  # ## 
-	0x8C, // #   ##
-	0xC0, // ##    
-	0x60, //  ##   
-	0x38, //   ### 
-	0x0C, //     ##
-	0x8C, // #   ##
-	0xCC, // ##  ##
-	0x70, //  ###  
-	0x20, //   #   
-	0x00, //       
-	0x00, //       
-
-	// @56 '%' (8 pixels wide)
-	0x00, //         
-	0x00, //         
-	0xE0, // ###     
-	0xA4, // # #  #  
-	0x84, // #    #  
-	0xA8, // # # #   
-	0x10, //    #    
-	0x19, //    ##  #
-	0x29, //   # #  #
-	0x49, //  #  #  #
-	0x06, //      ## 
-	0x00, //         
-	0x00, //         
-	0x00, //         
-
-	// @70 '&' (8 pixels wide)
-	0x00, //         
-	0x00, //         
-	0x38, //   ###   
-	0x64, //  ##  #  
-	0x64, //  ##  #  
-	0x38, //   ###   
-	0x30, //   ##    
-	0x5B, //  # ## ##
-	0xCE, // ##  ### 
-	0x46, //  #   ## 
-	0x7A, //  #### # 
-	0x00, //         
-	0x00, //         
-	0x00, //         
-
-	// @84 ''' (1 pixels wide)
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-
-	// @98 '(' (3 pixels wide)
-	0x00, //    
-	0x20, //   #
-	0x40, //  # 
-	0x40, //  # 
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0xC0, // ## 
-	0x40, //  # 
-	0x60, //  ##
-	0x20, //   #
-
-	// @112 ')' (3 pixels wide)
-	0x00, //    
-	0x80, // #  
-	0x40, //  # 
-	0x60, //  ##
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x40, //  # 
-	0x40, //  # 
-	0x80, // #  
-
-	// @126 '*' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x40, //  #  
-	0xD0, // ## #
-	0x60, //  ## 
-	0xA0, // # # 
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-
-	// @140 '+' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0xFE, // #######
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @154 ',' (2 pixels wide)
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x40, //  #
-	0x40, //  #
-	0x80, // # 
-	0x00, //   
-
-	// @168 '-' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0xF0, // ####
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-
-	// @182 '.' (1 pixels wide)
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x00, //  
-
-	// @196 '/' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x08, //     #
-	0x10, //    # 
-	0x10, //    # 
-	0x10, //    # 
-	0x20, //   #  
-	0x20, //   #  
-	0x60, //  ##  
-	0x40, //  #   
-	0x40, //  #   
-	0x80, // #    
-	0x00, //      
-	0x00, //      
-
-	// @210 '0' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x70, //  ###  
-	0x88, // #   # 
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0x88, // #   # 
-	0x70, //  ###  
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @224 '1' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0xF0, // ####
-	0x30, //   ##
-	0x30, //   ##
-	0x30, //   ##
-	0x30, //   ##
-	0x30, //   ##
-	0x30, //   ##
-	0x30, //   ##
-	0x30, //   ##
-	0x00, //     
-	0x00, //     
-	0x00, //     
-
-	// @238 '2' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x78, //  #### 
-	0x88, // #   # 
-	0x88, // #   # 
-	0x08, //     # 
-	0x10, //    #  
-	0x30, //   ##  
-	0x60, //  ##   
-	0x40, //  #    
-	0xFC, // ######
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @252 '3' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x78, //  #### 
-	0x88, // #   # 
-	0x88, // #   # 
-	0x08, //     # 
-	0x38, //   ### 
-	0x08, //     # 
-	0x8C, // #   ##
-	0x88, // #   # 
-	0x78, //  #### 
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @266 '4' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x0C, //     ## 
-	0x1C, //    ### 
-	0x1C, //    ### 
-	0x2C, //   # ## 
-	0x2C, //   # ## 
-	0x4C, //  #  ## 
-	0xFE, // #######
-	0x0C, //     ## 
-	0x0C, //     ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @280 '5' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x78, //  #### 
-	0xC0, // ##    
-	0xC0, // ##    
-	0xF8, // ##### 
-	0x88, // #   # 
-	0x0C, //     ##
-	0x8C, // #   ##
-	0x88, // #   # 
-	0x78, //  #### 
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @294 '6' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x78, //  #### 
-	0xC0, // ##    
-	0x80, // #     
-	0xB0, // # ##  
-	0x88, // #   # 
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0xC8, // ##  # 
-	0x78, //  #### 
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @308 '7' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0xFC, // ######
-	0x08, //     # 
-	0x18, //    ## 
-	0x10, //    #  
-	0x20, //   #   
-	0x20, //   #   
-	0x20, //   #   
-	0x20, //   #   
-	0x20, //   #   
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @322 '8' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x78, //  #### 
-	0x88, // #   # 
-	0x88, // #   # 
-	0x88, // #   # 
-	0x70, //  ###  
-	0x88, // #   # 
-	0x8C, // #   ##
-	0x88, // #   # 
-	0x78, //  #### 
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @336 '9' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x78, //  ####
-	0x08, //     #
-	0x08, //     #
-	0xF0, // #### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @350 ':' (1 pixels wide)
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x00, //  
-
-	// @364 ';' (2 pixels wide)
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x40, //  #
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x40, //  #
-	0x40, //  #
-	0x80, // # 
-	0x00, //   
-
-	// @378 '<' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x0C, //     ##
-	0x70, //  ###  
-	0xC0, // ##    
-	0x30, //   ##  
-	0x0C, //     ##
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @392 '=' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0xF8, // #####
-	0x00, //      
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @406 '>' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0xC0, // ##   
-	0x70, //  ### 
-	0x08, //     #
-	0x30, //   ## 
-	0xC0, // ##   
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @420 '?' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x78, //  #### 
-	0xC8, // ##  # 
-	0x0C, //     ##
-	0x08, //     # 
-	0x18, //    ## 
-	0x30, //   ##  
-	0x30, //   ##  
-	0x00, //       
-	0x30, //   ##  
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @434 '@' (10 pixels wide)
-	0x00, 0x00, //           
-	0x00, 0x00, //           
-	0x1F, 0x00, //    #####  
-	0x61, 0x80, //  ##    ## 
-	0x4C, 0x80, //  #  ##  # 
-	0x9A, 0x40, // #  ## #  #
-	0x92, 0x40, // #  #  #  #
-	0x92, 0x40, // #  #  #  #
-	0xB2, 0x40, // # ##  #  #
-	0x92, 0x40, // #  #  #  #
-	0x9B, 0x80, // #  ## ### 
-	0x80, 0x00, // #         
-	0x60, 0x00, //  ##       
-	0x3E, 0x00, //   #####   
-
-	// @462 'A' (8 pixels wide)
-	0x00, //         
-	0x00, //         
-	0x18, //    ##   
-	0x18, //    ##   
-	0x1C, //    ###  
-	0x24, //   #  #  
-	0x24, //   #  #  
-	0x26, //   #  ## 
-	0x7E, //  ###### 
-	0x42, //  #    # 
-	0xC1, // ##     #
-	0x00, //         
-	0x00, //         
-	0x00, //         
-
-	// @476 'B' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0xF8, // #####  
-	0x84, // #    # 
-	0x84, // #    # 
-	0x84, // #    # 
-	0xFC, // ###### 
-	0x86, // #    ##
-	0x82, // #     #
-	0x86, // #    ##
-	0xFC, // ###### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @490 'C' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x78, //  ####  
-	0xC4, // ##   # 
-	0x86, // #    ##
-	0x80, // #      
-	0x80, // #      
-	0x80, // #      
-	0x86, // #    ##
-	0xC4, // ##   # 
-	0x78, //  ####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @504 'D' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0xF8, // #####  
-	0x84, // #    # 
-	0x86, // #    ##
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x86, // #    ##
-	0x84, // #    # 
-	0xF8, // #####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @518 'E' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0xFC, // ######
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0xF8, // ##### 
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0xFC, // ######
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @532 'F' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0xFC, // ######
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0xF8, // ##### 
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @546 'G' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x78, //  ####  
-	0xC4, // ##   # 
-	0x86, // #    ##
-	0x80, // #      
-	0x9E, // #  ####
-	0x86, // #    ##
-	0x86, // #    ##
-	0xC6, // ##   ##
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @560 'H' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0xFE, // #######
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @574 'I' (1 pixels wide)
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x00, //  
-
-	// @588 'J' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x04, //      #
-	0x04, //      #
-	0x04, //      #
-	0x04, //      #
-	0x04, //      #
-	0x04, //      #
-	0xC4, // ##   #
-	0x4C, //  #  ##
-	0x78, //  #### 
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @602 'K' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x84, // #    # 
-	0x8C, // #   ## 
-	0x98, // #  ##  
-	0x90, // #  #   
-	0xE0, // ###    
-	0x90, // #  #   
-	0x88, // #   #  
-	0x8C, // #   ## 
-	0x86, // #    ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @616 'L' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0xFC, // ######
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @630 'M' (9 pixels wide)
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-	0xC1, 0x80, // ##     ##
-	0xC1, 0x80, // ##     ##
-	0xA1, 0x80, // # #    ##
-	0xA2, 0x80, // # #   # #
-	0xB2, 0x80, // # ##  # #
-	0x96, 0x80, // #  # ## #
-	0x94, 0x80, // #  # #  #
-	0x8C, 0x80, // #   ##  #
-	0x88, 0x80, // #   #   #
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-
-	// @658 'N' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0xC2, // ##    #
-	0xC2, // ##    #
-	0xA2, // # #   #
-	0xB2, // # ##  #
-	0x92, // #  #  #
-	0x8A, // #   # #
-	0x8E, // #   ###
-	0x86, // #    ##
-	0x86, // #    ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @672 'O' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x78, //  ####  
-	0xC4, // ##   # 
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0xC4, // ##   # 
-	0x78, //  ####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @686 'P' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0xFC, // ###### 
-	0x84, // #    # 
-	0x86, // #    ##
-	0x86, // #    ##
-	0x8C, // #   ## 
-	0x80, // #      
-	0x80, // #      
-	0x80, // #      
-	0x80, // #      
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @700 'Q' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x78, //  ####  
-	0xC4, // ##   # 
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0xC4, // ##   # 
-	0x7E, //  ######
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @714 'R' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0xF8, // ##### 
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0xF8, // ##### 
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @728 'S' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x78, //  #### 
-	0xCC, // ##  ##
-	0x84, // #    #
-	0xC0, // ##    
-	0x38, //   ### 
-	0x0C, //     ##
-	0x84, // #    #
-	0x84, // #    #
-	0x78, //  #### 
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @742 'T' (8 pixels wide)
-	0x00, //         
-	0x00, //         
-	0xFF, // ########
-	0x18, //    ##   
-	0x18, //    ##   
-	0x18, //    ##   
-	0x18, //    ##   
-	0x18, //    ##   
-	0x18, //    ##   
-	0x18, //    ##   
-	0x18, //    ##   
-	0x00, //         
-	0x00, //         
-	0x00, //         
-
-	// @756 'U' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0x82, // #     #
-	0xC4, // ##   # 
-	0x78, //  ####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @770 'V' (8 pixels wide)
-	0x00, //         
-	0x00, //         
-	0xC1, // ##     #
-	0x43, //  #    ##
-	0x42, //  #    # 
-	0x66, //  ##  ## 
-	0x24, //   #  #  
-	0x24, //   #  #  
-	0x1C, //    ###  
-	0x18, //    ##   
-	0x18, //    ##   
-	0x00, //         
-	0x00, //         
-	0x00, //         
-
-	// @784 'W' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0xC4, 0x60, // ##   #   ##
-	0x46, 0x60, //  #   ##  ##
-	0x4A, 0x40, //  #  # #  # 
-	0x4A, 0x40, //  #  # #  # 
-	0x6A, 0x40, //  ## # #  # 
-	0x39, 0xC0, //   ###  ### 
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @812 'X' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x84, // #    # 
-	0xCC, // ##  ## 
-	0x48, //  #  #  
-	0x38, //   ###  
-	0x30, //   ##   
-	0x38, //   ###  
-	0x48, //  #  #  
-	0xCC, // ##  ## 
-	0x86, // #    ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @826 'Y' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x86, // #    ##
-	0x84, // #    # 
-	0x4C, //  #  ## 
-	0x68, //  ## #  
-	0x30, //   ##   
-	0x30, //   ##   
-	0x30, //   ##   
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @840 'Z' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0xFC, // ######
-	0x0C, //     ##
-	0x18, //    ## 
-	0x10, //    #  
-	0x20, //   #   
-	0x60, //  ##   
-	0x40, //  #    
-	0x80, // #     
-	0xFC, // ######
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @854 '[' (2 pixels wide)
-	0xC0, // ##
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0xC0, // ##
-	0x00, //   
-
-	// @868 '\' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xC0, // ##   
-	0x40, //  #   
-	0x40, //  #   
-	0x20, //   #  
-	0x20, //   #  
-	0x30, //   ## 
-	0x10, //    # 
-	0x10, //    # 
-	0x08, //     #
-	0x08, //     #
-	0x00, //      
-	0x00, //      
-
-	// @882 ']' (3 pixels wide)
-	0xE0, // ###
-	0x60, //  ##
-	0x60, //  ##
-	0x60, //  ##
-	0x60, //  ##
-	0x60, //  ##
-	0x60, //  ##
-	0x60, //  ##
-	0x60, //  ##
-	0x60, //  ##
-	0x60, //  ##
-	0x60, //  ##
-	0xE0, // ###
-	0x00, //    
-
-	// @896 '^' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x20, //   #  
-	0x30, //   ## 
-	0x50, //  # # 
-	0x58, //  # ##
-	0xC8, // ##  #
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @910 '_' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0xFC, // ######
-	0x00, //       
-	0x00, //       
-
-	// @924 '`' (2 pixels wide)
-	0x00, //   
-	0x80, // # 
-	0x40, //  #
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-
-	// @938 'a' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x08, //     #
-	0xF8, // #####
-	0x88, // #   #
-	0x88, // #   #
-	0xE8, // ### #
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @952 'b' (6 pixels wide)
-	0x00, //       
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0xB8, // # ### 
-	0xC8, // ##  # 
-	0x8C, // #   ##
-	0x84, // #    #
-	0x8C, // #   ##
-	0xC8, // ##  # 
-	0xB8, // # ### 
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @966 'c' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x88, // #   #
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @980 'd' (5 pixels wide)
-	0x00, //      
-	0x08, //     #
-	0x08, //     #
-	0x08, //     #
-	0x78, //  ####
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @994 'e' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x88, // #   #
-	0xF8, // #####
-	0x80, // #    
-	0x88, // #   #
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @1008 'f' (4 pixels wide)
-	0x00, //     
-	0x30, //   ##
-	0x60, //  ## 
-	0x60, //  ## 
-	0xF0, // ####
-	0x60, //  ## 
-	0x60, //  ## 
-	0x60, //  ## 
-	0x60, //  ## 
-	0x60, //  ## 
-	0x60, //  ## 
-	0x00, //     
-	0x00, //     
-	0x00, //     
-
-	// @1022 'g' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x7C, //  #####
-	0xCC, // ##  ##
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0x7C, //  #####
-	0x08, //     # 
-	0x08, //     # 
-	0xF0, // ####  
-
-	// @1036 'h' (6 pixels wide)
-	0x00, //       
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0xB8, // # ### 
-	0x88, // #   # 
-	0x88, // #   # 
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @1050 'i' (1 pixels wide)
-	0x00, //  
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x00, //  
-
-	// @1064 'j' (2 pixels wide)
-	0x00, //   
-	0x40, //  #
-	0x00, //   
-	0x00, //   
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0xC0, // ##
-
-	// @1078 'k' (5 pixels wide)
-	0x00, //      
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x98, // #  ##
-	0x90, // #  # 
-	0xA0, // # #  
-	0xE0, // ###  
-	0xB0, // # ## 
-	0x90, // #  # 
-	0x88, // #   #
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @1092 'l' (1 pixels wide)
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x00, //  
-
-	// @1106 'm' (9 pixels wide)
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-	0xBB, 0x80, // # ### ###
-	0x8C, 0x80, // #   ##  #
-	0x88, 0x80, // #   #   #
-	0x88, 0x80, // #   #   #
-	0x88, 0x80, // #   #   #
-	0x88, 0x80, // #   #   #
-	0x88, 0x80, // #   #   #
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-
-	// @1134 'n' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0xB8, // # ###
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @1148 'o' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x70, //  ###  
-	0x88, // #   # 
-	0x8C, // #   ##
-	0x84, // #    #
-	0x8C, // #   ##
-	0x88, // #   # 
-	0x70, //  ###  
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @1162 'p' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0xB8, // # ### 
-	0x88, // #   # 
-	0x8C, // #   ##
-	0x84, // #    #
-	0x8C, // #   ##
-	0x88, // #   # 
-	0xB8, // # ### 
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-
-	// @1176 'q' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x78, //  ####
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x78, //  ####
-	0x08, //     #
-	0x08, //     #
-	0x08, //     #
-
-	// @1190 'r' (3 pixels wide)
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0xA0, // # #
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x00, //    
-	0x00, //    
-	0x00, //    
-
-	// @1204 's' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x80, // #    
-	0x70, //  ### 
-	0x08, //     #
-	0x88, // #   #
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @1218 't' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x60, //  ## 
-	0x60, //  ## 
-	0xF0, // ####
-	0x60, //  ## 
-	0x60, //  ## 
-	0x60, //  ## 
-	0x60, //  ## 
-	0x60, //  ## 
-	0x30, //   ##
-	0x00, //     
-	0x00, //     
-	0x00, //     
-
-	// @1232 'u' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @1246 'v' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0xC4, // ##   #
-	0x44, //  #   #
-	0x48, //  #  # 
-	0x28, //   # # 
-	0x28, //   # # 
-	0x30, //   ##  
-	0x10, //    #  
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @1260 'w' (9 pixels wide)
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-	0xCC, 0x80, // ##  ##  #
-	0x4C, 0x80, //  #  ##  #
-	0x4C, 0x80, //  #  ##  #
-	0x57, 0x80, //  # # ####
-	0x33, 0x00, //   ##  ## 
-	0x33, 0x00, //   ##  ## 
-	0x23, 0x00, //   #   ## 
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-
-	// @1288 'x' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x98, // #  ##
-	0xD0, // ## # 
-	0x70, //  ### 
-	0x20, //   #  
-	0x70, //  ### 
-	0xD0, // ## # 
-	0x98, // #  ##
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @1302 'y' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0xC4, // ##   #
-	0x4C, //  #  ##
-	0x48, //  #  # 
-	0x68, //  ## # 
-	0x28, //   # # 
-	0x30, //   ##  
-	0x10, //    #  
-	0x10, //    #  
-	0x20, //   #   
-	0x60, //  ##   
-
-	// @1316 'z' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0xF8, // #####
-	0x10, //    # 
-	0x30, //   ## 
-	0x60, //  ##  
-	0x40, //  #   
-	0x80, // #    
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @1330 '{' (4 pixels wide)
-	0x00, //     
-	0x10, //    #
-	0x20, //   # 
-	0x20, //   # 
-	0x20, //   # 
-	0x20, //   # 
-	0x60, //  ## 
-	0xC0, // ##  
-	0x60, //  ## 
-	0x20, //   # 
-	0x20, //   # 
-	0x20, //   # 
-	0x20, //   # 
-	0x10, //    #
-
-	// @1344 '|' (1 pixels wide)
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-
-	// @1358 '}' (4 pixels wide)
-	0x00, //     
-	0x80, // #   
-	0x40, //  #  
-	0x60, //  ## 
-	0x60, //  ## 
-	0x60, //  ## 
-	0x20, //   # 
-	0x10, //    #
-	0x20, //   # 
-	0x60, //  ## 
-	0x60, //  ## 
-	0x60, //  ## 
-	0x40, //  #  
-	0x80, // #   
-
-	// @1372 '~' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xF2, // ####  #
-	0x8C, // #   ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
+static const uint8_t _fonts_roboto_10pt_bitmaps[] = {
+
+    /* Index: 0x00, char: \x20, offset: 0x0000
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     */
+    0x00, 0x00,
+    0x00, 0x00,
+
+    /* Index: 0x01, char: !, offset: 0x0004
+     * .
+     * .
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * .
+     * .
+     * #
+     * .
+     * .
+     * .
+     */
+    0xfc,
+    0x04,
+
+    /* Index: 0x02, char: ", offset: 0x0006
+     * ...
+     * ...
+     * #.#
+     * #.#
+     * #.#
+     * ...
+     * ...
+     * ...
+     * ...
+     * ...
+     * ...
+     * ...
+     * ...
+     * ...
+     */
+    0x1c, 0x00, 0x1c,
+    0x00, 0x00, 0x00,
+
+    /* Index: 0x03, char: #, offset: 0x000c
+     * ........
+     * ........
+     * ...#..#.
+     * ...#.#..
+     * .#######
+     * ..#..#..
+     * ..#..#..
+     * #######.
+     * ..#.#...
+     * ..#.#...
+     * ....#...
+     * ........
+     * ........
+     * ........
+     */
+    0x80, 0x90, 0xf0, 0x9c, 0x90, 0xf8, 0x94, 0x10,
+    0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00,
+
+    /* Index: 0x04, char: $, offset: 0x001c
+     * ..#...
+     * ..##..
+     * .#.##.
+     * #...##
+     * ##....
+     * .##...
+     * ..###.
+     * ....##
+     * #...##
+     * ##..##
+     * .###..
+     * ..#...
+     * ......
+     * ......
+     */
+    0x18, 0x34, 0x63, 0x46, 0xcc, 0x88,
+    0x03, 0x06, 0x0c, 0x04, 0x03, 0x03,
+
+    /* Index: 0x05, char: %, offset: 0x0028
+     * ........
+     * ........
+     * ###.....
+     * #.#..#..
+     * #....#..
+     * #.#.#...
+     * ...#....
+     * ...##..#
+     * ..#.#..#
+     * .#..#..#
+     * .....##.
+     * ........
+     * ........
+     * ........
+     */
+    0x3c, 0x04, 0x2c, 0xc0, 0xa0, 0x18, 0x00, 0x80,
+    0x00, 0x02, 0x01, 0x00, 0x03, 0x04, 0x04, 0x03,
+
+    /* Index: 0x06, char: &, offset: 0x0038
+     * ........
+     * ........
+     * ..###...
+     * .##..#..
+     * .##..#..
+     * ..###...
+     * ..##....
+     * .#.##.##
+     * ##..###.
+     * .#...##.
+     * .####.#.
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x98, 0x7c, 0xe4, 0xa4, 0x18, 0x80, 0x80,
+    0x01, 0x07, 0x04, 0x04, 0x05, 0x03, 0x07, 0x00,
+
+    /* Index: 0x07, char: ', offset: 0x0048
+     * .
+     * .
+     * #
+     * #
+     * #
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     */
+    0x1c,
+    0x00,
+
+    /* Index: 0x08, char: (, offset: 0x004a
+     * ...
+     * ..#
+     * .#.
+     * .#.
+     * #..
+     * #..
+     * #..
+     * #..
+     * #..
+     * #..
+     * ##.
+     * .#.
+     * .##
+     * ..#
+     */
+    0xf0, 0x0c, 0x02,
+    0x07, 0x1c, 0x30,
+
+    /* Index: 0x09, char: ), offset: 0x0050
+     * ...
+     * #..
+     * .#.
+     * .##
+     * ..#
+     * ..#
+     * ..#
+     * ..#
+     * ..#
+     * ..#
+     * ..#
+     * .#.
+     * .#.
+     * #..
+     */
+    0x02, 0x0c, 0xf8,
+    0x20, 0x18, 0x07,
+
+    /* Index: 0x0a, char: \x2a, offset: 0x0056
+     * ....
+     * ....
+     * ....
+     * ....
+     * .#..
+     * ##.#
+     * .##.
+     * #.#.
+     * ....
+     * ....
+     * ....
+     * ....
+     * ....
+     * ....
+     */
+    0xa0, 0x70, 0xc0, 0x20,
+    0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x0b, char: +, offset: 0x005e
+     * .......
+     * .......
+     * .......
+     * ...#...
+     * ...#...
+     * ...#...
+     * #######
+     * ...#...
+     * ...#...
+     * ...#...
+     * .......
+     * .......
+     * .......
+     * .......
+     */
+    0x40, 0x40, 0x40, 0xf8, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+
+    /* Index: 0x0c, char: ,, offset: 0x006c
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * .#
+     * .#
+     * #.
+     * ..
+     */
+    0x00, 0x00,
+    0x10, 0x0c,
+
+    /* Index: 0x0d, char: -, offset: 0x0070
+     * ....
+     * ....
+     * ....
+     * ....
+     * ....
+     * ....
+     * ....
+     * ####
+     * ....
+     * ....
+     * ....
+     * ....
+     * ....
+     * ....
+     */
+    0x80, 0x80, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x0e, char: ., offset: 0x0078
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * #
+     * .
+     * .
+     * .
+     */
+    0x00,
+    0x04,
+
+    /* Index: 0x0f, char: \x2f, offset: 0x007a
+     * .....
+     * .....
+     * ....#
+     * ...#.
+     * ...#.
+     * ...#.
+     * ..#..
+     * ..#..
+     * .##..
+     * .#...
+     * .#...
+     * #....
+     * .....
+     * .....
+     */
+    0x00, 0x00, 0xc0, 0x38, 0x04,
+    0x08, 0x07, 0x01, 0x00, 0x00,
+
+    /* Index: 0x10, char: 0, offset: 0x0084
+     * ......
+     * ......
+     * .###..
+     * #...#.
+     * #...##
+     * #...##
+     * #...##
+     * #...##
+     * #...##
+     * #...#.
+     * .###..
+     * ......
+     * ......
+     * ......
+     */
+    0xf8, 0x04, 0x04, 0x04, 0xf8, 0xf0,
+    0x03, 0x04, 0x04, 0x04, 0x03, 0x01,
+
+    /* Index: 0x11, char: 1, offset: 0x0090
+     * ....
+     * ....
+     * ####
+     * ..##
+     * ..##
+     * ..##
+     * ..##
+     * ..##
+     * ..##
+     * ..##
+     * ..##
+     * ....
+     * ....
+     * ....
+     */
+    0x04, 0x04, 0xfc, 0xfc,
+    0x00, 0x00, 0x07, 0x07,
+
+    /* Index: 0x12, char: 2, offset: 0x0098
+     * ......
+     * ......
+     * .####.
+     * #...#.
+     * #...#.
+     * ....#.
+     * ...#..
+     * ..##..
+     * .##...
+     * .#....
+     * ######
+     * ......
+     * ......
+     * ......
+     */
+    0x18, 0x04, 0x84, 0xc4, 0x3c, 0x00,
+    0x04, 0x07, 0x05, 0x04, 0x04, 0x04,
+
+    /* Index: 0x13, char: 3, offset: 0x00a4
+     * ......
+     * ......
+     * .####.
+     * #...#.
+     * #...#.
+     * ....#.
+     * ..###.
+     * ....#.
+     * #...##
+     * #...#.
+     * .####.
+     * ......
+     * ......
+     * ......
+     */
+    0x18, 0x04, 0x44, 0x44, 0xfc, 0x00,
+    0x03, 0x04, 0x04, 0x04, 0x07, 0x01,
+
+    /* Index: 0x14, char: 4, offset: 0x00b0
+     * .......
+     * .......
+     * ....##.
+     * ...###.
+     * ...###.
+     * ..#.##.
+     * ..#.##.
+     * .#..##.
+     * #######
+     * ....##.
+     * ....##.
+     * .......
+     * .......
+     * .......
+     */
+    0x00, 0x80, 0x60, 0x18, 0xfc, 0xfc, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x01,
+
+    /* Index: 0x15, char: 5, offset: 0x00be
+     * ......
+     * ......
+     * .####.
+     * ##....
+     * ##....
+     * #####.
+     * #...#.
+     * ....##
+     * #...##
+     * #...#.
+     * .####.
+     * ......
+     * ......
+     * ......
+     */
+    0x78, 0x3c, 0x24, 0x24, 0xe4, 0x80,
+    0x03, 0x04, 0x04, 0x04, 0x07, 0x01,
+
+    /* Index: 0x16, char: 6, offset: 0x00ca
+     * ......
+     * ......
+     * .####.
+     * ##....
+     * #.....
+     * #.##..
+     * #...#.
+     * #...##
+     * #...##
+     * ##..#.
+     * .####.
+     * ......
+     * ......
+     * ......
+     */
+    0xf8, 0x0c, 0x24, 0x24, 0xc4, 0x80,
+    0x03, 0x06, 0x04, 0x04, 0x07, 0x01,
+
+    /* Index: 0x17, char: 7, offset: 0x00d6
+     * ......
+     * ......
+     * ######
+     * ....#.
+     * ...##.
+     * ...#..
+     * ..#...
+     * ..#...
+     * ..#...
+     * ..#...
+     * ..#...
+     * ......
+     * ......
+     * ......
+     */
+    0x04, 0x04, 0xc4, 0x34, 0x1c, 0x04,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+
+    /* Index: 0x18, char: 8, offset: 0x00e2
+     * ......
+     * ......
+     * .####.
+     * #...#.
+     * #...#.
+     * #...#.
+     * .###..
+     * #...#.
+     * #...##
+     * #...#.
+     * .####.
+     * ......
+     * ......
+     * ......
+     */
+    0xb8, 0x44, 0x44, 0x44, 0xbc, 0x00,
+    0x03, 0x04, 0x04, 0x04, 0x07, 0x01,
+
+    /* Index: 0x19, char: 9, offset: 0x00ee
+     * .....
+     * .....
+     * .###.
+     * #...#
+     * #...#
+     * #...#
+     * #...#
+     * .####
+     * ....#
+     * ....#
+     * ####.
+     * .....
+     * .....
+     * .....
+     */
+    0x78, 0x84, 0x84, 0x84, 0xf8,
+    0x04, 0x04, 0x04, 0x04, 0x03,
+
+    /* Index: 0x1a, char: :, offset: 0x00f8
+     * .
+     * .
+     * .
+     * .
+     * #
+     * .
+     * .
+     * .
+     * .
+     * .
+     * #
+     * .
+     * .
+     * .
+     */
+    0x10,
+    0x04,
+
+    /* Index: 0x1b, char: ;, offset: 0x00fa
+     * ..
+     * ..
+     * ..
+     * ..
+     * .#
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * .#
+     * .#
+     * #.
+     * ..
+     */
+    0x00, 0x10,
+    0x10, 0x0c,
+
+    /* Index: 0x1c, char: <, offset: 0x00fe
+     * ......
+     * ......
+     * ......
+     * ......
+     * ......
+     * ....##
+     * .###..
+     * ##....
+     * ..##..
+     * ....##
+     * ......
+     * ......
+     * ......
+     * ......
+     */
+    0x80, 0xc0, 0x40, 0x40, 0x20, 0x20,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x02,
+
+    /* Index: 0x1d, char: =, offset: 0x010a
+     * .....
+     * .....
+     * .....
+     * .....
+     * .....
+     * #####
+     * .....
+     * #####
+     * .....
+     * .....
+     * .....
+     * .....
+     * .....
+     * .....
+     */
+    0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x1e, char: >, offset: 0x0114
+     * .....
+     * .....
+     * .....
+     * .....
+     * .....
+     * ##...
+     * .###.
+     * ....#
+     * ..##.
+     * ##...
+     * .....
+     * .....
+     * .....
+     * .....
+     */
+    0x20, 0x60, 0x40, 0x40, 0x80,
+    0x02, 0x02, 0x01, 0x01, 0x00,
+
+    /* Index: 0x1f, char: ?, offset: 0x011e
+     * ......
+     * ......
+     * .####.
+     * ##..#.
+     * ....##
+     * ....#.
+     * ...##.
+     * ..##..
+     * ..##..
+     * ......
+     * ..##..
+     * ......
+     * ......
+     * ......
+     */
+    0x08, 0x0c, 0x84, 0xc4, 0x7c, 0x10,
+    0x00, 0x00, 0x05, 0x05, 0x00, 0x00,
+
+    /* Index: 0x20, char: @, offset: 0x012a
+     * ..........
+     * ..........
+     * ...#####..
+     * .##....##.
+     * .#..##..#.
+     * #..##.#..#
+     * #..#..#..#
+     * #..#..#..#
+     * #.##..#..#
+     * #..#..#..#
+     * #..##.###.
+     * #.........
+     * .##.......
+     * ..#####...
+     */
+    0xe0, 0x18, 0x08, 0xe4, 0x34, 0x14, 0xe4, 0x0c, 0x18, 0xe0,
+    0x0f, 0x10, 0x31, 0x27, 0x24, 0x20, 0x27, 0x04, 0x04, 0x03,
+
+    /* Index: 0x21, char: A, offset: 0x013e
+     * ........
+     * ........
+     * ...##...
+     * ...##...
+     * ...###..
+     * ..#..#..
+     * ..#..#..
+     * ..#..##.
+     * .######.
+     * .#....#.
+     * ##.....#
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xe0, 0x1c, 0x1c, 0xf0, 0x80, 0x00,
+    0x04, 0x07, 0x01, 0x01, 0x01, 0x01, 0x03, 0x04,
+
+    /* Index: 0x22, char: B, offset: 0x014e
+     * .......
+     * .......
+     * #####..
+     * #....#.
+     * #....#.
+     * #....#.
+     * ######.
+     * #....##
+     * #.....#
+     * #....##
+     * ######.
+     * .......
+     * .......
+     * .......
+     */
+    0xfc, 0x44, 0x44, 0x44, 0x44, 0xf8, 0x80,
+    0x07, 0x04, 0x04, 0x04, 0x04, 0x06, 0x03,
+
+    /* Index: 0x23, char: C, offset: 0x015c
+     * .......
+     * .......
+     * .####..
+     * ##...#.
+     * #....##
+     * #......
+     * #......
+     * #......
+     * #....##
+     * ##...#.
+     * .####..
+     * .......
+     * .......
+     * .......
+     */
+    0xf8, 0x0c, 0x04, 0x04, 0x04, 0x18, 0x10,
+    0x03, 0x06, 0x04, 0x04, 0x04, 0x03, 0x01,
+
+    /* Index: 0x24, char: D, offset: 0x016a
+     * .......
+     * .......
+     * #####..
+     * #....#.
+     * #....##
+     * #.....#
+     * #.....#
+     * #.....#
+     * #....##
+     * #....#.
+     * #####..
+     * .......
+     * .......
+     * .......
+     */
+    0xfc, 0x04, 0x04, 0x04, 0x04, 0x18, 0xf0,
+    0x07, 0x04, 0x04, 0x04, 0x04, 0x03, 0x01,
+
+    /* Index: 0x25, char: E, offset: 0x0178
+     * ......
+     * ......
+     * ######
+     * #.....
+     * #.....
+     * #.....
+     * #####.
+     * #.....
+     * #.....
+     * #.....
+     * ######
+     * ......
+     * ......
+     * ......
+     */
+    0xfc, 0x44, 0x44, 0x44, 0x44, 0x04,
+    0x07, 0x04, 0x04, 0x04, 0x04, 0x04,
+
+    /* Index: 0x26, char: F, offset: 0x0184
+     * ......
+     * ......
+     * ######
+     * #.....
+     * #.....
+     * #.....
+     * #####.
+     * #.....
+     * #.....
+     * #.....
+     * #.....
+     * ......
+     * ......
+     * ......
+     */
+    0xfc, 0x44, 0x44, 0x44, 0x44, 0x04,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x27, char: G, offset: 0x0190
+     * .......
+     * .......
+     * .####..
+     * ##...#.
+     * #....##
+     * #......
+     * #..####
+     * #....##
+     * #....##
+     * ##...##
+     * .#####.
+     * .......
+     * .......
+     * .......
+     */
+    0xf8, 0x0c, 0x04, 0x44, 0x44, 0xd8, 0xd0,
+    0x03, 0x06, 0x04, 0x04, 0x04, 0x07, 0x03,
+
+    /* Index: 0x28, char: H, offset: 0x019e
+     * .......
+     * .......
+     * #.....#
+     * #.....#
+     * #.....#
+     * #.....#
+     * #######
+     * #.....#
+     * #.....#
+     * #.....#
+     * #.....#
+     * .......
+     * .......
+     * .......
+     */
+    0xfc, 0x40, 0x40, 0x40, 0x40, 0x40, 0xfc,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+
+    /* Index: 0x29, char: I, offset: 0x01ac
+     * .
+     * .
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * .
+     * .
+     * .
+     */
+    0xfc,
+    0x07,
+
+    /* Index: 0x2a, char: J, offset: 0x01ae
+     * ......
+     * ......
+     * .....#
+     * .....#
+     * .....#
+     * .....#
+     * .....#
+     * .....#
+     * ##...#
+     * .#..##
+     * .####.
+     * ......
+     * ......
+     * ......
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,
+    0x01, 0x07, 0x04, 0x04, 0x06, 0x03,
+
+    /* Index: 0x2b, char: K, offset: 0x01ba
+     * .......
+     * .......
+     * #....#.
+     * #...##.
+     * #..##..
+     * #..#...
+     * ###....
+     * #..#...
+     * #...#..
+     * #...##.
+     * #....##
+     * .......
+     * .......
+     * .......
+     */
+    0xfc, 0x40, 0x40, 0xb0, 0x18, 0x0c, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x03, 0x06, 0x04,
+
+    /* Index: 0x2c, char: L, offset: 0x01c8
+     * ......
+     * ......
+     * #.....
+     * #.....
+     * #.....
+     * #.....
+     * #.....
+     * #.....
+     * #.....
+     * #.....
+     * ######
+     * ......
+     * ......
+     * ......
+     */
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x04, 0x04, 0x04, 0x04, 0x04,
+
+    /* Index: 0x2d, char: M, offset: 0x01d4
+     * .........
+     * .........
+     * ##.....##
+     * ##.....##
+     * #.#....##
+     * #.#...#.#
+     * #.##..#.#
+     * #..#.##.#
+     * #..#.#..#
+     * #...##..#
+     * #...#...#
+     * .........
+     * .........
+     * .........
+     */
+    0xfc, 0x0c, 0x70, 0xc0, 0x00, 0x80, 0xe0, 0x1c, 0xfc,
+    0x07, 0x00, 0x00, 0x01, 0x06, 0x03, 0x00, 0x00, 0x07,
+
+    /* Index: 0x2e, char: N, offset: 0x01e6
+     * .......
+     * .......
+     * ##....#
+     * ##....#
+     * #.#...#
+     * #.##..#
+     * #..#..#
+     * #...#.#
+     * #...###
+     * #....##
+     * #....##
+     * .......
+     * .......
+     * .......
+     */
+    0xfc, 0x0c, 0x30, 0x60, 0x80, 0x00, 0xfc,
+    0x07, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07,
+
+    /* Index: 0x2f, char: O, offset: 0x01f4
+     * .......
+     * .......
+     * .####..
+     * ##...#.
+     * #.....#
+     * #.....#
+     * #.....#
+     * #.....#
+     * #.....#
+     * ##...#.
+     * .####..
+     * .......
+     * .......
+     * .......
+     */
+    0xf8, 0x0c, 0x04, 0x04, 0x04, 0x08, 0xf0,
+    0x03, 0x06, 0x04, 0x04, 0x04, 0x02, 0x01,
+
+    /* Index: 0x30, char: P, offset: 0x0202
+     * .......
+     * .......
+     * ######.
+     * #....#.
+     * #....##
+     * #....##
+     * #...##.
+     * #......
+     * #......
+     * #......
+     * #......
+     * .......
+     * .......
+     * .......
+     */
+    0xfc, 0x04, 0x04, 0x04, 0x44, 0x7c, 0x30,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x31, char: Q, offset: 0x0210
+     * .......
+     * .......
+     * .####..
+     * ##...#.
+     * #.....#
+     * #.....#
+     * #.....#
+     * #.....#
+     * #.....#
+     * ##...#.
+     * .######
+     * .......
+     * .......
+     * .......
+     */
+    0xf8, 0x0c, 0x04, 0x04, 0x04, 0x08, 0xf0,
+    0x03, 0x06, 0x04, 0x04, 0x04, 0x06, 0x05,
+
+    /* Index: 0x32, char: R, offset: 0x021e
+     * ......
+     * ......
+     * #####.
+     * #....#
+     * #....#
+     * #....#
+     * #####.
+     * #....#
+     * #....#
+     * #....#
+     * #....#
+     * ......
+     * ......
+     * ......
+     */
+    0xfc, 0x44, 0x44, 0x44, 0x44, 0xb8,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x07,
+
+    /* Index: 0x33, char: S, offset: 0x022a
+     * ......
+     * ......
+     * .####.
+     * ##..##
+     * #....#
+     * ##....
+     * ..###.
+     * ....##
+     * #....#
+     * #....#
+     * .####.
+     * ......
+     * ......
+     * ......
+     */
+    0x38, 0x2c, 0x44, 0x44, 0xcc, 0x98,
+    0x03, 0x04, 0x04, 0x04, 0x04, 0x03,
+
+    /* Index: 0x34, char: T, offset: 0x0236
+     * ........
+     * ........
+     * ########
+     * ...##...
+     * ...##...
+     * ...##...
+     * ...##...
+     * ...##...
+     * ...##...
+     * ...##...
+     * ...##...
+     * ........
+     * ........
+     * ........
+     */
+    0x04, 0x04, 0x04, 0xfc, 0xfc, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00,
+
+    /* Index: 0x35, char: U, offset: 0x0246
+     * .......
+     * .......
+     * #.....#
+     * #.....#
+     * #.....#
+     * #.....#
+     * #.....#
+     * #.....#
+     * #.....#
+     * ##...#.
+     * .####..
+     * .......
+     * .......
+     * .......
+     */
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,
+    0x03, 0x06, 0x04, 0x04, 0x04, 0x02, 0x01,
+
+    /* Index: 0x36, char: V, offset: 0x0254
+     * ........
+     * ........
+     * ##.....#
+     * .#....##
+     * .#....#.
+     * .##..##.
+     * ..#..#..
+     * ..#..#..
+     * ...###..
+     * ...##...
+     * ...##...
+     * ........
+     * ........
+     * ........
+     */
+    0x04, 0x3c, 0xe0, 0x00, 0x00, 0xe0, 0x38, 0x0c,
+    0x00, 0x00, 0x00, 0x07, 0x07, 0x01, 0x00, 0x00,
+
+    /* Index: 0x37, char: W, offset: 0x0264
+     * ...........
+     * ...........
+     * ##...#...##
+     * .#...##..##
+     * .#..#.#..#.
+     * .#..#.#..#.
+     * .##.#.#..#.
+     * ..###..###.
+     * ..##...##..
+     * ..##...##..
+     * ..##...##..
+     * ...........
+     * ...........
+     * ...........
+     */
+    0x04, 0x7c, 0xc0, 0x80, 0xf0, 0x0c, 0x78, 0x80, 0x80, 0xfc, 0x0c,
+    0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+
+    /* Index: 0x38, char: X, offset: 0x027a
+     * .......
+     * .......
+     * #....#.
+     * ##..##.
+     * .#..#..
+     * ..###..
+     * ..##...
+     * ..###..
+     * .#..#..
+     * ##..##.
+     * #....##
+     * .......
+     * .......
+     * .......
+     */
+    0x0c, 0x18, 0xe0, 0xe0, 0xb8, 0x0c, 0x00,
+    0x06, 0x03, 0x00, 0x00, 0x03, 0x06, 0x04,
+
+    /* Index: 0x39, char: Y, offset: 0x0288
+     * .......
+     * .......
+     * #....##
+     * #....#.
+     * .#..##.
+     * .##.#..
+     * ..##...
+     * ..##...
+     * ..##...
+     * ..##...
+     * ..##...
+     * .......
+     * .......
+     * .......
+     */
+    0x0c, 0x30, 0xe0, 0xc0, 0x30, 0x1c, 0x04,
+    0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00,
+
+    /* Index: 0x3a, char: Z, offset: 0x0296
+     * ......
+     * ......
+     * ######
+     * ....##
+     * ...##.
+     * ...#..
+     * ..#...
+     * .##...
+     * .#....
+     * #.....
+     * ######
+     * ......
+     * ......
+     * ......
+     */
+    0x04, 0x84, 0xc4, 0x34, 0x1c, 0x0c,
+    0x06, 0x05, 0x04, 0x04, 0x04, 0x04,
+
+    /* Index: 0x3b, char: [, offset: 0x02a2
+     * ##
+     * #.
+     * #.
+     * #.
+     * #.
+     * #.
+     * #.
+     * #.
+     * #.
+     * #.
+     * #.
+     * #.
+     * ##
+     * ..
+     */
+    0xff, 0x01,
+    0x1f, 0x10,
+
+    /* Index: 0x3c, char: \x5c, offset: 0x02a6
+     * .....
+     * .....
+     * ##...
+     * .#...
+     * .#...
+     * ..#..
+     * ..#..
+     * ..##.
+     * ...#.
+     * ...#.
+     * ....#
+     * ....#
+     * .....
+     * .....
+     */
+    0x04, 0x1c, 0xe0, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x0c,
+
+    /* Index: 0x3d, char: ], offset: 0x02b0
+     * ###
+     * .##
+     * .##
+     * .##
+     * .##
+     * .##
+     * .##
+     * .##
+     * .##
+     * .##
+     * .##
+     * .##
+     * ###
+     * ...
+     */
+    0x01, 0xff, 0xff,
+    0x10, 0x1f, 0x1f,
+
+    /* Index: 0x3e, char: ^, offset: 0x02b6
+     * .....
+     * .....
+     * ..#..
+     * ..##.
+     * .#.#.
+     * .#.##
+     * ##..#
+     * .....
+     * .....
+     * .....
+     * .....
+     * .....
+     * .....
+     * .....
+     */
+    0x40, 0x70, 0x0c, 0x38, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x3f, char: _, offset: 0x02c0
+     * ......
+     * ......
+     * ......
+     * ......
+     * ......
+     * ......
+     * ......
+     * ......
+     * ......
+     * ......
+     * ......
+     * ######
+     * ......
+     * ......
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+
+    /* Index: 0x40, char: `, offset: 0x02cc
+     * ..
+     * #.
+     * .#
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     */
+    0x02, 0x04,
+    0x00, 0x00,
+
+    /* Index: 0x41, char: a, offset: 0x02d0
+     * .....
+     * .....
+     * .....
+     * .....
+     * .###.
+     * #...#
+     * ....#
+     * #####
+     * #...#
+     * #...#
+     * ###.#
+     * .....
+     * .....
+     * .....
+     */
+    0xa0, 0x90, 0x90, 0x90, 0xe0,
+    0x07, 0x04, 0x04, 0x00, 0x07,
+
+    /* Index: 0x42, char: b, offset: 0x02da
+     * ......
+     * #.....
+     * #.....
+     * #.....
+     * #.###.
+     * ##..#.
+     * #...##
+     * #....#
+     * #...##
+     * ##..#.
+     * #.###.
+     * ......
+     * ......
+     * ......
+     */
+    0xfe, 0x20, 0x10, 0x10, 0x70, 0xc0,
+    0x07, 0x02, 0x04, 0x04, 0x07, 0x01,
+
+    /* Index: 0x43, char: c, offset: 0x02e6
+     * .....
+     * .....
+     * .....
+     * .....
+     * .###.
+     * #...#
+     * #....
+     * #....
+     * #....
+     * #...#
+     * .###.
+     * .....
+     * .....
+     * .....
+     */
+    0xe0, 0x10, 0x10, 0x10, 0x20,
+    0x03, 0x04, 0x04, 0x04, 0x02,
+
+    /* Index: 0x44, char: d, offset: 0x02f0
+     * .....
+     * ....#
+     * ....#
+     * ....#
+     * .####
+     * #...#
+     * #...#
+     * #...#
+     * #...#
+     * #...#
+     * .####
+     * .....
+     * .....
+     * .....
+     */
+    0xe0, 0x10, 0x10, 0x10, 0xfe,
+    0x03, 0x04, 0x04, 0x04, 0x07,
+
+    /* Index: 0x45, char: e, offset: 0x02fa
+     * .....
+     * .....
+     * .....
+     * .....
+     * .###.
+     * #...#
+     * #...#
+     * #####
+     * #....
+     * #...#
+     * .####
+     * .....
+     * .....
+     * .....
+     */
+    0xe0, 0x90, 0x90, 0x90, 0xe0,
+    0x03, 0x04, 0x04, 0x04, 0x06,
+
+    /* Index: 0x46, char: f, offset: 0x0304
+     * ....
+     * ..##
+     * .##.
+     * .##.
+     * ####
+     * .##.
+     * .##.
+     * .##.
+     * .##.
+     * .##.
+     * .##.
+     * ....
+     * ....
+     * ....
+     */
+    0x10, 0xfc, 0xfe, 0x12,
+    0x00, 0x07, 0x07, 0x00,
+
+    /* Index: 0x47, char: g, offset: 0x030c
+     * ......
+     * ......
+     * ......
+     * ......
+     * .#####
+     * ##..##
+     * #...##
+     * #...##
+     * #...##
+     * #...##
+     * .#####
+     * ....#.
+     * ....#.
+     * ####..
+     */
+    0xe0, 0x30, 0x10, 0x10, 0xf0, 0xf0,
+    0x23, 0x24, 0x24, 0x24, 0x1f, 0x07,
+
+    /* Index: 0x48, char: h, offset: 0x0318
+     * ......
+     * #.....
+     * #.....
+     * #.....
+     * #.###.
+     * #...#.
+     * #...#.
+     * #...##
+     * #...##
+     * #...##
+     * #...##
+     * ......
+     * ......
+     * ......
+     */
+    0xfe, 0x00, 0x10, 0x10, 0xf0, 0x80,
+    0x07, 0x00, 0x00, 0x00, 0x07, 0x07,
+
+    /* Index: 0x49, char: i, offset: 0x0324
+     * .
+     * #
+     * .
+     * .
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * .
+     * .
+     * .
+     */
+    0xf2,
+    0x07,
+
+    /* Index: 0x4a, char: j, offset: 0x0326
+     * ..
+     * .#
+     * ..
+     * ..
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * ##
+     */
+    0x00, 0xf2,
+    0x20, 0x3f,
+
+    /* Index: 0x4b, char: k, offset: 0x032a
+     * .....
+     * #....
+     * #....
+     * #....
+     * #..##
+     * #..#.
+     * #.#..
+     * ###..
+     * #.##.
+     * #..#.
+     * #...#
+     * .....
+     * .....
+     * .....
+     */
+    0xfe, 0x80, 0xc0, 0x30, 0x10,
+    0x07, 0x00, 0x01, 0x03, 0x04,
+
+    /* Index: 0x4c, char: l, offset: 0x0334
+     * .
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * .
+     * .
+     * .
+     */
+    0xfe,
+    0x07,
+
+    /* Index: 0x4d, char: m, offset: 0x0336
+     * .........
+     * .........
+     * .........
+     * .........
+     * #.###.###
+     * #...##..#
+     * #...#...#
+     * #...#...#
+     * #...#...#
+     * #...#...#
+     * #...#...#
+     * .........
+     * .........
+     * .........
+     */
+    0xf0, 0x00, 0x10, 0x10, 0xf0, 0x20, 0x10, 0x10, 0xf0,
+    0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+
+    /* Index: 0x4e, char: n, offset: 0x0348
+     * .....
+     * .....
+     * .....
+     * .....
+     * #.###
+     * #...#
+     * #...#
+     * #...#
+     * #...#
+     * #...#
+     * #...#
+     * .....
+     * .....
+     * .....
+     */
+    0xf0, 0x00, 0x10, 0x10, 0xf0,
+    0x07, 0x00, 0x00, 0x00, 0x07,
+
+    /* Index: 0x4f, char: o, offset: 0x0352
+     * ......
+     * ......
+     * ......
+     * ......
+     * .###..
+     * #...#.
+     * #...##
+     * #....#
+     * #...##
+     * #...#.
+     * .###..
+     * ......
+     * ......
+     * ......
+     */
+    0xe0, 0x10, 0x10, 0x10, 0x60, 0xc0,
+    0x03, 0x04, 0x04, 0x04, 0x03, 0x01,
+
+    /* Index: 0x50, char: p, offset: 0x035e
+     * ......
+     * ......
+     * ......
+     * ......
+     * #.###.
+     * #...#.
+     * #...##
+     * #....#
+     * #...##
+     * #...#.
+     * #.###.
+     * #.....
+     * #.....
+     * #.....
+     */
+    0xf0, 0x00, 0x10, 0x10, 0x70, 0xc0,
+    0x3f, 0x00, 0x04, 0x04, 0x07, 0x01,
+
+    /* Index: 0x51, char: q, offset: 0x036a
+     * .....
+     * .....
+     * .....
+     * .....
+     * .####
+     * #...#
+     * #...#
+     * #...#
+     * #...#
+     * #...#
+     * .####
+     * ....#
+     * ....#
+     * ....#
+     */
+    0xe0, 0x10, 0x10, 0x10, 0xf0,
+    0x03, 0x04, 0x04, 0x04, 0x3f,
+
+    /* Index: 0x52, char: r, offset: 0x0374
+     * ...
+     * ...
+     * ...
+     * ...
+     * #.#
+     * #..
+     * #..
+     * #..
+     * #..
+     * #..
+     * #..
+     * ...
+     * ...
+     * ...
+     */
+    0xf0, 0x00, 0x10,
+    0x07, 0x00, 0x00,
+
+    /* Index: 0x53, char: s, offset: 0x037a
+     * .....
+     * .....
+     * .....
+     * .....
+     * .###.
+     * #...#
+     * #....
+     * .###.
+     * ....#
+     * #...#
+     * .###.
+     * .....
+     * .....
+     * .....
+     */
+    0x60, 0x90, 0x90, 0x90, 0x20,
+    0x02, 0x04, 0x04, 0x04, 0x03,
+
+    /* Index: 0x54, char: t, offset: 0x0384
+     * ....
+     * ....
+     * .##.
+     * .##.
+     * ####
+     * .##.
+     * .##.
+     * .##.
+     * .##.
+     * .##.
+     * ..##
+     * ....
+     * ....
+     * ....
+     */
+    0x10, 0xfc, 0xfc, 0x10,
+    0x00, 0x03, 0x07, 0x04,
+
+    /* Index: 0x55, char: u, offset: 0x038c
+     * .....
+     * .....
+     * .....
+     * .....
+     * #...#
+     * #...#
+     * #...#
+     * #...#
+     * #...#
+     * #...#
+     * .####
+     * .....
+     * .....
+     * .....
+     */
+    0xf0, 0x00, 0x00, 0x00, 0xf0,
+    0x03, 0x04, 0x04, 0x04, 0x07,
+
+    /* Index: 0x56, char: v, offset: 0x0396
+     * ......
+     * ......
+     * ......
+     * ......
+     * ##...#
+     * .#...#
+     * .#..#.
+     * ..#.#.
+     * ..#.#.
+     * ..##..
+     * ...#..
+     * ......
+     * ......
+     * ......
+     */
+    0x10, 0x70, 0x80, 0x00, 0xc0, 0x30,
+    0x00, 0x00, 0x03, 0x06, 0x01, 0x00,
+
+    /* Index: 0x57, char: w, offset: 0x03a2
+     * .........
+     * .........
+     * .........
+     * .........
+     * ##..##..#
+     * .#..##..#
+     * .#..##..#
+     * .#.#.####
+     * ..##..##.
+     * ..##..##.
+     * ..#...##.
+     * .........
+     * .........
+     * .........
+     */
+    0x10, 0xf0, 0x00, 0x80, 0x70, 0xf0, 0x80, 0x80, 0xf0,
+    0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0x07, 0x07, 0x00,
+
+    /* Index: 0x58, char: x, offset: 0x03b4
+     * .....
+     * .....
+     * .....
+     * .....
+     * #..##
+     * ##.#.
+     * .###.
+     * ..#..
+     * .###.
+     * ##.#.
+     * #..##
+     * .....
+     * .....
+     * .....
+     */
+    0x30, 0x60, 0xc0, 0x70, 0x10,
+    0x06, 0x03, 0x01, 0x07, 0x04,
+
+    /* Index: 0x59, char: y, offset: 0x03be
+     * ......
+     * ......
+     * ......
+     * ......
+     * ##...#
+     * .#..##
+     * .#..#.
+     * .##.#.
+     * ..#.#.
+     * ..##..
+     * ...#..
+     * ...#..
+     * ..#...
+     * .##...
+     */
+    0x10, 0xf0, 0x80, 0x00, 0xe0, 0x30,
+    0x00, 0x20, 0x33, 0x0e, 0x01, 0x00,
+
+    /* Index: 0x5a, char: z, offset: 0x03ca
+     * .....
+     * .....
+     * .....
+     * .....
+     * #####
+     * ...#.
+     * ..##.
+     * .##..
+     * .#...
+     * #....
+     * #####
+     * .....
+     * .....
+     * .....
+     */
+    0x10, 0x90, 0xd0, 0x70, 0x10,
+    0x06, 0x05, 0x04, 0x04, 0x04,
+
+    /* Index: 0x5b, char: {, offset: 0x03d4
+     * ....
+     * ...#
+     * ..#.
+     * ..#.
+     * ..#.
+     * ..#.
+     * .##.
+     * ##..
+     * .##.
+     * ..#.
+     * ..#.
+     * ..#.
+     * ..#.
+     * ...#
+     */
+    0x80, 0xc0, 0x7c, 0x02,
+    0x00, 0x01, 0x1f, 0x20,
+
+    /* Index: 0x5c, char: |, offset: 0x03dc
+     * .
+     * .
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * .
+     */
+    0xfc,
+    0x1f,
+
+    /* Index: 0x5d, char: }, offset: 0x03de
+     * ....
+     * #...
+     * .#..
+     * .##.
+     * .##.
+     * .##.
+     * ..#.
+     * ...#
+     * ..#.
+     * .##.
+     * .##.
+     * .##.
+     * .#..
+     * #...
+     */
+    0x02, 0x3c, 0x78, 0x80,
+    0x20, 0x1e, 0x0f, 0x00,
+
+    /* Index: 0x5e, char: ~, offset: 0x03e6
+     * .......
+     * .......
+     * .......
+     * .......
+     * .......
+     * .......
+     * ####..#
+     * #...##.
+     * .......
+     * .......
+     * .......
+     * .......
+     * .......
+     * .......
+     */
+    0xc0, 0x40, 0x40, 0x40, 0x80, 0x80, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const font_char_desc_t _fonts_roboto_10pt_descriptors[] = {
+    { 0x02, 0x0000 }, /* Index: 0x00, char: \x20 */
+    { 0x01, 0x0004 }, /* Index: 0x01, char: ! */
+    { 0x03, 0x0006 }, /* Index: 0x02, char: " */
+    { 0x08, 0x000c }, /* Index: 0x03, char: # */
+    { 0x06, 0x001c }, /* Index: 0x04, char: $ */
+    { 0x08, 0x0028 }, /* Index: 0x05, char: % */
+    { 0x08, 0x0038 }, /* Index: 0x06, char: & */
+    { 0x01, 0x0048 }, /* Index: 0x07, char: ' */
+    { 0x03, 0x004a }, /* Index: 0x08, char: ( */
+    { 0x03, 0x0050 }, /* Index: 0x09, char: ) */
+    { 0x04, 0x0056 }, /* Index: 0x0a, char: \x2a */
+    { 0x07, 0x005e }, /* Index: 0x0b, char: + */
+    { 0x02, 0x006c }, /* Index: 0x0c, char: , */
+    { 0x04, 0x0070 }, /* Index: 0x0d, char: - */
+    { 0x01, 0x0078 }, /* Index: 0x0e, char: . */
+    { 0x05, 0x007a }, /* Index: 0x0f, char: \x2f */
+    { 0x06, 0x0084 }, /* Index: 0x10, char: 0 */
+    { 0x04, 0x0090 }, /* Index: 0x11, char: 1 */
+    { 0x06, 0x0098 }, /* Index: 0x12, char: 2 */
+    { 0x06, 0x00a4 }, /* Index: 0x13, char: 3 */
+    { 0x07, 0x00b0 }, /* Index: 0x14, char: 4 */
+    { 0x06, 0x00be }, /* Index: 0x15, char: 5 */
+    { 0x06, 0x00ca }, /* Index: 0x16, char: 6 */
+    { 0x06, 0x00d6 }, /* Index: 0x17, char: 7 */
+    { 0x06, 0x00e2 }, /* Index: 0x18, char: 8 */
+    { 0x05, 0x00ee }, /* Index: 0x19, char: 9 */
+    { 0x01, 0x00f8 }, /* Index: 0x1a, char: : */
+    { 0x02, 0x00fa }, /* Index: 0x1b, char: ; */
+    { 0x06, 0x00fe }, /* Index: 0x1c, char: < */
+    { 0x05, 0x010a }, /* Index: 0x1d, char: = */
+    { 0x05, 0x0114 }, /* Index: 0x1e, char: > */
+    { 0x06, 0x011e }, /* Index: 0x1f, char: ? */
+    { 0x0a, 0x012a }, /* Index: 0x20, char: @ */
+    { 0x08, 0x013e }, /* Index: 0x21, char: A */
+    { 0x07, 0x014e }, /* Index: 0x22, char: B */
+    { 0x07, 0x015c }, /* Index: 0x23, char: C */
+    { 0x07, 0x016a }, /* Index: 0x24, char: D */
+    { 0x06, 0x0178 }, /* Index: 0x25, char: E */
+    { 0x06, 0x0184 }, /* Index: 0x26, char: F */
+    { 0x07, 0x0190 }, /* Index: 0x27, char: G */
+    { 0x07, 0x019e }, /* Index: 0x28, char: H */
+    { 0x01, 0x01ac }, /* Index: 0x29, char: I */
+    { 0x06, 0x01ae }, /* Index: 0x2a, char: J */
+    { 0x07, 0x01ba }, /* Index: 0x2b, char: K */
+    { 0x06, 0x01c8 }, /* Index: 0x2c, char: L */
+    { 0x09, 0x01d4 }, /* Index: 0x2d, char: M */
+    { 0x07, 0x01e6 }, /* Index: 0x2e, char: N */
+    { 0x07, 0x01f4 }, /* Index: 0x2f, char: O */
+    { 0x07, 0x0202 }, /* Index: 0x30, char: P */
+    { 0x07, 0x0210 }, /* Index: 0x31, char: Q */
+    { 0x06, 0x021e }, /* Index: 0x32, char: R */
+    { 0x06, 0x022a }, /* Index: 0x33, char: S */
+    { 0x08, 0x0236 }, /* Index: 0x34, char: T */
+    { 0x07, 0x0246 }, /* Index: 0x35, char: U */
+    { 0x08, 0x0254 }, /* Index: 0x36, char: V */
+    { 0x0b, 0x0264 }, /* Index: 0x37, char: W */
+    { 0x07, 0x027a }, /* Index: 0x38, char: X */
+    { 0x07, 0x0288 }, /* Index: 0x39, char: Y */
+    { 0x06, 0x0296 }, /* Index: 0x3a, char: Z */
+    { 0x02, 0x02a2 }, /* Index: 0x3b, char: [ */
+    { 0x05, 0x02a6 }, /* Index: 0x3c, char: \x5c */
+    { 0x03, 0x02b0 }, /* Index: 0x3d, char: ] */
+    { 0x05, 0x02b6 }, /* Index: 0x3e, char: ^ */
+    { 0x06, 0x02c0 }, /* Index: 0x3f, char: _ */
+    { 0x02, 0x02cc }, /* Index: 0x40, char: ` */
+    { 0x05, 0x02d0 }, /* Index: 0x41, char: a */
+    { 0x06, 0x02da }, /* Index: 0x42, char: b */
+    { 0x05, 0x02e6 }, /* Index: 0x43, char: c */
+    { 0x05, 0x02f0 }, /* Index: 0x44, char: d */
+    { 0x05, 0x02fa }, /* Index: 0x45, char: e */
+    { 0x04, 0x0304 }, /* Index: 0x46, char: f */
+    { 0x06, 0x030c }, /* Index: 0x47, char: g */
+    { 0x06, 0x0318 }, /* Index: 0x48, char: h */
+    { 0x01, 0x0324 }, /* Index: 0x49, char: i */
+    { 0x02, 0x0326 }, /* Index: 0x4a, char: j */
+    { 0x05, 0x032a }, /* Index: 0x4b, char: k */
+    { 0x01, 0x0334 }, /* Index: 0x4c, char: l */
+    { 0x09, 0x0336 }, /* Index: 0x4d, char: m */
+    { 0x05, 0x0348 }, /* Index: 0x4e, char: n */
+    { 0x06, 0x0352 }, /* Index: 0x4f, char: o */
+    { 0x06, 0x035e }, /* Index: 0x50, char: p */
+    { 0x05, 0x036a }, /* Index: 0x51, char: q */
+    { 0x03, 0x0374 }, /* Index: 0x52, char: r */
+    { 0x05, 0x037a }, /* Index: 0x53, char: s */
+    { 0x04, 0x0384 }, /* Index: 0x54, char: t */
+    { 0x05, 0x038c }, /* Index: 0x55, char: u */
+    { 0x06, 0x0396 }, /* Index: 0x56, char: v */
+    { 0x09, 0x03a2 }, /* Index: 0x57, char: w */
+    { 0x05, 0x03b4 }, /* Index: 0x58, char: x */
+    { 0x06, 0x03be }, /* Index: 0x59, char: y */
+    { 0x05, 0x03ca }, /* Index: 0x5a, char: z */
+    { 0x04, 0x03d4 }, /* Index: 0x5b, char: { */
+    { 0x01, 0x03dc }, /* Index: 0x5c, char: | */
+    { 0x04, 0x03de }, /* Index: 0x5d, char: } */
+    { 0x07, 0x03e6 }, /* Index: 0x5e, char: ~ */
+};
+
+static const font_kern_left_t _fonts_roboto_10pt_kern_lefts[] = {
+    { 0x0022,    0 }, /* " */
+    { 0x0027,    3 }, /* ' */
+    { 0x002c,    6 }, /* , */
+    { 0x002d,   16 }, /* - */
+    { 0x002e,   21 }, /* . */
+    { 0x0030,   31 }, /* 0 */
+    { 0x0032,   32 }, /* 2 */
+    { 0x0033,   34 }, /* 3 */
+    { 0x0034,   36 }, /* 4 */
+    { 0x0035,   38 }, /* 5 */
+    { 0x0036,   40 }, /* 6 */
+    { 0x0037,   42 }, /* 7 */
+    { 0x0038,   49 }, /* 8 */
+    { 0x003a,   51 }, /* : */
+    { 0x003b,   55 }, /* ; */
+    { 0x0041,   59 }, /* A */
+    { 0x0043,   70 }, /* C */
+    { 0x0044,   71 }, /* D */
+    { 0x0045,   72 }, /* E */
+    { 0x0046,   76 }, /* F */
+    { 0x004b,   87 }, /* K */
+    { 0x004c,   88 }, /* L */
+    { 0x004f,  101 }, /* O */
+    { 0x0050,  102 }, /* P */
+    { 0x0054,  107 }, /* T */
+    { 0x0055,  133 }, /* U */
+    { 0x0056,  134 }, /* V */
+    { 0x0057,  140 }, /* W */
+    { 0x0058,  143 }, /* X */
+    { 0x0059,  144 }, /* Y */
+    { 0x005a,  151 }, /* Z */
+    { 0x0061,  153 }, /* a */
+    { 0x0062,  156 }, /* b */
+    { 0x0063,  161 }, /* c */
+    { 0x0065,  165 }, /* e */
+    { 0x0066,  168 }, /* f */
+    { 0x0067,  169 }, /* g */
+    { 0x0068,  172 }, /* h */
+    { 0x006b,  176 }, /* k */
+    { 0x006d,  179 }, /* m */
+    { 0x006e,  182 }, /* n */
+    { 0x006f,  185 }, /* o */
+    { 0x0070,  190 }, /* p */
+    { 0x0071,  195 }, /* q */
+    { 0x0072,  198 }, /* r */
+    { 0x0073,  208 }, /* s */
+    { 0x0075,  211 }, /* u */
+    { 0x0076,  214 }, /* v */
+    { 0x0077,  220 }, /* w */
+    { 0x0078,  224 }, /* x */
+    { 0x0079,  227 }, /* y */
+    { 0x007a,  233 }, /* z */
+    { 0xffff,  237 },
+};
+
+static const uint16_t _fonts_roboto_10pt_kern_rights[] = {
+    0x0034, /* " 4 */
+    0x0041, /* " A */
+    0x004a, /* " J */
+    0x0034, /* ' 4 */
+    0x0041, /* ' A */
+    0x004a, /* ' J */
+    0x0031, /* , 1 */
+    0x0034, /* , 4 */
+    0x0037, /* , 7 */
+    0x0054, /* , T */
+    0x0056, /* , V */
+    0x0057, /* , W */
+    0x0059, /* , Y */
+    0x0076, /* , v */
+    0x0077, /* , w */
+    0x0079, /* , y */
+    0x0031, /* - 1 */
+    0x0037, /* - 7 */
+    0x0054, /* - T */
+    0x0056, /* - V */
+    0x0059, /* - Y */
+    0x0031, /* . 1 */
+    0x0034, /* . 4 */
+    0x0037, /* . 7 */
+    0x0054, /* . T */
+    0x0056, /* . V */
+    0x0057, /* . W */
+    0x0059, /* . Y */
+    0x0076, /* . v */
+    0x0077, /* . w */
+    0x0079, /* . y */
+    0x002c, /* 0 , */
+    0x002d, /* 2 - */
+    0x0034, /* 2 4 */
+    0x002c, /* 3 , */
+    0x003b, /* 3 ; */
+    0x002c, /* 4 , */
+    0x003b, /* 4 ; */
+    0x002c, /* 5 , */
+    0x003b, /* 5 ; */
+    0x002c, /* 6 , */
+    0x003b, /* 6 ; */
+    0x002c, /* 7 , */
+    0x002d, /* 7 - */
+    0x002e, /* 7 . */
+    0x0034, /* 7 4 */
+    0x003b, /* 7 ; */
+    0x0041, /* 7 A */
+    0x004a, /* 7 J */
+    0x002c, /* 8 , */
+    0x003b, /* 8 ; */
+    0x0031, /* : 1 */
+    0x0034, /* : 4 */
+    0x0037, /* : 7 */
+    0x0054, /* : T */
+    0x0031, /* ; 1 */
+    0x0034, /* ; 4 */
+    0x0037, /* ; 7 */
+    0x0054, /* ; T */
+    0x0022, /* A " */
+    0x0027, /* A ' */
+    0x0031, /* A 1 */
+    0x0037, /* A 7 */
+    0x0054, /* A T */
+    0x0056, /* A V */
+    0x0057, /* A W */
+    0x0059, /* A Y */
+    0x0076, /* A v */
+    0x0077, /* A w */
+    0x0079, /* A y */
+    0x002c, /* C , */
+    0x002c, /* D , */
+    0x0034, /* E 4 */
+    0x0076, /* E v */
+    0x0077, /* E w */
+    0x0079, /* E y */
+    0x002c, /* F , */
+    0x002e, /* F . */
+    0x0034, /* F 4 */
+    0x003a, /* F : */
+    0x003b, /* F ; */
+    0x0041, /* F A */
+    0x004a, /* F J */
+    0x0076, /* F v */
+    0x0077, /* F w */
+    0x0079, /* F y */
+    0x007a, /* F z */
+    0x002d, /* K - */
+    0x0022, /* L " */
+    0x0027, /* L ' */
+    0x002d, /* L - */
+    0x0031, /* L 1 */
+    0x0034, /* L 4 */
+    0x0037, /* L 7 */
+    0x0054, /* L T */
+    0x0056, /* L V */
+    0x0057, /* L W */
+    0x0059, /* L Y */
+    0x0076, /* L v */
+    0x0077, /* L w */
+    0x0079, /* L y */
+    0x002c, /* O , */
+    0x002c, /* P , */
+    0x002e, /* P . */
+    0x0034, /* P 4 */
+    0x0041, /* P A */
+    0x004a, /* P J */
+    0x002c, /* T , */
+    0x002d, /* T - */
+    0x002e, /* T . */
+    0x0034, /* T 4 */
+    0x003a, /* T : */
+    0x003b, /* T ; */
+    0x0041, /* T A */
+    0x004a, /* T J */
+    0x0061, /* T a */
+    0x0063, /* T c */
+    0x0064, /* T d */
+    0x0065, /* T e */
+    0x0067, /* T g */
+    0x006d, /* T m */
+    0x006e, /* T n */
+    0x006f, /* T o */
+    0x0070, /* T p */
+    0x0071, /* T q */
+    0x0072, /* T r */
+    0x0073, /* T s */
+    0x0075, /* T u */
+    0x0076, /* T v */
+    0x0077, /* T w */
+    0x0078, /* T x */
+    0x0079, /* T y */
+    0x007a, /* T z */
+    0x002c, /* U , */
+    0x002c, /* V , */
+    0x002d, /* V - */
+    0x002e, /* V . */
+    0x0034, /* V 4 */
+    0x0041, /* V A */
+    0x004a, /* V J */
+    0x002c, /* W , */
+    0x002e, /* W . */
+    0x0041, /* W A */
+    0x002d, /* X - */
+    0x002c, /* Y , */
+    0x002d, /* Y - */
+    0x002e, /* Y . */
+    0x0034, /* Y 4 */
+    0x003b, /* Y ; */
+    0x0041, /* Y A */
+    0x004a, /* Y J */
+    0x002d, /* Z - */
+    0x0034, /* Z 4 */
+    0x0031, /* a 1 */
+    0x0037, /* a 7 */
+    0x0054, /* a T */
+    0x002c, /* b , */
+    0x0031, /* b 1 */
+    0x0037, /* b 7 */
+    0x003b, /* b ; */
+    0x0054, /* b T */
+    0x002d, /* c - */
+    0x0031, /* c 1 */
+    0x0037, /* c 7 */
+    0x0054, /* c T */
+    0x0031, /* e 1 */
+    0x0037, /* e 7 */
+    0x0054, /* e T */
+    0x002c, /* f , */
+    0x0031, /* g 1 */
+    0x0037, /* g 7 */
+    0x0054, /* g T */
+    0x0031, /* h 1 */
+    0x0037, /* h 7 */
+    0x0054, /* h T */
+    0x0056, /* h V */
+    0x0031, /* k 1 */
+    0x0037, /* k 7 */
+    0x0054, /* k T */
+    0x0031, /* m 1 */
+    0x0037, /* m 7 */
+    0x0054, /* m T */
+    0x0031, /* n 1 */
+    0x0037, /* n 7 */
+    0x0054, /* n T */
+    0x002c, /* o , */
+    0x0031, /* o 1 */
+    0x0037, /* o 7 */
+    0x003b, /* o ; */
+    0x0054, /* o T */
+    0x002c, /* p , */
+    0x0031, /* p 1 */
+    0x0037, /* p 7 */
+    0x003b, /* p ; */
+    0x0054, /* p T */
+    0x0031, /* q 1 */
+    0x0037, /* q 7 */
+    0x0054, /* q T */
+    0x002c, /* r , */
+    0x002d, /* r - */
+    0x002e, /* r . */
+    0x0031, /* r 1 */
+    0x0034, /* r 4 */
+    0x0037, /* r 7 */
+    0x0041, /* r A */
+    0x004a, /* r J */
+    0x0054, /* r T */
+    0x005a, /* r Z */
+    0x0031, /* s 1 */
+    0x0037, /* s 7 */
+    0x0054, /* s T */
+    0x0031, /* u 1 */
+    0x0037, /* u 7 */
+    0x0054, /* u T */
+    0x002c, /* v , */
+    0x002e, /* v . */
+    0x0031, /* v 1 */
+    0x0037, /* v 7 */
+    0x0041, /* v A */
+    0x0054, /* v T */
+    0x002c, /* w , */
+    0x0031, /* w 1 */
+    0x0037, /* w 7 */
+    0x0054, /* w T */
+    0x0031, /* x 1 */
+    0x0037, /* x 7 */
+    0x0054, /* x T */
+    0x002c, /* y , */
+    0x002e, /* y . */
+    0x0031, /* y 1 */
+    0x0037, /* y 7 */
+    0x0041, /* y A */
+    0x0054, /* y T */
+    0x0031, /* z 1 */
+    0x0034, /* z 4 */
+    0x0037, /* z 7 */
+    0x0054, /* z T */
+};
+
+static const int8_t _fonts_roboto_10pt_kern_adjust[] = {
+    -2, -2, -5, -2, -2, -5, -2, -4, -2, -3, -3, -2, -2, -2, -2, -2,
+    -2, -2, -3, -2, -2, -2, -4, -2, -3, -3, -2, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -3, -3, -3, -2, -3,
+    -3, -2, -2, -2, -2, -2, -3, -2, -2, -2, -3, -2, -2, -2, -2, -3,
+    -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -6, -5, -2, -5,
+    -6, -3, -5, -2, -2, -2, -2, -2, -5, -5, -5, -2, -4, -2, -3, -3,
+    -2, -2, -2, -2, -2, -2, -7, -6, -2, -2, -5, -4, -3, -3, -3, -3,
+    -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3,
+    -3, -3, -3, -3, -3, -2, -4, -2, -3, -2, -3, -2, -3, -2, -2, -2,
+    -4, -3, -3, -3, -2, -3, -3, -3, -3, -2, -2, -3, -2, -2, -2, -2,
+    -3, -4, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -2, -3, -2,
+    -2, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -2, -3, -2, -2,
+    -2, -2, -3, -2, -2, -3, -3, -2, -2, -2, -2, -3, -2, -2, -3, -2,
+    -2, -2, -3, -2, -2, -3, -3, -2, -2, -2, -2, -3, -2, -2, -2, -3,
+    -2, -2, -3, -2, -2, -2, -2, -2, -3, -2, -2, -2, -3,
 };
 
-// Character descriptors for Roboto 10pt
-// { [Char width in bits], [Offset into roboto_10ptCharBitmaps in bytes] }
-const font_char_desc_t _fonts_roboto_10pt_descriptors[] =
+static const font_kerning_t _fonts_roboto_10pt_kerning =
 {
-	{1, 0}, 		// ! 
-	{3, 14}, 		// " 
-	{8, 28}, 		// # 
-	{6, 42}, 		// $ 
-	{8, 56}, 		// % 
-	{8, 70}, 		// & 
-	{1, 84}, 		// ' 
-	{3, 98}, 		// ( 
-	{3, 112}, 		// ) 
-	{4, 126}, 		// * 
-	{7, 140}, 		// + 
-	{2, 154}, 		// , 
-	{4, 168}, 		// - 
-	{1, 182}, 		// . 
-	{5, 196}, 		// / 
-	{6, 210}, 		// 0 
-	{4, 224}, 		// 1 
-	{6, 238}, 		// 2 
-	{6, 252}, 		// 3 
-	{7, 266}, 		// 4 
-	{6, 280}, 		// 5 
-	{6, 294}, 		// 6 
-	{6, 308}, 		// 7 
-	{6, 322}, 		// 8 
-	{5, 336}, 		// 9 
-	{1, 350}, 		// : 
-	{2, 364}, 		// ; 
-	{6, 378}, 		// < 
-	{5, 392}, 		// = 
-	{5, 406}, 		// > 
-	{6, 420}, 		// ? 
-	{10, 434}, 		// @ 
-	{8, 462}, 		// A 
-	{7, 476}, 		// B 
-	{7, 490}, 		// C 
-	{7, 504}, 		// D 
-	{6, 518}, 		// E 
-	{6, 532}, 		// F 
-	{7, 546}, 		// G 
-	{7, 560}, 		// H 
-	{1, 574}, 		// I 
-	{6, 588}, 		// J 
-	{7, 602}, 		// K 
-	{6, 616}, 		// L 
-	{9, 630}, 		// M 
-	{7, 658}, 		// N 
-	{7, 672}, 		// O 
-	{7, 686}, 		// P 
-	{7, 700}, 		// Q 
-	{6, 714}, 		// R 
-	{6, 728}, 		// S 
-	{8, 742}, 		// T 
-	{7, 756}, 		// U 
-	{8, 770}, 		// V 
-	{11, 784}, 		// W 
-	{7, 812}, 		// X 
-	{7, 826}, 		// Y 
-	{6, 840}, 		// Z 
-	{2, 854}, 		// [ 
-	{5, 868}, 		/*  \  */
-	{3, 882}, 		// ] 
-	{5, 896}, 		// ^ 
-	{6, 910}, 		// _ 
-	{2, 924}, 		// ` 
-	{5, 938}, 		// a 
-	{6, 952}, 		// b 
-	{5, 966}, 		// c 
-	{5, 980}, 		// d 
-	{5, 994}, 		// e 
-	{4, 1008}, 		// f 
-	{6, 1022}, 		// g 
-	{6, 1036}, 		// h 
-	{1, 1050}, 		// i 
-	{2, 1064}, 		// j 
-	{5, 1078}, 		// k 
-	{1, 1092}, 		// l 
-	{9, 1106}, 		// m 
-	{5, 1134}, 		// n 
-	{6, 1148}, 		// o 
-	{6, 1162}, 		// p 
-	{5, 1176}, 		// q 
-	{3, 1190}, 		// r 
-	{5, 1204}, 		// s 
-	{4, 1218}, 		// t 
-	{5, 1232}, 		// u 
-	{6, 1246}, 		// v 
-	{9, 1260}, 		// w 
-	{5, 1288}, 		// x 
-	{6, 1302}, 		// y 
-	{5, 1316}, 		// z 
-	{4, 1330}, 		// { 
-	{1, 1344}, 		// | 
-	{4, 1358}, 		// } 
-	{7, 1372}, 		// ~ 
+    .num_lefts        = 52, /* Left characters */
+    .lefts            = _fonts_roboto_10pt_kern_lefts, /* Pairs of each left character */
+    .rights           = _fonts_roboto_10pt_kern_rights, /* Right character of each pair */
+    .adjust           = _fonts_roboto_10pt_kern_adjust, /* Added to the space of each pair */
 };
 
-// Font information for Roboto 10pt
 const font_info_t _fonts_roboto_10pt_info =
 {
-    .height           = 14,                              //  Character height
-    .c                = '!',                            //  Start character
-    .char_start       = '~',                            //  End character
-    .char_end         = 2,                              //  Width, in pixels, of space character
-    .char_descriptors = _fonts_roboto_10pt_descriptors, //  Character descriptor array
-    .bitmap           = _fonts_roboto_10pt_bitmaps,     //  Character bitmap array
+    .height           = 14, /* Character height */
+    .c                = 1, /* C */
+    .char_start       = 32, /* Start character */
+    .char_end         = 126, /* End character */
+    .char_descriptors = _fonts_roboto_10pt_descriptors, /* Character descriptor array */
+    .bitmap           = _fonts_roboto_10pt_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_PAGES, /* Flags */
+    .kerning          = &_fonts_roboto_10pt_kerning, /* 237 kerning pairs */
 };
 
 #endif /* _EXTRAS_FONTS_FONT_ROBOTO_10PT_H_ */
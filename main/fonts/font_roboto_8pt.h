@@ -1,1348 +1,1909 @@
-/*
- *  Font data for Roboto 8pt
+/**
+ * This file contains generated binary font data.
  *
- *  FIXME: Add license information
+ * Font:    roboto_8pt
+ * Height:  11
+ * Layout:  page-native
+ * 95 characters (32..126)
+ * 201 kerning pairs of 39 left characters
+ * 1 glyph identical to an earlier one, stored once
  *
- *      Author: zaltora
+ * Roboto 8 pt, converted from TheDotFactory tables by zaltora
+ * FIXME: Add license information
+ *
+ * Source:  ../../main/fonts/src/roboto_8pt.bdf
+ * Generated by tools/fontc, do not edit. Command:
+ *     fontc -n roboto_8pt -c 1 --kern 2 -o ../../main/fonts/font_roboto_8pt.h ../../main/fonts/src/roboto_8pt.bdf
  */
 #ifndef _EXTRAS_FONTS_FONT_ROBOTO_8PT_H_
 #define _EXTRAS_FONTS_FONT_ROBOTO_8PT_H_
 
-// Character bitmaps for Roboto 8pt
-const uint8_t _fonts_roboto_8pt_bitmaps[] =
-{
-	// @0 '!' (1 pixels wide)
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x00, //  
-	0x00, //  
-
-	// @11 '"' (2 pixels wide)
-	0x00, //   
-	0xC0, // ##
-	0xC0, // ##
-	0x40, //  #
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-
-	// @22 '#' (6 pixels wide)
-	0x00, //       
-	0x04, //      #
-	0x20, //   #   
-	0x7C, //  #####
-	0x28, //   # # 
-	0x28, //   # # 
-	0xFC, // ######
-	0x40, //  #    
-	0x50, //  # #  
-	0x00, //       
-	0x00, //       
-
-	// @33 '$' (5 pixels wide)
-	0x20, //   #  
-	0x70, //  ### 
-	0x98, // #  ##
-	0x80, // #    
-	0xC0, // ##   
-	0x30, //   ## 
-	0x08, //     #
-	0x98, // #  ##
-	0x70, //  ### 
-	0x20, //   #  
-	0x00, //      
-
-	// @44 '%' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x28, //   # #  
-	0x28, //   # #  
-	0xD0, // ## #   
-	0x2C, //   # ## 
-	0x32, //   ##  #
-	0x52, //  # #  #
-	0x0C, //     ## 
-	0x00, //        
-	0x00, //        
-
-	// @55 '&' (6 pixels wide)
-	0x00, //       
-	0x30, //   ##  
-	0x48, //  #  # 
-	0x58, //  # ## 
-	0x20, //   #   
-	0x54, //  # # #
-	0x8C, // #   ##
-	0xCC, // ##  ##
-	0x7C, //  #####
-	0x00, //       
-	0x00, //       
-
-	// @66 ''' (1 pixels wide)
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-
-	// @77 '(' (3 pixels wide)
-	0x40, //  # 
-	0x40, //  # 
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x40, //  # 
-	0x20, //   #
-
-	// @88 ')' (3 pixels wide)
-	0x80, // #  
-	0x40, //  # 
-	0x40, //  # 
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x40, //  # 
-	0x40, //  # 
-	0x80, // #  
-
-	// @99 '*' (3 pixels wide)
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x40, //  # 
-	0xE0, // ###
-	0xC0, // ## 
-	0x80, // #  
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-
-	// @110 '+' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x10, //    #  
-	0x10, //    #  
-	0xFC, // ######
-	0x10, //    #  
-	0x10, //    #  
-	0x10, //    #  
-	0x00, //       
-	0x00, //       
-	0x00, //       
-
-	// @121 ',' (2 pixels wide)
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x40, //  #
-	0x40, //  #
-	0x80, // # 
-	0x00, //   
-
-	// @132 '-' (3 pixels wide)
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0xE0, // ###
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-
-	// @143 '.' (1 pixels wide)
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x00, //  
-	0x00, //  
-
-	// @154 '/' (4 pixels wide)
-	0x00, //     
-	0x10, //    #
-	0x10, //    #
-	0x20, //   # 
-	0x20, //   # 
-	0x20, //   # 
-	0x40, //  #  
-	0x40, //  #  
-	0x80, // #   
-	0x80, // #   
-	0x00, //     
-
-	// @165 '0' (5 pixels wide)
-	0x00, //      
-	0x70, //  ### 
-	0x90, // #  # 
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x90, // #  # 
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @176 '1' (3 pixels wide)
-	0x00, //    
-	0xE0, // ###
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x20, //   #
-	0x00, //    
-	0x00, //    
-
-	// @187 '2' (5 pixels wide)
-	0x00, //      
-	0x70, //  ### 
-	0x90, // #  # 
-	0x10, //    # 
-	0x10, //    # 
-	0x20, //   #  
-	0x40, //  #   
-	0xC0, // ##   
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-
-	// @198 '3' (5 pixels wide)
-	0x00, //      
-	0x70, //  ### 
-	0x90, // #  # 
-	0x10, //    # 
-	0x70, //  ### 
-	0x10, //    # 
-	0x08, //     #
-	0x90, // #  # 
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @209 '4' (6 pixels wide)
-	0x00, //       
-	0x18, //    ## 
-	0x18, //    ## 
-	0x28, //   # # 
-	0x28, //   # # 
-	0x48, //  #  # 
-	0xFC, // ######
-	0x08, //     # 
-	0x08, //     # 
-	0x00, //       
-	0x00, //       
-
-	// @220 '5' (5 pixels wide)
-	0x00, //      
-	0xF0, // #### 
-	0x80, // #    
-	0x80, // #    
-	0xF0, // #### 
-	0x18, //    ##
-	0x08, //     #
-	0x90, // #  # 
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @231 '6' (5 pixels wide)
-	0x00, //      
-	0x70, //  ### 
-	0x80, // #    
-	0x80, // #    
-	0xF0, // #### 
-	0x98, // #  ##
-	0x88, // #   #
-	0x98, // #  ##
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @242 '7' (5 pixels wide)
-	0x00, //      
-	0xF8, // #####
-	0x10, //    # 
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x40, //  #   
-	0x40, //  #   
-	0x40, //  #   
-	0x00, //      
-	0x00, //      
-
-	// @253 '8' (5 pixels wide)
-	0x00, //      
-	0xF0, // #### 
-	0x90, // #  # 
-	0x90, // #  # 
-	0xF0, // #### 
-	0x90, // #  # 
-	0x88, // #   #
-	0x98, // #  ##
-	0xF0, // #### 
-	0x00, //      
-	0x00, //      
-
-	// @264 '9' (4 pixels wide)
-	0x00, //     
-	0xE0, // ### 
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0xF0, // ####
-	0x10, //    #
-	0x10, //    #
-	0xE0, // ### 
-	0x00, //     
-	0x00, //     
-
-	// @275 ':' (1 pixels wide)
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x00, //  
-	0x80, // #
-	0x00, //  
-	0x00, //  
-
-	// @286 ';' (2 pixels wide)
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x40, //  #
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x40, //  #
-	0x40, //  #
-	0x80, // # 
-	0x00, //   
-
-	// @297 '<' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x30, //   ##
-	0xC0, // ##  
-	0xC0, // ##  
-	0x30, //   ##
-	0x00, //     
-	0x00, //     
-	0x00, //     
-
-	// @308 '=' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0xF0, // ####
-	0x00, //     
-	0xF0, // ####
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-
-	// @319 '>' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0xC0, // ##  
-	0x30, //   ##
-	0x30, //   ##
-	0xC0, // ##  
-	0x00, //     
-	0x00, //     
-	0x00, //     
-
-	// @330 '?' (5 pixels wide)
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x08, //     #
-	0x10, //    # 
-	0x30, //   ## 
-	0x20, //   #  
-	0x00, //      
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @341 '@' (8 pixels wide)
-	0x00, //         
-	0x3C, //   ####  
-	0x42, //  #    # 
-	0x89, // #   #  #
-	0xB4, // # ## #  
-	0x24, //   #  #  
-	0x24, //   #  #  
-	0x25, //   #  # #
-	0xBE, // # ##### 
-	0x40, //  #      
-	0x3C, //   ####  
-
-	// @352 'A' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x28, //   # #  
-	0x28, //   # #  
-	0x6C, //  ## ## 
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x86, // #    ##
-	0x00, //        
-	0x00, //        
-
-	// @363 'B' (6 pixels wide)
-	0x00, //       
-	0xF0, // ####  
-	0x88, // #   # 
-	0x88, // #   # 
-	0xF0, // ####  
-	0x88, // #   # 
-	0x84, // #    #
-	0x88, // #   # 
-	0xF8, // ##### 
-	0x00, //       
-	0x00, //       
-
-	// @374 'C' (6 pixels wide)
-	0x00, //       
-	0x70, //  ###  
-	0x88, // #   # 
-	0x8C, // #   ##
-	0x80, // #     
-	0x80, // #     
-	0x8C, // #   ##
-	0x88, // #   # 
-	0x70, //  ###  
-	0x00, //       
-	0x00, //       
-
-	// @385 'D' (6 pixels wide)
-	0x00, //       
-	0xF0, // ####  
-	0x88, // #   # 
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x88, // #   # 
-	0xF0, // ####  
-	0x00, //       
-	0x00, //       
-
-	// @396 'E' (5 pixels wide)
-	0x00, //      
-	0xF8, // #####
-	0x80, // #    
-	0x80, // #    
-	0xF0, // #### 
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-
-	// @407 'F' (5 pixels wide)
-	0x00, //      
-	0xF8, // #####
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x00, //      
-	0x00, //      
-
-	// @418 'G' (6 pixels wide)
-	0x00, //       
-	0x78, //  #### 
-	0x88, // #   # 
-	0x80, // #     
-	0x80, // #     
-	0x9C, // #  ###
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0x78, //  #### 
-	0x00, //       
-	0x00, //       
-
-	// @429 'H' (6 pixels wide)
-	0x00, //       
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0xFC, // ######
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x00, //       
-	0x00, //       
-
-	// @440 'I' (1 pixels wide)
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-	0x00, //  
-
-	// @451 'J' (5 pixels wide)
-	0x00, //      
-	0x08, //     #
-	0x08, //     #
-	0x08, //     #
-	0x08, //     #
-	0x08, //     #
-	0x08, //     #
-	0xC8, // ##  #
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @462 'K' (5 pixels wide)
-	0x00, //      
-	0x88, // #   #
-	0x90, // #  # 
-	0xB0, // # ## 
-	0xE0, // ###  
-	0xA0, // # #  
-	0x90, // #  # 
-	0x98, // #  ##
-	0x88, // #   #
-	0x00, //      
-	0x00, //      
-
-	// @473 'L' (5 pixels wide)
-	0x00, //      
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0x80, // #    
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-
-	// @484 'M' (8 pixels wide)
-	0x00, //         
-	0x83, // #     ##
-	0xC3, // ##    ##
-	0xC5, // ##   # #
-	0xA5, // # #  # #
-	0xA5, // # #  # #
-	0xA9, // # # #  #
-	0x99, // #  ##  #
-	0x91, // #  #   #
-	0x00, //         
-	0x00, //         
-
-	// @495 'N' (6 pixels wide)
-	0x00, //       
-	0x84, // #    #
-	0xC4, // ##   #
-	0xE4, // ###  #
-	0xA4, // # #  #
-	0x94, // #  # #
-	0x94, // #  # #
-	0x8C, // #   ##
-	0x8C, // #   ##
-	0x00, //       
-	0x00, //       
-
-	// @506 'O' (6 pixels wide)
-	0x00, //       
-	0x70, //  ###  
-	0x88, // #   # 
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x88, // #   # 
-	0x70, //  ###  
-	0x00, //       
-	0x00, //       
-
-	// @517 'P' (6 pixels wide)
-	0x00, //       
-	0xF8, // ##### 
-	0x88, // #   # 
-	0x8C, // #   ##
-	0x88, // #   # 
-	0xF0, // ####  
-	0x80, // #     
-	0x80, // #     
-	0x80, // #     
-	0x00, //       
-	0x00, //       
-
-	// @528 'Q' (6 pixels wide)
-	0x00, //       
-	0x70, //  ###  
-	0x88, // #   # 
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x88, // #   # 
-	0x7C, //  #####
-	0x04, //      #
-	0x00, //       
-
-	// @539 'R' (5 pixels wide)
-	0x00, //      
-	0xF0, // #### 
-	0x88, // #   #
-	0x88, // #   #
-	0x98, // #  ##
-	0xF8, // #####
-	0x88, // #   #
-	0x88, // #   #
-	0x88, // #   #
-	0x00, //      
-	0x00, //      
-
-	// @550 'S' (5 pixels wide)
-	0x00, //      
-	0x70, //  ### 
-	0x88, // #   #
-	0x80, // #    
-	0xE0, // ###  
-	0x18, //    ##
-	0x08, //     #
-	0x88, // #   #
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @561 'T' (6 pixels wide)
-	0x00, //       
-	0xFC, // ######
-	0x10, //    #  
-	0x10, //    #  
-	0x10, //    #  
-	0x10, //    #  
-	0x10, //    #  
-	0x10, //    #  
-	0x10, //    #  
-	0x00, //       
-	0x00, //       
-
-	// @572 'U' (6 pixels wide)
-	0x00, //       
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x84, // #    #
-	0x88, // #   # 
-	0x78, //  #### 
-	0x00, //       
-	0x00, //       
-
-	// @583 'V' (7 pixels wide)
-	0x00, //        
-	0x82, // #     #
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x4C, //  #  ## 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x20, //   #    
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-
-	// @594 'W' (9 pixels wide)
-	0x00, 0x00, //          
-	0x88, 0x80, // #   #   #
-	0x4C, 0x80, //  #  ##  #
-	0x4C, 0x80, //  #  ##  #
-	0x55, 0x00, //  # # # # 
-	0x55, 0x00, //  # # # # 
-	0x73, 0x00, //  ###  ## 
-	0x23, 0x00, //   #   ## 
-	0x23, 0x00, //   #   ## 
-	0x00, 0x00, //          
-	0x00, 0x00, //          
-
-	// @616 'X' (5 pixels wide)
-	0x00, //      
-	0x88, // #   #
-	0xD8, // ## ##
-	0x50, //  # # 
-	0x20, //   #  
-	0x20, //   #  
-	0x50, //  # # 
-	0xD8, // ## ##
-	0x88, // #   #
-	0x00, //      
-	0x00, //      
-
-	// @627 'Y' (6 pixels wide)
-	0x00, //       
-	0xC4, // ##   #
-	0x44, //  #   #
-	0x28, //   # # 
-	0x28, //   # # 
-	0x10, //    #  
-	0x10, //    #  
-	0x10, //    #  
-	0x10, //    #  
-	0x00, //       
-	0x00, //       
-
-	// @638 'Z' (5 pixels wide)
-	0x00, //      
-	0xF8, // #####
-	0x10, //    # 
-	0x10, //    # 
-	0x20, //   #  
-	0x40, //  #   
-	0x40, //  #   
-	0x80, // #    
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-
-	// @649 '[' (2 pixels wide)
-	0xC0, // ##
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0x80, // # 
-	0xC0, // ##
-
-	// @660 '\' (4 pixels wide)
-	0x00, //     
-	0x80, // #   
-	0x40, //  #  
-	0x40, //  #  
-	0x20, //   # 
-	0x20, //   # 
-	0x20, //   # 
-	0x10, //    #
-	0x10, //    #
-	0x10, //    #
-	0x00, //     
-
-	// @671 ']' (2 pixels wide)
-	0xC0, // ##
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0xC0, // ##
-
-	// @682 '^' (3 pixels wide)
-	0x00, //    
-	0x40, //  # 
-	0xC0, // ## 
-	0xA0, // # #
-	0xA0, // # #
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0x00, //    
-
-	// @693 '_' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0xF8, // #####
-	0x00, //      
-
-	// @704 '`' (2 pixels wide)
-	0x00, //   
-	0x80, // # 
-	0x40, //  #
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-	0x00, //   
-
-	// @715 'a' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x70, //  ###
-	0x90, // #  #
-	0x30, //   ##
-	0x90, // #  #
-	0x90, // #  #
-	0xF0, // ####
-	0x00, //     
-	0x00, //     
-
-	// @726 'b' (5 pixels wide)
-	0x00, //      
-	0x80, // #    
-	0x80, // #    
-	0xF0, // #### 
-	0x90, // #  # 
-	0x88, // #   #
-	0x88, // #   #
-	0x98, // #  ##
-	0xF0, // #### 
-	0x00, //      
-	0x00, //      
-
-	// @737 'c' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x70, //  ###
-	0x90, // #  #
-	0x80, // #   
-	0x80, // #   
-	0x90, // #  #
-	0x70, //  ###
-	0x00, //     
-	0x00, //     
-
-	// @748 'd' (4 pixels wide)
-	0x00, //     
-	0x10, //    #
-	0x10, //    #
-	0xF0, // ####
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0xE0, // ### 
-	0x00, //     
-	0x00, //     
-
-	// @759 'e' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x70, //  ###
-	0x90, // #  #
-	0xF0, // ####
-	0x80, // #   
-	0x80, // #   
-	0x70, //  ###
-	0x00, //     
-	0x00, //     
-
-	// @770 'f' (4 pixels wide)
-	0x00, //     
-	0x30, //   ##
-	0x40, //  #  
-	0xE0, // ### 
-	0x40, //  #  
-	0x40, //  #  
-	0x40, //  #  
-	0x40, //  #  
-	0x40, //  #  
-	0x00, //     
-	0x00, //     
-
-	// @781 'g' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0xE8, // ### #
-	0x98, // #  ##
-	0x98, // #  ##
-	0x98, // #  ##
-	0x98, // #  ##
-	0xF8, // #####
-	0x10, //    # 
-	0xF0, // #### 
-
-	// @792 'h' (5 pixels wide)
-	0x00, //      
-	0x80, // #    
-	0x80, // #    
-	0xF0, // #### 
-	0x90, // #  # 
-	0x98, // #  ##
-	0x98, // #  ##
-	0x98, // #  ##
-	0x98, // #  ##
-	0x00, //      
-	0x00, //      
-
-	// @803 'i' (1 pixels wide)
-	0x00, //  
-	0x80, // #
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-	0x00, //  
-
-	// @814 'j' (2 pixels wide)
-	0x00, //   
-	0x40, //  #
-	0x00, //   
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0x40, //  #
-	0xC0, // ##
-
-	// @825 'k' (4 pixels wide)
-	0x00, //     
-	0x80, // #   
-	0x80, // #   
-	0x90, // #  #
-	0xA0, // # # 
-	0xC0, // ##  
-	0xA0, // # # 
-	0xA0, // # # 
-	0x90, // #  #
-	0x00, //     
-	0x00, //     
-
-	// @836 'l' (1 pixels wide)
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-	0x00, //  
-
-	// @847 'm' (8 pixels wide)
-	0x00, //         
-	0x00, //         
-	0x00, //         
-	0xF6, // #### ## 
-	0x99, // #  ##  #
-	0x91, // #  #   #
-	0x91, // #  #   #
-	0x91, // #  #   #
-	0x91, // #  #   #
-	0x00, //         
-	0x00, //         
-
-	// @858 'n' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0xF0, // ####
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0x00, //     
-	0x00, //     
-
-	// @869 'o' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x90, // #  # 
-	0x88, // #   #
-	0x88, // #   #
-	0x90, // #  # 
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @880 'p' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0xF0, // #### 
-	0x90, // #  # 
-	0x88, // #   #
-	0x88, // #   #
-	0x98, // #  ##
-	0xF0, // #### 
-	0x80, // #    
-	0x80, // #    
-
-	// @891 'q' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0xF0, // ####
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0xF0, // ####
-	0x10, //    #
-	0x10, //    #
-
-	// @902 'r' (3 pixels wide)
-	0x00, //    
-	0x00, //    
-	0x00, //    
-	0xE0, // ###
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x80, // #  
-	0x00, //    
-	0x00, //    
-
-	// @913 's' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0xE0, // ### 
-	0x90, // #  #
-	0xC0, // ##  
-	0x30, //   ##
-	0x90, // #  #
-	0xF0, // ####
-	0x00, //     
-	0x00, //     
-
-	// @924 't' (3 pixels wide)
-	0x00, //    
-	0x40, //  # 
-	0x40, //  # 
-	0xE0, // ###
-	0x40, //  # 
-	0x40, //  # 
-	0x40, //  # 
-	0x40, //  # 
-	0x60, //  ##
-	0x00, //    
-	0x00, //    
-
-	// @935 'u' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0x90, // #  #
-	0xF0, // ####
-	0x00, //     
-	0x00, //     
-
-	// @946 'v' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x88, // #   #
-	0x48, //  #  #
-	0x50, //  # # 
-	0x10, //    # 
-	0x30, //   ## 
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @957 'w' (8 pixels wide)
-	0x00, //         
-	0x00, //         
-	0x00, //         
-	0x89, // #   #  #
-	0x59, //  # ##  #
-	0x5A, //  # ## # 
-	0x56, //  # # ## 
-	0x66, //  ##  ## 
-	0x26, //   #  ## 
-	0x00, //         
-	0x00, //         
-
-	// @968 'x' (4 pixels wide)
-	0x00, //     
-	0x00, //     
-	0x00, //     
-	0x90, // #  #
-	0xA0, // # # 
-	0x60, //  ## 
-	0x60, //  ## 
-	0xA0, // # # 
-	0x90, // #  #
-	0x00, //     
-	0x00, //     
-
-	// @979 'y' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x88, // #   #
-	0x48, //  #  #
-	0x50, //  # # 
-	0x70, //  ### 
-	0x30, //   ## 
-	0x20, //   #  
-	0x20, //   #  
-	0x40, //  #   
-
-	// @990 'z' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x78, //  ####
-	0x10, //    # 
-	0x30, //   ## 
-	0x20, //   #  
-	0x40, //  #   
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-
-	// @1001 '{' (3 pixels wide)
-	0x00, //    
-	0x20, //   #
-	0x60, //  ##
-	0x60, //  ##
-	0x40, //  # 
-	0xC0, // ## 
-	0x40, //  # 
-	0x60, //  ##
-	0x60, //  ##
-	0x20, //   #
-	0x00, //    
-
-	// @1012 '|' (1 pixels wide)
-	0x00, //  
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x80, // #
-	0x00, //  
-
-	// @1023 '}' (3 pixels wide)
-	0x80, // #  
-	0x40, //  # 
-	0x40, //  # 
-	0x40, //  # 
-	0x40, //  # 
-	0x20, //   #
-	0x40, //  # 
-	0x40, //  # 
-	0x40, //  # 
-	0x40, //  # 
-	0x80, // #  
-
-	// @1034 '~' (6 pixels wide)
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0xE4, // ###  #
-	0x18, //    ## 
-	0x00, //       
-	0x00, //       
-	0x00, //       
-	0x00, //       
+static const uint8_t _fonts_roboto_8pt_bitmaps[] = {
+
+    /* Index: 0x00, char: \x20, offset: 0x0000
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     */
+    0x00, 0x00,
+    0x00, 0x00,
+
+    /* Index: 0x01, char: !, offset: 0x0004
+     * .
+     * #
+     * #
+     * #
+     * #
+     * #
+     * .
+     * .
+     * #
+     * .
+     * .
+     */
+    0x3e,
+    0x01,
+
+    /* Index: 0x02, char: ", offset: 0x0006
+     * ..
+     * ##
+     * ##
+     * .#
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     */
+    0x06, 0x0e,
+    0x00, 0x00,
+
+    /* Index: 0x03, char: #, offset: 0x000a
+     * ......
+     * .....#
+     * ..#...
+     * .#####
+     * ..#.#.
+     * ..#.#.
+     * ######
+     * .#....
+     * .#.#..
+     * ......
+     * ......
+     */
+    0x40, 0xc8, 0x7c, 0x48, 0x78, 0x4a,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+
+    /* Index: 0x04, char: $, offset: 0x0016
+     * ..#..
+     * .###.
+     * #..##
+     * #....
+     * ##...
+     * ..##.
+     * ....#
+     * #..##
+     * .###.
+     * ..#..
+     * .....
+     */
+    0x9c, 0x12, 0x23, 0xa6, 0xc4,
+    0x00, 0x01, 0x03, 0x01, 0x00,
+
+    /* Index: 0x05, char: %, offset: 0x0020
+     * .......
+     * ##.....
+     * ..#.#..
+     * ..#.#..
+     * ##.#...
+     * ..#.##.
+     * ..##..#
+     * .#.#..#
+     * ....##.
+     * .......
+     * .......
+     */
+    0x12, 0x92, 0x6c, 0xd0, 0x2c, 0x20, 0xc0,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+
+    /* Index: 0x06, char: &, offset: 0x002e
+     * ......
+     * ..##..
+     * .#..#.
+     * .#.##.
+     * ..#...
+     * .#.#.#
+     * #...##
+     * ##..##
+     * .#####
+     * ......
+     * ......
+     */
+    0xc0, 0xac, 0x12, 0x2a, 0xcc, 0xe0,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+
+    /* Index: 0x07, char: ', offset: 0x003a
+     * .
+     * #
+     * #
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     */
+    0x06,
+    0x00,
+
+    /* Index: 0x08, char: (, offset: 0x003c
+     * .#.
+     * .#.
+     * #..
+     * #..
+     * #..
+     * #..
+     * #..
+     * #..
+     * #..
+     * .#.
+     * ..#
+     */
+    0xfc, 0x03, 0x00,
+    0x01, 0x02, 0x04,
+
+    /* Index: 0x09, char: ), offset: 0x0042
+     * #..
+     * .#.
+     * .#.
+     * ..#
+     * ..#
+     * ..#
+     * ..#
+     * ..#
+     * .#.
+     * .#.
+     * #..
+     */
+    0x01, 0x06, 0xf8,
+    0x04, 0x03, 0x00,
+
+    /* Index: 0x0a, char: \x2a, offset: 0x0048
+     * ...
+     * ...
+     * ...
+     * .#.
+     * ###
+     * ##.
+     * #..
+     * ...
+     * ...
+     * ...
+     * ...
+     */
+    0x70, 0x38, 0x10,
+    0x00, 0x00, 0x00,
+
+    /* Index: 0x0b, char: +, offset: 0x004e
+     * ......
+     * ......
+     * ...#..
+     * ...#..
+     * ######
+     * ...#..
+     * ...#..
+     * ...#..
+     * ......
+     * ......
+     * ......
+     */
+    0x10, 0x10, 0x10, 0xfc, 0x10, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x0c, char: ,, offset: 0x005a
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * .#
+     * .#
+     * #.
+     * ..
+     */
+    0x00, 0x80,
+    0x02, 0x01,
+
+    /* Index: 0x0d, char: -, offset: 0x005e
+     * ...
+     * ...
+     * ...
+     * ...
+     * ...
+     * ###
+     * ...
+     * ...
+     * ...
+     * ...
+     * ...
+     */
+    0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00,
+
+    /* Index: 0x0e, char: ., offset: 0x0064
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * .
+     * #
+     * .
+     * .
+     */
+    0x00,
+    0x01,
+
+    /* Index: 0x0f, char: \x2f, offset: 0x0066
+     * ....
+     * ...#
+     * ...#
+     * ..#.
+     * ..#.
+     * ..#.
+     * .#..
+     * .#..
+     * #...
+     * #...
+     * ....
+     */
+    0x00, 0xc0, 0x38, 0x06,
+    0x03, 0x00, 0x00, 0x00,
+
+    /* Index: 0x10, char: 0, offset: 0x006e
+     * .....
+     * .###.
+     * #..#.
+     * #...#
+     * #...#
+     * #...#
+     * #...#
+     * #..#.
+     * .###.
+     * .....
+     * .....
+     */
+    0xfc, 0x02, 0x02, 0x86, 0x78,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x11, char: 1, offset: 0x0078
+     * ...
+     * ###
+     * ..#
+     * ..#
+     * ..#
+     * ..#
+     * ..#
+     * ..#
+     * ..#
+     * ...
+     * ...
+     */
+    0x02, 0x02, 0xfe,
+    0x00, 0x00, 0x01,
+
+    /* Index: 0x12, char: 2, offset: 0x007e
+     * .....
+     * .###.
+     * #..#.
+     * ...#.
+     * ...#.
+     * ..#..
+     * .#...
+     * ##...
+     * #####
+     * .....
+     * .....
+     */
+    0x84, 0xc2, 0x22, 0x1e, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+
+    /* Index: 0x13, char: 3, offset: 0x0088
+     * .....
+     * .###.
+     * #..#.
+     * ...#.
+     * .###.
+     * ...#.
+     * ....#
+     * #..#.
+     * .###.
+     * .....
+     * .....
+     */
+    0x84, 0x12, 0x12, 0xbe, 0x40,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x14, char: 4, offset: 0x0092
+     * ......
+     * ...##.
+     * ...##.
+     * ..#.#.
+     * ..#.#.
+     * .#..#.
+     * ######
+     * ....#.
+     * ....#.
+     * ......
+     * ......
+     */
+    0x40, 0x60, 0x58, 0x46, 0xfe, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+
+    /* Index: 0x15, char: 5, offset: 0x009e
+     * .....
+     * ####.
+     * #....
+     * #....
+     * ####.
+     * ...##
+     * ....#
+     * #..#.
+     * .###.
+     * .....
+     * .....
+     */
+    0x9e, 0x12, 0x12, 0xb2, 0x60,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x16, char: 6, offset: 0x00a8
+     * .....
+     * .###.
+     * #....
+     * #....
+     * ####.
+     * #..##
+     * #...#
+     * #..##
+     * .###.
+     * .....
+     * .....
+     */
+    0xfc, 0x12, 0x12, 0xb2, 0xe0,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x17, char: 7, offset: 0x00b2
+     * .....
+     * #####
+     * ...#.
+     * ..#..
+     * ..#..
+     * ..#..
+     * .#...
+     * .#...
+     * .#...
+     * .....
+     * .....
+     */
+    0x02, 0xc2, 0x3a, 0x06, 0x02,
+    0x00, 0x01, 0x00, 0x00, 0x00,
+
+    /* Index: 0x18, char: 8, offset: 0x00bc
+     * .....
+     * ####.
+     * #..#.
+     * #..#.
+     * ####.
+     * #..#.
+     * #...#
+     * #..##
+     * ####.
+     * .....
+     * .....
+     */
+    0xfe, 0x12, 0x12, 0xbe, 0xc0,
+    0x01, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x19, char: 9, offset: 0x00c6
+     * ....
+     * ###.
+     * #..#
+     * #..#
+     * #..#
+     * ####
+     * ...#
+     * ...#
+     * ###.
+     * ....
+     * ....
+     */
+    0x3e, 0x22, 0x22, 0xfc,
+    0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x1a, char: :, offset: 0x00ce
+     * .
+     * .
+     * .
+     * #
+     * .
+     * .
+     * .
+     * .
+     * #
+     * .
+     * .
+     */
+    0x08,
+    0x01,
+
+    /* Index: 0x1b, char: ;, offset: 0x00d0
+     * ..
+     * ..
+     * ..
+     * .#
+     * ..
+     * ..
+     * ..
+     * .#
+     * .#
+     * #.
+     * ..
+     */
+    0x00, 0x88,
+    0x02, 0x01,
+
+    /* Index: 0x1c, char: <, offset: 0x00d4
+     * ....
+     * ....
+     * ....
+     * ....
+     * ..##
+     * ##..
+     * ##..
+     * ..##
+     * ....
+     * ....
+     * ....
+     */
+    0x60, 0x60, 0x90, 0x90,
+    0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x1d, char: =, offset: 0x00dc
+     * ....
+     * ....
+     * ....
+     * ....
+     * ####
+     * ....
+     * ####
+     * ....
+     * ....
+     * ....
+     * ....
+     */
+    0x50, 0x50, 0x50, 0x50,
+    0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x1e, char: >, offset: 0x00e4
+     * ....
+     * ....
+     * ....
+     * ....
+     * ##..
+     * ..##
+     * ..##
+     * ##..
+     * ....
+     * ....
+     * ....
+     */
+    0x90, 0x90, 0x60, 0x60,
+    0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x1f, char: ?, offset: 0x00ec
+     * .....
+     * .###.
+     * #...#
+     * ....#
+     * ...#.
+     * ..##.
+     * ..#..
+     * .....
+     * ..#..
+     * .....
+     * .....
+     */
+    0x04, 0x02, 0x62, 0x32, 0x0c,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+
+    /* Index: 0x20, char: @, offset: 0x00f6
+     * ........
+     * ..####..
+     * .#....#.
+     * #...#..#
+     * #.##.#..
+     * ..#..#..
+     * ..#..#..
+     * ..#..#.#
+     * #.#####.
+     * .#......
+     * ..####..
+     */
+    0x18, 0x04, 0xf2, 0x12, 0x0a, 0xf2, 0x04, 0x88,
+    0x01, 0x02, 0x05, 0x05, 0x05, 0x05, 0x01, 0x00,
+
+    /* Index: 0x21, char: A, offset: 0x0106
+     * .......
+     * ...#...
+     * ...#...
+     * ..#.#..
+     * ..#.#..
+     * .##.##.
+     * .#####.
+     * .#...#.
+     * #....##
+     * .......
+     * .......
+     */
+    0x00, 0xe0, 0x78, 0x46, 0x78, 0xe0, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+
+    /* Index: 0x22, char: B, offset: 0x0114
+     * ......
+     * ####..
+     * #...#.
+     * #...#.
+     * ####..
+     * #...#.
+     * #....#
+     * #...#.
+     * #####.
+     * ......
+     * ......
+     */
+    0xfe, 0x12, 0x12, 0x12, 0xac, 0x40,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x23, char: C, offset: 0x0120
+     * ......
+     * .###..
+     * #...#.
+     * #...##
+     * #.....
+     * #.....
+     * #...##
+     * #...#.
+     * .###..
+     * ......
+     * ......
+     */
+    0xfc, 0x02, 0x02, 0x02, 0xcc, 0x48,
+    0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+
+    /* Index: 0x24, char: D, offset: 0x012c
+     * ......
+     * ####..
+     * #...#.
+     * #....#
+     * #....#
+     * #....#
+     * #....#
+     * #...#.
+     * ####..
+     * ......
+     * ......
+     */
+    0xfe, 0x02, 0x02, 0x02, 0x84, 0x78,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+
+    /* Index: 0x25, char: E, offset: 0x0138
+     * .....
+     * #####
+     * #....
+     * #....
+     * ####.
+     * #....
+     * #....
+     * #....
+     * #####
+     * .....
+     * .....
+     */
+    0xfe, 0x12, 0x12, 0x12, 0x02,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+
+    /* Index: 0x26, char: F, offset: 0x0142
+     * .....
+     * #####
+     * #....
+     * #....
+     * #....
+     * #....
+     * #....
+     * #....
+     * #....
+     * .....
+     * .....
+     */
+    0xfe, 0x02, 0x02, 0x02, 0x02,
+    0x01, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x27, char: G, offset: 0x014c
+     * ......
+     * .####.
+     * #...#.
+     * #.....
+     * #.....
+     * #..###
+     * #...##
+     * #...##
+     * .####.
+     * ......
+     * ......
+     */
+    0xfc, 0x02, 0x02, 0x22, 0xe6, 0xe0,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x28, char: H, offset: 0x0158
+     * ......
+     * #....#
+     * #....#
+     * #....#
+     * #....#
+     * ######
+     * #....#
+     * #....#
+     * #....#
+     * ......
+     * ......
+     */
+    0xfe, 0x20, 0x20, 0x20, 0x20, 0xfe,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+
+    /* Index: 0x29, char: I, offset: 0x0164
+     * .
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * .
+     * .
+     */
+    0xfe,
+    0x01,
+
+    /* Index: 0x2a, char: J, offset: 0x0166
+     * .....
+     * ....#
+     * ....#
+     * ....#
+     * ....#
+     * ....#
+     * ....#
+     * ##..#
+     * .###.
+     * .....
+     * .....
+     */
+    0x80, 0x80, 0x00, 0x00, 0xfe,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x2b, char: K, offset: 0x0170
+     * .....
+     * #...#
+     * #..#.
+     * #.##.
+     * ###..
+     * #.#..
+     * #..#.
+     * #..##
+     * #...#
+     * .....
+     * .....
+     */
+    0xfe, 0x10, 0x38, 0xcc, 0x82,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+
+    /* Index: 0x2c, char: L, offset: 0x017a
+     * .....
+     * #....
+     * #....
+     * #....
+     * #....
+     * #....
+     * #....
+     * #....
+     * #####
+     * .....
+     * .....
+     */
+    0xfe, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+
+    /* Index: 0x2d, char: M, offset: 0x0184
+     * ........
+     * #.....##
+     * ##....##
+     * ##...#.#
+     * #.#..#.#
+     * #.#..#.#
+     * #.#.#..#
+     * #..##..#
+     * #..#...#
+     * ........
+     * ........
+     */
+    0xfe, 0x0c, 0x70, 0x80, 0xc0, 0x38, 0x06, 0xfe,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+
+    /* Index: 0x2e, char: N, offset: 0x0194
+     * ......
+     * #....#
+     * ##...#
+     * ###..#
+     * #.#..#
+     * #..#.#
+     * #..#.#
+     * #...##
+     * #...##
+     * ......
+     * ......
+     */
+    0xfe, 0x0c, 0x18, 0x60, 0x80, 0xfe,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
+
+    /* Index: 0x2f, char: O, offset: 0x01a0
+     * ......
+     * .###..
+     * #...#.
+     * #....#
+     * #....#
+     * #....#
+     * #....#
+     * #...#.
+     * .###..
+     * ......
+     * ......
+     */
+    0xfc, 0x02, 0x02, 0x02, 0x84, 0x78,
+    0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+
+    /* Index: 0x30, char: P, offset: 0x01ac
+     * ......
+     * #####.
+     * #...#.
+     * #...##
+     * #...#.
+     * ####..
+     * #.....
+     * #.....
+     * #.....
+     * ......
+     * ......
+     */
+    0xfe, 0x22, 0x22, 0x22, 0x1e, 0x08,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x31, char: Q, offset: 0x01b8
+     * ......
+     * .###..
+     * #...#.
+     * #....#
+     * #....#
+     * #....#
+     * #....#
+     * #...#.
+     * .#####
+     * .....#
+     * ......
+     */
+    0xfc, 0x02, 0x02, 0x02, 0x84, 0x78,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x03,
+
+    /* Index: 0x32, char: R, offset: 0x01c4
+     * .....
+     * ####.
+     * #...#
+     * #...#
+     * #..##
+     * #####
+     * #...#
+     * #...#
+     * #...#
+     * .....
+     * .....
+     */
+    0xfe, 0x22, 0x22, 0x32, 0xfc,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+
+    /* Index: 0x33, char: S, offset: 0x01ce
+     * .....
+     * .###.
+     * #...#
+     * #....
+     * ###..
+     * ...##
+     * ....#
+     * #...#
+     * .###.
+     * .....
+     * .....
+     */
+    0x9c, 0x12, 0x12, 0x22, 0xe4,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x34, char: T, offset: 0x01d8
+     * ......
+     * ######
+     * ...#..
+     * ...#..
+     * ...#..
+     * ...#..
+     * ...#..
+     * ...#..
+     * ...#..
+     * ......
+     * ......
+     */
+    0x02, 0x02, 0x02, 0xfe, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+
+    /* Index: 0x35, char: U, offset: 0x01e4
+     * ......
+     * #....#
+     * #....#
+     * #....#
+     * #....#
+     * #....#
+     * #....#
+     * #...#.
+     * .####.
+     * ......
+     * ......
+     */
+    0xfe, 0x00, 0x00, 0x00, 0x80, 0x7e,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x36, char: V, offset: 0x01f0
+     * .......
+     * #.....#
+     * .#...#.
+     * .#...#.
+     * .#..##.
+     * ..#.#..
+     * ..#.#..
+     * ..#....
+     * ...#...
+     * .......
+     * .......
+     */
+    0x02, 0x1c, 0xe0, 0x00, 0x70, 0x1c, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+
+    /* Index: 0x37, char: W, offset: 0x01fe
+     * .........
+     * #...#...#
+     * .#..##..#
+     * .#..##..#
+     * .#.#.#.#.
+     * .#.#.#.#.
+     * .###..##.
+     * ..#...##.
+     * ..#...##.
+     * .........
+     * .........
+     */
+    0x02, 0x7c, 0xc0, 0x70, 0x0e, 0x3c, 0xc0, 0xf0, 0x0e,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+
+    /* Index: 0x38, char: X, offset: 0x0210
+     * .....
+     * #...#
+     * ##.##
+     * .#.#.
+     * ..#..
+     * ..#..
+     * .#.#.
+     * ##.##
+     * #...#
+     * .....
+     * .....
+     */
+    0x86, 0xcc, 0x30, 0xcc, 0x86,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+
+    /* Index: 0x39, char: Y, offset: 0x021a
+     * ......
+     * ##...#
+     * .#...#
+     * ..#.#.
+     * ..#.#.
+     * ...#..
+     * ...#..
+     * ...#..
+     * ...#..
+     * ......
+     * ......
+     */
+    0x02, 0x06, 0x18, 0xe0, 0x18, 0x06,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+
+    /* Index: 0x3a, char: Z, offset: 0x0226
+     * .....
+     * #####
+     * ...#.
+     * ...#.
+     * ..#..
+     * .#...
+     * .#...
+     * #....
+     * #####
+     * .....
+     * .....
+     */
+    0x82, 0x62, 0x12, 0x0e, 0x02,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+
+    /* Index: 0x3b, char: [, offset: 0x0230
+     * ##
+     * #.
+     * #.
+     * #.
+     * #.
+     * #.
+     * #.
+     * #.
+     * #.
+     * #.
+     * ##
+     */
+    0xff, 0x01,
+    0x07, 0x04,
+
+    /* Index: 0x3c, char: \x5c, offset: 0x0234
+     * ....
+     * #...
+     * .#..
+     * .#..
+     * ..#.
+     * ..#.
+     * ..#.
+     * ...#
+     * ...#
+     * ...#
+     * ....
+     */
+    0x02, 0x0c, 0x70, 0x80,
+    0x00, 0x00, 0x00, 0x03,
+
+    /* Index: 0x3d, char: ], offset: 0x023c
+     * ##
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * ##
+     */
+    0x01, 0xff,
+    0x04, 0x07,
+
+    /* Index: 0x3e, char: ^, offset: 0x0240
+     * ...
+     * .#.
+     * ##.
+     * #.#
+     * #.#
+     * ...
+     * ...
+     * ...
+     * ...
+     * ...
+     * ...
+     */
+    0x1c, 0x06, 0x18,
+    0x00, 0x00, 0x00,
+
+    /* Index: 0x3f, char: _, offset: 0x0246
+     * .....
+     * .....
+     * .....
+     * .....
+     * .....
+     * .....
+     * .....
+     * .....
+     * .....
+     * #####
+     * .....
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0x02, 0x02, 0x02,
+
+    /* Index: 0x40, char: `, offset: 0x0250
+     * ..
+     * #.
+     * .#
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     * ..
+     */
+    0x02, 0x04,
+    0x00, 0x00,
+
+    /* Index: 0x41, char: a, offset: 0x0254
+     * ....
+     * ....
+     * ....
+     * .###
+     * #..#
+     * ..##
+     * #..#
+     * #..#
+     * ####
+     * ....
+     * ....
+     */
+    0xd0, 0x08, 0x28, 0xf8,
+    0x01, 0x01, 0x01, 0x01,
+
+    /* Index: 0x42, char: b, offset: 0x025c
+     * .....
+     * #....
+     * #....
+     * ####.
+     * #..#.
+     * #...#
+     * #...#
+     * #..##
+     * ####.
+     * .....
+     * .....
+     */
+    0xfe, 0x08, 0x08, 0x98, 0xe0,
+    0x01, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x43, char: c, offset: 0x0266
+     * ....
+     * ....
+     * ....
+     * .###
+     * #..#
+     * #...
+     * #...
+     * #..#
+     * .###
+     * ....
+     * ....
+     */
+    0xf0, 0x08, 0x08, 0x98,
+    0x00, 0x01, 0x01, 0x01,
+
+    /* Index: 0x44, char: d, offset: 0x026e
+     * ....
+     * ...#
+     * ...#
+     * ####
+     * #..#
+     * #..#
+     * #..#
+     * #..#
+     * ###.
+     * ....
+     * ....
+     */
+    0xf8, 0x08, 0x08, 0xfe,
+    0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x45, char: e, offset: 0x0276
+     * ....
+     * ....
+     * ....
+     * .###
+     * #..#
+     * ####
+     * #...
+     * #...
+     * .###
+     * ....
+     * ....
+     */
+    0xf0, 0x28, 0x28, 0x38,
+    0x00, 0x01, 0x01, 0x01,
+
+    /* Index: 0x46, char: f, offset: 0x027e
+     * ....
+     * ..##
+     * .#..
+     * ###.
+     * .#..
+     * .#..
+     * .#..
+     * .#..
+     * .#..
+     * ....
+     * ....
+     */
+    0x08, 0xfc, 0x0a, 0x02,
+    0x00, 0x01, 0x00, 0x00,
+
+    /* Index: 0x47, char: g, offset: 0x0286
+     * .....
+     * .....
+     * .....
+     * ###.#
+     * #..##
+     * #..##
+     * #..##
+     * #..##
+     * #####
+     * ...#.
+     * ####.
+     */
+    0xf8, 0x08, 0x08, 0xf0, 0xf8,
+    0x05, 0x05, 0x05, 0x07, 0x01,
+
+    /* Index: 0x48, char: h, offset: 0x0290
+     * .....
+     * #....
+     * #....
+     * ####.
+     * #..#.
+     * #..##
+     * #..##
+     * #..##
+     * #..##
+     * .....
+     * .....
+     */
+    0xfe, 0x08, 0x08, 0xf8, 0xe0,
+    0x01, 0x00, 0x00, 0x01, 0x01,
+
+    /* Index: 0x49, char: i, offset: 0x029a
+     * .
+     * #
+     * .
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * .
+     * .
+     */
+    0xfa,
+    0x01,
+
+    /* Index: 0x4a, char: j, offset: 0x029c
+     * ..
+     * .#
+     * ..
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * .#
+     * ##
+     */
+    0x00, 0xfa,
+    0x04, 0x07,
+
+    /* Index: 0x4b, char: k, offset: 0x02a0
+     * ....
+     * #...
+     * #...
+     * #..#
+     * #.#.
+     * ##..
+     * #.#.
+     * #.#.
+     * #..#
+     * ....
+     * ....
+     */
+    0xfe, 0x20, 0xd0, 0x08,
+    0x01, 0x00, 0x00, 0x01,
+
+    /* Index: 0x4d, char: m, offset: 0x02a8
+     * ........
+     * ........
+     * ........
+     * ####.##.
+     * #..##..#
+     * #..#...#
+     * #..#...#
+     * #..#...#
+     * #..#...#
+     * ........
+     * ........
+     */
+    0xf8, 0x08, 0x08, 0xf8, 0x10, 0x08, 0x08, 0xf0,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+
+    /* Index: 0x4e, char: n, offset: 0x02b8
+     * ....
+     * ....
+     * ....
+     * ####
+     * #..#
+     * #..#
+     * #..#
+     * #..#
+     * #..#
+     * ....
+     * ....
+     */
+    0xf8, 0x08, 0x08, 0xf8,
+    0x01, 0x00, 0x00, 0x01,
+
+    /* Index: 0x4f, char: o, offset: 0x02c0
+     * .....
+     * .....
+     * .....
+     * .###.
+     * #..#.
+     * #...#
+     * #...#
+     * #..#.
+     * .###.
+     * .....
+     * .....
+     */
+    0xf0, 0x08, 0x08, 0x98, 0x60,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x50, char: p, offset: 0x02ca
+     * .....
+     * .....
+     * .....
+     * ####.
+     * #..#.
+     * #...#
+     * #...#
+     * #..##
+     * ####.
+     * #....
+     * #....
+     */
+    0xf8, 0x08, 0x08, 0x98, 0xe0,
+    0x07, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x51, char: q, offset: 0x02d4
+     * ....
+     * ....
+     * ....
+     * ####
+     * #..#
+     * #..#
+     * #..#
+     * #..#
+     * ####
+     * ...#
+     * ...#
+     */
+    0xf8, 0x08, 0x08, 0xf8,
+    0x01, 0x01, 0x01, 0x07,
+
+    /* Index: 0x52, char: r, offset: 0x02dc
+     * ...
+     * ...
+     * ...
+     * ###
+     * #..
+     * #..
+     * #..
+     * #..
+     * #..
+     * ...
+     * ...
+     */
+    0xf8, 0x08, 0x08,
+    0x01, 0x00, 0x00,
+
+    /* Index: 0x53, char: s, offset: 0x02e2
+     * ....
+     * ....
+     * ....
+     * ###.
+     * #..#
+     * ##..
+     * ..##
+     * #..#
+     * ####
+     * ....
+     * ....
+     */
+    0xb8, 0x28, 0x48, 0xd0,
+    0x01, 0x01, 0x01, 0x01,
+
+    /* Index: 0x54, char: t, offset: 0x02ea
+     * ...
+     * .#.
+     * .#.
+     * ###
+     * .#.
+     * .#.
+     * .#.
+     * .#.
+     * .##
+     * ...
+     * ...
+     */
+    0x08, 0xfe, 0x08,
+    0x00, 0x01, 0x01,
+
+    /* Index: 0x55, char: u, offset: 0x02f0
+     * ....
+     * ....
+     * ....
+     * #..#
+     * #..#
+     * #..#
+     * #..#
+     * #..#
+     * ####
+     * ....
+     * ....
+     */
+    0xf8, 0x00, 0x00, 0xf8,
+    0x01, 0x01, 0x01, 0x01,
+
+    /* Index: 0x56, char: v, offset: 0x02f8
+     * .....
+     * .....
+     * .....
+     * #...#
+     * .#..#
+     * .#.#.
+     * ...#.
+     * ..##.
+     * ..#..
+     * .....
+     * .....
+     */
+    0x08, 0x30, 0x80, 0xe0, 0x18,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+
+    /* Index: 0x57, char: w, offset: 0x0302
+     * ........
+     * ........
+     * ........
+     * #...#..#
+     * .#.##..#
+     * .#.##.#.
+     * .#.#.##.
+     * .##..##.
+     * ..#..##.
+     * ........
+     * ........
+     */
+    0x08, 0xf0, 0x80, 0x70, 0x38, 0xc0, 0xe0, 0x18,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+
+    /* Index: 0x58, char: x, offset: 0x0312
+     * ....
+     * ....
+     * ....
+     * #..#
+     * #.#.
+     * .##.
+     * .##.
+     * #.#.
+     * #..#
+     * ....
+     * ....
+     */
+    0x98, 0x60, 0xf0, 0x08,
+    0x01, 0x00, 0x00, 0x01,
+
+    /* Index: 0x59, char: y, offset: 0x031a
+     * .....
+     * .....
+     * .....
+     * #...#
+     * .#..#
+     * .#.#.
+     * .###.
+     * ..##.
+     * ..#..
+     * ..#..
+     * .#...
+     */
+    0x08, 0x70, 0xc0, 0xe0, 0x18,
+    0x00, 0x04, 0x03, 0x00, 0x00,
+
+    /* Index: 0x5a, char: z, offset: 0x0324
+     * .....
+     * .....
+     * .....
+     * .####
+     * ...#.
+     * ..##.
+     * ..#..
+     * .#...
+     * #####
+     * .....
+     * .....
+     */
+    0x00, 0x88, 0x68, 0x38, 0x08,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+
+    /* Index: 0x5b, char: {, offset: 0x032e
+     * ...
+     * ..#
+     * .##
+     * .##
+     * .#.
+     * ##.
+     * .#.
+     * .##
+     * .##
+     * ..#
+     * ...
+     */
+    0x20, 0xfc, 0x8e,
+    0x00, 0x01, 0x03,
+
+    /* Index: 0x5c, char: |, offset: 0x0334
+     * .
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * #
+     * .
+     */
+    0xfe,
+    0x03,
+
+    /* Index: 0x5d, char: }, offset: 0x0336
+     * #..
+     * .#.
+     * .#.
+     * .#.
+     * .#.
+     * ..#
+     * .#.
+     * .#.
+     * .#.
+     * .#.
+     * #..
+     */
+    0x01, 0xde, 0x20,
+    0x04, 0x03, 0x00,
+
+    /* Index: 0x5e, char: ~, offset: 0x033c
+     * ......
+     * ......
+     * ......
+     * ......
+     * ......
+     * ###..#
+     * ...##.
+     * ......
+     * ......
+     * ......
+     * ......
+     */
+    0x20, 0x20, 0x20, 0x40, 0x40, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const font_char_desc_t _fonts_roboto_8pt_descriptors[] = {
+    { 0x02, 0x0000 }, /* Index: 0x00, char: \x20 */
+    { 0x01, 0x0004 }, /* Index: 0x01, char: ! */
+    { 0x02, 0x0006 }, /* Index: 0x02, char: " */
+    { 0x06, 0x000a }, /* Index: 0x03, char: # */
+    { 0x05, 0x0016 }, /* Index: 0x04, char: $ */
+    { 0x07, 0x0020 }, /* Index: 0x05, char: % */
+    { 0x06, 0x002e }, /* Index: 0x06, char: & */
+    { 0x01, 0x003a }, /* Index: 0x07, char: ' */
+    { 0x03, 0x003c }, /* Index: 0x08, char: ( */
+    { 0x03, 0x0042 }, /* Index: 0x09, char: ) */
+    { 0x03, 0x0048 }, /* Index: 0x0a, char: \x2a */
+    { 0x06, 0x004e }, /* Index: 0x0b, char: + */
+    { 0x02, 0x005a }, /* Index: 0x0c, char: , */
+    { 0x03, 0x005e }, /* Index: 0x0d, char: - */
+    { 0x01, 0x0064 }, /* Index: 0x0e, char: . */
+    { 0x04, 0x0066 }, /* Index: 0x0f, char: \x2f */
+    { 0x05, 0x006e }, /* Index: 0x10, char: 0 */
+    { 0x03, 0x0078 }, /* Index: 0x11, char: 1 */
+    { 0x05, 0x007e }, /* Index: 0x12, char: 2 */
+    { 0x05, 0x0088 }, /* Index: 0x13, char: 3 */
+    { 0x06, 0x0092 }, /* Index: 0x14, char: 4 */
+    { 0x05, 0x009e }, /* Index: 0x15, char: 5 */
+    { 0x05, 0x00a8 }, /* Index: 0x16, char: 6 */
+    { 0x05, 0x00b2 }, /* Index: 0x17, char: 7 */
+    { 0x05, 0x00bc }, /* Index: 0x18, char: 8 */
+    { 0x04, 0x00c6 }, /* Index: 0x19, char: 9 */
+    { 0x01, 0x00ce }, /* Index: 0x1a, char: : */
+    { 0x02, 0x00d0 }, /* Index: 0x1b, char: ; */
+    { 0x04, 0x00d4 }, /* Index: 0x1c, char: < */
+    { 0x04, 0x00dc }, /* Index: 0x1d, char: = */
+    { 0x04, 0x00e4 }, /* Index: 0x1e, char: > */
+    { 0x05, 0x00ec }, /* Index: 0x1f, char: ? */
+    { 0x08, 0x00f6 }, /* Index: 0x20, char: @ */
+    { 0x07, 0x0106 }, /* Index: 0x21, char: A */
+    { 0x06, 0x0114 }, /* Index: 0x22, char: B */
+    { 0x06, 0x0120 }, /* Index: 0x23, char: C */
+    { 0x06, 0x012c }, /* Index: 0x24, char: D */
+    { 0x05, 0x0138 }, /* Index: 0x25, char: E */
+    { 0x05, 0x0142 }, /* Index: 0x26, char: F */
+    { 0x06, 0x014c }, /* Index: 0x27, char: G */
+    { 0x06, 0x0158 }, /* Index: 0x28, char: H */
+    { 0x01, 0x0164 }, /* Index: 0x29, char: I */
+    { 0x05, 0x0166 }, /* Index: 0x2a, char: J */
+    { 0x05, 0x0170 }, /* Index: 0x2b, char: K */
+    { 0x05, 0x017a }, /* Index: 0x2c, char: L */
+    { 0x08, 0x0184 }, /* Index: 0x2d, char: M */
+    { 0x06, 0x0194 }, /* Index: 0x2e, char: N */
+    { 0x06, 0x01a0 }, /* Index: 0x2f, char: O */
+    { 0x06, 0x01ac }, /* Index: 0x30, char: P */
+    { 0x06, 0x01b8 }, /* Index: 0x31, char: Q */
+    { 0x05, 0x01c4 }, /* Index: 0x32, char: R */
+    { 0x05, 0x01ce }, /* Index: 0x33, char: S */
+    { 0x06, 0x01d8 }, /* Index: 0x34, char: T */
+    { 0x06, 0x01e4 }, /* Index: 0x35, char: U */
+    { 0x07, 0x01f0 }, /* Index: 0x36, char: V */
+    { 0x09, 0x01fe }, /* Index: 0x37, char: W */
+    { 0x05, 0x0210 }, /* Index: 0x38, char: X */
+    { 0x06, 0x021a }, /* Index: 0x39, char: Y */
+    { 0x05, 0x0226 }, /* Index: 0x3a, char: Z */
+    { 0x02, 0x0230 }, /* Index: 0x3b, char: [ */
+    { 0x04, 0x0234 }, /* Index: 0x3c, char: \x5c */
+    { 0x02, 0x023c }, /* Index: 0x3d, char: ] */
+    { 0x03, 0x0240 }, /* Index: 0x3e, char: ^ */
+    { 0x05, 0x0246 }, /* Index: 0x3f, char: _ */
+    { 0x02, 0x0250 }, /* Index: 0x40, char: ` */
+    { 0x04, 0x0254 }, /* Index: 0x41, char: a */
+    { 0x05, 0x025c }, /* Index: 0x42, char: b */
+    { 0x04, 0x0266 }, /* Index: 0x43, char: c */
+    { 0x04, 0x026e }, /* Index: 0x44, char: d */
+    { 0x04, 0x0276 }, /* Index: 0x45, char: e */
+    { 0x04, 0x027e }, /* Index: 0x46, char: f */
+    { 0x05, 0x0286 }, /* Index: 0x47, char: g */
+    { 0x05, 0x0290 }, /* Index: 0x48, char: h */
+    { 0x01, 0x029a }, /* Index: 0x49, char: i */
+    { 0x02, 0x029c }, /* Index: 0x4a, char: j */
+    { 0x04, 0x02a0 }, /* Index: 0x4b, char: k */
+    { 0x01, 0x0164 }, /* Index: 0x4c, char: l */
+    { 0x08, 0x02a8 }, /* Index: 0x4d, char: m */
+    { 0x04, 0x02b8 }, /* Index: 0x4e, char: n */
+    { 0x05, 0x02c0 }, /* Index: 0x4f, char: o */
+    { 0x05, 0x02ca }, /* Index: 0x50, char: p */
+    { 0x04, 0x02d4 }, /* Index: 0x51, char: q */
+    { 0x03, 0x02dc }, /* Index: 0x52, char: r */
+    { 0x04, 0x02e2 }, /* Index: 0x53, char: s */
+    { 0x03, 0x02ea }, /* Index: 0x54, char: t */
+    { 0x04, 0x02f0 }, /* Index: 0x55, char: u */
+    { 0x05, 0x02f8 }, /* Index: 0x56, char: v */
+    { 0x08, 0x0302 }, /* Index: 0x57, char: w */
+    { 0x04, 0x0312 }, /* Index: 0x58, char: x */
+    { 0x05, 0x031a }, /* Index: 0x59, char: y */
+    { 0x05, 0x0324 }, /* Index: 0x5a, char: z */
+    { 0x03, 0x032e }, /* Index: 0x5b, char: { */
+    { 0x01, 0x0334 }, /* Index: 0x5c, char: | */
+    { 0x03, 0x0336 }, /* Index: 0x5d, char: } */
+    { 0x06, 0x033c }, /* Index: 0x5e, char: ~ */
+};
+
+static const font_kern_left_t _fonts_roboto_8pt_kern_lefts[] = {
+    { 0x0022,    0 }, /* " */
+    { 0x0027,    3 }, /* ' */
+    { 0x002c,    6 }, /* , */
+    { 0x002d,   11 }, /* - */
+    { 0x002e,   16 }, /* . */
+    { 0x0032,   24 }, /* 2 */
+    { 0x0037,   25 }, /* 7 */
+    { 0x003a,   37 }, /* : */
+    { 0x003b,   40 }, /* ; */
+    { 0x0041,   42 }, /* A */
+    { 0x0045,   51 }, /* E */
+    { 0x0046,   52 }, /* F */
+    { 0x004c,   78 }, /* L */
+    { 0x0050,   89 }, /* P */
+    { 0x0054,   94 }, /* T */
+    { 0x0056,  120 }, /* V */
+    { 0x0059,  127 }, /* Y */
+    { 0x005a,  132 }, /* Z */
+    { 0x0061,  134 }, /* a */
+    { 0x0062,  136 }, /* b */
+    { 0x0063,  139 }, /* c */
+    { 0x0065,  141 }, /* e */
+    { 0x0066,  143 }, /* f */
+    { 0x0067,  151 }, /* g */
+    { 0x0068,  153 }, /* h */
+    { 0x006b,  156 }, /* k */
+    { 0x006d,  158 }, /* m */
+    { 0x006e,  161 }, /* n */
+    { 0x006f,  163 }, /* o */
+    { 0x0070,  166 }, /* p */
+    { 0x0071,  169 }, /* q */
+    { 0x0072,  171 }, /* r */
+    { 0x0073,  181 }, /* s */
+    { 0x0075,  184 }, /* u */
+    { 0x0076,  186 }, /* v */
+    { 0x0077,  190 }, /* w */
+    { 0x0078,  193 }, /* x */
+    { 0x0079,  195 }, /* y */
+    { 0x007a,  199 }, /* z */
+    { 0xffff,  201 },
+};
+
+static const uint16_t _fonts_roboto_8pt_kern_rights[] = {
+    0x0034, /* " 4 */
+    0x0041, /* " A */
+    0x004a, /* " J */
+    0x0034, /* ' 4 */
+    0x0041, /* ' A */
+    0x004a, /* ' J */
+    0x0031, /* , 1 */
+    0x0054, /* , T */
+    0x0056, /* , V */
+    0x0059, /* , Y */
+    0x0076, /* , v */
+    0x0031, /* - 1 */
+    0x004a, /* - J */
+    0x0054, /* - T */
+    0x0059, /* - Y */
+    0x007a, /* - z */
+    0x0031, /* . 1 */
+    0x0034, /* . 4 */
+    0x0054, /* . T */
+    0x0056, /* . V */
+    0x0057, /* . W */
+    0x0059, /* . Y */
+    0x0076, /* . v */
+    0x0079, /* . y */
+    0x0034, /* 2 4 */
+    0x002c, /* 7 , */
+    0x002d, /* 7 - */
+    0x002e, /* 7 . */
+    0x0034, /* 7 4 */
+    0x003b, /* 7 ; */
+    0x0041, /* 7 A */
+    0x004a, /* 7 J */
+    0x0061, /* 7 a */
+    0x0063, /* 7 c */
+    0x0065, /* 7 e */
+    0x006f, /* 7 o */
+    0x007a, /* 7 z */
+    0x0031, /* : 1 */
+    0x0034, /* : 4 */
+    0x0054, /* : T */
+    0x0031, /* ; 1 */
+    0x0054, /* ; T */
+    0x0022, /* A " */
+    0x0027, /* A ' */
+    0x0031, /* A 1 */
+    0x0054, /* A T */
+    0x0056, /* A V */
+    0x0057, /* A W */
+    0x0059, /* A Y */
+    0x0076, /* A v */
+    0x0079, /* A y */
+    0x0034, /* E 4 */
+    0x002c, /* F , */
+    0x002d, /* F - */
+    0x002e, /* F . */
+    0x0034, /* F 4 */
+    0x003a, /* F : */
+    0x003b, /* F ; */
+    0x0041, /* F A */
+    0x004a, /* F J */
+    0x0061, /* F a */
+    0x0063, /* F c */
+    0x0064, /* F d */
+    0x0065, /* F e */
+    0x0067, /* F g */
+    0x006d, /* F m */
+    0x006e, /* F n */
+    0x006f, /* F o */
+    0x0070, /* F p */
+    0x0071, /* F q */
+    0x0072, /* F r */
+    0x0073, /* F s */
+    0x0075, /* F u */
+    0x0076, /* F v */
+    0x0077, /* F w */
+    0x0078, /* F x */
+    0x0079, /* F y */
+    0x007a, /* F z */
+    0x0022, /* L " */
+    0x0027, /* L ' */
+    0x002d, /* L - */
+    0x0031, /* L 1 */
+    0x0034, /* L 4 */
+    0x0054, /* L T */
+    0x0056, /* L V */
+    0x0057, /* L W */
+    0x0059, /* L Y */
+    0x0076, /* L v */
+    0x0079, /* L y */
+    0x002c, /* P , */
+    0x002e, /* P . */
+    0x0034, /* P 4 */
+    0x0041, /* P A */
+    0x004a, /* P J */
+    0x002c, /* T , */
+    0x002d, /* T - */
+    0x002e, /* T . */
+    0x0034, /* T 4 */
+    0x003a, /* T : */
+    0x003b, /* T ; */
+    0x0041, /* T A */
+    0x004a, /* T J */
+    0x0061, /* T a */
+    0x0063, /* T c */
+    0x0064, /* T d */
+    0x0065, /* T e */
+    0x0067, /* T g */
+    0x006d, /* T m */
+    0x006e, /* T n */
+    0x006f, /* T o */
+    0x0070, /* T p */
+    0x0071, /* T q */
+    0x0072, /* T r */
+    0x0073, /* T s */
+    0x0075, /* T u */
+    0x0076, /* T v */
+    0x0077, /* T w */
+    0x0078, /* T x */
+    0x0079, /* T y */
+    0x007a, /* T z */
+    0x002c, /* V , */
+    0x002e, /* V . */
+    0x0034, /* V 4 */
+    0x003b, /* V ; */
+    0x0041, /* V A */
+    0x004a, /* V J */
+    0x007a, /* V z */
+    0x002c, /* Y , */
+    0x002e, /* Y . */
+    0x0034, /* Y 4 */
+    0x0041, /* Y A */
+    0x004a, /* Y J */
+    0x002d, /* Z - */
+    0x0034, /* Z 4 */
+    0x0031, /* a 1 */
+    0x0054, /* a T */
+    0x0031, /* b 1 */
+    0x0054, /* b T */
+    0x0059, /* b Y */
+    0x0031, /* c 1 */
+    0x0054, /* c T */
+    0x0031, /* e 1 */
+    0x0054, /* e T */
+    0x002c, /* f , */
+    0x002d, /* f - */
+    0x002e, /* f . */
+    0x0034, /* f 4 */
+    0x003b, /* f ; */
+    0x0041, /* f A */
+    0x004a, /* f J */
+    0x007a, /* f z */
+    0x0031, /* g 1 */
+    0x0054, /* g T */
+    0x0031, /* h 1 */
+    0x0054, /* h T */
+    0x0059, /* h Y */
+    0x0031, /* k 1 */
+    0x0054, /* k T */
+    0x0031, /* m 1 */
+    0x0054, /* m T */
+    0x0059, /* m Y */
+    0x0031, /* n 1 */
+    0x0054, /* n T */
+    0x0031, /* o 1 */
+    0x0054, /* o T */
+    0x0059, /* o Y */
+    0x0031, /* p 1 */
+    0x0054, /* p T */
+    0x0059, /* p Y */
+    0x0031, /* q 1 */
+    0x0054, /* q T */
+    0x002c, /* r , */
+    0x002d, /* r - */
+    0x002e, /* r . */
+    0x0031, /* r 1 */
+    0x0034, /* r 4 */
+    0x0037, /* r 7 */
+    0x0041, /* r A */
+    0x004a, /* r J */
+    0x0054, /* r T */
+    0x005a, /* r Z */
+    0x0031, /* s 1 */
+    0x0054, /* s T */
+    0x0059, /* s Y */
+    0x0031, /* u 1 */
+    0x0054, /* u T */
+    0x002c, /* v , */
+    0x0031, /* v 1 */
+    0x0037, /* v 7 */
+    0x0054, /* v T */
+    0x0031, /* w 1 */
+    0x0037, /* w 7 */
+    0x0054, /* w T */
+    0x0031, /* x 1 */
+    0x0054, /* x T */
+    0x002c, /* y , */
+    0x0031, /* y 1 */
+    0x0037, /* y 7 */
+    0x0054, /* y T */
+    0x0031, /* z 1 */
+    0x0054, /* z T */
+};
+
+static const int8_t _fonts_roboto_8pt_kern_adjust[] = {
+    -2, -2, -4, -2, -2, -4, -2, -3, -2, -3, -2, -2, -4, -3, -2, -2,
+    -2, -4, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -2, -3, -3,
+    -2, -2, -2, -2, -2, -2, -2, -3, -2, -3, -2, -2, -2, -3, -2, -2,
+    -3, -2, -2, -2, -4, -4, -4, -3, -4, -4, -3, -4, -4, -4, -3, -4,
+    -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+    -4, -2, -4, -3, -2, -2, -3, -2, -2, -5, -5, -2, -2, -4, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -2, -2, -2, -2, -2, -2,
+    -2, -2, -2, -2, -2, -3, -2, -3, -2, -3, -2, -2, -3, -2, -3, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -3, -2, -2, -3, -2, -3,
+    -2, -2, -3, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -2, -2,
+    -2, -2, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -2,
+    -3, -2, -3, -2, -2, -2, -3, -2, -3,
 };
 
-// Character descriptors for Roboto 8pt
-// { [Char width in bits], [Offset into roboto_8ptCharBitmaps in bytes] }
-const font_char_desc_t _fonts_roboto_8pt_descriptors[] =
+static const font_kerning_t _fonts_roboto_8pt_kerning =
 {
-	{1, 0}, 		// ! 
-	{2, 11}, 		// " 
-	{6, 22}, 		// # 
-	{5, 33}, 		// $ 
-	{7, 44}, 		// % 
-	{6, 55}, 		// & 
-	{1, 66}, 		// ' 
-	{3, 77}, 		// ( 
-	{3, 88}, 		// ) 
-	{3, 99}, 		// * 
-	{6, 110}, 		// + 
-	{2, 121}, 		// , 
-	{3, 132}, 		// - 
-	{1, 143}, 		// . 
-	{4, 154}, 		// / 
-	{5, 165}, 		// 0 
-	{3, 176}, 		// 1 
-	{5, 187}, 		// 2 
-	{5, 198}, 		// 3 
-	{6, 209}, 		// 4 
-	{5, 220}, 		// 5 
-	{5, 231}, 		// 6 
-	{5, 242}, 		// 7 
-	{5, 253}, 		// 8 
-	{4, 264}, 		// 9 
-	{1, 275}, 		// : 
-	{2, 286}, 		// ; 
-	{4, 297}, 		// < 
-	{4, 308}, 		// = 
-	{4, 319}, 		// > 
-	{5, 330}, 		// ? 
-	{8, 341}, 		// @ 
-	{7, 352}, 		// A 
-	{6, 363}, 		// B 
-	{6, 374}, 		// C 
-	{6, 385}, 		// D 
-	{5, 396}, 		// E 
-	{5, 407}, 		// F 
-	{6, 418}, 		// G 
-	{6, 429}, 		// H 
-	{1, 440}, 		// I 
-	{5, 451}, 		// J 
-	{5, 462}, 		// K 
-	{5, 473}, 		// L 
-	{8, 484}, 		// M 
-	{6, 495}, 		// N 
-	{6, 506}, 		// O 
-	{6, 517}, 		// P 
-	{6, 528}, 		// Q 
-	{5, 539}, 		// R 
-	{5, 550}, 		// S 
-	{6, 561}, 		// T 
-	{6, 572}, 		// U 
-	{7, 583}, 		// V 
-	{9, 594}, 		// W 
-	{5, 616}, 		// X 
-	{6, 627}, 		// Y 
-	{5, 638}, 		// Z 
-	{2, 649}, 		// [ 
-	{4, 660}, 		/* \ */
-	{2, 671}, 		// ] 
-	{3, 682}, 		// ^ 
-	{5, 693}, 		// _ 
-	{2, 704}, 		// ` 
-	{4, 715}, 		// a 
-	{5, 726}, 		// b 
-	{4, 737}, 		// c 
-	{4, 748}, 		// d 
-	{4, 759}, 		// e 
-	{4, 770}, 		// f 
-	{5, 781}, 		// g 
-	{5, 792}, 		// h 
-	{1, 803}, 		// i 
-	{2, 814}, 		// j 
-	{4, 825}, 		// k 
-	{1, 836}, 		// l 
-	{8, 847}, 		// m 
-	{4, 858}, 		// n 
-	{5, 869}, 		// o 
-	{5, 880}, 		// p 
-	{4, 891}, 		// q 
-	{3, 902}, 		// r 
-	{4, 913}, 		// s 
-	{3, 924}, 		// t 
-	{4, 935}, 		// u 
-	{5, 946}, 		// v 
-	{8, 957}, 		// w 
-	{4, 968}, 		// x 
-	{5, 979}, 		// y 
-	{5, 990}, 		// z 
-	{3, 1001}, 		// { 
-	{1, 1012}, 		// | 
-	{3, 1023}, 		// } 
-	{6, 1034}, 		// ~ 
+    .num_lefts        = 39, /* Left characters */
+    .lefts            = _fonts_roboto_8pt_kern_lefts, /* Pairs of each left character */
+    .rights           = _fonts_roboto_8pt_kern_rights, /* Right character of each pair */
+    .adjust           = _fonts_roboto_8pt_kern_adjust, /* Added to the space of each pair */
 };
 
-// Font information for Roboto 8pt
 const font_info_t _fonts_roboto_8pt_info =
 {
-    .height           = 11,                            //  Character height
-    .c                = '!',                           //  Start character
-    .char_start       = '~',                           //  End character
-    .char_end         = 2,                             //  Width, in pixels, of space character
-    .char_descriptors = _fonts_roboto_8pt_descriptors, //  Character descriptor array
-    .bitmap           = _fonts_roboto_8pt_bitmaps,     //  Character bitmap array
+    .height           = 11, /* Character height */
+    .c                = 1, /* C */
+    .char_start       = 32, /* Start character */
+    .char_end         = 126, /* End character */
+    .char_descriptors = _fonts_roboto_8pt_descriptors, /* Character descriptor array */
+    .bitmap           = _fonts_roboto_8pt_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_PAGES, /* Flags */
+    .kerning          = &_fonts_roboto_8pt_kerning, /* 201 kerning pairs */
 };
 
 #endif /* _EXTRAS_FONTS_FONT_ROBOTO_8PT_H_ */
@@ -7668,272 +7668,17 @@ static const uint8_t _fonts_terminus_14x28_iso8859_1_bitmaps[] = {
     0x00, 0x00, /* ................ */
 };
 
-const font_char_desc_t _fonts_terminus_14x28_iso8859_1_descriptors[] = {
-    { 0x0e, 0x0000 }, /* Index: 0x00, char: \x01 */
-    { 0x0e, 0x0038 }, /* Index: 0x01, char: \x02 */
-    { 0x0e, 0x0070 }, /* Index: 0x02, char: \x03 */
-    { 0x0e, 0x00a8 }, /* Index: 0x03, char: \x04 */
-    { 0x0e, 0x00e0 }, /* Index: 0x04, char: \x05 */
-    { 0x0e, 0x0118 }, /* Index: 0x05, char: \x06 */
-    { 0x0e, 0x0150 }, /* Index: 0x06, char: \x07 */
-    { 0x0e, 0x0188 }, /* Index: 0x07, char: \x08 */
-    { 0x0e, 0x01c0 }, /* Index: 0x08, char: \x09 */
-    { 0x0e, 0x01f8 }, /* Index: 0x09, char: \x0a */
-    { 0x0e, 0x0230 }, /* Index: 0x0a, char: \x0b */
-    { 0x0e, 0x0268 }, /* Index: 0x0b, char: \x0c */
-    { 0x0e, 0x02a0 }, /* Index: 0x0c, char: \x0d */
-    { 0x0e, 0x02d8 }, /* Index: 0x0d, char: \x0e */
-    { 0x0e, 0x0310 }, /* Index: 0x0e, char: \x0f */
-    { 0x0e, 0x0348 }, /* Index: 0x0f, char: \x10 */
-    { 0x0e, 0x0380 }, /* Index: 0x10, char: \x11 */
-    { 0x0e, 0x03b8 }, /* Index: 0x11, char: \x12 */
-    { 0x0e, 0x03f0 }, /* Index: 0x12, char: \x13 */
-    { 0x0e, 0x0428 }, /* Index: 0x13, char: \x14 */
-    { 0x0e, 0x0460 }, /* Index: 0x14, char: \x15 */
-    { 0x0e, 0x0498 }, /* Index: 0x15, char: \x16 */
-    { 0x0e, 0x04d0 }, /* Index: 0x16, char: \x17 */
-    { 0x0e, 0x0508 }, /* Index: 0x17, char: \x18 */
-    { 0x0e, 0x0540 }, /* Index: 0x18, char: \x19 */
-    { 0x0e, 0x0578 }, /* Index: 0x19, char: \x1a */
-    { 0x0e, 0x05b0 }, /* Index: 0x1a, char: \x1b */
-    { 0x0e, 0x05e8 }, /* Index: 0x1b, char: \x1c */
-    { 0x0e, 0x0620 }, /* Index: 0x1c, char: \x1d */
-    { 0x0e, 0x0658 }, /* Index: 0x1d, char: \x1e */
-    { 0x0e, 0x0690 }, /* Index: 0x1e, char: \x1f */
-    { 0x0e, 0x06c8 }, /* Index: 0x1f, char: \x20 */
-    { 0x0e, 0x0700 }, /* Index: 0x20, char: \x21 */
-    { 0x0e, 0x0738 }, /* Index: 0x21, char: \x22 */
-    { 0x0e, 0x0770 }, /* Index: 0x22, char: \x23 */
-    { 0x0e, 0x07a8 }, /* Index: 0x23, char: \x24 */
-    { 0x0e, 0x07e0 }, /* Index: 0x24, char: \x25 */
-    { 0x0e, 0x0818 }, /* Index: 0x25, char: \x26 */
-    { 0x0e, 0x0850 }, /* Index: 0x26, char: \x27 */
-    { 0x0e, 0x0888 }, /* Index: 0x27, char: \x28 */
-    { 0x0e, 0x08c0 }, /* Index: 0x28, char: \x29 */
-    { 0x0e, 0x08f8 }, /* Index: 0x29, char: \x2a */
-    { 0x0e, 0x0930 }, /* Index: 0x2a, char: \x2b */
-    { 0x0e, 0x0968 }, /* Index: 0x2b, char: \x2c */
-    { 0x0e, 0x09a0 }, /* Index: 0x2c, char: \x2d */
-    { 0x0e, 0x09d8 }, /* Index: 0x2d, char: \x2e */
-    { 0x0e, 0x0a10 }, /* Index: 0x2e, char: \x2f */
-    { 0x0e, 0x0a48 }, /* Index: 0x2f, char: \x30 */
-    { 0x0e, 0x0a80 }, /* Index: 0x30, char: \x31 */
-    { 0x0e, 0x0ab8 }, /* Index: 0x31, char: \x32 */
-    { 0x0e, 0x0af0 }, /* Index: 0x32, char: \x33 */
-    { 0x0e, 0x0b28 }, /* Index: 0x33, char: \x34 */
-    { 0x0e, 0x0b60 }, /* Index: 0x34, char: \x35 */
-    { 0x0e, 0x0b98 }, /* Index: 0x35, char: \x36 */
-    { 0x0e, 0x0bd0 }, /* Index: 0x36, char: \x37 */
-    { 0x0e, 0x0c08 }, /* Index: 0x37, char: \x38 */
-    { 0x0e, 0x0c40 }, /* Index: 0x38, char: \x39 */
-    { 0x0e, 0x0c78 }, /* Index: 0x39, char: \x3a */
-    { 0x0e, 0x0cb0 }, /* Index: 0x3a, char: \x3b */
-    { 0x0e, 0x0ce8 }, /* Index: 0x3b, char: \x3c */
-    { 0x0e, 0x0d20 }, /* Index: 0x3c, char: \x3d */
-    { 0x0e, 0x0d58 }, /* Index: 0x3d, char: \x3e */
-    { 0x0e, 0x0d90 }, /* Index: 0x3e, char: \x3f */
-    { 0x0e, 0x0dc8 }, /* Index: 0x3f, char: \x40 */
-    { 0x0e, 0x0e00 }, /* Index: 0x40, char: \x41 */
-    { 0x0e, 0x0e38 }, /* Index: 0x41, char: \x42 */
-    { 0x0e, 0x0e70 }, /* Index: 0x42, char: \x43 */
-    { 0x0e, 0x0ea8 }, /* Index: 0x43, char: \x44 */
-    { 0x0e, 0x0ee0 }, /* Index: 0x44, char: \x45 */
-    { 0x0e, 0x0f18 }, /* Index: 0x45, char: \x46 */
-    { 0x0e, 0x0f50 }, /* Index: 0x46, char: \x47 */
-    { 0x0e, 0x0f88 }, /* Index: 0x47, char: \x48 */
-    { 0x0e, 0x0fc0 }, /* Index: 0x48, char: \x49 */
-    { 0x0e, 0x0ff8 }, /* Index: 0x49, char: \x4a */
-    { 0x0e, 0x1030 }, /* Index: 0x4a, char: \x4b */
-    { 0x0e, 0x1068 }, /* Index: 0x4b, char: \x4c */
-    { 0x0e, 0x10a0 }, /* Index: 0x4c, char: \x4d */
-    { 0x0e, 0x10d8 }, /* Index: 0x4d, char: \x4e */
-    { 0x0e, 0x1110 }, /* Index: 0x4e, char: \x4f */
-    { 0x0e, 0x1148 }, /* Index: 0x4f, char: \x50 */
-    { 0x0e, 0x1180 }, /* Index: 0x50, char: \x51 */
-    { 0x0e, 0x11b8 }, /* Index: 0x51, char: \x52 */
-    { 0x0e, 0x11f0 }, /* Index: 0x52, char: \x53 */
-    { 0x0e, 0x1228 }, /* Index: 0x53, char: \x54 */
-    { 0x0e, 0x1260 }, /* Index: 0x54, char: \x55 */
-    { 0x0e, 0x1298 }, /* Index: 0x55, char: \x56 */
-    { 0x0e, 0x12d0 }, /* Index: 0x56, char: \x57 */
-    { 0x0e, 0x1308 }, /* Index: 0x57, char: \x58 */
-    { 0x0e, 0x1340 }, /* Index: 0x58, char: \x59 */
-    { 0x0e, 0x1378 }, /* Index: 0x59, char: \x5a */
-    { 0x0e, 0x13b0 }, /* Index: 0x5a, char: \x5b */
-    { 0x0e, 0x13e8 }, /* Index: 0x5b, char: \x5c */
-    { 0x0e, 0x1420 }, /* Index: 0x5c, char: \x5d */
-    { 0x0e, 0x1458 }, /* Index: 0x5d, char: \x5e */
-    { 0x0e, 0x1490 }, /* Index: 0x5e, char: \x5f */
-    { 0x0e, 0x14c8 }, /* Index: 0x5f, char: \x60 */
-    { 0x0e, 0x1500 }, /* Index: 0x60, char: \x61 */
-    { 0x0e, 0x1538 }, /* Index: 0x61, char: \x62 */
-    { 0x0e, 0x1570 }, /* Index: 0x62, char: \x63 */
-    { 0x0e, 0x15a8 }, /* Index: 0x63, char: \x64 */
-    { 0x0e, 0x15e0 }, /* Index: 0x64, char: \x65 */
-    { 0x0e, 0x1618 }, /* Index: 0x65, char: \x66 */
-    { 0x0e, 0x1650 }, /* Index: 0x66, char: \x67 */
-    { 0x0e, 0x1688 }, /* Index: 0x67, char: \x68 */
-    { 0x0e, 0x16c0 }, /* Index: 0x68, char: \x69 */
-    { 0x0e, 0x16f8 }, /* Index: 0x69, char: \x6a */
-    { 0x0e, 0x1730 }, /* Index: 0x6a, char: \x6b */
-    { 0x0e, 0x1768 }, /* Index: 0x6b, char: \x6c */
-    { 0x0e, 0x17a0 }, /* Index: 0x6c, char: \x6d */
-    { 0x0e, 0x17d8 }, /* Index: 0x6d, char: \x6e */
-    { 0x0e, 0x1810 }, /* Index: 0x6e, char: \x6f */
-    { 0x0e, 0x1848 }, /* Index: 0x6f, char: \x70 */
-    { 0x0e, 0x1880 }, /* Index: 0x70, char: \x71 */
-    { 0x0e, 0x18b8 }, /* Index: 0x71, char: \x72 */
-    { 0x0e, 0x18f0 }, /* Index: 0x72, char: \x73 */
-    { 0x0e, 0x1928 }, /* Index: 0x73, char: \x74 */
-    { 0x0e, 0x1960 }, /* Index: 0x74, char: \x75 */
-    { 0x0e, 0x1998 }, /* Index: 0x75, char: \x76 */
-    { 0x0e, 0x19d0 }, /* Index: 0x76, char: \x77 */
-    { 0x0e, 0x1a08 }, /* Index: 0x77, char: \x78 */
-    { 0x0e, 0x1a40 }, /* Index: 0x78, char: \x79 */
-    { 0x0e, 0x1a78 }, /* Index: 0x79, char: \x7a */
-    { 0x0e, 0x1ab0 }, /* Index: 0x7a, char: \x7b */
-    { 0x0e, 0x1ae8 }, /* Index: 0x7b, char: \x7c */
-    { 0x0e, 0x1b20 }, /* Index: 0x7c, char: \x7d */
-    { 0x0e, 0x1b58 }, /* Index: 0x7d, char: \x7e */
-    { 0x0e, 0x1b90 }, /* Index: 0x7e, char: \x7f */
-    { 0x0e, 0x1bc8 }, /* Index: 0x7f, char: \x80 */
-    { 0x0e, 0x1c00 }, /* Index: 0x80, char: \x81 */
-    { 0x0e, 0x1c38 }, /* Index: 0x81, char: \x82 */
-    { 0x0e, 0x1c70 }, /* Index: 0x82, char: \x83 */
-    { 0x0e, 0x1ca8 }, /* Index: 0x83, char: \x84 */
-    { 0x0e, 0x1ce0 }, /* Index: 0x84, char: \x85 */
-    { 0x0e, 0x1d18 }, /* Index: 0x85, char: \x86 */
-    { 0x0e, 0x1d50 }, /* Index: 0x86, char: \x87 */
-    { 0x0e, 0x1d88 }, /* Index: 0x87, char: \x88 */
-    { 0x0e, 0x1dc0 }, /* Index: 0x88, char: \x89 */
-    { 0x0e, 0x1df8 }, /* Index: 0x89, char: \x8a */
-    { 0x0e, 0x1e30 }, /* Index: 0x8a, char: \x8b */
-    { 0x0e, 0x1e68 }, /* Index: 0x8b, char: \x8c */
-    { 0x0e, 0x1ea0 }, /* Index: 0x8c, char: \x8d */
-    { 0x0e, 0x1ed8 }, /* Index: 0x8d, char: \x8e */
-    { 0x0e, 0x1f10 }, /* Index: 0x8e, char: \x8f */
-    { 0x0e, 0x1f48 }, /* Index: 0x8f, char: \x90 */
-    { 0x0e, 0x1f80 }, /* Index: 0x90, char: \x91 */
-    { 0x0e, 0x1fb8 }, /* Index: 0x91, char: \x92 */
-    { 0x0e, 0x1ff0 }, /* Index: 0x92, char: \x93 */
-    { 0x0e, 0x2028 }, /* Index: 0x93, char: \x94 */
-    { 0x0e, 0x2060 }, /* Index: 0x94, char: \x95 */
-    { 0x0e, 0x2098 }, /* Index: 0x95, char: \x96 */
-    { 0x0e, 0x20d0 }, /* Index: 0x96, char: \x97 */
-    { 0x0e, 0x2108 }, /* Index: 0x97, char: \x98 */
-    { 0x0e, 0x2140 }, /* Index: 0x98, char: \x99 */
-    { 0x0e, 0x2178 }, /* Index: 0x99, char: \x9a */
-    { 0x0e, 0x21b0 }, /* Index: 0x9a, char: \x9b */
-    { 0x0e, 0x21e8 }, /* Index: 0x9b, char: \x9c */
-    { 0x0e, 0x2220 }, /* Index: 0x9c, char: \x9d */
-    { 0x0e, 0x2258 }, /* Index: 0x9d, char: \x9e */
-    { 0x0e, 0x2290 }, /* Index: 0x9e, char: \x9f */
-    { 0x0e, 0x22c8 }, /* Index: 0x9f, char: \xa0 */
-    { 0x0e, 0x2300 }, /* Index: 0xa0, char: \xa1 */
-    { 0x0e, 0x2338 }, /* Index: 0xa1, char: \xa2 */
-    { 0x0e, 0x2370 }, /* Index: 0xa2, char: \xa3 */
-    { 0x0e, 0x23a8 }, /* Index: 0xa3, char: \xa4 */
-    { 0x0e, 0x23e0 }, /* Index: 0xa4, char: \xa5 */
-    { 0x0e, 0x2418 }, /* Index: 0xa5, char: \xa6 */
-    { 0x0e, 0x2450 }, /* Index: 0xa6, char: \xa7 */
-    { 0x0e, 0x2488 }, /* Index: 0xa7, char: \xa8 */
-    { 0x0e, 0x24c0 }, /* Index: 0xa8, char: \xa9 */
-    { 0x0e, 0x24f8 }, /* Index: 0xa9, char: \xaa */
-    { 0x0e, 0x2530 }, /* Index: 0xaa, char: \xab */
-    { 0x0e, 0x2568 }, /* Index: 0xab, char: \xac */
-    { 0x0e, 0x25a0 }, /* Index: 0xac, char: \xad */
-    { 0x0e, 0x25d8 }, /* Index: 0xad, char: \xae */
-    { 0x0e, 0x2610 }, /* Index: 0xae, char: \xaf */
-    { 0x0e, 0x2648 }, /* Index: 0xaf, char: \xb0 */
-    { 0x0e, 0x2680 }, /* Index: 0xb0, char: \xb1 */
-    { 0x0e, 0x26b8 }, /* Index: 0xb1, char: \xb2 */
-    { 0x0e, 0x26f0 }, /* Index: 0xb2, char: \xb3 */
-    { 0x0e, 0x2728 }, /* Index: 0xb3, char: \xb4 */
-    { 0x0e, 0x2760 }, /* Index: 0xb4, char: \xb5 */
-    { 0x0e, 0x2798 }, /* Index: 0xb5, char: \xb6 */
-    { 0x0e, 0x27d0 }, /* Index: 0xb6, char: \xb7 */
-    { 0x0e, 0x2808 }, /* Index: 0xb7, char: \xb8 */
-    { 0x0e, 0x2840 }, /* Index: 0xb8, char: \xb9 */
-    { 0x0e, 0x2878 }, /* Index: 0xb9, char: \xba */
-    { 0x0e, 0x28b0 }, /* Index: 0xba, char: \xbb */
-    { 0x0e, 0x28e8 }, /* Index: 0xbb, char: \xbc */
-    { 0x0e, 0x2920 }, /* Index: 0xbc, char: \xbd */
-    { 0x0e, 0x2958 }, /* Index: 0xbd, char: \xbe */
-    { 0x0e, 0x2990 }, /* Index: 0xbe, char: \xbf */
-    { 0x0e, 0x29c8 }, /* Index: 0xbf, char: \xc0 */
-    { 0x0e, 0x2a00 }, /* Index: 0xc0, char: \xc1 */
-    { 0x0e, 0x2a38 }, /* Index: 0xc1, char: \xc2 */
-    { 0x0e, 0x2a70 }, /* Index: 0xc2, char: \xc3 */
-    { 0x0e, 0x2aa8 }, /* Index: 0xc3, char: \xc4 */
-    { 0x0e, 0x2ae0 }, /* Index: 0xc4, char: \xc5 */
-    { 0x0e, 0x2b18 }, /* Index: 0xc5, char: \xc6 */
-    { 0x0e, 0x2b50 }, /* Index: 0xc6, char: \xc7 */
-    { 0x0e, 0x2b88 }, /* Index: 0xc7, char: \xc8 */
-    { 0x0e, 0x2bc0 }, /* Index: 0xc8, char: \xc9 */
-    { 0x0e, 0x2bf8 }, /* Index: 0xc9, char: \xca */
-    { 0x0e, 0x2c30 }, /* Index: 0xca, char: \xcb */
-    { 0x0e, 0x2c68 }, /* Index: 0xcb, char: \xcc */
-    { 0x0e, 0x2ca0 }, /* Index: 0xcc, char: \xcd */
-    { 0x0e, 0x2cd8 }, /* Index: 0xcd, char: \xce */
-    { 0x0e, 0x2d10 }, /* Index: 0xce, char: \xcf */
-    { 0x0e, 0x2d48 }, /* Index: 0xcf, char: \xd0 */
-    { 0x0e, 0x2d80 }, /* Index: 0xd0, char: \xd1 */
-    { 0x0e, 0x2db8 }, /* Index: 0xd1, char: \xd2 */
-    { 0x0e, 0x2df0 }, /* Index: 0xd2, char: \xd3 */
-    { 0x0e, 0x2e28 }, /* Index: 0xd3, char: \xd4 */
-    { 0x0e, 0x2e60 }, /* Index: 0xd4, char: \xd5 */
-    { 0x0e, 0x2e98 }, /* Index: 0xd5, char: \xd6 */
-    { 0x0e, 0x2ed0 }, /* Index: 0xd6, char: \xd7 */
-    { 0x0e, 0x2f08 }, /* Index: 0xd7, char: \xd8 */
-    { 0x0e, 0x2f40 }, /* Index: 0xd8, char: \xd9 */
-    { 0x0e, 0x2f78 }, /* Index: 0xd9, char: \xda */
-    { 0x0e, 0x2fb0 }, /* Index: 0xda, char: \xdb */
-    { 0x0e, 0x2fe8 }, /* Index: 0xdb, char: \xdc */
-    { 0x0e, 0x3020 }, /* Index: 0xdc, char: \xdd */
-    { 0x0e, 0x3058 }, /* Index: 0xdd, char: \xde */
-    { 0x0e, 0x3090 }, /* Index: 0xde, char: \xdf */
-    { 0x0e, 0x30c8 }, /* Index: 0xdf, char: \xe0 */
-    { 0x0e, 0x3100 }, /* Index: 0xe0, char: \xe1 */
-    { 0x0e, 0x3138 }, /* Index: 0xe1, char: \xe2 */
-    { 0x0e, 0x3170 }, /* Index: 0xe2, char: \xe3 */
-    { 0x0e, 0x31a8 }, /* Index: 0xe3, char: \xe4 */
-    { 0x0e, 0x31e0 }, /* Index: 0xe4, char: \xe5 */
-    { 0x0e, 0x3218 }, /* Index: 0xe5, char: \xe6 */
-    { 0x0e, 0x3250 }, /* Index: 0xe6, char: \xe7 */
-    { 0x0e, 0x3288 }, /* Index: 0xe7, char: \xe8 */
-    { 0x0e, 0x32c0 }, /* Index: 0xe8, char: \xe9 */
-    { 0x0e, 0x32f8 }, /* Index: 0xe9, char: \xea */
-    { 0x0e, 0x3330 }, /* Index: 0xea, char: \xeb */
-    { 0x0e, 0x3368 }, /* Index: 0xeb, char: \xec */
-    { 0x0e, 0x33a0 }, /* Index: 0xec, char: \xed */
-    { 0x0e, 0x33d8 }, /* Index: 0xed, char: \xee */
-    { 0x0e, 0x3410 }, /* Index: 0xee, char: \xef */
-    { 0x0e, 0x3448 }, /* Index: 0xef, char: \xf0 */
-    { 0x0e, 0x3480 }, /* Index: 0xf0, char: \xf1 */
-    { 0x0e, 0x34b8 }, /* Index: 0xf1, char: \xf2 */
-    { 0x0e, 0x34f0 }, /* Index: 0xf2, char: \xf3 */
-    { 0x0e, 0x3528 }, /* Index: 0xf3, char: \xf4 */
-    { 0x0e, 0x3560 }, /* Index: 0xf4, char: \xf5 */
-    { 0x0e, 0x3598 }, /* Index: 0xf5, char: \xf6 */
-    { 0x0e, 0x35d0 }, /* Index: 0xf6, char: \xf7 */
-    { 0x0e, 0x3608 }, /* Index: 0xf7, char: \xf8 */
-    { 0x0e, 0x3640 }, /* Index: 0xf8, char: \xf9 */
-    { 0x0e, 0x3678 }, /* Index: 0xf9, char: \xfa */
-    { 0x0e, 0x36b0 }, /* Index: 0xfa, char: \xfb */
-    { 0x0e, 0x36e8 }, /* Index: 0xfb, char: \xfc */
-    { 0x0e, 0x3720 }, /* Index: 0xfc, char: \xfd */
-    { 0x0e, 0x3758 }, /* Index: 0xfd, char: \xfe */
-    { 0x0e, 0x3790 }, /* Index: 0xfe, char: \xff */
-};
-
 const font_info_t _fonts_terminus_14x28_iso8859_1_info =
 {
     .height           = 28, /* Character height */
     .c                = 0, /* C */
     .char_start       = 1, /* Start character */
     .char_end         = 255, /* End character */
-    .char_descriptors = _fonts_terminus_14x28_iso8859_1_descriptors, /* Character descriptor array */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
     .bitmap           = _fonts_terminus_14x28_iso8859_1_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 14, /* Glyph width */
+    .stride           = 56, /* Bytes per glyph */
 };
 
 #endif /* _EXTRAS_FONTS_FONT_TERMINUS_14X28_ISO8859_1_H_ */
@@ -0,0 +1,9065 @@
+/**
+ * This file contains generated binary font data.
+ *
+ * Font:    terminus_14x28_iso8859_1
+ * Height:  28
+ * Layout:  row-major, monospace
+ * 255 characters in 50 ranges (1..255)
+ * 43 glyphs identical to an earlier one, stored once
+ *
+ * Font:    terminus_14x28_koi8_r
+ * Height:  28
+ * Layout:  row-major, monospace
+ * 255 characters in 73 ranges (1..255)
+ * 171 glyphs identical to an earlier one, stored once
+ *
+ * Copyright (c) 2015 Dimitar Toshkov Zhekov
+ * License: SIL Open Font License, Version 1.1. The license is included as OFL.TXT, and is
+ *      also available with a FAQ at http://scripts.sil.org/OFL
+ *
+ * Source:  builtin:terminus_14x28_iso8859_1, builtin:terminus_14x28_koi8_r
+ * Generated by tools/fontc, do not edit. Command:
+ *     fontc -q --mono --rows --pool terminus_14x28_shared --comment ../../main/fonts/src/terminus.txt -o ../../main/fonts/font_terminus_14x28_shared.h builtin:terminus_14x28_iso8859_1 builtin:terminus_14x28_koi8_r
+ */
+#ifndef _EXTRAS_FONTS_FONT_TERMINUS_14X28_SHARED_H_
+#define _EXTRAS_FONTS_FONT_TERMINUS_14X28_SHARED_H_
+
+static const uint8_t _fonts_terminus_14x28_shared_bitmaps[] = {
+
+    /* Index: 0x00, char: \x01, offset: 0x0000 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x02, 0x00, /* ......#....... */
+    0x07, 0x00, /* .....###...... */
+    0x0f, 0x80, /* ....#####..... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x3f, 0xe0, /* ..#########... */
+    0x7f, 0xf0, /* .###########.. */
+    0xff, 0xf8, /* #############. */
+    0xff, 0xf8, /* #############. */
+    0x7f, 0xf0, /* .###########.. */
+    0x3f, 0xe0, /* ..#########... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x0f, 0x80, /* ....#####..... */
+    0x07, 0x00, /* .....###...... */
+    0x02, 0x00, /* ......#....... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x01, char: \x02, offset: 0x0038 */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x55, 0x54, /* .#.#.#.#.#.#.# */
+
+    /* Index: 0x02, char: \x03, offset: 0x0070 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x63, 0x00, /* .##...##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x7f, 0x00, /* .#######...... */
+    0x63, 0x00, /* .##...##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0xf8, /* .....########. */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x03, char: \x04, offset: 0x00a8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0x00, /* .#######...... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7c, 0x00, /* .#####........ */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0xf8, /* ......#######. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0xe0, /* ......#####... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x04, char: \x05, offset: 0x00e0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3e, 0x00, /* ..#####....... */
+    0x63, 0x00, /* .##...##...... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x63, 0x00, /* .##...##...... */
+    0x3e, 0x00, /* ..#####....... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0xf0, /* ......######.. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0xf0, /* ......######.. */
+    0x03, 0xc0, /* ......####.... */
+    0x03, 0x60, /* ......##.##... */
+    0x03, 0x30, /* ......##..##.. */
+    0x03, 0x18, /* ......##...##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x05, char: \x06, offset: 0x0118 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0x00, /* .#######...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0xf8, /* ......#######. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0xe0, /* ......#####... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x06, char: \x07, offset: 0x0150 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0f, 0x80, /* ....#####..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x0f, 0x80, /* ....#####..... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x07, char: \x08, offset: 0x0188 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x7f, 0xf8, /* .############. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf8, /* .############. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x08, char: \x09, offset: 0x01c0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x63, 0x00, /* .##...##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x73, 0x00, /* .###..##...... */
+    0x7b, 0x00, /* .####.##...... */
+    0x6f, 0x00, /* .##.####...... */
+    0x67, 0x00, /* .##..###...... */
+    0x63, 0x00, /* .##...##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0xf8, /* ......#######. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x09, char: \x0a, offset: 0x01f8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x0a, char: \x0b, offset: 0x0230 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0xff, 0x00, /* ########...... */
+    0xff, 0x00, /* ########...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x0b, char: \x0c, offset: 0x0268 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0x00, /* ########...... */
+    0xff, 0x00, /* ########...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0x0c, char: \x0d, offset: 0x02a0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0x0d, char: \x0e, offset: 0x02d8 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0xfc, /* ......######## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x0e, char: \x0f, offset: 0x0310 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0x11, char: \x12, offset: 0x0348 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x14, char: \x15, offset: 0x0380 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0x15, char: \x16, offset: 0x03b8 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0xff, 0x00, /* ########...... */
+    0xff, 0x00, /* ########...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0x16, char: \x17, offset: 0x03f0 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x17, char: \x18, offset: 0x0428 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0x18, char: \x19, offset: 0x0460 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0x19, char: \x1a, offset: 0x0498 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x60, /* .........##... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x30, 0x00, /* ..##.......... */
+    0x18, 0x00, /* ...##......... */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x01, 0x80, /* .......##..... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x1a, char: \x1b, offset: 0x04d0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x30, 0x00, /* ..##.......... */
+    0x18, 0x00, /* ...##......... */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x01, 0x80, /* .......##..... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x30, 0x00, /* ..##.......... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x1b, char: \x1c, offset: 0x0508 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x1c, char: \x1d, offset: 0x0540 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x18, /* ...........##. */
+    0x00, 0x30, /* ..........##.. */
+    0x7f, 0xf8, /* .############. */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x7f, 0xf8, /* .############. */
+    0x30, 0x00, /* ..##.......... */
+    0x60, 0x00, /* .##........... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x1d, char: \x1e, offset: 0x0578 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0x80, /* .....####..... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x18, 0x60, /* ...##....##... */
+    0x18, 0x00, /* ...##......... */
+    0x18, 0x00, /* ...##......... */
+    0x18, 0x00, /* ...##......... */
+    0x18, 0x00, /* ...##......... */
+    0x18, 0x00, /* ...##......... */
+    0x3f, 0x80, /* ..#######..... */
+    0x18, 0x00, /* ...##......... */
+    0x18, 0x00, /* ...##......... */
+    0x18, 0x00, /* ...##......... */
+    0x18, 0x00, /* ...##......... */
+    0x18, 0x00, /* ...##......... */
+    0x18, 0x00, /* ...##......... */
+    0x18, 0x30, /* ...##.....##.. */
+    0x38, 0x30, /* ..###.....##.. */
+    0x3f, 0xf0, /* ..##########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x1e, char: \x1f, offset: 0x05b0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x20, char: !, offset: 0x05e8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x21, char: ", offset: 0x0620 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x22, char: #, offset: 0x0658 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x7f, 0xf0, /* .###########.. */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x7f, 0xf0, /* .###########.. */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x23, char: $, offset: 0x0690 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x1f, 0xe0, /* ...########... */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x00, /* .##...##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x33, 0x00, /* ..##..##...... */
+    0x1f, 0xe0, /* ...########... */
+    0x03, 0x30, /* ......##..##.. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x1f, 0xe0, /* ...########... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x24, char: %, offset: 0x06c8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3c, 0x30, /* ..####....##.. */
+    0x66, 0x30, /* .##..##...##.. */
+    0x66, 0x60, /* .##..##..##... */
+    0x66, 0x60, /* .##..##..##... */
+    0x3c, 0xc0, /* ..####..##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0xf0, /* ....##..####.. */
+    0x19, 0x98, /* ...##..##..##. */
+    0x19, 0x98, /* ...##..##..##. */
+    0x31, 0x98, /* ..##...##..##. */
+    0x30, 0xf0, /* ..##....####.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x25, char: &, offset: 0x0700 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0f, 0x00, /* ....####...... */
+    0x19, 0x80, /* ...##..##..... */
+    0x30, 0xc0, /* ..##....##.... */
+    0x30, 0xc0, /* ..##....##.... */
+    0x30, 0xc0, /* ..##....##.... */
+    0x30, 0xc0, /* ..##....##.... */
+    0x19, 0x80, /* ...##..##..... */
+    0x0f, 0x00, /* ....####...... */
+    0x0e, 0x00, /* ....###....... */
+    0x1b, 0x18, /* ...##.##...##. */
+    0x31, 0x98, /* ..##...##..##. */
+    0x60, 0xf0, /* .##.....####.. */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0xf0, /* .##.....####.. */
+    0x31, 0x98, /* ..##...##..##. */
+    0x1f, 0x18, /* ...#####...##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x26, char: ', offset: 0x0738 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x27, char: (, offset: 0x0770 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x01, 0x80, /* .......##..... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x28, char: ), offset: 0x07a8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x29, char: \x2a, offset: 0x07e0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x30, 0x30, /* ..##......##.. */
+    0x18, 0x60, /* ...##....##... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x07, 0x80, /* .....####..... */
+    0x03, 0x00, /* ......##...... */
+    0x7f, 0xf8, /* .############. */
+    0x03, 0x00, /* ......##...... */
+    0x07, 0x80, /* .....####..... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x18, 0x60, /* ...##....##... */
+    0x30, 0x30, /* ..##......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x2a, char: +, offset: 0x0818 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x7f, 0xf8, /* .############. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x2b, char: ,, offset: 0x0850 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x2c, char: -, offset: 0x0888 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x2d, char: ., offset: 0x08c0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x2e, char: \x2f, offset: 0x08f8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x18, 0x00, /* ...##......... */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x2f, char: 0, offset: 0x0930 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x70, /* .##......###.. */
+    0x60, 0xf0, /* .##.....####.. */
+    0x61, 0xb0, /* .##....##.##.. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x66, 0x30, /* .##..##...##.. */
+    0x6c, 0x30, /* .##.##....##.. */
+    0x78, 0x30, /* .####.....##.. */
+    0x70, 0x30, /* .###......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x30, char: 1, offset: 0x0968 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x07, 0x00, /* .....###...... */
+    0x0f, 0x00, /* ....####...... */
+    0x1b, 0x00, /* ...##.##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x1f, 0xe0, /* ...########... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x31, char: 2, offset: 0x09a0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x30, 0x00, /* ..##.......... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x32, char: 3, offset: 0x09d8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x33, char: 4, offset: 0x0a10 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x70, /* .........###.. */
+    0x00, 0xf0, /* ........####.. */
+    0x01, 0xb0, /* .......##.##.. */
+    0x03, 0x30, /* ......##..##.. */
+    0x06, 0x30, /* .....##...##.. */
+    0x0c, 0x30, /* ....##....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x34, char: 5, offset: 0x0a48 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xc0, /* .#########.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x35, char: 6, offset: 0x0a80 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xe0, /* ...########... */
+    0x30, 0x00, /* ..##.......... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x36, char: 7, offset: 0x0ab8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x37, char: 8, offset: 0x0af0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x38, char: 9, offset: 0x0b28 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x3f, 0xc0, /* ..########.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x39, char: :, offset: 0x0b60 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x3a, char: ;, offset: 0x0b98 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x3b, char: <, offset: 0x0bd0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x30, 0x00, /* ..##.......... */
+    0x18, 0x00, /* ...##......... */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x01, 0x80, /* .......##..... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x3c, char: =, offset: 0x0c08 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x3d, char: >, offset: 0x0c40 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x30, 0x00, /* ..##.......... */
+    0x18, 0x00, /* ...##......... */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x01, 0x80, /* .......##..... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x30, 0x00, /* ..##.......... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x3e, char: ?, offset: 0x0c78 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x60, /* .........##... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x3f, char: @, offset: 0x0cb0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xe0, /* ...########... */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x61, 0xf8, /* .##....######. */
+    0x63, 0x18, /* .##...##...##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x61, 0xe8, /* .##....####.#. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x30, 0x00, /* ..##.......... */
+    0x1f, 0xf8, /* ...##########. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x40, char: A, offset: 0x0ce8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x41, char: B, offset: 0x0d20 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x7f, 0xc0, /* .#########.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x42, char: C, offset: 0x0d58 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x43, char: D, offset: 0x0d90 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0x00, /* .#######...... */
+    0x61, 0xc0, /* .##....###.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x61, 0xc0, /* .##....###.... */
+    0x7f, 0x00, /* .#######...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x44, char: E, offset: 0x0dc8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0x80, /* .########..... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x45, char: F, offset: 0x0e00 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0x80, /* .########..... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x46, char: G, offset: 0x0e38 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x63, 0xf0, /* .##...######.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x47, char: H, offset: 0x0e70 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x48, char: I, offset: 0x0ea8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0f, 0xc0, /* ....######.... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x49, char: J, offset: 0x0ee0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x01, 0xf8, /* .......######. */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x30, 0xc0, /* ..##....##.... */
+    0x1f, 0x80, /* ...######..... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x4a, char: K, offset: 0x0f18 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0xc0, /* .##.....##.... */
+    0x61, 0x80, /* .##....##..... */
+    0x63, 0x00, /* .##...##...... */
+    0x66, 0x00, /* .##..##....... */
+    0x6c, 0x00, /* .##.##........ */
+    0x78, 0x00, /* .####......... */
+    0x70, 0x00, /* .###.......... */
+    0x70, 0x00, /* .###.......... */
+    0x78, 0x00, /* .####......... */
+    0x6c, 0x00, /* .##.##........ */
+    0x66, 0x00, /* .##..##....... */
+    0x63, 0x00, /* .##...##...... */
+    0x61, 0x80, /* .##....##..... */
+    0x60, 0xc0, /* .##.....##.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x4b, char: L, offset: 0x0f50 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x4c, char: M, offset: 0x0f88 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x70, 0x38, /* .###......###. */
+    0x78, 0x78, /* .####....####. */
+    0x6c, 0xd8, /* .##.##..##.##. */
+    0x6c, 0xd8, /* .##.##..##.##. */
+    0x67, 0x98, /* .##..####..##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x4d, char: N, offset: 0x0fc0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x70, 0x30, /* .###......##.. */
+    0x78, 0x30, /* .####.....##.. */
+    0x6c, 0x30, /* .##.##....##.. */
+    0x66, 0x30, /* .##..##...##.. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x61, 0xb0, /* .##....##.##.. */
+    0x60, 0xf0, /* .##.....####.. */
+    0x60, 0x70, /* .##......###.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x4e, char: O, offset: 0x0ff8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x4f, char: P, offset: 0x1030 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x50, char: Q, offset: 0x1068 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x31, 0xe0, /* ..##...####... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x51, char: R, offset: 0x10a0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x7f, 0xc0, /* .#########.... */
+    0x78, 0x00, /* .####......... */
+    0x6c, 0x00, /* .##.##........ */
+    0x66, 0x00, /* .##..##....... */
+    0x63, 0x00, /* .##...##...... */
+    0x61, 0x80, /* .##....##..... */
+    0x60, 0xc0, /* .##.....##.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x52, char: S, offset: 0x10d8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x30, 0x00, /* ..##.......... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x53, char: T, offset: 0x1110 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf8, /* .############. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x54, char: U, offset: 0x1148 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x55, char: V, offset: 0x1180 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x60, /* ..##.....##... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x07, 0x00, /* .....###...... */
+    0x07, 0x00, /* .....###...... */
+    0x07, 0x00, /* .....###...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x56, char: W, offset: 0x11b8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x67, 0x98, /* .##..####..##. */
+    0x6c, 0xd8, /* .##.##..##.##. */
+    0x6c, 0xd8, /* .##.##..##.##. */
+    0x78, 0x78, /* .####....####. */
+    0x70, 0x38, /* .###......###. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x57, char: X, offset: 0x11f0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x60, /* ..##.....##... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x07, 0x00, /* .....###...... */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x58, char: Y, offset: 0x1228 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x18, 0x60, /* ...##....##... */
+    0x18, 0x60, /* ...##....##... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x07, 0x80, /* .....####..... */
+    0x07, 0x80, /* .....####..... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x59, char: Z, offset: 0x1260 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x30, 0x00, /* ..##.......... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x5a, char: [, offset: 0x1298 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0f, 0xc0, /* ....######.... */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x5b, char: \x5c, offset: 0x12d0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x18, 0x00, /* ...##......... */
+    0x18, 0x00, /* ...##......... */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x01, 0x80, /* .......##..... */
+    0x01, 0x80, /* .......##..... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x5c, char: ], offset: 0x1308 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x5d, char: ^, offset: 0x1340 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x02, 0x00, /* ......#....... */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x5e, char: _, offset: 0x1378 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x5f, char: `, offset: 0x13b0 */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x60, char: a, offset: 0x13e8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x61, char: b, offset: 0x1420 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x7f, 0xc0, /* .#########.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x62, char: c, offset: 0x1458 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x63, char: d, offset: 0x1490 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x64, char: e, offset: 0x14c8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xe0, /* ...########... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x65, char: f, offset: 0x1500 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0xf0, /* ......######.. */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x3f, 0xc0, /* ..########.... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x66, char: g, offset: 0x1538 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x3f, 0xc0, /* ..########.... */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x67, char: h, offset: 0x1570 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x68, char: i, offset: 0x15a8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0f, 0x00, /* ....####...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x69, char: j, offset: 0x15e0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x01, 0xe0, /* .......####... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x60, /* ..##.....##... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x0f, 0x80, /* ....#####..... */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x6a, char: k, offset: 0x1618 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0xc0, /* ..##....##.... */
+    0x31, 0x80, /* ..##...##..... */
+    0x33, 0x00, /* ..##..##...... */
+    0x36, 0x00, /* ..##.##....... */
+    0x3c, 0x00, /* ..####........ */
+    0x36, 0x00, /* ..##.##....... */
+    0x33, 0x00, /* ..##..##...... */
+    0x31, 0x80, /* ..##...##..... */
+    0x30, 0xc0, /* ..##....##.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x30, /* ..##......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x6b, char: l, offset: 0x1650 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0f, 0x00, /* ....####...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x6c, char: m, offset: 0x1688 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xe0, /* .##########... */
+    0x63, 0x30, /* .##...##..##.. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x6d, char: n, offset: 0x16c0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x6e, char: o, offset: 0x16f8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x6f, char: p, offset: 0x1730 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x70, char: q, offset: 0x1768 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x71, char: r, offset: 0x17a0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x67, 0xf0, /* .##..#######.. */
+    0x6c, 0x00, /* .##.##........ */
+    0x78, 0x00, /* .####......... */
+    0x70, 0x00, /* .###.......... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x72, char: s, offset: 0x17d8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x30, 0x00, /* ..##.......... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x73, char: t, offset: 0x1810 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x3f, 0xc0, /* ..########.... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0xe0, /* ......#####... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x74, char: u, offset: 0x1848 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x75, char: v, offset: 0x1880 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x60, /* ..##.....##... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x07, 0x00, /* .....###...... */
+    0x07, 0x00, /* .....###...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x76, char: w, offset: 0x18b8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x1f, 0xe0, /* ...########... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x77, char: x, offset: 0x18f0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x07, 0x00, /* .....###...... */
+    0x07, 0x00, /* .....###...... */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x78, char: y, offset: 0x1928 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x3f, 0xc0, /* ..########.... */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x79, char: z, offset: 0x1960 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x30, 0x00, /* ..##.......... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x7a, char: {, offset: 0x1998 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x01, 0xc0, /* .......###.... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x1c, 0x00, /* ...###........ */
+    0x1c, 0x00, /* ...###........ */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x01, 0xc0, /* .......###.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x7b, char: |, offset: 0x19d0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x7c, char: }, offset: 0x1a08 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1c, 0x00, /* ...###........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x01, 0xc0, /* .......###.... */
+    0x01, 0xc0, /* .......###.... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x1c, 0x00, /* ...###........ */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x7d, char: ~, offset: 0x1a40 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3c, 0x30, /* ..####....##.. */
+    0x66, 0x30, /* .##..##...##.. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x61, 0xe0, /* .##....####... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xa0, char: \xa1, offset: 0x1a78 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xa1, char: \xa2, offset: 0x1ab0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x1b, 0x60, /* ...##.##.##... */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x33, 0x00, /* ..##..##...... */
+    0x33, 0x00, /* ..##..##...... */
+    0x33, 0x00, /* ..##..##...... */
+    0x33, 0x00, /* ..##..##...... */
+    0x33, 0x00, /* ..##..##...... */
+    0x33, 0x00, /* ..##..##...... */
+    0x33, 0x00, /* ..##..##...... */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x1b, 0x60, /* ...##.##.##... */
+    0x0f, 0xc0, /* ....######.... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xa3, char: \xa4, offset: 0x1ae8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x18, /* .##........##. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xe0, /* ...########... */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xe0, /* ...########... */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x18, /* .##........##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xa4, char: \xa5, offset: 0x1b20 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x18, 0x60, /* ...##....##... */
+    0x18, 0x60, /* ...##....##... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x07, 0x80, /* .....####..... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x3f, 0xf0, /* ..##########.. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x3f, 0xf0, /* ..##########.. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xa5, char: \xa6, offset: 0x1b58 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xa6, char: \xa7, offset: 0x1b90 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0x80, /* .....####..... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x18, 0x60, /* ...##....##... */
+    0x18, 0x00, /* ...##......... */
+    0x1c, 0x00, /* ...###........ */
+    0x0f, 0x00, /* ....####...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0x60, /* ...##....##... */
+    0x18, 0x60, /* ...##....##... */
+    0x18, 0x60, /* ...##....##... */
+    0x18, 0x60, /* ...##....##... */
+    0x0c, 0x60, /* ....##...##... */
+    0x06, 0xc0, /* .....##.##.... */
+    0x03, 0xc0, /* ......####.... */
+    0x00, 0xe0, /* ........###... */
+    0x00, 0x60, /* .........##... */
+    0x18, 0x60, /* ...##....##... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x07, 0x80, /* .....####..... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xa7, char: \xa8, offset: 0x1bc8 */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xa8, char: \xa9, offset: 0x1c00 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3f, 0xe0, /* ..#########... */
+    0x60, 0x30, /* .##.......##.. */
+    0xcf, 0x98, /* ##..#####..##. */
+    0xd8, 0xd8, /* ##.##...##.##. */
+    0xd8, 0xd8, /* ##.##...##.##. */
+    0xd8, 0x18, /* ##.##......##. */
+    0xd8, 0x18, /* ##.##......##. */
+    0xd8, 0x18, /* ##.##......##. */
+    0xd8, 0x18, /* ##.##......##. */
+    0xd8, 0xd8, /* ##.##...##.##. */
+    0xd8, 0xd8, /* ##.##...##.##. */
+    0xcf, 0x98, /* ##..#####..##. */
+    0x60, 0x30, /* .##.......##.. */
+    0x3f, 0xe0, /* ..#########... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xa9, char: \xaa, offset: 0x1c38 */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x0f, 0xf0, /* ....########.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x0f, 0xf0, /* ....########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3f, 0xf0, /* ..##########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xaa, char: \xab, offset: 0x1c70 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x01, 0x98, /* .......##..##. */
+    0x03, 0x30, /* ......##..##.. */
+    0x06, 0x60, /* .....##..##... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x19, 0x80, /* ...##..##..... */
+    0x33, 0x00, /* ..##..##...... */
+    0x66, 0x00, /* .##..##....... */
+    0x33, 0x00, /* ..##..##...... */
+    0x19, 0x80, /* ...##..##..... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x06, 0x60, /* .....##..##... */
+    0x03, 0x30, /* ......##..##.. */
+    0x01, 0x98, /* .......##..##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xab, char: \xac, offset: 0x1ca8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xac, char: \xad, offset: 0x1ce0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3f, 0xf0, /* ..##########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xad, char: \xae, offset: 0x1d18 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3f, 0xe0, /* ..#########... */
+    0x60, 0x30, /* .##.......##.. */
+    0xdf, 0x98, /* ##.######..##. */
+    0xd8, 0xd8, /* ##.##...##.##. */
+    0xd8, 0xd8, /* ##.##...##.##. */
+    0xd8, 0xd8, /* ##.##...##.##. */
+    0xd8, 0xd8, /* ##.##...##.##. */
+    0xdf, 0x98, /* ##.######..##. */
+    0xde, 0x18, /* ##.####....##. */
+    0xdb, 0x18, /* ##.##.##...##. */
+    0xd9, 0x98, /* ##.##..##..##. */
+    0xd8, 0xd8, /* ##.##...##.##. */
+    0x60, 0x30, /* .##.......##.. */
+    0x3f, 0xe0, /* ..#########... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xae, char: \xaf, offset: 0x1d50 */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xb1, char: \xb2, offset: 0x1d88 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0f, 0x80, /* ....#####..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xb2, char: \xb3, offset: 0x1dc0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0f, 0x80, /* ....#####..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x07, 0x80, /* .....####..... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x0f, 0x80, /* ....#####..... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xb3, char: \xb4, offset: 0x1df8 */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xb4, char: \xb5, offset: 0x1e30 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x70, /* .##......###.. */
+    0x60, 0xf0, /* .##.....####.. */
+    0x61, 0xb0, /* .##....##.##.. */
+    0x7f, 0x30, /* .#######..##.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xb5, char: \xb6, offset: 0x1e68 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3f, 0xf8, /* ..###########. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x3f, 0x18, /* ..######...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xb7, char: \xb8, offset: 0x1ea0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xb8, char: \xb9, offset: 0x1ed8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x07, 0x00, /* .....###...... */
+    0x0f, 0x00, /* ....####...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xb9, char: \xba, offset: 0x1f10 */
+    0x00, 0x00, /* .............. */
+    0x0f, 0xc0, /* ....######.... */
+    0x18, 0x60, /* ...##....##... */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x18, 0x60, /* ...##....##... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3f, 0xf0, /* ..##########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xba, char: \xbb, offset: 0x1f48 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x66, 0x00, /* .##..##....... */
+    0x33, 0x00, /* ..##..##...... */
+    0x19, 0x80, /* ...##..##..... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x06, 0x60, /* .....##..##... */
+    0x03, 0x30, /* ......##..##.. */
+    0x01, 0x98, /* .......##..##. */
+    0x03, 0x30, /* ......##..##.. */
+    0x06, 0x60, /* .....##..##... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x19, 0x80, /* ...##..##..... */
+    0x33, 0x00, /* ..##..##...... */
+    0x66, 0x00, /* .##..##....... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xbb, char: \xbc, offset: 0x1f80 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0c, 0x00, /* ....##........ */
+    0x1c, 0x00, /* ...###........ */
+    0x3c, 0x00, /* ..####........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x10, /* ....##.....#.. */
+    0x0c, 0x30, /* ....##....##.. */
+    0x0c, 0x60, /* ....##...##... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x30, /* ......##..##.. */
+    0x06, 0x70, /* .....##..###.. */
+    0x0c, 0xf0, /* ....##..####.. */
+    0x19, 0xb0, /* ...##..##.##.. */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x66, 0x30, /* .##..##...##.. */
+    0x47, 0xf0, /* .#...#######.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xbc, char: \xbd, offset: 0x1fb8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x18, 0x00, /* ...##......... */
+    0x38, 0x00, /* ..###......... */
+    0x78, 0x10, /* .####......#.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x60, /* ...##....##... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x19, 0x80, /* ...##..##..... */
+    0x1b, 0x00, /* ...##.##...... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x1b, 0xe0, /* ...##.#####... */
+    0x36, 0x30, /* ..##.##...##.. */
+    0x66, 0x30, /* .##..##...##.. */
+    0x40, 0x60, /* .#.......##... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x07, 0xf0, /* .....#######.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xbd, char: \xbe, offset: 0x1ff0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3e, 0x00, /* ..#####....... */
+    0x63, 0x00, /* .##...##...... */
+    0x03, 0x00, /* ......##...... */
+    0x1e, 0x00, /* ...####....... */
+    0x03, 0x08, /* ......##....#. */
+    0x03, 0x18, /* ......##...##. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x3e, 0x60, /* ..#####..##... */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x98, /* .......##..##. */
+    0x03, 0x38, /* ......##..###. */
+    0x06, 0x78, /* .....##..####. */
+    0x0c, 0xd8, /* ....##..##.##. */
+    0x19, 0x98, /* ...##..##..##. */
+    0x33, 0x18, /* ..##..##...##. */
+    0x63, 0xf8, /* .##...#######. */
+    0x00, 0x18, /* ...........##. */
+    0x00, 0x18, /* ...........##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xbe, char: \xbf, offset: 0x2028 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x30, 0x00, /* ..##.......... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xbf, char: \xc0, offset: 0x2060 */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc0, char: \xc1, offset: 0x2098 */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc1, char: \xc2, offset: 0x20d0 */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc2, char: \xc3, offset: 0x2108 */
+    0x1c, 0x60, /* ...###...##... */
+    0x37, 0x60, /* ..##.###.##... */
+    0x31, 0xc0, /* ..##...###.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc3, char: \xc4, offset: 0x2140 */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc4, char: \xc5, offset: 0x2178 */
+    0x07, 0x80, /* .....####..... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x07, 0x80, /* .....####..... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc5, char: \xc6, offset: 0x21b0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3f, 0xf8, /* ..###########. */
+    0x63, 0x00, /* .##...##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xff, 0xf0, /* ############.. */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0xf8, /* ##....#######. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc6, char: \xc7, offset: 0x21e8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc7, char: \xc8, offset: 0x2220 */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0x80, /* .########..... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc8, char: \xc9, offset: 0x2258 */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0x80, /* .########..... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc9, char: \xca, offset: 0x2290 */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0x80, /* .########..... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xca, char: \xcb, offset: 0x22c8 */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0x80, /* .########..... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xf0, /* .###########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xcb, char: \xcc, offset: 0x2300 */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x0f, 0xc0, /* ....######.... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xcc, char: \xcd, offset: 0x2338 */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x0f, 0xc0, /* ....######.... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xcd, char: \xce, offset: 0x2370 */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x0f, 0xc0, /* ....######.... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xce, char: \xcf, offset: 0x23a8 */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x0f, 0xc0, /* ....######.... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xcf, char: \xd0, offset: 0x23e0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0x00, /* .#######...... */
+    0x61, 0xc0, /* .##....###.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0xfe, 0x30, /* #######...##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x61, 0xc0, /* .##....###.... */
+    0x7f, 0x00, /* .#######...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd0, char: \xd1, offset: 0x2418 */
+    0x1c, 0x60, /* ...###...##... */
+    0x37, 0x60, /* ..##.###.##... */
+    0x31, 0xc0, /* ..##...###.... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x70, 0x30, /* .###......##.. */
+    0x78, 0x30, /* .####.....##.. */
+    0x6c, 0x30, /* .##.##....##.. */
+    0x66, 0x30, /* .##..##...##.. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x61, 0xb0, /* .##....##.##.. */
+    0x60, 0xf0, /* .##.....####.. */
+    0x60, 0x70, /* .##......###.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd1, char: \xd2, offset: 0x2450 */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd2, char: \xd3, offset: 0x2488 */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd3, char: \xd4, offset: 0x24c0 */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd4, char: \xd5, offset: 0x24f8 */
+    0x1c, 0x60, /* ...###...##... */
+    0x37, 0x60, /* ..##.###.##... */
+    0x31, 0xc0, /* ..##...###.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd5, char: \xd6, offset: 0x2530 */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd6, char: \xd7, offset: 0x2568 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x18, /* .##........##. */
+    0x30, 0x30, /* ..##......##.. */
+    0x18, 0x60, /* ...##....##... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x07, 0x80, /* .....####..... */
+    0x03, 0x00, /* ......##...... */
+    0x07, 0x80, /* .....####..... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x18, 0x60, /* ...##....##... */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x18, /* .##........##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd7, char: \xd8, offset: 0x25a0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x38, /* .##.......###. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x70, /* .##......###.. */
+    0x60, 0xf0, /* .##.....####.. */
+    0x61, 0xb0, /* .##....##.##.. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x66, 0x30, /* .##..##...##.. */
+    0x6c, 0x30, /* .##.##....##.. */
+    0x78, 0x30, /* .####.....##.. */
+    0x70, 0x30, /* .###......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0xe0, 0x30, /* ###.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd8, char: \xd9, offset: 0x25d8 */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd9, char: \xda, offset: 0x2610 */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xda, char: \xdb, offset: 0x2648 */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xdb, char: \xdc, offset: 0x2680 */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xdc, char: \xdd, offset: 0x26b8 */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x18, 0x60, /* ...##....##... */
+    0x18, 0x60, /* ...##....##... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x07, 0x80, /* .....####..... */
+    0x07, 0x80, /* .....####..... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xdd, char: \xde, offset: 0x26f0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xde, char: \xdf, offset: 0x2728 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3f, 0x80, /* ..#######..... */
+    0x60, 0xc0, /* .##.....##.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0xc0, /* .##.....##.... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x70, 0x30, /* .###......##.. */
+    0x6c, 0x60, /* .##.##...##... */
+    0x67, 0xc0, /* .##..#####.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xdf, char: \xe0, offset: 0x2760 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe0, char: \xe1, offset: 0x2798 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe1, char: \xe2, offset: 0x27d0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe2, char: \xe3, offset: 0x2808 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1c, 0x60, /* ...###...##... */
+    0x37, 0x60, /* ..##.###.##... */
+    0x31, 0xc0, /* ..##...###.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe3, char: \xe4, offset: 0x2840 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe4, char: \xe5, offset: 0x2878 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0x80, /* .....####..... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x07, 0x80, /* .....####..... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe5, char: \xe6, offset: 0x28b0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7d, 0xe0, /* .#####.####... */
+    0x07, 0x30, /* .....###..##.. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x3f, 0x18, /* ..######...##. */
+    0x63, 0xf8, /* .##...#######. */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0xc3, 0x00, /* ##....##...... */
+    0x63, 0x98, /* .##...###..##. */
+    0x3e, 0xf0, /* ..#####.####.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe6, char: \xe7, offset: 0x28e8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x06, 0x00, /* .....##....... */
+    0x0c, 0x00, /* ....##........ */
+    0x18, 0x00, /* ...##......... */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe7, char: \xe8, offset: 0x2920 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xe0, /* ...########... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe8, char: \xe9, offset: 0x2958 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xe0, /* ...########... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe9, char: \xea, offset: 0x2990 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xe0, /* ...########... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xea, char: \xeb, offset: 0x29c8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xe0, /* ...########... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xeb, char: \xec, offset: 0x2a00 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x0f, 0x00, /* ....####...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xec, char: \xed, offset: 0x2a38 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0xc0, /* ........##.... */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x0f, 0x00, /* ....####...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xed, char: \xee, offset: 0x2a70 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x0f, 0x00, /* ....####...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xee, char: \xef, offset: 0x2aa8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x0f, 0x00, /* ....####...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xef, char: \xf0, offset: 0x2ae0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x19, 0x80, /* ...##..##..... */
+    0x0f, 0x00, /* ....####...... */
+    0x1e, 0x00, /* ...####....... */
+    0x33, 0x00, /* ..##..##...... */
+    0x01, 0x80, /* .......##..... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf0, char: \xf1, offset: 0x2b18 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3c, 0x60, /* ..####...##... */
+    0x66, 0x60, /* .##..##..##... */
+    0x63, 0xc0, /* .##...####.... */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf1, char: \xf2, offset: 0x2b50 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf2, char: \xf3, offset: 0x2b88 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf3, char: \xf4, offset: 0x2bc0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf4, char: \xf5, offset: 0x2bf8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1c, 0x60, /* ...###...##... */
+    0x37, 0x60, /* ..##.###.##... */
+    0x31, 0xc0, /* ..##...###.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf5, char: \xf6, offset: 0x2c30 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf6, char: \xf7, offset: 0x2c68 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf8, /* .############. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf7, char: \xf8, offset: 0x2ca0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xd8, /* ...#######.##. */
+    0x30, 0x78, /* ..##.....####. */
+    0x60, 0x70, /* .##......###.. */
+    0x60, 0xf0, /* .##.....####.. */
+    0x61, 0xb0, /* .##....##.##.. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x66, 0x30, /* .##..##...##.. */
+    0x6c, 0x30, /* .##.##....##.. */
+    0x78, 0x30, /* .####.....##.. */
+    0x70, 0x30, /* .###......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0xf0, 0x60, /* ####.....##... */
+    0xdf, 0xc0, /* ##.#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf8, char: \xf9, offset: 0x2cd8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0c, 0x00, /* ....##........ */
+    0x06, 0x00, /* .....##....... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf9, char: \xfa, offset: 0x2d10 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xfa, char: \xfb, offset: 0x2d48 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0x00, /* .....###...... */
+    0x0d, 0x80, /* ....##.##..... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xfb, char: \xfc, offset: 0x2d80 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xfc, char: \xfd, offset: 0x2db8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x01, 0x80, /* .......##..... */
+    0x03, 0x00, /* ......##...... */
+    0x06, 0x00, /* .....##....... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x3f, 0xc0, /* ..########.... */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xfd, char: \xfe, offset: 0x2df0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xfe, char: \xff, offset: 0x2e28 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x3f, 0xc0, /* ..########.... */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x8a, char: \x8b, offset: 0x2e60 */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x8b, char: \x8c, offset: 0x2e98 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+
+    /* Index: 0x8c, char: \x8d, offset: 0x2ed0 */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+
+    /* Index: 0x8d, char: \x8e, offset: 0x2f08 */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+    0xfe, 0x00, /* #######....... */
+
+    /* Index: 0x8e, char: \x8f, offset: 0x2f40 */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+    0x01, 0xfc, /* .......####### */
+
+    /* Index: 0x8f, char: \x90, offset: 0x2f78 */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x91, char: \x92, offset: 0x2fb0 */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+    0xff, 0xfc, /* ############## */
+    0xaa, 0xa8, /* #.#.#.#.#.#.#. */
+
+    /* Index: 0x92, char: \x93, offset: 0x2fe8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x01, 0xf0, /* .......#####.. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x18, /* ......##...##. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0x93, char: \x94, offset: 0x3020 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3f, 0xe0, /* ..#########... */
+    0x3f, 0xe0, /* ..#########... */
+    0x3f, 0xe0, /* ..#########... */
+    0x3f, 0xe0, /* ..#########... */
+    0x3f, 0xe0, /* ..#########... */
+    0x3f, 0xe0, /* ..#########... */
+    0x3f, 0xe0, /* ..#########... */
+    0x3f, 0xe0, /* ..#########... */
+    0x3f, 0xe0, /* ..#########... */
+    0x3f, 0xe0, /* ..#########... */
+    0x3f, 0xe0, /* ..#########... */
+    0x3f, 0xe0, /* ..#########... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x94, char: \x95, offset: 0x3058 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0x00, /* .....###...... */
+    0x0f, 0x80, /* ....#####..... */
+    0x0f, 0x80, /* ....#####..... */
+    0x0f, 0x80, /* ....#####..... */
+    0x07, 0x00, /* .....###...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x95, char: \x96, offset: 0x3090 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x78, /* .........####. */
+    0x00, 0x78, /* .........####. */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x60, /* .........##... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x60, /* .##......##... */
+    0x30, 0x60, /* ..##.....##... */
+    0x18, 0x60, /* ...##....##... */
+    0x0c, 0x60, /* ....##...##... */
+    0x06, 0x60, /* .....##..##... */
+    0x03, 0x60, /* ......##.##... */
+    0x01, 0xe0, /* .......####... */
+    0x00, 0xe0, /* ........###... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x96, char: \x97, offset: 0x30c8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1c, 0x30, /* ...###....##.. */
+    0x36, 0x30, /* ..##.##...##.. */
+    0x63, 0x60, /* .##...##.##... */
+    0x61, 0xc0, /* .##....###.... */
+    0x00, 0x00, /* .............. */
+    0x1c, 0x30, /* ...###....##.. */
+    0x36, 0x30, /* ..##.##...##.. */
+    0x63, 0x60, /* .##...##.##... */
+    0x61, 0xc0, /* .##....###.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x9a, char: \x9b, offset: 0x3100 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x63, 0x00, /* .##...##...... */
+    0x3e, 0x00, /* ..#####....... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0x9f, char: \xa0, offset: 0x3138 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xa0, char: \xa1, offset: 0x3170 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xa1, char: \xa2, offset: 0x31a8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0xa3, char: \xa4, offset: 0x31e0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0f, 0xfc, /* ....########## */
+    0x0f, 0xfc, /* ....########## */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xa4, char: \xa5, offset: 0x3218 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x0f, 0xfc, /* ....########## */
+    0x0f, 0xfc, /* ....########## */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0xfc, /* ....##..###### */
+    0x0c, 0xfc, /* ....##..###### */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xa5, char: \xa6, offset: 0x3250 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0x00, /* ########...... */
+    0xff, 0x00, /* ########...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0xff, 0x00, /* ########...... */
+    0xff, 0x00, /* ########...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0xa6, char: \xa7, offset: 0x3288 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xc0, /* ##########.... */
+    0xff, 0xc0, /* ##########.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xa7, char: \xa8, offset: 0x32c0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xc0, /* ##########.... */
+    0xff, 0xc0, /* ##########.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0xfc, 0xc0, /* ######..##.... */
+    0xfc, 0xc0, /* ######..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xa8, char: \xa9, offset: 0x32f8 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0xfc, /* ......######## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xa9, char: \xaa, offset: 0x3330 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0f, 0xfc, /* ....########## */
+    0x0f, 0xfc, /* ....########## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xaa, char: \xab, offset: 0x3368 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xfc, /* ....##..###### */
+    0x0c, 0xfc, /* ....##..###### */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0f, 0xfc, /* ....########## */
+    0x0f, 0xfc, /* ....########## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xab, char: \xac, offset: 0x33a0 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0xff, 0x00, /* ########...... */
+    0xff, 0x00, /* ########...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0xff, 0x00, /* ########...... */
+    0xff, 0x00, /* ########...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xac, char: \xad, offset: 0x33d8 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0xff, 0xc0, /* ##########.... */
+    0xff, 0xc0, /* ##########.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xad, char: \xae, offset: 0x3410 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0xfc, 0xc0, /* ######..##.... */
+    0xfc, 0xc0, /* ######..##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0xff, 0xc0, /* ##########.... */
+    0xff, 0xc0, /* ##########.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xae, char: \xaf, offset: 0x3448 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0xfc, /* ......######## */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0xaf, char: \xb0, offset: 0x3480 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xfc, /* ....##..###### */
+    0x0c, 0xfc, /* ....##..###### */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xb0, char: \xb1, offset: 0x34b8 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xfc, /* ....##..###### */
+    0x0c, 0xfc, /* ....##..###### */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0x00, /* ....##........ */
+    0x0c, 0xfc, /* ....##..###### */
+    0x0c, 0xfc, /* ....##..###### */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xb1, char: \xb2, offset: 0x34f0 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0xff, 0x00, /* ########...... */
+    0xff, 0x00, /* ########...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0xff, 0x00, /* ########...... */
+    0xff, 0x00, /* ########...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0xb3, char: \xb4, offset: 0x3528 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0xfc, 0xc0, /* ######..##.... */
+    0xfc, 0xc0, /* ######..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xb4, char: \xb5, offset: 0x3560 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0xfc, 0xc0, /* ######..##.... */
+    0xfc, 0xc0, /* ######..##.... */
+    0x00, 0xc0, /* ........##.... */
+    0x00, 0xc0, /* ........##.... */
+    0xfc, 0xc0, /* ######..##.... */
+    0xfc, 0xc0, /* ######..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xb5, char: \xb6, offset: 0x3598 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0xb6, char: \xb7, offset: 0x35d0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xb7, char: \xb8, offset: 0x3608 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xfc, 0xfc, /* ######..###### */
+    0xfc, 0xfc, /* ######..###### */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xb8, char: \xb9, offset: 0x3640 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xb9, char: \xba, offset: 0x3678 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xba, char: \xbb, offset: 0x36b0 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0xfc, 0xfc, /* ######..###### */
+    0xfc, 0xfc, /* ######..###### */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xbb, char: \xbc, offset: 0x36e8 */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+
+    /* Index: 0xbc, char: \xbd, offset: 0x3720 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0xff, 0xfc, /* ############## */
+    0xff, 0xfc, /* ############## */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xbd, char: \xbe, offset: 0x3758 */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0xfc, 0xfc, /* ######..###### */
+    0xfc, 0xfc, /* ######..###### */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xfc, 0xfc, /* ######..###### */
+    0xfc, 0xfc, /* ######..###### */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+    0x0c, 0xc0, /* ....##..##.... */
+
+    /* Index: 0xbf, char: \xc0, offset: 0x3790 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x61, 0xe0, /* .##....####... */
+    0x63, 0x30, /* .##...##..##.. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x7e, 0x18, /* .######....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x61, 0xe0, /* .##....####... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc1, char: \xc2, offset: 0x37c8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x00, /* ..##.......... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x7f, 0xc0, /* .#########.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc2, char: \xc3, offset: 0x3800 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf8, /* ...##########. */
+    0x00, 0x18, /* ...........##. */
+    0x00, 0x18, /* ...........##. */
+    0x00, 0x18, /* ...........##. */
+    0x00, 0x18, /* ...........##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc5, char: \xc6, offset: 0x3838 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x1f, 0xe0, /* ...########... */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x1f, 0xe0, /* ...########... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc6, char: \xc7, offset: 0x3870 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xc9, char: \xca, offset: 0x38a8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x0f, 0x80, /* ....#####..... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xca, char: \xcb, offset: 0x38e0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0xc0, /* ..##....##.... */
+    0x31, 0x80, /* ..##...##..... */
+    0x33, 0x00, /* ..##..##...... */
+    0x36, 0x00, /* ..##.##....... */
+    0x3c, 0x00, /* ..####........ */
+    0x36, 0x00, /* ..##.##....... */
+    0x33, 0x00, /* ..##..##...... */
+    0x31, 0x80, /* ..##...##..... */
+    0x30, 0xc0, /* ..##....##.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x30, /* ..##......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xcb, char: \xcc, offset: 0x3918 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0xf0, /* .....#######.. */
+    0x0c, 0x30, /* ....##....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xcc, char: \xcd, offset: 0x3950 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x70, 0x38, /* .###......###. */
+    0x78, 0x78, /* .####....####. */
+    0x6c, 0xd8, /* .##.##..##.##. */
+    0x6c, 0xd8, /* .##.##..##.##. */
+    0x67, 0x98, /* .##..####..##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xcd, char: \xce, offset: 0x3988 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd0, char: \xd1, offset: 0x39c0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x01, 0xb0, /* .......##.##.. */
+    0x03, 0x30, /* ......##..##.. */
+    0x06, 0x30, /* .....##...##.. */
+    0x0c, 0x30, /* ....##....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd3, char: \xd4, offset: 0x39f8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf8, /* .############. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd5, char: \xd6, offset: 0x3a30 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x1b, 0x60, /* ...##.##.##... */
+    0x0f, 0xc0, /* ....######.... */
+    0x1b, 0x60, /* ...##.##.##... */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd6, char: \xd7, offset: 0x3a68 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x3f, 0x00, /* ..######...... */
+    0x61, 0x80, /* .##....##..... */
+    0x60, 0xc0, /* .##.....##.... */
+    0x60, 0xc0, /* .##.....##.... */
+    0x60, 0xc0, /* .##.....##.... */
+    0x60, 0xc0, /* .##.....##.... */
+    0x61, 0x80, /* .##....##..... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x7f, 0xc0, /* .#########.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd7, char: \xd8, offset: 0x3aa0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x3f, 0xc0, /* ..########.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x3f, 0xc0, /* ..########.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd8, char: \xd9, offset: 0x3ad8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x7f, 0x18, /* .#######...##. */
+    0x61, 0x98, /* .##....##..##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x61, 0x98, /* .##....##..##. */
+    0x7f, 0x18, /* .#######...##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xd9, char: \xda, offset: 0x3b10 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x0f, 0xc0, /* ....######.... */
+    0x00, 0x60, /* .........##... */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xda, char: \xdb, offset: 0x3b48 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x33, 0x18, /* ..##..##...##. */
+    0x1f, 0xf8, /* ...##########. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xdb, char: \xdc, offset: 0x3b80 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x0f, 0xf0, /* ....########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xdc, char: \xdd, offset: 0x3bb8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x33, 0x18, /* ..##..##...##. */
+    0x1f, 0xfc, /* ...########### */
+    0x00, 0x0c, /* ............## */
+    0x00, 0x0c, /* ............## */
+    0x00, 0x0c, /* ............## */
+    0x00, 0x0c, /* ............## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xdd, char: \xde, offset: 0x3bf0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xde, char: \xdf, offset: 0x3c28 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xf0, 0x00, /* ####.......... */
+    0xf0, 0x00, /* ####.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x3f, 0xc0, /* ..########.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x3f, 0xc0, /* ..########.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xdf, char: \xe0, offset: 0x3c60 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x61, 0xe0, /* .##....####... */
+    0x63, 0x30, /* .##...##..##.. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x7e, 0x18, /* .######....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x66, 0x18, /* .##..##....##. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x61, 0xe0, /* .##....####... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe1, char: \xe2, offset: 0x3c98 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xe0, /* .##########... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x7f, 0xc0, /* .#########.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe2, char: \xe3, offset: 0x3cd0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf8, /* ...##########. */
+    0x00, 0x18, /* ...........##. */
+    0x00, 0x18, /* ...........##. */
+    0x00, 0x18, /* ...........##. */
+    0x00, 0x18, /* ...........##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe3, char: \xe4, offset: 0x3d08 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0xf0, /* .....#######.. */
+    0x0c, 0x30, /* ....##....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x7f, 0xf8, /* .############. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe5, char: \xe6, offset: 0x3d40 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x1f, 0xe0, /* ...########... */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x1f, 0xe0, /* ...########... */
+    0x03, 0x00, /* ......##...... */
+    0x03, 0x00, /* ......##...... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe6, char: \xe7, offset: 0x3d78 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe8, char: \xe9, offset: 0x3db0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x70, /* .##......###.. */
+    0x60, 0xf0, /* .##.....####.. */
+    0x61, 0xb0, /* .##....##.##.. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x66, 0x30, /* .##..##...##.. */
+    0x6c, 0x30, /* .##.##....##.. */
+    0x78, 0x30, /* .####.....##.. */
+    0x70, 0x30, /* .###......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xe9, char: \xea, offset: 0x3de8 */
+    0x18, 0xc0, /* ...##...##.... */
+    0x18, 0xc0, /* ...##...##.... */
+    0x0f, 0x80, /* ....#####..... */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x70, /* .##......###.. */
+    0x60, 0xf0, /* .##.....####.. */
+    0x61, 0xb0, /* .##....##.##.. */
+    0x63, 0x30, /* .##...##..##.. */
+    0x66, 0x30, /* .##..##...##.. */
+    0x6c, 0x30, /* .##.##....##.. */
+    0x78, 0x30, /* .####.....##.. */
+    0x70, 0x30, /* .###......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xeb, char: \xec, offset: 0x3e20 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x07, 0xf0, /* .....#######.. */
+    0x0c, 0x30, /* ....##....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xef, char: \xf0, offset: 0x3e58 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x7f, 0xf0, /* .###########.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf0, char: \xf1, offset: 0x3e90 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0xf0, /* ........####.. */
+    0x01, 0xb0, /* .......##.##.. */
+    0x03, 0x30, /* ......##..##.. */
+    0x06, 0x30, /* .....##...##.. */
+    0x0c, 0x30, /* ....##....##.. */
+    0x18, 0x30, /* ...##.....##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf4, char: \xf5, offset: 0x3ec8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x60, /* .........##... */
+    0x3f, 0xc0, /* ..########.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf5, char: \xf6, offset: 0x3f00 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x1b, 0x60, /* ...##.##.##... */
+    0x0f, 0xc0, /* ....######.... */
+    0x1b, 0x60, /* ...##.##.##... */
+    0x33, 0x30, /* ..##..##..##.. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf7, char: \xf8, offset: 0x3f38 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x60, 0x00, /* .##........... */
+    0x7f, 0xc0, /* .#########.... */
+    0x60, 0x60, /* .##......##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x60, /* .##......##... */
+    0x7f, 0xc0, /* .#########.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xf8, char: \xf9, offset: 0x3f70 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x60, 0x18, /* .##........##. */
+    0x7f, 0x18, /* .#######...##. */
+    0x61, 0x98, /* .##....##..##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x60, 0xd8, /* .##.....##.##. */
+    0x61, 0x98, /* .##....##..##. */
+    0x7f, 0x18, /* .#######...##. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xfa, char: \xfb, offset: 0x3fa8 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x33, 0x18, /* ..##..##...##. */
+    0x1f, 0xf8, /* ...##########. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xfb, char: \xfc, offset: 0x3fe0 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x1f, 0xc0, /* ...#######.... */
+    0x30, 0x60, /* ..##.....##... */
+    0x60, 0x30, /* .##.......##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x0f, 0xf0, /* ....########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x60, /* ..##.....##... */
+    0x1f, 0xc0, /* ...#######.... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xfc, char: \xfd, offset: 0x4018 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x63, 0x18, /* .##...##...##. */
+    0x33, 0x18, /* ..##..##...##. */
+    0x1f, 0xfc, /* ...########### */
+    0x00, 0x0c, /* ............## */
+    0x00, 0x0c, /* ............## */
+    0x00, 0x0c, /* ............## */
+    0x00, 0x0c, /* ............## */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xfd, char: \xfe, offset: 0x4050 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x60, 0x30, /* .##.......##.. */
+    0x30, 0x30, /* ..##......##.. */
+    0x1f, 0xf0, /* ...#########.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x30, /* ..........##.. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+
+    /* Index: 0xfe, char: \xff, offset: 0x4088 */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0xf0, 0x00, /* ####.......... */
+    0xf0, 0x00, /* ####.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x30, 0x00, /* ..##.......... */
+    0x3f, 0xe0, /* ..#########... */
+    0x30, 0x30, /* ..##......##.. */
+    0x30, 0x18, /* ..##.......##. */
+    0x30, 0x18, /* ..##.......##. */
+    0x30, 0x18, /* ..##.......##. */
+    0x30, 0x18, /* ..##.......##. */
+    0x30, 0x18, /* ..##.......##. */
+    0x30, 0x18, /* ..##.......##. */
+    0x30, 0x18, /* ..##.......##. */
+    0x30, 0x18, /* ..##.......##. */
+    0x30, 0x30, /* ..##......##.. */
+    0x3f, 0xe0, /* ..#########... */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+    0x00, 0x00, /* .............. */
+};
+
+static const font_range_t _fonts_terminus_14x28_iso8859_1_ranges[] = {
+    { 0x0001, 0x000f,    0 },
+    { 0x0010, 0x0010,    9 },
+    { 0x0011, 0x0011,    9 },
+    { 0x0012, 0x0012,   15 },
+    { 0x0013, 0x0013,    9 },
+    { 0x0014, 0x0014,    9 },
+    { 0x0015, 0x001f,   16 },
+    { 0x0020, 0x0020,    9 },
+    { 0x0021, 0x007e,   27 },
+    { 0x007f, 0x007f,    9 },
+    { 0x0080, 0x0080,    9 },
+    { 0x0081, 0x0081,    9 },
+    { 0x0082, 0x0082,    9 },
+    { 0x0083, 0x0083,    9 },
+    { 0x0084, 0x0084,    9 },
+    { 0x0085, 0x0085,    9 },
+    { 0x0086, 0x0086,    9 },
+    { 0x0087, 0x0087,    9 },
+    { 0x0088, 0x0088,    9 },
+    { 0x0089, 0x0089,    9 },
+    { 0x008a, 0x008a,    9 },
+    { 0x008b, 0x008b,    9 },
+    { 0x008c, 0x008c,    9 },
+    { 0x008d, 0x008d,    9 },
+    { 0x008e, 0x008e,    9 },
+    { 0x008f, 0x008f,    9 },
+    { 0x0090, 0x0090,    9 },
+    { 0x0091, 0x0091,    9 },
+    { 0x0092, 0x0092,    9 },
+    { 0x0093, 0x0093,    9 },
+    { 0x0094, 0x0094,    9 },
+    { 0x0095, 0x0095,    9 },
+    { 0x0096, 0x0096,    9 },
+    { 0x0097, 0x0097,    9 },
+    { 0x0098, 0x0098,    9 },
+    { 0x0099, 0x0099,    9 },
+    { 0x009a, 0x009a,    9 },
+    { 0x009b, 0x009b,    9 },
+    { 0x009c, 0x009c,    9 },
+    { 0x009d, 0x009d,    9 },
+    { 0x009e, 0x009e,    9 },
+    { 0x009f, 0x009f,    9 },
+    { 0x00a0, 0x00a0,    9 },
+    { 0x00a1, 0x00a2,  121 },
+    { 0x00a3, 0x00a3,   25 },
+    { 0x00a4, 0x00af,  123 },
+    { 0x00b0, 0x00b1,    6 },
+    { 0x00b2, 0x00b6,  135 },
+    { 0x00b7, 0x00b7,   26 },
+    { 0x00b8, 0x00ff,  140 },
+};
+
+const font_info_t _fonts_terminus_14x28_iso8859_1_info =
+{
+    .height           = 28, /* Character height */
+    .c                = 0, /* C */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
+    .bitmap           = _fonts_terminus_14x28_shared_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 14, /* Glyph width */
+    .stride           = 56, /* Bytes per glyph */
+    .ranges           = _fonts_terminus_14x28_iso8859_1_ranges, /* Code point ranges */
+    .num_ranges       = 50, /* Number of ranges */
+};
+
+static const font_range_t _fonts_terminus_14x28_koi8_r_ranges[] = {
+    { 0x0001, 0x000f,    0 },
+    { 0x0010, 0x0010,    9 },
+    { 0x0011, 0x0011,    9 },
+    { 0x0012, 0x0012,   15 },
+    { 0x0013, 0x0013,    9 },
+    { 0x0014, 0x0014,    9 },
+    { 0x0015, 0x001f,   16 },
+    { 0x0020, 0x0020,    9 },
+    { 0x0021, 0x007e,   27 },
+    { 0x007f, 0x007f,    9 },
+    { 0x0080, 0x0080,   15 },
+    { 0x0081, 0x0081,   20 },
+    { 0x0082, 0x0082,   12 },
+    { 0x0083, 0x0083,   11 },
+    { 0x0084, 0x0084,   13 },
+    { 0x0085, 0x0085,   10 },
+    { 0x0086, 0x0087,   16 },
+    { 0x0088, 0x0088,   19 },
+    { 0x0089, 0x0089,   18 },
+    { 0x008a, 0x008a,   14 },
+    { 0x008b, 0x0090,  212 },
+    { 0x0091, 0x0091,    1 },
+    { 0x0092, 0x0097,  218 },
+    { 0x0098, 0x0099,   21 },
+    { 0x009a, 0x009a,    9 },
+    { 0x009b, 0x009b,  224 },
+    { 0x009c, 0x009c,    6 },
+    { 0x009d, 0x009d,  135 },
+    { 0x009e, 0x009e,   26 },
+    { 0x009f, 0x009f,  203 },
+    { 0x00a0, 0x00a2,  225 },
+    { 0x00a3, 0x00a3,  191 },
+    { 0x00a4, 0x00b2,  228 },
+    { 0x00b3, 0x00b3,  159 },
+    { 0x00b4, 0x00be,  243 },
+    { 0x00bf, 0x00bf,  128 },
+    { 0x00c0, 0x00c0,  254 },
+    { 0x00c1, 0x00c1,   91 },
+    { 0x00c2, 0x00c3,  255 },
+    { 0x00c4, 0x00c4,   97 },
+    { 0x00c5, 0x00c5,   95 },
+    { 0x00c6, 0x00c7,  257 },
+    { 0x00c8, 0x00c8,  114 },
+    { 0x00c9, 0x00c9,  111 },
+    { 0x00ca, 0x00ce,  259 },
+    { 0x00cf, 0x00cf,  105 },
+    { 0x00d0, 0x00d0,   23 },
+    { 0x00d1, 0x00d1,  264 },
+    { 0x00d2, 0x00d2,  106 },
+    { 0x00d3, 0x00d3,   93 },
+    { 0x00d4, 0x00d4,  265 },
+    { 0x00d5, 0x00d5,  115 },
+    { 0x00d6, 0x00e0,  266 },
+    { 0x00e1, 0x00e1,   59 },
+    { 0x00e2, 0x00e4,  277 },
+    { 0x00e5, 0x00e5,   63 },
+    { 0x00e6, 0x00e7,  280 },
+    { 0x00e8, 0x00e8,   82 },
+    { 0x00e9, 0x00ea,  282 },
+    { 0x00eb, 0x00eb,   69 },
+    { 0x00ec, 0x00ec,  284 },
+    { 0x00ed, 0x00ed,   71 },
+    { 0x00ee, 0x00ee,   66 },
+    { 0x00ef, 0x00ef,   73 },
+    { 0x00f0, 0x00f1,  285 },
+    { 0x00f2, 0x00f2,   74 },
+    { 0x00f3, 0x00f3,   61 },
+    { 0x00f4, 0x00f4,   78 },
+    { 0x00f5, 0x00f6,  287 },
+    { 0x00f7, 0x00f7,   60 },
+    { 0x00f8, 0x00f9,  289 },
+    { 0x00fa, 0x00fa,   45 },
+    { 0x00fb, 0x00ff,  291 },
+};
+
+const font_info_t _fonts_terminus_14x28_koi8_r_info =
+{
+    .height           = 28, /* Character height */
+    .c                = 0, /* C */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
+    .bitmap           = _fonts_terminus_14x28_shared_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 14, /* Glyph width */
+    .stride           = 56, /* Bytes per glyph */
+    .ranges           = _fonts_terminus_14x28_koi8_r_ranges, /* Code point ranges */
+    .num_ranges       = 73, /* Number of ranges */
+};
+
+#endif /* _EXTRAS_FONTS_FONT_TERMINUS_14X28_SHARED_H_ */
@@ -8688,272 +8688,17 @@ static const uint8_t _fonts_terminus_16x32_iso8859_1_bitmaps[] = {
     0x00, 0x00, /* ................ */
 };
 
-const font_char_desc_t _fonts_terminus_16x32_iso8859_1_descriptors[] = {
-    { 0x10, 0x0000 }, /* Index: 0x00, char: \x01 */
-    { 0x10, 0x0040 }, /* Index: 0x01, char: \x02 */
-    { 0x10, 0x0080 }, /* Index: 0x02, char: \x03 */
-    { 0x10, 0x00c0 }, /* Index: 0x03, char: \x04 */
-    { 0x10, 0x0100 }, /* Index: 0x04, char: \x05 */
-    { 0x10, 0x0140 }, /* Index: 0x05, char: \x06 */
-    { 0x10, 0x0180 }, /* Index: 0x06, char: \x07 */
-    { 0x10, 0x01c0 }, /* Index: 0x07, char: \x08 */
-    { 0x10, 0x0200 }, /* Index: 0x08, char: \x09 */
-    { 0x10, 0x0240 }, /* Index: 0x09, char: \x0a */
-    { 0x10, 0x0280 }, /* Index: 0x0a, char: \x0b */
-    { 0x10, 0x02c0 }, /* Index: 0x0b, char: \x0c */
-    { 0x10, 0x0300 }, /* Index: 0x0c, char: \x0d */
-    { 0x10, 0x0340 }, /* Index: 0x0d, char: \x0e */
-    { 0x10, 0x0380 }, /* Index: 0x0e, char: \x0f */
-    { 0x10, 0x03c0 }, /* Index: 0x0f, char: \x10 */
-    { 0x10, 0x0400 }, /* Index: 0x10, char: \x11 */
-    { 0x10, 0x0440 }, /* Index: 0x11, char: \x12 */
-    { 0x10, 0x0480 }, /* Index: 0x12, char: \x13 */
-    { 0x10, 0x04c0 }, /* Index: 0x13, char: \x14 */
-    { 0x10, 0x0500 }, /* Index: 0x14, char: \x15 */
-    { 0x10, 0x0540 }, /* Index: 0x15, char: \x16 */
-    { 0x10, 0x0580 }, /* Index: 0x16, char: \x17 */
-    { 0x10, 0x05c0 }, /* Index: 0x17, char: \x18 */
-    { 0x10, 0x0600 }, /* Index: 0x18, char: \x19 */
-    { 0x10, 0x0640 }, /* Index: 0x19, char: \x1a */
-    { 0x10, 0x0680 }, /* Index: 0x1a, char: \x1b */
-    { 0x10, 0x06c0 }, /* Index: 0x1b, char: \x1c */
-    { 0x10, 0x0700 }, /* Index: 0x1c, char: \x1d */
-    { 0x10, 0x0740 }, /* Index: 0x1d, char: \x1e */
-    { 0x10, 0x0780 }, /* Index: 0x1e, char: \x1f */
-    { 0x10, 0x07c0 }, /* Index: 0x1f, char: \x20 */
-    { 0x10, 0x0800 }, /* Index: 0x20, char: \x21 */
-    { 0x10, 0x0840 }, /* Index: 0x21, char: \x22 */
-    { 0x10, 0x0880 }, /* Index: 0x22, char: \x23 */
-    { 0x10, 0x08c0 }, /* Index: 0x23, char: \x24 */
-    { 0x10, 0x0900 }, /* Index: 0x24, char: \x25 */
-    { 0x10, 0x0940 }, /* Index: 0x25, char: \x26 */
-    { 0x10, 0x0980 }, /* Index: 0x26, char: \x27 */
-    { 0x10, 0x09c0 }, /* Index: 0x27, char: \x28 */
-    { 0x10, 0x0a00 }, /* Index: 0x28, char: \x29 */
-    { 0x10, 0x0a40 }, /* Index: 0x29, char: \x2a */
-    { 0x10, 0x0a80 }, /* Index: 0x2a, char: \x2b */
-    { 0x10, 0x0ac0 }, /* Index: 0x2b, char: \x2c */
-    { 0x10, 0x0b00 }, /* Index: 0x2c, char: \x2d */
-    { 0x10, 0x0b40 }, /* Index: 0x2d, char: \x2e */
-    { 0x10, 0x0b80 }, /* Index: 0x2e, char: \x2f */
-    { 0x10, 0x0bc0 }, /* Index: 0x2f, char: \x30 */
-    { 0x10, 0x0c00 }, /* Index: 0x30, char: \x31 */
-    { 0x10, 0x0c40 }, /* Index: 0x31, char: \x32 */
-    { 0x10, 0x0c80 }, /* Index: 0x32, char: \x33 */
-    { 0x10, 0x0cc0 }, /* Index: 0x33, char: \x34 */
-    { 0x10, 0x0d00 }, /* Index: 0x34, char: \x35 */
-    { 0x10, 0x0d40 }, /* Index: 0x35, char: \x36 */
-    { 0x10, 0x0d80 }, /* Index: 0x36, char: \x37 */
-    { 0x10, 0x0dc0 }, /* Index: 0x37, char: \x38 */
-    { 0x10, 0x0e00 }, /* Index: 0x38, char: \x39 */
-    { 0x10, 0x0e40 }, /* Index: 0x39, char: \x3a */
-    { 0x10, 0x0e80 }, /* Index: 0x3a, char: \x3b */
-    { 0x10, 0x0ec0 }, /* Index: 0x3b, char: \x3c */
-    { 0x10, 0x0f00 }, /* Index: 0x3c, char: \x3d */
-    { 0x10, 0x0f40 }, /* Index: 0x3d, char: \x3e */
-    { 0x10, 0x0f80 }, /* Index: 0x3e, char: \x3f */
-    { 0x10, 0x0fc0 }, /* Index: 0x3f, char: \x40 */
-    { 0x10, 0x1000 }, /* Index: 0x40, char: \x41 */
-    { 0x10, 0x1040 }, /* Index: 0x41, char: \x42 */
-    { 0x10, 0x1080 }, /* Index: 0x42, char: \x43 */
-    { 0x10, 0x10c0 }, /* Index: 0x43, char: \x44 */
-    { 0x10, 0x1100 }, /* Index: 0x44, char: \x45 */
-    { 0x10, 0x1140 }, /* Index: 0x45, char: \x46 */
-    { 0x10, 0x1180 }, /* Index: 0x46, char: \x47 */
-    { 0x10, 0x11c0 }, /* Index: 0x47, char: \x48 */
-    { 0x10, 0x1200 }, /* Index: 0x48, char: \x49 */
-    { 0x10, 0x1240 }, /* Index: 0x49, char: \x4a */
-    { 0x10, 0x1280 }, /* Index: 0x4a, char: \x4b */
-    { 0x10, 0x12c0 }, /* Index: 0x4b, char: \x4c */
-    { 0x10, 0x1300 }, /* Index: 0x4c, char: \x4d */
-    { 0x10, 0x1340 }, /* Index: 0x4d, char: \x4e */
-    { 0x10, 0x1380 }, /* Index: 0x4e, char: \x4f */
-    { 0x10, 0x13c0 }, /* Index: 0x4f, char: \x50 */
-    { 0x10, 0x1400 }, /* Index: 0x50, char: \x51 */
-    { 0x10, 0x1440 }, /* Index: 0x51, char: \x52 */
-    { 0x10, 0x1480 }, /* Index: 0x52, char: \x53 */
-    { 0x10, 0x14c0 }, /* Index: 0x53, char: \x54 */
-    { 0x10, 0x1500 }, /* Index: 0x54, char: \x55 */
-    { 0x10, 0x1540 }, /* Index: 0x55, char: \x56 */
-    { 0x10, 0x1580 }, /* Index: 0x56, char: \x57 */
-    { 0x10, 0x15c0 }, /* Index: 0x57, char: \x58 */
-    { 0x10, 0x1600 }, /* Index: 0x58, char: \x59 */
-    { 0x10, 0x1640 }, /* Index: 0x59, char: \x5a */
-    { 0x10, 0x1680 }, /* Index: 0x5a, char: \x5b */
-    { 0x10, 0x16c0 }, /* Index: 0x5b, char: \x5c */
-    { 0x10, 0x1700 }, /* Index: 0x5c, char: \x5d */
-    { 0x10, 0x1740 }, /* Index: 0x5d, char: \x5e */
-    { 0x10, 0x1780 }, /* Index: 0x5e, char: \x5f */
-    { 0x10, 0x17c0 }, /* Index: 0x5f, char: \x60 */
-    { 0x10, 0x1800 }, /* Index: 0x60, char: \x61 */
-    { 0x10, 0x1840 }, /* Index: 0x61, char: \x62 */
-    { 0x10, 0x1880 }, /* Index: 0x62, char: \x63 */
-    { 0x10, 0x18c0 }, /* Index: 0x63, char: \x64 */
-    { 0x10, 0x1900 }, /* Index: 0x64, char: \x65 */
-    { 0x10, 0x1940 }, /* Index: 0x65, char: \x66 */
-    { 0x10, 0x1980 }, /* Index: 0x66, char: \x67 */
-    { 0x10, 0x19c0 }, /* Index: 0x67, char: \x68 */
-    { 0x10, 0x1a00 }, /* Index: 0x68, char: \x69 */
-    { 0x10, 0x1a40 }, /* Index: 0x69, char: \x6a */
-    { 0x10, 0x1a80 }, /* Index: 0x6a, char: \x6b */
-    { 0x10, 0x1ac0 }, /* Index: 0x6b, char: \x6c */
-    { 0x10, 0x1b00 }, /* Index: 0x6c, char: \x6d */
-    { 0x10, 0x1b40 }, /* Index: 0x6d, char: \x6e */
-    { 0x10, 0x1b80 }, /* Index: 0x6e, char: \x6f */
-    { 0x10, 0x1bc0 }, /* Index: 0x6f, char: \x70 */
-    { 0x10, 0x1c00 }, /* Index: 0x70, char: \x71 */
-    { 0x10, 0x1c40 }, /* Index: 0x71, char: \x72 */
-    { 0x10, 0x1c80 }, /* Index: 0x72, char: \x73 */
-    { 0x10, 0x1cc0 }, /* Index: 0x73, char: \x74 */
-    { 0x10, 0x1d00 }, /* Index: 0x74, char: \x75 */
-    { 0x10, 0x1d40 }, /* Index: 0x75, char: \x76 */
-    { 0x10, 0x1d80 }, /* Index: 0x76, char: \x77 */
-    { 0x10, 0x1dc0 }, /* Index: 0x77, char: \x78 */
-    { 0x10, 0x1e00 }, /* Index: 0x78, char: \x79 */
-    { 0x10, 0x1e40 }, /* Index: 0x79, char: \x7a */
-    { 0x10, 0x1e80 }, /* Index: 0x7a, char: \x7b */
-    { 0x10, 0x1ec0 }, /* Index: 0x7b, char: \x7c */
-    { 0x10, 0x1f00 }, /* Index: 0x7c, char: \x7d */
-    { 0x10, 0x1f40 }, /* Index: 0x7d, char: \x7e */
-    { 0x10, 0x1f80 }, /* Index: 0x7e, char: \x7f */
-    { 0x10, 0x1fc0 }, /* Index: 0x7f, char: \x80 */
-    { 0x10, 0x2000 }, /* Index: 0x80, char: \x81 */
-    { 0x10, 0x2040 }, /* Index: 0x81, char: \x82 */
-    { 0x10, 0x2080 }, /* Index: 0x82, char: \x83 */
-    { 0x10, 0x20c0 }, /* Index: 0x83, char: \x84 */
-    { 0x10, 0x2100 }, /* Index: 0x84, char: \x85 */
-    { 0x10, 0x2140 }, /* Index: 0x85, char: \x86 */
-    { 0x10, 0x2180 }, /* Index: 0x86, char: \x87 */
-    { 0x10, 0x21c0 }, /* Index: 0x87, char: \x88 */
-    { 0x10, 0x2200 }, /* Index: 0x88, char: \x89 */
-    { 0x10, 0x2240 }, /* Index: 0x89, char: \x8a */
-    { 0x10, 0x2280 }, /* Index: 0x8a, char: \x8b */
-    { 0x10, 0x22c0 }, /* Index: 0x8b, char: \x8c */
-    { 0x10, 0x2300 }, /* Index: 0x8c, char: \x8d */
-    { 0x10, 0x2340 }, /* Index: 0x8d, char: \x8e */
-    { 0x10, 0x2380 }, /* Index: 0x8e, char: \x8f */
-    { 0x10, 0x23c0 }, /* Index: 0x8f, char: \x90 */
-    { 0x10, 0x2400 }, /* Index: 0x90, char: \x91 */
-    { 0x10, 0x2440 }, /* Index: 0x91, char: \x92 */
-    { 0x10, 0x2480 }, /* Index: 0x92, char: \x93 */
-    { 0x10, 0x24c0 }, /* Index: 0x93, char: \x94 */
-    { 0x10, 0x2500 }, /* Index: 0x94, char: \x95 */
-    { 0x10, 0x2540 }, /* Index: 0x95, char: \x96 */
-    { 0x10, 0x2580 }, /* Index: 0x96, char: \x97 */
-    { 0x10, 0x25c0 }, /* Index: 0x97, char: \x98 */
-    { 0x10, 0x2600 }, /* Index: 0x98, char: \x99 */
-    { 0x10, 0x2640 }, /* Index: 0x99, char: \x9a */
-    { 0x10, 0x2680 }, /* Index: 0x9a, char: \x9b */
-    { 0x10, 0x26c0 }, /* Index: 0x9b, char: \x9c */
-    { 0x10, 0x2700 }, /* Index: 0x9c, char: \x9d */
-    { 0x10, 0x2740 }, /* Index: 0x9d, char: \x9e */
-    { 0x10, 0x2780 }, /* Index: 0x9e, char: \x9f */
-    { 0x10, 0x27c0 }, /* Index: 0x9f, char: \xa0 */
-    { 0x10, 0x2800 }, /* Index: 0xa0, char: \xa1 */
-    { 0x10, 0x2840 }, /* Index: 0xa1, char: \xa2 */
-    { 0x10, 0x2880 }, /* Index: 0xa2, char: \xa3 */
-    { 0x10, 0x28c0 }, /* Index: 0xa3, char: \xa4 */
-    { 0x10, 0x2900 }, /* Index: 0xa4, char: \xa5 */
-    { 0x10, 0x2940 }, /* Index: 0xa5, char: \xa6 */
-    { 0x10, 0x2980 }, /* Index: 0xa6, char: \xa7 */
-    { 0x10, 0x29c0 }, /* Index: 0xa7, char: \xa8 */
-    { 0x10, 0x2a00 }, /* Index: 0xa8, char: \xa9 */
-    { 0x10, 0x2a40 }, /* Index: 0xa9, char: \xaa */
-    { 0x10, 0x2a80 }, /* Index: 0xaa, char: \xab */
-    { 0x10, 0x2ac0 }, /* Index: 0xab, char: \xac */
-    { 0x10, 0x2b00 }, /* Index: 0xac, char: \xad */
-    { 0x10, 0x2b40 }, /* Index: 0xad, char: \xae */
-    { 0x10, 0x2b80 }, /* Index: 0xae, char: \xaf */
-    { 0x10, 0x2bc0 }, /* Index: 0xaf, char: \xb0 */
-    { 0x10, 0x2c00 }, /* Index: 0xb0, char: \xb1 */
-    { 0x10, 0x2c40 }, /* Index: 0xb1, char: \xb2 */
-    { 0x10, 0x2c80 }, /* Index: 0xb2, char: \xb3 */
-    { 0x10, 0x2cc0 }, /* Index: 0xb3, char: \xb4 */
-    { 0x10, 0x2d00 }, /* Index: 0xb4, char: \xb5 */
-    { 0x10, 0x2d40 }, /* Index: 0xb5, char: \xb6 */
-    { 0x10, 0x2d80 }, /* Index: 0xb6, char: \xb7 */
-    { 0x10, 0x2dc0 }, /* Index: 0xb7, char: \xb8 */
-    { 0x10, 0x2e00 }, /* Index: 0xb8, char: \xb9 */
-    { 0x10, 0x2e40 }, /* Index: 0xb9, char: \xba */
-    { 0x10, 0x2e80 }, /* Index: 0xba, char: \xbb */
-    { 0x10, 0x2ec0 }, /* Index: 0xbb, char: \xbc */
-    { 0x10, 0x2f00 }, /* Index: 0xbc, char: \xbd */
-    { 0x10, 0x2f40 }, /* Index: 0xbd, char: \xbe */
-    { 0x10, 0x2f80 }, /* Index: 0xbe, char: \xbf */
-    { 0x10, 0x2fc0 }, /* Index: 0xbf, char: \xc0 */
-    { 0x10, 0x3000 }, /* Index: 0xc0, char: \xc1 */
-    { 0x10, 0x3040 }, /* Index: 0xc1, char: \xc2 */
-    { 0x10, 0x3080 }, /* Index: 0xc2, char: \xc3 */
-    { 0x10, 0x30c0 }, /* Index: 0xc3, char: \xc4 */
-    { 0x10, 0x3100 }, /* Index: 0xc4, char: \xc5 */
-    { 0x10, 0x3140 }, /* Index: 0xc5, char: \xc6 */
-    { 0x10, 0x3180 }, /* Index: 0xc6, char: \xc7 */
-    { 0x10, 0x31c0 }, /* Index: 0xc7, char: \xc8 */
-    { 0x10, 0x3200 }, /* Index: 0xc8, char: \xc9 */
-    { 0x10, 0x3240 }, /* Index: 0xc9, char: \xca */
-    { 0x10, 0x3280 }, /* Index: 0xca, char: \xcb */
-    { 0x10, 0x32c0 }, /* Index: 0xcb, char: \xcc */
-    { 0x10, 0x3300 }, /* Index: 0xcc, char: \xcd */
-    { 0x10, 0x3340 }, /* Index: 0xcd, char: \xce */
-    { 0x10, 0x3380 }, /* Index: 0xce, char: \xcf */
-    { 0x10, 0x33c0 }, /* Index: 0xcf, char: \xd0 */
-    { 0x10, 0x3400 }, /* Index: 0xd0, char: \xd1 */
-    { 0x10, 0x3440 }, /* Index: 0xd1, char: \xd2 */
-    { 0x10, 0x3480 }, /* Index: 0xd2, char: \xd3 */
-    { 0x10, 0x34c0 }, /* Index: 0xd3, char: \xd4 */
-    { 0x10, 0x3500 }, /* Index: 0xd4, char: \xd5 */
-    { 0x10, 0x3540 }, /* Index: 0xd5, char: \xd6 */
-    { 0x10, 0x3580 }, /* Index: 0xd6, char: \xd7 */
-    { 0x10, 0x35c0 }, /* Index: 0xd7, char: \xd8 */
-    { 0x10, 0x3600 }, /* Index: 0xd8, char: \xd9 */
-    { 0x10, 0x3640 }, /* Index: 0xd9, char: \xda */
-    { 0x10, 0x3680 }, /* Index: 0xda, char: \xdb */
-    { 0x10, 0x36c0 }, /* Index: 0xdb, char: \xdc */
-    { 0x10, 0x3700 }, /* Index: 0xdc, char: \xdd */
-    { 0x10, 0x3740 }, /* Index: 0xdd, char: \xde */
-    { 0x10, 0x3780 }, /* Index: 0xde, char: \xdf */
-    { 0x10, 0x37c0 }, /* Index: 0xdf, char: \xe0 */
-    { 0x10, 0x3800 }, /* Index: 0xe0, char: \xe1 */
-    { 0x10, 0x3840 }, /* Index: 0xe1, char: \xe2 */
-    { 0x10, 0x3880 }, /* Index: 0xe2, char: \xe3 */
-    { 0x10, 0x38c0 }, /* Index: 0xe3, char: \xe4 */
-    { 0x10, 0x3900 }, /* Index: 0xe4, char: \xe5 */
-    { 0x10, 0x3940 }, /* Index: 0xe5, char: \xe6 */
-    { 0x10, 0x3980 }, /* Index: 0xe6, char: \xe7 */
-    { 0x10, 0x39c0 }, /* Index: 0xe7, char: \xe8 */
-    { 0x10, 0x3a00 }, /* Index: 0xe8, char: \xe9 */
-    { 0x10, 0x3a40 }, /* Index: 0xe9, char: \xea */
-    { 0x10, 0x3a80 }, /* Index: 0xea, char: \xeb */
-    { 0x10, 0x3ac0 }, /* Index: 0xeb, char: \xec */
-    { 0x10, 0x3b00 }, /* Index: 0xec, char: \xed */
-    { 0x10, 0x3b40 }, /* Index: 0xed, char: \xee */
-    { 0x10, 0x3b80 }, /* Index: 0xee, char: \xef */
-    { 0x10, 0x3bc0 }, /* Index: 0xef, char: \xf0 */
-    { 0x10, 0x3c00 }, /* Index: 0xf0, char: \xf1 */
-    { 0x10, 0x3c40 }, /* Index: 0xf1, char: \xf2 */
-    { 0x10, 0x3c80 }, /* Index: 0xf2, char: \xf3 */
-    { 0x10, 0x3cc0 }, /* Index: 0xf3, char: \xf4 */
-    { 0x10, 0x3d00 }, /* Index: 0xf4, char: \xf5 */
-    { 0x10, 0x3d40 }, /* Index: 0xf5, char: \xf6 */
-    { 0x10, 0x3d80 }, /* Index: 0xf6, char: \xf7 */
-    { 0x10, 0x3dc0 }, /* Index: 0xf7, char: \xf8 */
-    { 0x10, 0x3e00 }, /* Index: 0xf8, char: \xf9 */
-    { 0x10, 0x3e40 }, /* Index: 0xf9, char: \xfa */
-    { 0x10, 0x3e80 }, /* Index: 0xfa, char: \xfb */
-    { 0x10, 0x3ec0 }, /* Index: 0xfb, char: \xfc */
-    { 0x10, 0x3f00 }, /* Index: 0xfc, char: \xfd */
-    { 0x10, 0x3f40 }, /* Index: 0xfd, char: \xfe */
-    { 0x10, 0x3f80 }, /* Index: 0xfe, char: \xff */
-};
-
 const font_info_t _fonts_terminus_16x32_iso8859_1_info =
 {
     .height           = 32, /* Character height */
     .c                = 0, /* C */
     .char_start       = 1, /* Start character */
     .char_end         = 255, /* End character */
-    .char_descriptors = _fonts_terminus_16x32_iso8859_1_descriptors, /* Character descriptor array */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
     .bitmap           = _fonts_terminus_16x32_iso8859_1_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 16, /* Glyph width */
+    .stride           = 64, /* Bytes per glyph */
 };
 
 #endif /* _EXTRAS_FONTS_FONT_TERMINUS_16X32_ISO8859_1_H_ */
@@ -3588,272 +3588,17 @@ static const uint8_t _fonts_terminus_6x12_koi8_r_bitmaps[] = {
     0x00, /* ........ */
 };
 
-const font_char_desc_t _fonts_terminus_6x12_koi8_r_descriptors[] = {
-    { 0x06, 0x0000 }, /* Index: 0x00, char: \x01 */
-    { 0x06, 0x000c }, /* Index: 0x01, char: \x02 */
-    { 0x06, 0x0018 }, /* Index: 0x02, char: \x03 */
-    { 0x06, 0x0024 }, /* Index: 0x03, char: \x04 */
-    { 0x06, 0x0030 }, /* Index: 0x04, char: \x05 */
-    { 0x06, 0x003c }, /* Index: 0x05, char: \x06 */
-    { 0x06, 0x0048 }, /* Index: 0x06, char: \x07 */
-    { 0x06, 0x0054 }, /* Index: 0x07, char: \x08 */
-    { 0x06, 0x0060 }, /* Index: 0x08, char: \x09 */
-    { 0x06, 0x006c }, /* Index: 0x09, char: \x0a */
-    { 0x06, 0x0078 }, /* Index: 0x0a, char: \x0b */
-    { 0x06, 0x0084 }, /* Index: 0x0b, char: \x0c */
-    { 0x06, 0x0090 }, /* Index: 0x0c, char: \x0d */
-    { 0x06, 0x009c }, /* Index: 0x0d, char: \x0e */
-    { 0x06, 0x00a8 }, /* Index: 0x0e, char: \x0f */
-    { 0x06, 0x00b4 }, /* Index: 0x0f, char: \x10 */
-    { 0x06, 0x00c0 }, /* Index: 0x10, char: \x11 */
-    { 0x06, 0x00cc }, /* Index: 0x11, char: \x12 */
-    { 0x06, 0x00d8 }, /* Index: 0x12, char: \x13 */
-    { 0x06, 0x00e4 }, /* Index: 0x13, char: \x14 */
-    { 0x06, 0x00f0 }, /* Index: 0x14, char: \x15 */
-    { 0x06, 0x00fc }, /* Index: 0x15, char: \x16 */
-    { 0x06, 0x0108 }, /* Index: 0x16, char: \x17 */
-    { 0x06, 0x0114 }, /* Index: 0x17, char: \x18 */
-    { 0x06, 0x0120 }, /* Index: 0x18, char: \x19 */
-    { 0x06, 0x012c }, /* Index: 0x19, char: \x1a */
-    { 0x06, 0x0138 }, /* Index: 0x1a, char: \x1b */
-    { 0x06, 0x0144 }, /* Index: 0x1b, char: \x1c */
-    { 0x06, 0x0150 }, /* Index: 0x1c, char: \x1d */
-    { 0x06, 0x015c }, /* Index: 0x1d, char: \x1e */
-    { 0x06, 0x0168 }, /* Index: 0x1e, char: \x1f */
-    { 0x06, 0x0174 }, /* Index: 0x1f, char: \x20 */
-    { 0x06, 0x0180 }, /* Index: 0x20, char: \x21 */
-    { 0x06, 0x018c }, /* Index: 0x21, char: \x22 */
-    { 0x06, 0x0198 }, /* Index: 0x22, char: \x23 */
-    { 0x06, 0x01a4 }, /* Index: 0x23, char: \x24 */
-    { 0x06, 0x01b0 }, /* Index: 0x24, char: \x25 */
-    { 0x06, 0x01bc }, /* Index: 0x25, char: \x26 */
-    { 0x06, 0x01c8 }, /* Index: 0x26, char: \x27 */
-    { 0x06, 0x01d4 }, /* Index: 0x27, char: \x28 */
-    { 0x06, 0x01e0 }, /* Index: 0x28, char: \x29 */
-    { 0x06, 0x01ec }, /* Index: 0x29, char: \x2a */
-    { 0x06, 0x01f8 }, /* Index: 0x2a, char: \x2b */
-    { 0x06, 0x0204 }, /* Index: 0x2b, char: \x2c */
-    { 0x06, 0x0210 }, /* Index: 0x2c, char: \x2d */
-    { 0x06, 0x021c }, /* Index: 0x2d, char: \x2e */
-    { 0x06, 0x0228 }, /* Index: 0x2e, char: \x2f */
-    { 0x06, 0x0234 }, /* Index: 0x2f, char: \x30 */
-    { 0x06, 0x0240 }, /* Index: 0x30, char: \x31 */
-    { 0x06, 0x024c }, /* Index: 0x31, char: \x32 */
-    { 0x06, 0x0258 }, /* Index: 0x32, char: \x33 */
-    { 0x06, 0x0264 }, /* Index: 0x33, char: \x34 */
-    { 0x06, 0x0270 }, /* Index: 0x34, char: \x35 */
-    { 0x06, 0x027c }, /* Index: 0x35, char: \x36 */
-    { 0x06, 0x0288 }, /* Index: 0x36, char: \x37 */
-    { 0x06, 0x0294 }, /* Index: 0x37, char: \x38 */
-    { 0x06, 0x02a0 }, /* Index: 0x38, char: \x39 */
-    { 0x06, 0x02ac }, /* Index: 0x39, char: \x3a */
-    { 0x06, 0x02b8 }, /* Index: 0x3a, char: \x3b */
-    { 0x06, 0x02c4 }, /* Index: 0x3b, char: \x3c */
-    { 0x06, 0x02d0 }, /* Index: 0x3c, char: \x3d */
-    { 0x06, 0x02dc }, /* Index: 0x3d, char: \x3e */
-    { 0x06, 0x02e8 }, /* Index: 0x3e, char: \x3f */
-    { 0x06, 0x02f4 }, /* Index: 0x3f, char: \x40 */
-    { 0x06, 0x0300 }, /* Index: 0x40, char: \x41 */
-    { 0x06, 0x030c }, /* Index: 0x41, char: \x42 */
-    { 0x06, 0x0318 }, /* Index: 0x42, char: \x43 */
-    { 0x06, 0x0324 }, /* Index: 0x43, char: \x44 */
-    { 0x06, 0x0330 }, /* Index: 0x44, char: \x45 */
-    { 0x06, 0x033c }, /* Index: 0x45, char: \x46 */
-    { 0x06, 0x0348 }, /* Index: 0x46, char: \x47 */
-    { 0x06, 0x0354 }, /* Index: 0x47, char: \x48 */
-    { 0x06, 0x0360 }, /* Index: 0x48, char: \x49 */
-    { 0x06, 0x036c }, /* Index: 0x49, char: \x4a */
-    { 0x06, 0x0378 }, /* Index: 0x4a, char: \x4b */
-    { 0x06, 0x0384 }, /* Index: 0x4b, char: \x4c */
-    { 0x06, 0x0390 }, /* Index: 0x4c, char: \x4d */
-    { 0x06, 0x039c }, /* Index: 0x4d, char: \x4e */
-    { 0x06, 0x03a8 }, /* Index: 0x4e, char: \x4f */
-    { 0x06, 0x03b4 }, /* Index: 0x4f, char: \x50 */
-    { 0x06, 0x03c0 }, /* Index: 0x50, char: \x51 */
-    { 0x06, 0x03cc }, /* Index: 0x51, char: \x52 */
-    { 0x06, 0x03d8 }, /* Index: 0x52, char: \x53 */
-    { 0x06, 0x03e4 }, /* Index: 0x53, char: \x54 */
-    { 0x06, 0x03f0 }, /* Index: 0x54, char: \x55 */
-    { 0x06, 0x03fc }, /* Index: 0x55, char: \x56 */
-    { 0x06, 0x0408 }, /* Index: 0x56, char: \x57 */
-    { 0x06, 0x0414 }, /* Index: 0x57, char: \x58 */
-    { 0x06, 0x0420 }, /* Index: 0x58, char: \x59 */
-    { 0x06, 0x042c }, /* Index: 0x59, char: \x5a */
-    { 0x06, 0x0438 }, /* Index: 0x5a, char: \x5b */
-    { 0x06, 0x0444 }, /* Index: 0x5b, char: \x5c */
-    { 0x06, 0x0450 }, /* Index: 0x5c, char: \x5d */
-    { 0x06, 0x045c }, /* Index: 0x5d, char: \x5e */
-    { 0x06, 0x0468 }, /* Index: 0x5e, char: \x5f */
-    { 0x06, 0x0474 }, /* Index: 0x5f, char: \x60 */
-    { 0x06, 0x0480 }, /* Index: 0x60, char: \x61 */
-    { 0x06, 0x048c }, /* Index: 0x61, char: \x62 */
-    { 0x06, 0x0498 }, /* Index: 0x62, char: \x63 */
-    { 0x06, 0x04a4 }, /* Index: 0x63, char: \x64 */
-    { 0x06, 0x04b0 }, /* Index: 0x64, char: \x65 */
-    { 0x06, 0x04bc }, /* Index: 0x65, char: \x66 */
-    { 0x06, 0x04c8 }, /* Index: 0x66, char: \x67 */
-    { 0x06, 0x04d4 }, /* Index: 0x67, char: \x68 */
-    { 0x06, 0x04e0 }, /* Index: 0x68, char: \x69 */
-    { 0x06, 0x04ec }, /* Index: 0x69, char: \x6a */
-    { 0x06, 0x04f8 }, /* Index: 0x6a, char: \x6b */
-    { 0x06, 0x0504 }, /* Index: 0x6b, char: \x6c */
-    { 0x06, 0x0510 }, /* Index: 0x6c, char: \x6d */
-    { 0x06, 0x051c }, /* Index: 0x6d, char: \x6e */
-    { 0x06, 0x0528 }, /* Index: 0x6e, char: \x6f */
-    { 0x06, 0x0534 }, /* Index: 0x6f, char: \x70 */
-    { 0x06, 0x0540 }, /* Index: 0x70, char: \x71 */
-    { 0x06, 0x054c }, /* Index: 0x71, char: \x72 */
-    { 0x06, 0x0558 }, /* Index: 0x72, char: \x73 */
-    { 0x06, 0x0564 }, /* Index: 0x73, char: \x74 */
-    { 0x06, 0x0570 }, /* Index: 0x74, char: \x75 */
-    { 0x06, 0x057c }, /* Index: 0x75, char: \x76 */
-    { 0x06, 0x0588 }, /* Index: 0x76, char: \x77 */
-    { 0x06, 0x0594 }, /* Index: 0x77, char: \x78 */
-    { 0x06, 0x05a0 }, /* Index: 0x78, char: \x79 */
-    { 0x06, 0x05ac }, /* Index: 0x79, char: \x7a */
-    { 0x06, 0x05b8 }, /* Index: 0x7a, char: \x7b */
-    { 0x06, 0x05c4 }, /* Index: 0x7b, char: \x7c */
-    { 0x06, 0x05d0 }, /* Index: 0x7c, char: \x7d */
-    { 0x06, 0x05dc }, /* Index: 0x7d, char: \x7e */
-    { 0x06, 0x05e8 }, /* Index: 0x7e, char: \x7f */
-    { 0x06, 0x05f4 }, /* Index: 0x7f, char: \x80 */
-    { 0x06, 0x0600 }, /* Index: 0x80, char: \x81 */
-    { 0x06, 0x060c }, /* Index: 0x81, char: \x82 */
-    { 0x06, 0x0618 }, /* Index: 0x82, char: \x83 */
-    { 0x06, 0x0624 }, /* Index: 0x83, char: \x84 */
-    { 0x06, 0x0630 }, /* Index: 0x84, char: \x85 */
-    { 0x06, 0x063c }, /* Index: 0x85, char: \x86 */
-    { 0x06, 0x0648 }, /* Index: 0x86, char: \x87 */
-    { 0x06, 0x0654 }, /* Index: 0x87, char: \x88 */
-    { 0x06, 0x0660 }, /* Index: 0x88, char: \x89 */
-    { 0x06, 0x066c }, /* Index: 0x89, char: \x8a */
-    { 0x06, 0x0678 }, /* Index: 0x8a, char: \x8b */
-    { 0x06, 0x0684 }, /* Index: 0x8b, char: \x8c */
-    { 0x06, 0x0690 }, /* Index: 0x8c, char: \x8d */
-    { 0x06, 0x069c }, /* Index: 0x8d, char: \x8e */
-    { 0x06, 0x06a8 }, /* Index: 0x8e, char: \x8f */
-    { 0x06, 0x06b4 }, /* Index: 0x8f, char: \x90 */
-    { 0x06, 0x06c0 }, /* Index: 0x90, char: \x91 */
-    { 0x06, 0x06cc }, /* Index: 0x91, char: \x92 */
-    { 0x06, 0x06d8 }, /* Index: 0x92, char: \x93 */
-    { 0x06, 0x06e4 }, /* Index: 0x93, char: \x94 */
-    { 0x06, 0x06f0 }, /* Index: 0x94, char: \x95 */
-    { 0x06, 0x06fc }, /* Index: 0x95, char: \x96 */
-    { 0x06, 0x0708 }, /* Index: 0x96, char: \x97 */
-    { 0x06, 0x0714 }, /* Index: 0x97, char: \x98 */
-    { 0x06, 0x0720 }, /* Index: 0x98, char: \x99 */
-    { 0x06, 0x072c }, /* Index: 0x99, char: \x9a */
-    { 0x06, 0x0738 }, /* Index: 0x9a, char: \x9b */
-    { 0x06, 0x0744 }, /* Index: 0x9b, char: \x9c */
-    { 0x06, 0x0750 }, /* Index: 0x9c, char: \x9d */
-    { 0x06, 0x075c }, /* Index: 0x9d, char: \x9e */
-    { 0x06, 0x0768 }, /* Index: 0x9e, char: \x9f */
-    { 0x06, 0x0774 }, /* Index: 0x9f, char: \xa0 */
-    { 0x06, 0x0780 }, /* Index: 0xa0, char: \xa1 */
-    { 0x06, 0x078c }, /* Index: 0xa1, char: \xa2 */
-    { 0x06, 0x0798 }, /* Index: 0xa2, char: \xa3 */
-    { 0x06, 0x07a4 }, /* Index: 0xa3, char: \xa4 */
-    { 0x06, 0x07b0 }, /* Index: 0xa4, char: \xa5 */
-    { 0x06, 0x07bc }, /* Index: 0xa5, char: \xa6 */
-    { 0x06, 0x07c8 }, /* Index: 0xa6, char: \xa7 */
-    { 0x06, 0x07d4 }, /* Index: 0xa7, char: \xa8 */
-    { 0x06, 0x07e0 }, /* Index: 0xa8, char: \xa9 */
-    { 0x06, 0x07ec }, /* Index: 0xa9, char: \xaa */
-    { 0x06, 0x07f8 }, /* Index: 0xaa, char: \xab */
-    { 0x06, 0x0804 }, /* Index: 0xab, char: \xac */
-    { 0x06, 0x0810 }, /* Index: 0xac, char: \xad */
-    { 0x06, 0x081c }, /* Index: 0xad, char: \xae */
-    { 0x06, 0x0828 }, /* Index: 0xae, char: \xaf */
-    { 0x06, 0x0834 }, /* Index: 0xaf, char: \xb0 */
-    { 0x06, 0x0840 }, /* Index: 0xb0, char: \xb1 */
-    { 0x06, 0x084c }, /* Index: 0xb1, char: \xb2 */
-    { 0x06, 0x0858 }, /* Index: 0xb2, char: \xb3 */
-    { 0x06, 0x0864 }, /* Index: 0xb3, char: \xb4 */
-    { 0x06, 0x0870 }, /* Index: 0xb4, char: \xb5 */
-    { 0x06, 0x087c }, /* Index: 0xb5, char: \xb6 */
-    { 0x06, 0x0888 }, /* Index: 0xb6, char: \xb7 */
-    { 0x06, 0x0894 }, /* Index: 0xb7, char: \xb8 */
-    { 0x06, 0x08a0 }, /* Index: 0xb8, char: \xb9 */
-    { 0x06, 0x08ac }, /* Index: 0xb9, char: \xba */
-    { 0x06, 0x08b8 }, /* Index: 0xba, char: \xbb */
-    { 0x06, 0x08c4 }, /* Index: 0xbb, char: \xbc */
-    { 0x06, 0x08d0 }, /* Index: 0xbc, char: \xbd */
-    { 0x06, 0x08dc }, /* Index: 0xbd, char: \xbe */
-    { 0x06, 0x08e8 }, /* Index: 0xbe, char: \xbf */
-    { 0x06, 0x08f4 }, /* Index: 0xbf, char: \xc0 */
-    { 0x06, 0x0900 }, /* Index: 0xc0, char: \xc1 */
-    { 0x06, 0x090c }, /* Index: 0xc1, char: \xc2 */
-    { 0x06, 0x0918 }, /* Index: 0xc2, char: \xc3 */
-    { 0x06, 0x0924 }, /* Index: 0xc3, char: \xc4 */
-    { 0x06, 0x0930 }, /* Index: 0xc4, char: \xc5 */
-    { 0x06, 0x093c }, /* Index: 0xc5, char: \xc6 */
-    { 0x06, 0x0948 }, /* Index: 0xc6, char: \xc7 */
-    { 0x06, 0x0954 }, /* Index: 0xc7, char: \xc8 */
-    { 0x06, 0x0960 }, /* Index: 0xc8, char: \xc9 */
-    { 0x06, 0x096c }, /* Index: 0xc9, char: \xca */
-    { 0x06, 0x0978 }, /* Index: 0xca, char: \xcb */
-    { 0x06, 0x0984 }, /* Index: 0xcb, char: \xcc */
-    { 0x06, 0x0990 }, /* Index: 0xcc, char: \xcd */
-    { 0x06, 0x099c }, /* Index: 0xcd, char: \xce */
-    { 0x06, 0x09a8 }, /* Index: 0xce, char: \xcf */
-    { 0x06, 0x09b4 }, /* Index: 0xcf, char: \xd0 */
-    { 0x06, 0x09c0 }, /* Index: 0xd0, char: \xd1 */
-    { 0x06, 0x09cc }, /* Index: 0xd1, char: \xd2 */
-    { 0x06, 0x09d8 }, /* Index: 0xd2, char: \xd3 */
-    { 0x06, 0x09e4 }, /* Index: 0xd3, char: \xd4 */
-    { 0x06, 0x09f0 }, /* Index: 0xd4, char: \xd5 */
-    { 0x06, 0x09fc }, /* Index: 0xd5, char: \xd6 */
-    { 0x06, 0x0a08 }, /* Index: 0xd6, char: \xd7 */
-    { 0x06, 0x0a14 }, /* Index: 0xd7, char: \xd8 */
-    { 0x06, 0x0a20 }, /* Index: 0xd8, char: \xd9 */
-    { 0x06, 0x0a2c }, /* Index: 0xd9, char: \xda */
-    { 0x06, 0x0a38 }, /* Index: 0xda, char: \xdb */
-    { 0x06, 0x0a44 }, /* Index: 0xdb, char: \xdc */
-    { 0x06, 0x0a50 }, /* Index: 0xdc, char: \xdd */
-    { 0x06, 0x0a5c }, /* Index: 0xdd, char: \xde */
-    { 0x06, 0x0a68 }, /* Index: 0xde, char: \xdf */
-    { 0x06, 0x0a74 }, /* Index: 0xdf, char: \xe0 */
-    { 0x06, 0x0a80 }, /* Index: 0xe0, char: \xe1 */
-    { 0x06, 0x0a8c }, /* Index: 0xe1, char: \xe2 */
-    { 0x06, 0x0a98 }, /* Index: 0xe2, char: \xe3 */
-    { 0x06, 0x0aa4 }, /* Index: 0xe3, char: \xe4 */
-    { 0x06, 0x0ab0 }, /* Index: 0xe4, char: \xe5 */
-    { 0x06, 0x0abc }, /* Index: 0xe5, char: \xe6 */
-    { 0x06, 0x0ac8 }, /* Index: 0xe6, char: \xe7 */
-    { 0x06, 0x0ad4 }, /* Index: 0xe7, char: \xe8 */
-    { 0x06, 0x0ae0 }, /* Index: 0xe8, char: \xe9 */
-    { 0x06, 0x0aec }, /* Index: 0xe9, char: \xea */
-    { 0x06, 0x0af8 }, /* Index: 0xea, char: \xeb */
-    { 0x06, 0x0b04 }, /* Index: 0xeb, char: \xec */
-    { 0x06, 0x0b10 }, /* Index: 0xec, char: \xed */
-    { 0x06, 0x0b1c }, /* Index: 0xed, char: \xee */
-    { 0x06, 0x0b28 }, /* Index: 0xee, char: \xef */
-    { 0x06, 0x0b34 }, /* Index: 0xef, char: \xf0 */
-    { 0x06, 0x0b40 }, /* Index: 0xf0, char: \xf1 */
-    { 0x06, 0x0b4c }, /* Index: 0xf1, char: \xf2 */
-    { 0x06, 0x0b58 }, /* Index: 0xf2, char: \xf3 */
-    { 0x06, 0x0b64 }, /* Index: 0xf3, char: \xf4 */
-    { 0x06, 0x0b70 }, /* Index: 0xf4, char: \xf5 */
-    { 0x06, 0x0b7c }, /* Index: 0xf5, char: \xf6 */
-    { 0x06, 0x0b88 }, /* Index: 0xf6, char: \xf7 */
-    { 0x06, 0x0b94 }, /* Index: 0xf7, char: \xf8 */
-    { 0x06, 0x0ba0 }, /* Index: 0xf8, char: \xf9 */
-    { 0x06, 0x0bac }, /* Index: 0xf9, char: \xfa */
-    { 0x06, 0x0bb8 }, /* Index: 0xfa, char: \xfb */
-    { 0x06, 0x0bc4 }, /* Index: 0xfb, char: \xfc */
-    { 0x06, 0x0bd0 }, /* Index: 0xfc, char: \xfd */
-    { 0x06, 0x0bdc }, /* Index: 0xfd, char: \xfe */
-    { 0x06, 0x0be8 }, /* Index: 0xfe, char: \xff */
-};
-
 const font_info_t _fonts_terminus_6x12_koi8_r_info =
 {
     .height           = 12, /* Character height */
     .c                = 0, /* C */
     .char_start       = 1, /* Start character */
     .char_end         = 255, /* End character */
-    .char_descriptors = _fonts_terminus_6x12_koi8_r_descriptors, /* Character descriptor array */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
     .bitmap           = _fonts_terminus_6x12_koi8_r_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 6, /* Glyph width */
+    .stride           = 12, /* Bytes per glyph */
 };
 
 #endif /* _EXTRAS_FONTS_FONT_TERMINUS_6X12_KOI8_R_H_ */
@@ -0,0 +1,5278 @@
+/**
+ * This file contains generated binary font data.
+ *
+ * Font:    terminus_6x12_iso8859_1
+ * Height:  12
+ * Layout:  row-major, monospace
+ * 255 characters (1..255)
+ *
+ * Font:    terminus_6x12_koi8_r
+ * Height:  12
+ * Layout:  row-major, monospace
+ * 255 characters in 12 ranges (1..255)
+ * 138 glyphs identical to an earlier one, stored once
+ *
+ * Copyright (c) 2015 Dimitar Toshkov Zhekov
+ * License: SIL Open Font License, Version 1.1. The license is included as OFL.TXT, and is
+ *      also available with a FAQ at http://scripts.sil.org/OFL
+ *
+ * Source:  builtin:terminus_6x12_iso8859_1, builtin:terminus_6x12_koi8_r
+ * Generated by tools/fontc, do not edit. Command:
+ *     fontc -q --mono --rows --pool terminus_6x12_shared --comment ../../main/fonts/src/terminus.txt -o ../../main/fonts/font_terminus_6x12_shared.h builtin:terminus_6x12_iso8859_1 builtin:terminus_6x12_koi8_r
+ */
+#ifndef _EXTRAS_FONTS_FONT_TERMINUS_6X12_SHARED_H_
+#define _EXTRAS_FONTS_FONT_TERMINUS_6X12_SHARED_H_
+
+static const uint8_t _fonts_terminus_6x12_shared_bitmaps[] = {
+
+    /* Index: 0x00, char: \x01, offset: 0x0000 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0xf8, /* #####. */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x01, char: \x02, offset: 0x000c */
+    0xa8, /* #.#.#. */
+    0x54, /* .#.#.# */
+    0xa8, /* #.#.#. */
+    0x54, /* .#.#.# */
+    0xa8, /* #.#.#. */
+    0x54, /* .#.#.# */
+    0xa8, /* #.#.#. */
+    0x54, /* .#.#.# */
+    0xa8, /* #.#.#. */
+    0x54, /* .#.#.# */
+    0xa8, /* #.#.#. */
+    0x54, /* .#.#.# */
+
+    /* Index: 0x02, char: \x03, offset: 0x0018 */
+    0x90, /* #..#.. */
+    0x90, /* #..#.. */
+    0xf0, /* ####.. */
+    0x90, /* #..#.. */
+    0x90, /* #..#.. */
+    0x00, /* ...... */
+    0x7c, /* .##### */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x00, /* ...... */
+
+    /* Index: 0x03, char: \x04, offset: 0x0024 */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0xe0, /* ###... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x00, /* ...... */
+    0x3c, /* ..#### */
+    0x20, /* ..#... */
+    0x38, /* ..###. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+
+    /* Index: 0x04, char: \x05, offset: 0x0030 */
+    0x60, /* .##... */
+    0x90, /* #..#.. */
+    0x80, /* #..... */
+    0x90, /* #..#.. */
+    0x60, /* .##... */
+    0x00, /* ...... */
+    0x38, /* ..###. */
+    0x24, /* ..#..# */
+    0x38, /* ..###. */
+    0x28, /* ..#.#. */
+    0x24, /* ..#..# */
+    0x00, /* ...... */
+
+    /* Index: 0x05, char: \x06, offset: 0x003c */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x00, /* ...... */
+    0x3c, /* ..#### */
+    0x20, /* ..#... */
+    0x38, /* ..###. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+
+    /* Index: 0x06, char: \x07, offset: 0x0048 */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x07, char: \x08, offset: 0x0054 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0xf8, /* #####. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x08, char: \x09, offset: 0x0060 */
+    0x90, /* #..#.. */
+    0xd0, /* ##.#.. */
+    0xb0, /* #.##.. */
+    0x90, /* #..#.. */
+    0x90, /* #..#.. */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x3c, /* ..#### */
+    0x00, /* ...... */
+
+    /* Index: 0x09, char: \x0a, offset: 0x006c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x0a, char: \x0b, offset: 0x0078 */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0xe0, /* ###... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x0b, char: \x0c, offset: 0x0084 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xe0, /* ###... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0x0c, char: \x0d, offset: 0x0090 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x3c, /* ..#### */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0x0d, char: \x0e, offset: 0x009c */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x3c, /* ..#### */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x0e, char: \x0f, offset: 0x00a8 */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0xfc, /* ###### */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0x0f, char: \x10, offset: 0x00b4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x10, char: \x11, offset: 0x00c0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x11, char: \x12, offset: 0x00cc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xfc, /* ###### */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x12, char: \x13, offset: 0x00d8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x13, char: \x14, offset: 0x00e4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x14, char: \x15, offset: 0x00f0 */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x3c, /* ..#### */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0x15, char: \x16, offset: 0x00fc */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0xe0, /* ###... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0x16, char: \x17, offset: 0x0108 */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0xfc, /* ###### */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x17, char: \x18, offset: 0x0114 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xfc, /* ###### */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0x18, char: \x19, offset: 0x0120 */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0x19, char: \x1a, offset: 0x012c */
+    0x00, /* ...... */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x80, /* #..... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x10, /* ...#.. */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x1a, char: \x1b, offset: 0x0138 */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x10, /* ...#.. */
+    0x08, /* ....#. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x1b, char: \x1c, offset: 0x0144 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x1c, char: \x1d, offset: 0x0150 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x08, /* ....#. */
+    0xf8, /* #####. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x1d, char: \x1e, offset: 0x015c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x30, /* ..##.. */
+    0x48, /* .#..#. */
+    0x40, /* .#.... */
+    0xf0, /* ####.. */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x48, /* .#..#. */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x1e, char: \x1f, offset: 0x0168 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x1f, char: \x20, offset: 0x0174 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x20, char: !, offset: 0x0180 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x21, char: ", offset: 0x018c */
+    0x00, /* ...... */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x22, char: #, offset: 0x0198 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0xf8, /* #####. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0xf8, /* #####. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x23, char: $, offset: 0x01a4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0xa8, /* #.#.#. */
+    0xa0, /* #.#... */
+    0x70, /* .###.. */
+    0x28, /* ..#.#. */
+    0xa8, /* #.#.#. */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+
+    /* Index: 0x24, char: %, offset: 0x01b0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x48, /* .#..#. */
+    0xa8, /* #.#.#. */
+    0x50, /* .#.#.. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x28, /* ..#.#. */
+    0x54, /* .#.#.# */
+    0x48, /* .#..#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x25, char: &, offset: 0x01bc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x68, /* .##.#. */
+    0x90, /* #..#.. */
+    0x90, /* #..#.. */
+    0x68, /* .##.#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x26, char: ', offset: 0x01c8 */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x27, char: (, offset: 0x01d4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x10, /* ...#.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x28, char: ), offset: 0x01e0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x29, char: \x2a, offset: 0x01ec */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0xf8, /* #####. */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x2a, char: +, offset: 0x01f8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0xf8, /* #####. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x2b, char: ,, offset: 0x0204 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x00, /* ...... */
+
+    /* Index: 0x2c, char: -, offset: 0x0210 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x2d, char: ., offset: 0x021c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x2e, char: \x2f, offset: 0x0228 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x2f, char: 0, offset: 0x0234 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x98, /* #..##. */
+    0xa8, /* #.#.#. */
+    0xc8, /* ##..#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x30, char: 1, offset: 0x0240 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x60, /* .##... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x31, char: 2, offset: 0x024c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x08, /* ....#. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x32, char: 3, offset: 0x0258 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x08, /* ....#. */
+    0x30, /* ..##.. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x33, char: 4, offset: 0x0264 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x08, /* ....#. */
+    0x18, /* ...##. */
+    0x28, /* ..#.#. */
+    0x48, /* .#..#. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x34, char: 5, offset: 0x0270 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x35, char: 6, offset: 0x027c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x36, char: 7, offset: 0x0288 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x37, char: 8, offset: 0x0294 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x38, char: 9, offset: 0x02a0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x39, char: :, offset: 0x02ac */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x3a, char: ;, offset: 0x02b8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x00, /* ...... */
+
+    /* Index: 0x3b, char: <, offset: 0x02c4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x08, /* ....#. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x10, /* ...#.. */
+    0x08, /* ....#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x3c, char: =, offset: 0x02d0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x3d, char: >, offset: 0x02dc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x10, /* ...#.. */
+    0x08, /* ....#. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x3e, char: ?, offset: 0x02e8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x3f, char: @, offset: 0x02f4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x98, /* #..##. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x98, /* #..##. */
+    0x80, /* #..... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x40, char: A, offset: 0x0300 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x41, char: B, offset: 0x030c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x42, char: C, offset: 0x0318 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x43, char: D, offset: 0x0324 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xe0, /* ###... */
+    0x90, /* #..#.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x90, /* #..#.. */
+    0xe0, /* ###... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x44, char: E, offset: 0x0330 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x45, char: F, offset: 0x033c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x46, char: G, offset: 0x0348 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xb8, /* #.###. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x47, char: H, offset: 0x0354 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x48, char: I, offset: 0x0360 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x49, char: J, offset: 0x036c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x38, /* ..###. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x90, /* #..#.. */
+    0x90, /* #..#.. */
+    0x60, /* .##... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x4a, char: K, offset: 0x0378 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x90, /* #..#.. */
+    0xa0, /* #.#... */
+    0xc0, /* ##.... */
+    0xc0, /* ##.... */
+    0xa0, /* #.#... */
+    0x90, /* #..#.. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x4b, char: L, offset: 0x0384 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x4c, char: M, offset: 0x0390 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0xd8, /* ##.##. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x4d, char: N, offset: 0x039c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xc8, /* ##..#. */
+    0xa8, /* #.#.#. */
+    0x98, /* #..##. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x4e, char: O, offset: 0x03a8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x4f, char: P, offset: 0x03b4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x50, char: Q, offset: 0x03c0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xa8, /* #.#.#. */
+    0x70, /* .###.. */
+    0x08, /* ....#. */
+    0x00, /* ...... */
+
+    /* Index: 0x51, char: R, offset: 0x03cc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0xa0, /* #.#... */
+    0x90, /* #..#.. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x52, char: S, offset: 0x03d8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x80, /* #..... */
+    0x70, /* .###.. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x53, char: T, offset: 0x03e4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x54, char: U, offset: 0x03f0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x55, char: V, offset: 0x03fc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x56, char: W, offset: 0x0408 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xd8, /* ##.##. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x57, char: X, offset: 0x0414 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x58, char: Y, offset: 0x0420 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x59, char: Z, offset: 0x042c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x08, /* ....#. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x5a, char: [, offset: 0x0438 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x5b, char: \x5c, offset: 0x0444 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x5c, char: ], offset: 0x0450 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x5d, char: ^, offset: 0x045c */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x5e, char: _, offset: 0x0468 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+
+    /* Index: 0x5f, char: `, offset: 0x0474 */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x60, char: a, offset: 0x0480 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x08, /* ....#. */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x61, char: b, offset: 0x048c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x62, char: c, offset: 0x0498 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x63, char: d, offset: 0x04a4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x64, char: e, offset: 0x04b0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x65, char: f, offset: 0x04bc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x18, /* ...##. */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x66, char: g, offset: 0x04c8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x08, /* ....#. */
+    0x70, /* .###.. */
+
+    /* Index: 0x67, char: h, offset: 0x04d4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x68, char: i, offset: 0x04e0 */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x60, /* .##... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x69, char: j, offset: 0x04ec */
+    0x00, /* ...... */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x00, /* ...... */
+    0x18, /* ...##. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x48, /* .#..#. */
+    0x30, /* ..##.. */
+
+    /* Index: 0x6a, char: k, offset: 0x04f8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x48, /* .#..#. */
+    0x50, /* .#.#.. */
+    0x60, /* .##... */
+    0x60, /* .##... */
+    0x50, /* .#.#.. */
+    0x48, /* .#..#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x6b, char: l, offset: 0x0504 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x60, /* .##... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x6c, char: m, offset: 0x0510 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf0, /* ####.. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x6d, char: n, offset: 0x051c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x6e, char: o, offset: 0x0528 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x6f, char: p, offset: 0x0534 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+
+    /* Index: 0x70, char: q, offset: 0x0540 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+
+    /* Index: 0x71, char: r, offset: 0x054c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xb8, /* #.###. */
+    0xc0, /* ##.... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x72, char: s, offset: 0x0558 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x80, /* #..... */
+    0x70, /* .###.. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0xf0, /* ####.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x73, char: t, offset: 0x0564 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x18, /* ...##. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x74, char: u, offset: 0x0570 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x75, char: v, offset: 0x057c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x76, char: w, offset: 0x0588 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x77, char: x, offset: 0x0594 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x78, char: y, offset: 0x05a0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x08, /* ....#. */
+    0x70, /* .###.. */
+
+    /* Index: 0x79, char: z, offset: 0x05ac */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x80, /* #..... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x7a, char: {, offset: 0x05b8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x18, /* ...##. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x18, /* ...##. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x7b, char: |, offset: 0x05c4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x7c, char: }, offset: 0x05d0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x60, /* .##... */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x08, /* ....#. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x60, /* .##... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x7d, char: ~, offset: 0x05dc */
+    0x00, /* ...... */
+    0x48, /* .#..#. */
+    0xa8, /* #.#.#. */
+    0x90, /* #..#.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x7e, char: \x7f, offset: 0x05e8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x7f, char: \x80, offset: 0x05f4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x80, char: \x81, offset: 0x0600 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x81, char: \x82, offset: 0x060c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x82, char: \x83, offset: 0x0618 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x83, char: \x84, offset: 0x0624 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x84, char: \x85, offset: 0x0630 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x85, char: \x86, offset: 0x063c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x86, char: \x87, offset: 0x0648 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x87, char: \x88, offset: 0x0654 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x88, char: \x89, offset: 0x0660 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x89, char: \x8a, offset: 0x066c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x8a, char: \x8b, offset: 0x0678 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x8b, char: \x8c, offset: 0x0684 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x8c, char: \x8d, offset: 0x0690 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x8d, char: \x8e, offset: 0x069c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x8e, char: \x8f, offset: 0x06a8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x8f, char: \x90, offset: 0x06b4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x90, char: \x91, offset: 0x06c0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x91, char: \x92, offset: 0x06cc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x92, char: \x93, offset: 0x06d8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x93, char: \x94, offset: 0x06e4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x94, char: \x95, offset: 0x06f0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x95, char: \x96, offset: 0x06fc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x96, char: \x97, offset: 0x0708 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x97, char: \x98, offset: 0x0714 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x98, char: \x99, offset: 0x0720 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x99, char: \x9a, offset: 0x072c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x9a, char: \x9b, offset: 0x0738 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x9b, char: \x9c, offset: 0x0744 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x9c, char: \x9d, offset: 0x0750 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x9d, char: \x9e, offset: 0x075c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x9e, char: \x9f, offset: 0x0768 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x9f, char: \xa0, offset: 0x0774 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xa0, char: \xa1, offset: 0x0780 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xa1, char: \xa2, offset: 0x078c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0xa8, /* #.#.#. */
+    0xa0, /* #.#... */
+    0xa0, /* #.#... */
+    0xa8, /* #.#.#. */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+
+    /* Index: 0xa2, char: \xa3, offset: 0x0798 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x30, /* ..##.. */
+    0x48, /* .#..#. */
+    0x40, /* .#.... */
+    0xf0, /* ####.. */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x48, /* .#..#. */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xa3, char: \xa4, offset: 0x07a4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x48, /* .#..#. */
+    0x30, /* ..##.. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x30, /* ..##.. */
+    0x48, /* .#..#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xa4, char: \xa5, offset: 0x07b0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xa5, char: \xa6, offset: 0x07bc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xa6, char: \xa7, offset: 0x07c8 */
+    0x00, /* ...... */
+    0x30, /* ..##.. */
+    0x48, /* .#..#. */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x48, /* .#..#. */
+    0x28, /* ..#.#. */
+    0x10, /* ...#.. */
+    0x48, /* .#..#. */
+    0x30, /* ..##.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xa7, char: \xa8, offset: 0x07d4 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xa8, char: \xa9, offset: 0x07e0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x84, /* #....# */
+    0xb4, /* #.##.# */
+    0xa4, /* #.#..# */
+    0xa4, /* #.#..# */
+    0xb4, /* #.##.# */
+    0x84, /* #....# */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xa9, char: \xaa, offset: 0x07ec */
+    0x30, /* ..##.. */
+    0x08, /* ....#. */
+    0x38, /* ..###. */
+    0x48, /* .#..#. */
+    0x38, /* ..###. */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xaa, char: \xab, offset: 0x07f8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x14, /* ...#.# */
+    0x28, /* ..#.#. */
+    0x50, /* .#.#.. */
+    0xa0, /* #.#... */
+    0x50, /* .#.#.. */
+    0x28, /* ..#.#. */
+    0x14, /* ...#.# */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xab, char: \xac, offset: 0x0804 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xac, char: \xad, offset: 0x0810 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xad, char: \xae, offset: 0x081c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x84, /* #....# */
+    0xb4, /* #.##.# */
+    0xac, /* #.#.## */
+    0xb4, /* #.##.# */
+    0xac, /* #.#.## */
+    0x84, /* #....# */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xae, char: \xaf, offset: 0x0828 */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xaf, char: \xb0, offset: 0x0834 */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xb0, char: \xb1, offset: 0x0840 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0xf8, /* #####. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xb1, char: \xb2, offset: 0x084c */
+    0x00, /* ...... */
+    0x30, /* ..##.. */
+    0x48, /* .#..#. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xb2, char: \xb3, offset: 0x0858 */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x08, /* ....#. */
+    0x30, /* ..##.. */
+    0x08, /* ....#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xb3, char: \xb4, offset: 0x0864 */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xb4, char: \xb5, offset: 0x0870 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x98, /* #..##. */
+    0xe8, /* ###.#. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+
+    /* Index: 0xb5, char: \xb6, offset: 0x087c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x68, /* .##.#. */
+    0x28, /* ..#.#. */
+    0x28, /* ..#.#. */
+    0x28, /* ..#.#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xb6, char: \xb7, offset: 0x0888 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xb7, char: \xb8, offset: 0x0894 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+
+    /* Index: 0xb8, char: \xb9, offset: 0x08a0 */
+    0x00, /* ...... */
+    0x10, /* ...#.. */
+    0x30, /* ..##.. */
+    0x10, /* ...#.. */
+    0x10, /* ...#.. */
+    0x38, /* ..###. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xb9, char: \xba, offset: 0x08ac */
+    0x30, /* ..##.. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x30, /* ..##.. */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xba, char: \xbb, offset: 0x08b8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xa0, /* #.#... */
+    0x50, /* .#.#.. */
+    0x28, /* ..#.#. */
+    0x14, /* ...#.# */
+    0x28, /* ..#.#. */
+    0x50, /* .#.#.. */
+    0xa0, /* #.#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xbb, char: \xbc, offset: 0x08c4 */
+    0x40, /* .#.... */
+    0xc0, /* ##.... */
+    0x44, /* .#...# */
+    0x48, /* .#..#. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x48, /* .#..#. */
+    0x98, /* #..##. */
+    0x28, /* ..#.#. */
+    0x78, /* .####. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+
+    /* Index: 0xbc, char: \xbd, offset: 0x08d0 */
+    0x40, /* .#.... */
+    0xc0, /* ##.... */
+    0x44, /* .#...# */
+    0x48, /* .#..#. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x98, /* #..##. */
+    0x24, /* ..#..# */
+    0x08, /* ....#. */
+    0x10, /* ...#.. */
+    0x3c, /* ..#### */
+
+    /* Index: 0xbd, char: \xbe, offset: 0x08dc */
+    0xe0, /* ###... */
+    0x10, /* ...#.. */
+    0x60, /* .##... */
+    0x14, /* ...#.# */
+    0xe8, /* ###.#. */
+    0x10, /* ...#.. */
+    0x24, /* ..#..# */
+    0x4c, /* .#..## */
+    0x94, /* #..#.# */
+    0x3c, /* ..#### */
+    0x04, /* .....# */
+    0x04, /* .....# */
+
+    /* Index: 0xbe, char: \xbf, offset: 0x08e8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xbf, char: \xc0, offset: 0x08f4 */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc0, char: \xc1, offset: 0x0900 */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc1, char: \xc2, offset: 0x090c */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc2, char: \xc3, offset: 0x0918 */
+    0x28, /* ..#.#. */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc3, char: \xc4, offset: 0x0924 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc4, char: \xc5, offset: 0x0930 */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc5, char: \xc6, offset: 0x093c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x7c, /* .##### */
+    0x90, /* #..#.. */
+    0x90, /* #..#.. */
+    0xfc, /* ###### */
+    0x90, /* #..#.. */
+    0x90, /* #..#.. */
+    0x90, /* #..#.. */
+    0x9c, /* #..### */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc6, char: \xc7, offset: 0x0948 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+
+    /* Index: 0xc7, char: \xc8, offset: 0x0954 */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc8, char: \xc9, offset: 0x0960 */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc9, char: \xca, offset: 0x096c */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xca, char: \xcb, offset: 0x0978 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xcb, char: \xcc, offset: 0x0984 */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xcc, char: \xcd, offset: 0x0990 */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xcd, char: \xce, offset: 0x099c */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xce, char: \xcf, offset: 0x09a8 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xcf, char: \xd0, offset: 0x09b4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xe0, /* ###... */
+    0x90, /* #..#.. */
+    0x88, /* #...#. */
+    0xe8, /* ###.#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x90, /* #..#.. */
+    0xe0, /* ###... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd0, char: \xd1, offset: 0x09c0 */
+    0x28, /* ..#.#. */
+    0x50, /* .#.#.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xc8, /* ##..#. */
+    0xa8, /* #.#.#. */
+    0x98, /* #..##. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd1, char: \xd2, offset: 0x09cc */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd2, char: \xd3, offset: 0x09d8 */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd3, char: \xd4, offset: 0x09e4 */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd4, char: \xd5, offset: 0x09f0 */
+    0x28, /* ..#.#. */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd5, char: \xd6, offset: 0x09fc */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd6, char: \xd7, offset: 0x0a08 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd7, char: \xd8, offset: 0x0a14 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x74, /* .###.# */
+    0x88, /* #...#. */
+    0x98, /* #..##. */
+    0xa8, /* #.#.#. */
+    0xc8, /* ##..#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd8, char: \xd9, offset: 0x0a20 */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd9, char: \xda, offset: 0x0a2c */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xda, char: \xdb, offset: 0x0a38 */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xdb, char: \xdc, offset: 0x0a44 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xdc, char: \xdd, offset: 0x0a50 */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xdd, char: \xde, offset: 0x0a5c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xde, char: \xdf, offset: 0x0a68 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xe0, /* ###... */
+    0x90, /* #..#.. */
+    0x90, /* #..#.. */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xc8, /* ##..#. */
+    0xb0, /* #.##.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xdf, char: \xe0, offset: 0x0a74 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x08, /* ....#. */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe0, char: \xe1, offset: 0x0a80 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x08, /* ....#. */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe1, char: \xe2, offset: 0x0a8c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x08, /* ....#. */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe2, char: \xe3, offset: 0x0a98 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x28, /* ..#.#. */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x08, /* ....#. */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe3, char: \xe4, offset: 0x0aa4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x08, /* ....#. */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe4, char: \xe5, offset: 0x0ab0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x08, /* ....#. */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe5, char: \xe6, offset: 0x0abc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x28, /* ..#.#. */
+    0x68, /* .##.#. */
+    0xb0, /* #.##.. */
+    0xa0, /* #.#... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe6, char: \xe7, offset: 0x0ac8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+
+    /* Index: 0xe7, char: \xe8, offset: 0x0ad4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe8, char: \xe9, offset: 0x0ae0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe9, char: \xea, offset: 0x0aec */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xea, char: \xeb, offset: 0x0af8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xeb, char: \xec, offset: 0x0b04 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x60, /* .##... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xec, char: \xed, offset: 0x0b10 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x60, /* .##... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xed, char: \xee, offset: 0x0b1c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x60, /* .##... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xee, char: \xef, offset: 0x0b28 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x60, /* .##... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xef, char: \xf0, offset: 0x0b34 */
+    0x00, /* ...... */
+    0xa0, /* #.#... */
+    0x40, /* .#.... */
+    0xa0, /* #.#... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf0, char: \xf1, offset: 0x0b40 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x28, /* ..#.#. */
+    0x50, /* .#.#.. */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf1, char: \xf2, offset: 0x0b4c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf2, char: \xf3, offset: 0x0b58 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf3, char: \xf4, offset: 0x0b64 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf4, char: \xf5, offset: 0x0b70 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x28, /* ..#.#. */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf5, char: \xf6, offset: 0x0b7c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf6, char: \xf7, offset: 0x0b88 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf7, char: \xf8, offset: 0x0b94 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x34, /* ..##.# */
+    0x48, /* .#..#. */
+    0x58, /* .#.##. */
+    0x68, /* .##.#. */
+    0x48, /* .#..#. */
+    0xb0, /* #.##.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf8, char: \xf9, offset: 0x0ba0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf9, char: \xfa, offset: 0x0bac */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xfa, char: \xfb, offset: 0x0bb8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xfb, char: \xfc, offset: 0x0bc4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xfc, char: \xfd, offset: 0x0bd0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x08, /* ....#. */
+    0x70, /* .###.. */
+
+    /* Index: 0xfd, char: \xfe, offset: 0x0bdc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+
+    /* Index: 0xfe, char: \xff, offset: 0x0be8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x08, /* ....#. */
+    0x70, /* .###.. */
+
+    /* Index: 0x8a, char: \x8b, offset: 0x0bf4 */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x8b, char: \x8c, offset: 0x0c00 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+
+    /* Index: 0x8c, char: \x8d, offset: 0x0c0c */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+    0xfc, /* ###### */
+
+    /* Index: 0x8d, char: \x8e, offset: 0x0c18 */
+    0xe0, /* ###... */
+    0xe0, /* ###... */
+    0xe0, /* ###... */
+    0xe0, /* ###... */
+    0xe0, /* ###... */
+    0xe0, /* ###... */
+    0xe0, /* ###... */
+    0xe0, /* ###... */
+    0xe0, /* ###... */
+    0xe0, /* ###... */
+    0xe0, /* ###... */
+    0xe0, /* ###... */
+
+    /* Index: 0x8e, char: \x8f, offset: 0x0c24 */
+    0x1c, /* ...### */
+    0x1c, /* ...### */
+    0x1c, /* ...### */
+    0x1c, /* ...### */
+    0x1c, /* ...### */
+    0x1c, /* ...### */
+    0x1c, /* ...### */
+    0x1c, /* ...### */
+    0x1c, /* ...### */
+    0x1c, /* ...### */
+    0x1c, /* ...### */
+    0x1c, /* ...### */
+
+    /* Index: 0x8f, char: \x90, offset: 0x0c30 */
+    0x90, /* #..#.. */
+    0x24, /* ..#..# */
+    0x90, /* #..#.. */
+    0x24, /* ..#..# */
+    0x90, /* #..#.. */
+    0x24, /* ..#..# */
+    0x90, /* #..#.. */
+    0x24, /* ..#..# */
+    0x90, /* #..#.. */
+    0x24, /* ..#..# */
+    0x90, /* #..#.. */
+    0x24, /* ..#..# */
+
+    /* Index: 0x90, char: \x91, offset: 0x0c3c */
+    0xa8, /* #.#.#. */
+    0x54, /* .#.#.# */
+    0xa8, /* #.#.#. */
+    0x54, /* .#.#.# */
+    0xa8, /* #.#.#. */
+    0x54, /* .#.#.# */
+    0xa8, /* #.#.#. */
+    0x54, /* .#.#.# */
+    0xa8, /* #.#.#. */
+    0x54, /* .#.#.# */
+    0xa8, /* #.#.#. */
+    0x54, /* .#.#.# */
+
+    /* Index: 0x91, char: \x92, offset: 0x0c48 */
+    0xd8, /* ##.##. */
+    0xb4, /* #.##.# */
+    0xd8, /* ##.##. */
+    0xb4, /* #.##.# */
+    0xd8, /* ##.##. */
+    0xb4, /* #.##.# */
+    0xd8, /* ##.##. */
+    0xb4, /* #.##.# */
+    0xd8, /* ##.##. */
+    0xb4, /* #.##.# */
+    0xd8, /* ##.##. */
+    0xb4, /* #.##.# */
+
+    /* Index: 0x92, char: \x93, offset: 0x0c54 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x10, /* ...#.. */
+    0x28, /* ..#.#. */
+    0x28, /* ..#.#. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0x93, char: \x94, offset: 0x0c60 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x78, /* .####. */
+    0x78, /* .####. */
+    0x78, /* .####. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x94, char: \x95, offset: 0x0c6c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x30, /* ..##.. */
+    0x78, /* .####. */
+    0x30, /* ..##.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x95, char: \x96, offset: 0x0c78 */
+    0x00, /* ...... */
+    0x0c, /* ....## */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x48, /* .#..#. */
+    0x28, /* ..#.#. */
+    0x18, /* ...##. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x96, char: \x97, offset: 0x0c84 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x68, /* .##.#. */
+    0xb0, /* #.##.. */
+    0x00, /* ...... */
+    0x68, /* .##.#. */
+    0xb0, /* #.##.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x97, char: \x98, offset: 0x0c90 */
+    0x00, /* ...... */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x80, /* #..... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x10, /* ...#.. */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x98, char: \x99, offset: 0x0c9c */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x20, /* ..#... */
+    0x10, /* ...#.. */
+    0x08, /* ....#. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x40, /* .#.... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x99, char: \x9a, offset: 0x0ca8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x9a, char: \x9b, offset: 0x0cb4 */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0xa0, /* #.#... */
+    0xa0, /* #.#... */
+    0x40, /* .#.... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x9b, char: \x9c, offset: 0x0cc0 */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x9c, char: \x9d, offset: 0x0ccc */
+    0x00, /* ...... */
+    0x30, /* ..##.. */
+    0x48, /* .#..#. */
+    0x10, /* ...#.. */
+    0x20, /* ..#... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x9d, char: \x9e, offset: 0x0cd8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x9e, char: \x9f, offset: 0x0ce4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0x9f, char: \xa0, offset: 0x0cf0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xfc, /* ###### */
+    0x00, /* ...... */
+    0xfc, /* ###### */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xa0, char: \xa1, offset: 0x0cfc */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xa1, char: \xa2, offset: 0x0d08 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x3c, /* ..#### */
+    0x20, /* ..#... */
+    0x3c, /* ..#### */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0xa2, char: \xa3, offset: 0x0d14 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xa3, char: \xa4, offset: 0x0d20 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x7c, /* .##### */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xa4, char: \xa5, offset: 0x0d2c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x7c, /* .##### */
+    0x40, /* .#.... */
+    0x5c, /* .#.### */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xa5, char: \xa6, offset: 0x0d38 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xe0, /* ###... */
+    0x20, /* ..#... */
+    0xe0, /* ###... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0xa6, char: \xa7, offset: 0x0d44 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf0, /* ####.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xa7, char: \xa8, offset: 0x0d50 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf0, /* ####.. */
+    0x10, /* ...#.. */
+    0xd0, /* ##.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xa8, char: \xa9, offset: 0x0d5c */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x3c, /* ..#### */
+    0x20, /* ..#... */
+    0x3c, /* ..#### */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xa9, char: \xaa, offset: 0x0d68 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x7c, /* .##### */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xaa, char: \xab, offset: 0x0d74 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x5c, /* .#.### */
+    0x40, /* .#.... */
+    0x7c, /* .##### */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xab, char: \xac, offset: 0x0d80 */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0xe0, /* ###... */
+    0x20, /* ..#... */
+    0xe0, /* ###... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xac, char: \xad, offset: 0x0d8c */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0xf0, /* ####.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xad, char: \xae, offset: 0x0d98 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0xd0, /* ##.#.. */
+    0x10, /* ...#.. */
+    0xf0, /* ####.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xae, char: \xaf, offset: 0x0da4 */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x3c, /* ..#### */
+    0x20, /* ..#... */
+    0x3c, /* ..#### */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0xaf, char: \xb0, offset: 0x0db0 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x5c, /* .#.### */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xb0, char: \xb1, offset: 0x0dbc */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x5c, /* .#.### */
+    0x40, /* .#.... */
+    0x5c, /* .#.### */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xb1, char: \xb2, offset: 0x0dc8 */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0xe0, /* ###... */
+    0x20, /* ..#... */
+    0xe0, /* ###... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0xb2, char: \xb3, offset: 0x0dd4 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xb3, char: \xb4, offset: 0x0de0 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0xd0, /* ##.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xb4, char: \xb5, offset: 0x0dec */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0xd0, /* ##.#.. */
+    0x10, /* ...#.. */
+    0xd0, /* ##.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xb5, char: \xb6, offset: 0x0df8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xfc, /* ###### */
+    0x00, /* ...... */
+    0xfc, /* ###### */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0xb6, char: \xb7, offset: 0x0e04 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xfc, /* ###### */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xb7, char: \xb8, offset: 0x0e10 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xfc, /* ###### */
+    0x00, /* ...... */
+    0xdc, /* ##.### */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xb8, char: \xb9, offset: 0x0e1c */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0xfc, /* ###### */
+    0x00, /* ...... */
+    0xfc, /* ###### */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xb9, char: \xba, offset: 0x0e28 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0xfc, /* ###### */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xba, char: \xbb, offset: 0x0e34 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0xdc, /* ##.### */
+    0x00, /* ...... */
+    0xfc, /* ###### */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xbb, char: \xbc, offset: 0x0e40 */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0xfc, /* ###### */
+    0x20, /* ..#... */
+    0xfc, /* ###### */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+
+    /* Index: 0xbc, char: \xbd, offset: 0x0e4c */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0xfc, /* ###### */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xbd, char: \xbe, offset: 0x0e58 */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0xdc, /* ##.### */
+    0x00, /* ...... */
+    0xdc, /* ##.### */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+    0x50, /* .#.#.. */
+
+    /* Index: 0xbe, char: \xbf, offset: 0x0e64 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x84, /* #....# */
+    0xb4, /* #.##.# */
+    0xa4, /* #.#..# */
+    0xa4, /* #.#..# */
+    0xb4, /* #.##.# */
+    0x84, /* #....# */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xbf, char: \xc0, offset: 0x0e70 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x90, /* #..#.. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xe8, /* ###.#. */
+    0xa8, /* #.#.#. */
+    0x90, /* #..#.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc0, char: \xc1, offset: 0x0e7c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x08, /* ....#. */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc1, char: \xc2, offset: 0x0e88 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc2, char: \xc3, offset: 0x0e94 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x7c, /* .##### */
+    0x04, /* .....# */
+    0x04, /* .....# */
+
+    /* Index: 0xc3, char: \xc4, offset: 0x0ea0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x08, /* ....#. */
+    0x70, /* .###.. */
+
+    /* Index: 0xc4, char: \xc5, offset: 0x0eac */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc5, char: \xc6, offset: 0x0eb8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+
+    /* Index: 0xc6, char: \xc7, offset: 0x0ec4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc7, char: \xc8, offset: 0x0ed0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc8, char: \xc9, offset: 0x0edc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xc9, char: \xca, offset: 0x0ee8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xca, char: \xcb, offset: 0x0ef4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x48, /* .#..#. */
+    0x50, /* .#.#.. */
+    0x60, /* .##... */
+    0x60, /* .##... */
+    0x50, /* .#.#.. */
+    0x48, /* .#..#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xcb, char: \xcc, offset: 0x0f00 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x38, /* ..###. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xcc, char: \xcd, offset: 0x0f0c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0xd8, /* ##.##. */
+    0xa8, /* #.#.#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xcd, char: \xce, offset: 0x0f18 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xce, char: \xcf, offset: 0x0f24 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xcf, char: \xd0, offset: 0x0f30 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd0, char: \xd1, offset: 0x0f3c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x28, /* ..#.#. */
+    0x48, /* .#..#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd1, char: \xd2, offset: 0x0f48 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+
+    /* Index: 0xd2, char: \xd3, offset: 0x0f54 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd3, char: \xd4, offset: 0x0f60 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd4, char: \xd5, offset: 0x0f6c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x08, /* ....#. */
+    0x70, /* .###.. */
+
+    /* Index: 0xd5, char: \xd6, offset: 0x0f78 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x70, /* .###.. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd6, char: \xd7, offset: 0x0f84 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xe0, /* ###... */
+    0x90, /* #..#.. */
+    0x90, /* #..#.. */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd7, char: \xd8, offset: 0x0f90 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x70, /* .###.. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd8, char: \xd9, offset: 0x0f9c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xc8, /* ##..#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xc8, /* ##..#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xd9, char: \xda, offset: 0x0fa8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x30, /* ..##.. */
+    0x08, /* ....#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xda, char: \xdb, offset: 0x0fb4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xdb, char: \xdc, offset: 0x0fc0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x38, /* ..###. */
+    0x08, /* ....#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xdc, char: \xdd, offset: 0x0fcc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x7c, /* .##### */
+    0x04, /* .....# */
+    0x04, /* .....# */
+
+    /* Index: 0xdd, char: \xde, offset: 0x0fd8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xde, char: \xdf, offset: 0x0fe4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xc0, /* ##.... */
+    0x40, /* .#.... */
+    0x70, /* .###.. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xdf, char: \xe0, offset: 0x0ff0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x90, /* #..#.. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xe8, /* ###.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x90, /* #..#.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe0, char: \xe1, offset: 0x0ffc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe1, char: \xe2, offset: 0x1008 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe2, char: \xe3, offset: 0x1014 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x7c, /* .##### */
+    0x04, /* .....# */
+    0x04, /* .....# */
+
+    /* Index: 0xe3, char: \xe4, offset: 0x1020 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x38, /* ..###. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0xfc, /* ###### */
+    0x84, /* #....# */
+    0x00, /* ...... */
+
+    /* Index: 0xe4, char: \xe5, offset: 0x102c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0xf8, /* #####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe5, char: \xe6, offset: 0x1038 */
+    0x00, /* ...... */
+    0x20, /* ..#... */
+    0x70, /* .###.. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x70, /* .###.. */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+
+    /* Index: 0xe6, char: \xe7, offset: 0x1044 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe7, char: \xe8, offset: 0x1050 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x50, /* .#.#.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe8, char: \xe9, offset: 0x105c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x98, /* #..##. */
+    0xa8, /* #.#.#. */
+    0xc8, /* ##..#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xe9, char: \xea, offset: 0x1068 */
+    0x50, /* .#.#.. */
+    0x20, /* ..#... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x98, /* #..##. */
+    0xa8, /* #.#.#. */
+    0xc8, /* ##..#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xea, char: \xeb, offset: 0x1074 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x90, /* #..#.. */
+    0xa0, /* #.#... */
+    0xc0, /* ##.... */
+    0xc0, /* ##.... */
+    0xa0, /* #.#... */
+    0x90, /* #..#.. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xeb, char: \xec, offset: 0x1080 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x38, /* ..###. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xec, char: \xed, offset: 0x108c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0xd8, /* ##.##. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xed, char: \xee, offset: 0x1098 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xee, char: \xef, offset: 0x10a4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xef, char: \xf0, offset: 0x10b0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf0, char: \xf1, offset: 0x10bc */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x78, /* .####. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x28, /* ..#.#. */
+    0x48, /* .#..#. */
+    0x88, /* #...#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf1, char: \xf2, offset: 0x10c8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf2, char: \xf3, offset: 0x10d4 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x80, /* #..... */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf3, char: \xf4, offset: 0x10e0 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf8, /* #####. */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x20, /* ..#... */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf4, char: \xf5, offset: 0x10ec */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf5, char: \xf6, offset: 0x10f8 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x70, /* .###.. */
+    0x70, /* .###.. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf6, char: \xf7, offset: 0x1104 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xf0, /* ####.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf7, char: \xf8, offset: 0x1110 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x40, /* .#.... */
+    0x40, /* .#.... */
+    0x70, /* .###.. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf8, char: \xf9, offset: 0x111c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0xc8, /* ##..#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xc8, /* ##..#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xf9, char: \xfa, offset: 0x1128 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x08, /* ....#. */
+    0x30, /* ..##.. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xfa, char: \xfb, offset: 0x1134 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x78, /* .####. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xfb, char: \xfc, offset: 0x1140 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x70, /* .###.. */
+    0x88, /* #...#. */
+    0x08, /* ....#. */
+    0x38, /* ..###. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x88, /* #...#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xfc, char: \xfd, offset: 0x114c */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0xa8, /* #.#.#. */
+    0x7c, /* .##### */
+    0x04, /* .....# */
+    0x04, /* .....# */
+
+    /* Index: 0xfd, char: \xfe, offset: 0x1158 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x88, /* #...#. */
+    0x78, /* .####. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x08, /* ....#. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+
+    /* Index: 0xfe, char: \xff, offset: 0x1164 */
+    0x00, /* ...... */
+    0x00, /* ...... */
+    0xc0, /* ##.... */
+    0x40, /* .#.... */
+    0x70, /* .###.. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x48, /* .#..#. */
+    0x70, /* .###.. */
+    0x00, /* ...... */
+    0x00, /* ...... */
+};
+
+const font_info_t _fonts_terminus_6x12_iso8859_1_info =
+{
+    .height           = 12, /* Character height */
+    .c                = 0, /* C */
+    .char_start       = 1, /* Start character */
+    .char_end         = 255, /* End character */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
+    .bitmap           = _fonts_terminus_6x12_shared_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 6, /* Glyph width */
+    .stride           = 12, /* Bytes per glyph */
+};
+
+static const font_range_t _fonts_terminus_6x12_koi8_r_ranges[] = {
+    { 0x0001, 0x007f,    0 },
+    { 0x0080, 0x0080,   17 },
+    { 0x0081, 0x0081,   24 },
+    { 0x0082, 0x0082,   12 },
+    { 0x0083, 0x0083,   11 },
+    { 0x0084, 0x0084,   13 },
+    { 0x0085, 0x0085,   10 },
+    { 0x0086, 0x0087,   20 },
+    { 0x0088, 0x0088,   23 },
+    { 0x0089, 0x0089,   22 },
+    { 0x008a, 0x008a,   14 },
+    { 0x008b, 0x00ff,  255 },
+};
+
+const font_info_t _fonts_terminus_6x12_koi8_r_info =
+{
+    .height           = 12, /* Character height */
+    .c                = 0, /* C */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
+    .bitmap           = _fonts_terminus_6x12_shared_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 6, /* Glyph width */
+    .stride           = 12, /* Bytes per glyph */
+    .ranges           = _fonts_terminus_6x12_koi8_r_ranges, /* Code point ranges */
+    .num_ranges       = 12, /* Number of ranges */
+};
+
+#endif /* _EXTRAS_FONTS_FONT_TERMINUS_6X12_SHARED_H_ */
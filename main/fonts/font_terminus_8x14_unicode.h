@@ -0,0 +1,7228 @@
+/**
+ * This file contains generated binary font data.
+ *
+ * Font:    terminus_8x14_unicode
+ * Height:  14
+ * Layout:  page-native, monospace
+ * 377 characters in 26 ranges (U+0001..U+25A0)
+ *
+ * Copyright (c) 2015 Dimitar Toshkov Zhekov
+ * License: SIL Open Font License, Version 1.1. The license is included as OFL.TXT, and is
+ *      also available with a FAQ at http://scripts.sil.org/OFL
+ *
+ * Source:  builtin:terminus_8x14_iso8859_1, builtin:terminus_8x14_koi8_r
+ * Generated by tools/fontc, do not edit. Command:
+ *     fontc --mono -n terminus_8x14_unicode --comment ../../main/fonts/src/terminus.txt -o ../../main/fonts/font_terminus_8x14_unicode.h builtin:terminus_8x14_iso8859_1 --charset koi8-r builtin:terminus_8x14_koi8_r
+ */
+#ifndef _EXTRAS_FONTS_FONT_TERMINUS_8X14_UNICODE_H_
+#define _EXTRAS_FONTS_FONT_TERMINUS_8X14_UNICODE_H_
+
+static const uint8_t _fonts_terminus_8x14_unicode_bitmaps[] = {
+
+    /* Index: 0x00, char: \x01, offset: 0x0000
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ..###...
+     * .#####..
+     * #######.
+     * .#####..
+     * ..###...
+     * ...#....
+     * ........
+     * ........
+     * ........
+     */
+    0x80, 0xc0, 0xe0, 0xf0, 0xe0, 0xc0, 0x80, 0x00,
+    0x00, 0x01, 0x03, 0x07, 0x03, 0x01, 0x00, 0x00,
+
+    /* Index: 0x01, char: \x02, offset: 0x0010
+     * #.#.#.#.
+     * .#.#.#.#
+     * #.#.#.#.
+     * .#.#.#.#
+     * #.#.#.#.
+     * .#.#.#.#
+     * #.#.#.#.
+     * .#.#.#.#
+     * #.#.#.#.
+     * .#.#.#.#
+     * #.#.#.#.
+     * .#.#.#.#
+     * #.#.#.#.
+     * .#.#.#.#
+     */
+    0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa,
+    0x15, 0x2a, 0x15, 0x2a, 0x15, 0x2a, 0x15, 0x2a,
+
+    /* Index: 0x02, char: \x03, offset: 0x0020
+     * #...#...
+     * #...#...
+     * #####...
+     * #...#...
+     * #...#...
+     * #...#...
+     * ........
+     * ...#####
+     * .....#..
+     * .....#..
+     * .....#..
+     * .....#..
+     * .....#..
+     * ........
+     */
+    0x3f, 0x04, 0x04, 0x84, 0xbf, 0x80, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+
+    /* Index: 0x03, char: \x04, offset: 0x0030
+     * #####...
+     * #.......
+     * ###.....
+     * #.......
+     * #.......
+     * #.......
+     * ........
+     * ...#####
+     * ...#....
+     * ...###..
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     */
+    0x3f, 0x05, 0x05, 0x81, 0x81, 0x80, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x1f, 0x02, 0x02, 0x00, 0x00,
+
+    /* Index: 0x04, char: \x05, offset: 0x0040
+     * .###....
+     * #...#...
+     * #.......
+     * #.......
+     * #...#...
+     * .###....
+     * ........
+     * ...####.
+     * ...#...#
+     * ...#...#
+     * ...####.
+     * ...#..#.
+     * ...#...#
+     * ........
+     */
+    0x1e, 0x21, 0x21, 0xa1, 0x92, 0x80, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x0c, 0x13,
+
+    /* Index: 0x05, char: \x06, offset: 0x0050
+     * #.......
+     * #.......
+     * #.......
+     * #.......
+     * #.......
+     * #####...
+     * ........
+     * ...#####
+     * ...#....
+     * ...###..
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     */
+    0x3f, 0x20, 0x20, 0xa0, 0xa0, 0x80, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x1f, 0x02, 0x02, 0x00, 0x00,
+
+    /* Index: 0x06, char: \x07, offset: 0x0060
+     * ........
+     * ...##...
+     * ..#..#..
+     * ..#..#..
+     * ...##...
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x0c, 0x12, 0x12, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x07, char: \x08, offset: 0x0070
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * .#####..
+     * ...#....
+     * ...#....
+     * ........
+     * .#####..
+     * ........
+     * ........
+     */
+    0x00, 0x80, 0x80, 0xe0, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x08, 0x08, 0x0b, 0x08, 0x08, 0x00, 0x00,
+
+    /* Index: 0x08, char: \x09, offset: 0x0080
+     * #...#...
+     * ##..#...
+     * #.#.#...
+     * #..##...
+     * #...#...
+     * #...#...
+     * ........
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#####
+     * ........
+     */
+    0x3f, 0x02, 0x04, 0x88, 0x3f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x10, 0x10,
+
+    /* Index: 0x09, char: \x0a, offset: 0x0090
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x0a, char: \x0b, offset: 0x00a0
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ####....
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x40, 0x40, 0x40, 0x7f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x0b, char: \x0c, offset: 0x00b0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ####....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x40, 0x40, 0x40, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x0c, char: \x0d, offset: 0x00c0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#####
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x00, 0x00, 0x00, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x0d, char: \x0e, offset: 0x00d0
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#####
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x7f, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x0e, char: \x0f, offset: 0x00e0
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ########
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x0f, char: \x10, offset: 0x00f0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x10, char: \x11, offset: 0x0100
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x11, char: \x12, offset: 0x0110
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ########
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x12, char: \x13, offset: 0x0120
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x13, char: \x14, offset: 0x0130
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x14, char: \x15, offset: 0x0140
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#####
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x00, 0x00, 0x00, 0xff, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x15, char: \x16, offset: 0x0150
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ####....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x40, 0x40, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x16, char: \x17, offset: 0x0160
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ########
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x40, 0x40, 0x40, 0x7f, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x17, char: \x18, offset: 0x0170
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ########
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x40, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x18, char: \x19, offset: 0x0180
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x19, char: \x1a, offset: 0x0190
+     * ........
+     * ........
+     * ........
+     * .....#..
+     * ....#...
+     * ...#....
+     * ..#.....
+     * ...#....
+     * ....#...
+     * .....#..
+     * ........
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x40, 0xa0, 0x10, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x09, 0x0a, 0x08, 0x00,
+
+    /* Index: 0x1a, char: \x1b, offset: 0x01a0
+     * ........
+     * ........
+     * ........
+     * ..#.....
+     * ...#....
+     * ....#...
+     * .....#..
+     * ....#...
+     * ...#....
+     * ..#.....
+     * ........
+     * .#####..
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x08, 0x10, 0xa0, 0x40, 0x00, 0x00,
+    0x00, 0x08, 0x0a, 0x09, 0x08, 0x08, 0x00, 0x00,
+
+    /* Index: 0x1b, char: \x1c, offset: 0x01b0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x1c, char: \x1d, offset: 0x01c0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ......#.
+     * .######.
+     * ....#...
+     * ...#....
+     * .######.
+     * .#......
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x20, 0x20, 0xa0, 0x60, 0x20, 0x30, 0x00,
+    0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x1d, char: \x1e, offset: 0x01d0
+     * ........
+     * ........
+     * ...##...
+     * ..#..#..
+     * ..#.....
+     * ..#.....
+     * .####...
+     * ..#.....
+     * ..#.....
+     * ..#.....
+     * ..#...#.
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0x40, 0xf8, 0x44, 0x44, 0x08, 0x00, 0x00,
+    0x00, 0x08, 0x0f, 0x08, 0x08, 0x08, 0x0c, 0x00,
+
+    /* Index: 0x1e, char: \x1f, offset: 0x01e0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x1f, char: \x20, offset: 0x01f0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x20, char: !, offset: 0x0200
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x21, char: ", offset: 0x0210
+     * ........
+     * ..#..#..
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x22, char: #, offset: 0x0220
+     * ........
+     * ........
+     * ..#..#..
+     * ..#..#..
+     * ..#..#..
+     * .######.
+     * ..#..#..
+     * ..#..#..
+     * .######.
+     * ..#..#..
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * ........
+     */
+    0x00, 0x20, 0xfc, 0x20, 0x20, 0xfc, 0x20, 0x00,
+    0x00, 0x01, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x00,
+
+    /* Index: 0x23, char: $, offset: 0x0230
+     * ........
+     * ...#....
+     * ...#....
+     * .#####..
+     * #..#..#.
+     * #..#....
+     * #..#....
+     * .#####..
+     * ...#..#.
+     * ...#..#.
+     * #..#..#.
+     * .#####..
+     * ...#....
+     * ...#....
+     */
+    0x70, 0x88, 0x88, 0xfe, 0x88, 0x88, 0x10, 0x00,
+    0x04, 0x08, 0x08, 0x3f, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x24, char: %, offset: 0x0240
+     * ........
+     * ........
+     * .##..#..
+     * #..#.#..
+     * .##.#...
+     * ....#...
+     * ...#....
+     * ...#....
+     * ..#.....
+     * ..#.##..
+     * .#.#..#.
+     * .#..##..
+     * ........
+     * ........
+     */
+    0x08, 0x14, 0x14, 0xc8, 0x30, 0x0c, 0x00, 0x00,
+    0x00, 0x0c, 0x03, 0x04, 0x0a, 0x0a, 0x04, 0x00,
+
+    /* Index: 0x25, char: &, offset: 0x0250
+     * ........
+     * ........
+     * ...##...
+     * ..#..#..
+     * ..#..#..
+     * ...##...
+     * ..##....
+     * .#..#.#.
+     * .#...#..
+     * .#...#..
+     * .#...#..
+     * ..###.#.
+     * ........
+     * ........
+     */
+    0x00, 0x80, 0x58, 0x64, 0xa4, 0x18, 0x80, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x07, 0x08, 0x00,
+
+    /* Index: 0x26, char: ', offset: 0x0260
+     * ........
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x27, char: (, offset: 0x0270
+     * ........
+     * ........
+     * ....#...
+     * ...#....
+     * ..#.....
+     * ..#.....
+     * ..#.....
+     * ..#.....
+     * ..#.....
+     * ..#.....
+     * ...#....
+     * ....#...
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xf0, 0x08, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x04, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0x28, char: ), offset: 0x0280
+     * ........
+     * ........
+     * ..#.....
+     * ...#....
+     * ....#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ...#....
+     * ..#.....
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x04, 0x08, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x04, 0x03, 0x00, 0x00, 0x00,
+
+    /* Index: 0x29, char: \x2a, offset: 0x0290
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..#..#..
+     * ...##...
+     * .######.
+     * ...##...
+     * ..#..#..
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x80, 0xa0, 0xc0, 0xc0, 0xa0, 0x80, 0x00,
+    0x00, 0x00, 0x02, 0x01, 0x01, 0x02, 0x00, 0x00,
+
+    /* Index: 0x2a, char: +, offset: 0x02a0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * .#####..
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x80, 0x80, 0xe0, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x2b, char: ,, offset: 0x02b0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ..#.....
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x2c, char: -, offset: 0x02c0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .######.
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x2d, char: ., offset: 0x02d0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x2e, char: \x2f, offset: 0x02e0
+     * ........
+     * ........
+     * .....#..
+     * .....#..
+     * ....#...
+     * ....#...
+     * ...#....
+     * ...#....
+     * ..#.....
+     * ..#.....
+     * .#......
+     * .#......
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0xc0, 0x30, 0x0c, 0x00, 0x00,
+    0x00, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x2f, char: 0, offset: 0x02f0
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#...##.
+     * .#..#.#.
+     * .#.#..#.
+     * .##...#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x04, 0x84, 0x44, 0x24, 0xf8, 0x00,
+    0x00, 0x07, 0x09, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x30, char: 1, offset: 0x0300
+     * ........
+     * ........
+     * ....#...
+     * ...##...
+     * ..#.#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x10, 0x08, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x0f, 0x08, 0x08, 0x00,
+
+    /* Index: 0x31, char: 2, offset: 0x0310
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * ......#.
+     * .....#..
+     * ....#...
+     * ...#....
+     * ..#.....
+     * .#......
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0x18, 0x04, 0x04, 0x84, 0x44, 0x38, 0x00,
+    0x00, 0x0c, 0x0a, 0x09, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0x32, char: 3, offset: 0x0320
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * ......#.
+     * ...###..
+     * ......#.
+     * ......#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0x18, 0x04, 0x44, 0x44, 0x44, 0xb8, 0x00,
+    0x00, 0x06, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x33, char: 4, offset: 0x0330
+     * ........
+     * ........
+     * ......#.
+     * .....##.
+     * ....#.#.
+     * ...#..#.
+     * ..#...#.
+     * .#....#.
+     * .######.
+     * ......#.
+     * ......#.
+     * ......#.
+     * ........
+     * ........
+     */
+    0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0xfc, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x00,
+
+    /* Index: 0x34, char: 5, offset: 0x0340
+     * ........
+     * ........
+     * .######.
+     * .#......
+     * .#......
+     * .#......
+     * .#####..
+     * ......#.
+     * ......#.
+     * ......#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0x7c, 0x44, 0x44, 0x44, 0x44, 0x84, 0x00,
+    0x00, 0x04, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x35, char: 6, offset: 0x0350
+     * ........
+     * ........
+     * ...###..
+     * ..#.....
+     * .#......
+     * .#......
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf0, 0x48, 0x44, 0x44, 0x44, 0x80, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x36, char: 7, offset: 0x0360
+     * ........
+     * ........
+     * .######.
+     * ......#.
+     * ......#.
+     * .....#..
+     * .....#..
+     * ....#...
+     * ....#...
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x00, 0x04, 0x04, 0x04, 0x84, 0x64, 0x1c, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x00,
+
+    /* Index: 0x37, char: 8, offset: 0x0370
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xb8, 0x44, 0x44, 0x44, 0x44, 0xb8, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x38, char: 9, offset: 0x0380
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ......#.
+     * ......#.
+     * .....#..
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x78, 0x84, 0x84, 0x84, 0x84, 0xf8, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x04, 0x03, 0x00,
+
+    /* Index: 0x39, char: :, offset: 0x0390
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x3a, char: ;, offset: 0x03a0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ..#.....
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x3b, char: <, offset: 0x03b0
+     * ........
+     * ........
+     * ........
+     * .....#..
+     * ....#...
+     * ...#....
+     * ..#.....
+     * .#......
+     * ..#.....
+     * ...#....
+     * ....#...
+     * .....#..
+     * ........
+     * ........
+     */
+    0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00, 0x00,
+
+    /* Index: 0x3c, char: =, offset: 0x03c0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .######.
+     * ........
+     * ........
+     * .######.
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+
+    /* Index: 0x3d, char: >, offset: 0x03d0
+     * ........
+     * ........
+     * ........
+     * .#......
+     * ..#.....
+     * ...#....
+     * ....#...
+     * .....#..
+     * ....#...
+     * ...#....
+     * ..#.....
+     * .#......
+     * ........
+     * ........
+     */
+    0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00,
+    0x00, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00,
+
+    /* Index: 0x3e, char: ?, offset: 0x03e0
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .....#..
+     * ....#...
+     * ....#...
+     * ........
+     * ....#...
+     * ....#...
+     * ........
+     * ........
+     */
+    0x00, 0x38, 0x04, 0x04, 0x84, 0x44, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+
+    /* Index: 0x3f, char: @, offset: 0x03f0
+     * ........
+     * ........
+     * .#####..
+     * #.....#.
+     * #..####.
+     * #.#...#.
+     * #.#...#.
+     * #.#...#.
+     * #.#..##.
+     * #..##.#.
+     * #.......
+     * .######.
+     * ........
+     * ........
+     */
+    0xf8, 0x04, 0xe4, 0x14, 0x14, 0x14, 0xf8, 0x00,
+    0x07, 0x08, 0x09, 0x0a, 0x0a, 0x09, 0x0b, 0x00,
+
+    /* Index: 0x40, char: A, offset: 0x0400
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x84, 0x84, 0x84, 0x84, 0xf8, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x41, char: B, offset: 0x0410
+     * ........
+     * ........
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x44, 0x44, 0x44, 0x44, 0xb8, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x42, char: C, offset: 0x0420
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x04, 0x04, 0x04, 0x04, 0x18, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x06, 0x00,
+
+    /* Index: 0x43, char: D, offset: 0x0430
+     * ........
+     * ........
+     * .####...
+     * .#...#..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#...#..
+     * .####...
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x04, 0x04, 0x04, 0x08, 0xf0, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x04, 0x03, 0x00,
+
+    /* Index: 0x44, char: E, offset: 0x0440
+     * ........
+     * ........
+     * .######.
+     * .#......
+     * .#......
+     * .#......
+     * .####...
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x44, 0x44, 0x44, 0x04, 0x04, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0x45, char: F, offset: 0x0450
+     * ........
+     * ........
+     * .######.
+     * .#......
+     * .#......
+     * .#......
+     * .####...
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x44, 0x44, 0x44, 0x04, 0x04, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x46, char: G, offset: 0x0460
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#......
+     * .#......
+     * .#..###.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x04, 0x04, 0x84, 0x84, 0x98, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x47, char: H, offset: 0x0470
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x40, 0x40, 0x40, 0x40, 0xfc, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x48, char: I, offset: 0x0480
+     * ........
+     * ........
+     * ..###...
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x04, 0xfc, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0f, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0x49, char: J, offset: 0x0490
+     * ........
+     * ........
+     * ....###.
+     * .....#..
+     * .....#..
+     * .....#..
+     * .....#..
+     * .....#..
+     * .....#..
+     * .#...#..
+     * .#...#..
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xfc, 0x04, 0x00,
+    0x00, 0x06, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00,
+
+    /* Index: 0x4a, char: K, offset: 0x04a0
+     * ........
+     * ........
+     * .#....#.
+     * .#...#..
+     * .#..#...
+     * .#.#....
+     * .##.....
+     * .##.....
+     * .#.#....
+     * .#..#...
+     * .#...#..
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0xc0, 0x20, 0x10, 0x08, 0x04, 0x00,
+    0x00, 0x0f, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00,
+
+    /* Index: 0x4b, char: L, offset: 0x04b0
+     * ........
+     * ........
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0x4c, char: M, offset: 0x04c0
+     * ........
+     * ........
+     * #.....#.
+     * ##...##.
+     * #.#.#.#.
+     * #..#..#.
+     * #..#..#.
+     * #.....#.
+     * #.....#.
+     * #.....#.
+     * #.....#.
+     * #.....#.
+     * ........
+     * ........
+     */
+    0xfc, 0x08, 0x10, 0x60, 0x10, 0x08, 0xfc, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x4d, char: N, offset: 0x04d0
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .##...#.
+     * .#.#..#.
+     * .#..#.#.
+     * .#...##.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x20, 0x40, 0x80, 0x00, 0xfc, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x00,
+
+    /* Index: 0x4e, char: O, offset: 0x04e0
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x04, 0x04, 0x04, 0x04, 0xf8, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x4f, char: P, offset: 0x04f0
+     * ........
+     * ........
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x84, 0x84, 0x84, 0x84, 0x78, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x50, char: Q, offset: 0x0500
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#..#.#.
+     * ..####..
+     * ......#.
+     * ........
+     */
+    0x00, 0xf8, 0x04, 0x04, 0x04, 0x04, 0xf8, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x0c, 0x08, 0x17, 0x00,
+
+    /* Index: 0x51, char: R, offset: 0x0510
+     * ........
+     * ........
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * .#.#....
+     * .#..#...
+     * .#...#..
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x84, 0x84, 0x84, 0x84, 0x78, 0x00,
+    0x00, 0x0f, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00,
+
+    /* Index: 0x52, char: S, offset: 0x0520
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#......
+     * .#......
+     * ..####..
+     * ......#.
+     * ......#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x88, 0x00,
+    0x00, 0x06, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x53, char: T, offset: 0x0530
+     * ........
+     * ........
+     * #######.
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x04, 0x04, 0x04, 0xfc, 0x04, 0x04, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x54, char: U, offset: 0x0540
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x55, char: V, offset: 0x0550
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#..#..
+     * ..#..#..
+     * ..#..#..
+     * ...##...
+     * ...##...
+     * ........
+     * ........
+     */
+    0x00, 0x7c, 0x80, 0x00, 0x00, 0x80, 0x7c, 0x00,
+    0x00, 0x00, 0x03, 0x0c, 0x0c, 0x03, 0x00, 0x00,
+
+    /* Index: 0x56, char: W, offset: 0x0560
+     * ........
+     * ........
+     * #.....#.
+     * #.....#.
+     * #.....#.
+     * #.....#.
+     * #.....#.
+     * #..#..#.
+     * #..#..#.
+     * #.#.#.#.
+     * ##...##.
+     * #.....#.
+     * ........
+     * ........
+     */
+    0xfc, 0x00, 0x00, 0x80, 0x00, 0x00, 0xfc, 0x00,
+    0x0f, 0x04, 0x02, 0x01, 0x02, 0x04, 0x0f, 0x00,
+
+    /* Index: 0x57, char: X, offset: 0x0570
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * ..#..#..
+     * ..#..#..
+     * ...##...
+     * ...##...
+     * ..#..#..
+     * ..#..#..
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0x0c, 0x30, 0xc0, 0xc0, 0x30, 0x0c, 0x00,
+    0x00, 0x0c, 0x03, 0x00, 0x00, 0x03, 0x0c, 0x00,
+
+    /* Index: 0x58, char: Y, offset: 0x0580
+     * ........
+     * ........
+     * #.....#.
+     * #.....#.
+     * .#...#..
+     * .#...#..
+     * ..#.#...
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x0c, 0x30, 0x40, 0x80, 0x40, 0x30, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x59, char: Z, offset: 0x0590
+     * ........
+     * ........
+     * .######.
+     * ......#.
+     * ......#.
+     * .....#..
+     * ....#...
+     * ...#....
+     * ..#.....
+     * .#......
+     * .#......
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0x04, 0x04, 0x84, 0x44, 0x24, 0x1c, 0x00,
+    0x00, 0x0e, 0x09, 0x08, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0x5a, char: [, offset: 0x05a0
+     * ........
+     * ........
+     * ..###...
+     * ..#.....
+     * ..#.....
+     * ..#.....
+     * ..#.....
+     * ..#.....
+     * ..#.....
+     * ..#.....
+     * ..#.....
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xfc, 0x04, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x08, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0x5b, char: \x5c, offset: 0x05b0
+     * ........
+     * ........
+     * .#......
+     * .#......
+     * ..#.....
+     * ..#.....
+     * ...#....
+     * ...#....
+     * ....#...
+     * ....#...
+     * .....#..
+     * .....#..
+     * ........
+     * ........
+     */
+    0x00, 0x0c, 0x30, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x00,
+
+    /* Index: 0x5c, char: ], offset: 0x05c0
+     * ........
+     * ........
+     * ..###...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x0f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x5d, char: ^, offset: 0x05d0
+     * ........
+     * ...#....
+     * ..#.#...
+     * .#...#..
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x08, 0x04, 0x02, 0x04, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x5e, char: _, offset: 0x05e0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .######.
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00,
+
+    /* Index: 0x5f, char: `, offset: 0x05f0
+     * ...#....
+     * ....#...
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x60, char: a, offset: 0x0600
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * ......#.
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xa0, 0xa0, 0xa0, 0xa0, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0x61, char: b, offset: 0x0610
+     * ........
+     * ........
+     * .#......
+     * .#......
+     * .#......
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x62, char: c, offset: 0x0620
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#......
+     * .#......
+     * .#......
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0x40, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x04, 0x00,
+
+    /* Index: 0x63, char: d, offset: 0x0630
+     * ........
+     * ........
+     * ......#.
+     * ......#.
+     * ......#.
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0xfc, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0x64, char: e, offset: 0x0640
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#......
+     * .#......
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x01, 0x00,
+
+    /* Index: 0x65, char: f, offset: 0x0650
+     * ........
+     * ........
+     * ....###.
+     * ...#....
+     * ...#....
+     * .#####..
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x00, 0x20, 0x20, 0xf8, 0x24, 0x24, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x66, char: g, offset: 0x0660
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ......#.
+     * ..####..
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x00,
+    0x00, 0x07, 0x28, 0x28, 0x28, 0x28, 0x1f, 0x00,
+
+    /* Index: 0x67, char: h, offset: 0x0670
+     * ........
+     * ........
+     * .#......
+     * .#......
+     * .#......
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x68, char: i, offset: 0x0680
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ........
+     * ..##....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x20, 0xec, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0f, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0x69, char: j, offset: 0x0690
+     * ........
+     * ........
+     * .....#..
+     * .....#..
+     * ........
+     * ....##..
+     * .....#..
+     * .....#..
+     * .....#..
+     * .....#..
+     * .....#..
+     * .#...#..
+     * .#...#..
+     * ..###...
+     */
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xec, 0x00, 0x00,
+    0x00, 0x18, 0x20, 0x20, 0x20, 0x1f, 0x00, 0x00,
+
+    /* Index: 0x6a, char: k, offset: 0x06a0
+     * ........
+     * ........
+     * .#......
+     * .#......
+     * .#......
+     * .#....#.
+     * .#...#..
+     * .#..#...
+     * .###....
+     * .#..#...
+     * .#...#..
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x00, 0x00, 0x80, 0x40, 0x20, 0x00,
+    0x00, 0x0f, 0x01, 0x01, 0x02, 0x04, 0x08, 0x00,
+
+    /* Index: 0x6b, char: l, offset: 0x06b0
+     * ........
+     * ........
+     * ..##....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0f, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0x6c, char: m, offset: 0x06c0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ######..
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * ........
+     * ........
+     */
+    0xe0, 0x20, 0x20, 0xe0, 0x20, 0x20, 0xc0, 0x00,
+    0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x6d, char: n, offset: 0x06d0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x6e, char: o, offset: 0x06e0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x6f, char: p, offset: 0x06f0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * .#......
+     * .#......
+     */
+    0x00, 0xe0, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x3f, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x70, char: q, offset: 0x0700
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ......#.
+     * ......#.
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x3f, 0x00,
+
+    /* Index: 0x71, char: r, offset: 0x0710
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#.####.
+     * .##.....
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x40, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x72, char: s, offset: 0x0720
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..#####.
+     * .#......
+     * .#......
+     * ..####..
+     * ......#.
+     * ......#.
+     * .#####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x08, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00,
+
+    /* Index: 0x73, char: t, offset: 0x0730
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ...#....
+     * .#####..
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ....###.
+     * ........
+     * ........
+     */
+    0x00, 0x20, 0x20, 0xfc, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0x74, char: u, offset: 0x0740
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0x75, char: v, offset: 0x0750
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#..#..
+     * ..#..#..
+     * ...##...
+     * ...##...
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x00, 0x03, 0x0c, 0x0c, 0x03, 0x00, 0x00,
+
+    /* Index: 0x76, char: w, offset: 0x0760
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * #.....#.
+     * #.....#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * .#####..
+     * ........
+     * ........
+     */
+    0xe0, 0x00, 0x00, 0x80, 0x00, 0x00, 0xe0, 0x00,
+    0x07, 0x08, 0x08, 0x0f, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x77, char: x, offset: 0x0770
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * ..#..#..
+     * ...##...
+     * ..#..#..
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0x60, 0x80, 0x00, 0x00, 0x80, 0x60, 0x00,
+    0x00, 0x0c, 0x02, 0x01, 0x01, 0x02, 0x0c, 0x00,
+
+    /* Index: 0x78, char: y, offset: 0x0780
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ......#.
+     * ..####..
+     */
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x07, 0x28, 0x28, 0x28, 0x28, 0x1f, 0x00,
+
+    /* Index: 0x79, char: z, offset: 0x0790
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .######.
+     * .....#..
+     * ....#...
+     * ...#....
+     * ..#.....
+     * .#......
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0x20, 0x20, 0x20, 0xa0, 0x60, 0x20, 0x00,
+    0x00, 0x0c, 0x0a, 0x09, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0x7a, char: {, offset: 0x07a0
+     * ........
+     * ........
+     * ....##..
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..#.....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ....##..
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x40, 0xb8, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x00, 0x00,
+
+    /* Index: 0x7b, char: |, offset: 0x07b0
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x7c, char: }, offset: 0x07c0
+     * ........
+     * ........
+     * ..##....
+     * ....#...
+     * ....#...
+     * ....#...
+     * .....#..
+     * ....#...
+     * ....#...
+     * ....#...
+     * ....#...
+     * ..##....
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x04, 0x04, 0xb8, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00,
+
+    /* Index: 0x7d, char: ~, offset: 0x07d0
+     * ........
+     * .##...#.
+     * #..#..#.
+     * #...##..
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x0c, 0x02, 0x02, 0x04, 0x08, 0x08, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x7e, char: \x7f, offset: 0x07e0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x7f, char: \x80, offset: 0x07f0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x80, char: \x81, offset: 0x0800
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x81, char: \x82, offset: 0x0810
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x82, char: \x83, offset: 0x0820
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x83, char: \x84, offset: 0x0830
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x84, char: \x85, offset: 0x0840
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x85, char: \x86, offset: 0x0850
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x86, char: \x87, offset: 0x0860
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x87, char: \x88, offset: 0x0870
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x88, char: \x89, offset: 0x0880
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x89, char: \x8a, offset: 0x0890
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x8a, char: \x8b, offset: 0x08a0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x8b, char: \x8c, offset: 0x08b0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x8c, char: \x8d, offset: 0x08c0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x8d, char: \x8e, offset: 0x08d0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x8e, char: \x8f, offset: 0x08e0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x8f, char: \x90, offset: 0x08f0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x90, char: \x91, offset: 0x0900
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x91, char: \x92, offset: 0x0910
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x92, char: \x93, offset: 0x0920
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x93, char: \x94, offset: 0x0930
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x94, char: \x95, offset: 0x0940
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x95, char: \x96, offset: 0x0950
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x96, char: \x97, offset: 0x0960
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x97, char: \x98, offset: 0x0970
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x98, char: \x99, offset: 0x0980
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x99, char: \x9a, offset: 0x0990
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x9a, char: \x9b, offset: 0x09a0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x9b, char: \x9c, offset: 0x09b0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x9c, char: \x9d, offset: 0x09c0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x9d, char: \x9e, offset: 0x09d0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x9e, char: \x9f, offset: 0x09e0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x9f, char: \xa0, offset: 0x09f0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xa0, char: \xa1, offset: 0x0a00
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ........
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xa1, char: \xa2, offset: 0x0a10
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * .#####..
+     * #..#..#.
+     * #..#....
+     * #..#....
+     * #..#....
+     * #..#..#.
+     * .#####..
+     * ...#....
+     * ...#....
+     */
+    0xc0, 0x20, 0x20, 0xf8, 0x20, 0x20, 0x40, 0x00,
+    0x07, 0x08, 0x08, 0x3f, 0x08, 0x08, 0x04, 0x00,
+
+    /* Index: 0xa2, char: \xa3, offset: 0x0a20
+     * ........
+     * ........
+     * ...##...
+     * ..#..#..
+     * ..#.....
+     * ..#.....
+     * .####...
+     * ..#.....
+     * ..#.....
+     * ..#.....
+     * ..#...#.
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0x40, 0xf8, 0x44, 0x44, 0x08, 0x00, 0x00,
+    0x00, 0x08, 0x0f, 0x08, 0x08, 0x08, 0x0c, 0x00,
+
+    /* Index: 0xa3, char: \xa4, offset: 0x0a30
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#...#..
+     * ..###...
+     * .#...#..
+     * .#...#..
+     * .#...#..
+     * ..###...
+     * .#...#..
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0xd0, 0x20, 0x20, 0x20, 0xd0, 0x00, 0x00,
+    0x00, 0x05, 0x02, 0x02, 0x02, 0x05, 0x00, 0x00,
+
+    /* Index: 0xa4, char: \xa5, offset: 0x0a40
+     * ........
+     * ........
+     * #.....#.
+     * #.....#.
+     * .#...#..
+     * ..#.#...
+     * ...#....
+     * .#####..
+     * ...#....
+     * .#####..
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x0c, 0x90, 0xa0, 0xc0, 0xa0, 0x90, 0x0c, 0x00,
+    0x00, 0x02, 0x02, 0x0f, 0x02, 0x02, 0x00, 0x00,
+
+    /* Index: 0xa5, char: \xa6, offset: 0x0a50
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xa6, char: \xa7, offset: 0x0a60
+     * ........
+     * ..###...
+     * .#...#..
+     * .#......
+     * ..##....
+     * .#..#...
+     * .#...#..
+     * .#...#..
+     * ..#..#..
+     * ...##...
+     * .....#..
+     * .#...#..
+     * ..###...
+     * ........
+     */
+    0x00, 0xec, 0x12, 0x12, 0x22, 0xc4, 0x00, 0x00,
+    0x00, 0x08, 0x11, 0x12, 0x12, 0x0d, 0x00, 0x00,
+
+    /* Index: 0xa7, char: \xa8, offset: 0x0a70
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xa8, char: \xa9, offset: 0x0a80
+     * ........
+     * ........
+     * ........
+     * .######.
+     * #......#
+     * #..##..#
+     * #.#..#.#
+     * #.#....#
+     * #.#..#.#
+     * #..##..#
+     * #......#
+     * .######.
+     * ........
+     * ........
+     */
+    0xf0, 0x08, 0xc8, 0x28, 0x28, 0x48, 0x08, 0xf0,
+    0x07, 0x08, 0x09, 0x0a, 0x0a, 0x09, 0x08, 0x07,
+
+    /* Index: 0xa9, char: \xaa, offset: 0x0a90
+     * ........
+     * ..###...
+     * .....#..
+     * ..####..
+     * .#...#..
+     * ..####..
+     * ........
+     * .#####..
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xbc, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xaa, char: \xab, offset: 0x0aa0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#..#.
+     * ..#..#..
+     * .#..#...
+     * #..#....
+     * .#..#...
+     * ..#..#..
+     * ...#..#.
+     * ........
+     * ........
+     */
+    0x00, 0x80, 0x40, 0x20, 0x80, 0x40, 0x20, 0x00,
+    0x01, 0x02, 0x04, 0x09, 0x02, 0x04, 0x08, 0x00,
+
+    /* Index: 0xab, char: \xac, offset: 0x0ab0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .######.
+     * ......#.
+     * ......#.
+     * ......#.
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+
+    /* Index: 0xac, char: \xad, offset: 0x0ac0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xad, char: \xae, offset: 0x0ad0
+     * ........
+     * ........
+     * ........
+     * .######.
+     * #......#
+     * #.###..#
+     * #.#..#.#
+     * #.###..#
+     * #.#.#..#
+     * #.#..#.#
+     * #......#
+     * .######.
+     * ........
+     * ........
+     */
+    0xf0, 0x08, 0xe8, 0xa8, 0xa8, 0x48, 0x08, 0xf0,
+    0x07, 0x08, 0x0b, 0x08, 0x09, 0x0a, 0x08, 0x07,
+
+    /* Index: 0xae, char: \xaf, offset: 0x0ae0
+     * ..####..
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xaf, char: \xb0, offset: 0x0af0
+     * ........
+     * ...##...
+     * ..#..#..
+     * ..#..#..
+     * ...##...
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x0c, 0x12, 0x12, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xb0, char: \xb1, offset: 0x0b00
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * .#####..
+     * ...#....
+     * ...#....
+     * ........
+     * .#####..
+     * ........
+     * ........
+     */
+    0x00, 0x80, 0x80, 0xe0, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x08, 0x08, 0x0b, 0x08, 0x08, 0x00, 0x00,
+
+    /* Index: 0xb1, char: \xb2, offset: 0x0b10
+     * ........
+     * ...##...
+     * ..#..#..
+     * .....#..
+     * ....#...
+     * ...#....
+     * ..####..
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x44, 0x62, 0x52, 0x4c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xb2, char: \xb3, offset: 0x0b20
+     * ........
+     * ..###...
+     * .....#..
+     * ...##...
+     * .....#..
+     * .....#..
+     * ..###...
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x42, 0x4a, 0x4a, 0x34, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xb3, char: \xb4, offset: 0x0b30
+     * ....#...
+     * ...#....
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xb4, char: \xb5, offset: 0x0b40
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#...##.
+     * .####.#.
+     * .#......
+     * .#......
+     */
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x3f, 0x08, 0x08, 0x08, 0x04, 0x0f, 0x00,
+
+    /* Index: 0xb5, char: \xb6, offset: 0x0b50
+     * ........
+     * ........
+     * .######.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * .###..#.
+     * ...#..#.
+     * ...#..#.
+     * ...#..#.
+     * ...#..#.
+     * ........
+     * ........
+     */
+    0x78, 0x84, 0x84, 0xfc, 0x04, 0x04, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0xb6, char: \xb7, offset: 0x0b60
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xb7, char: \xb8, offset: 0x0b70
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ..#.....
+     */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xb8, char: \xb9, offset: 0x0b80
+     * ........
+     * ...#....
+     * ..##....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..###...
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x44, 0x7e, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xb9, char: \xba, offset: 0x0b90
+     * ........
+     * ..###...
+     * .#...#..
+     * .#...#..
+     * .#...#..
+     * ..###...
+     * ........
+     * .#####..
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x9c, 0xa2, 0xa2, 0xa2, 0x9c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xba, char: \xbb, offset: 0x0ba0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * #..#....
+     * .#..#...
+     * ..#..#..
+     * ...#..#.
+     * ..#..#..
+     * .#..#...
+     * #..#....
+     * ........
+     * ........
+     */
+    0x20, 0x40, 0x80, 0x20, 0x40, 0x80, 0x00, 0x00,
+    0x08, 0x04, 0x02, 0x09, 0x04, 0x02, 0x01, 0x00,
+
+    /* Index: 0xbb, char: \xbc, offset: 0x0bb0
+     * ..#.....
+     * .##.....
+     * ..#.....
+     * ..#...#.
+     * ..#..#..
+     * ....#...
+     * ...#....
+     * ..#...#.
+     * .#...##.
+     * #...#.#.
+     * ...####.
+     * ......#.
+     * ......#.
+     * ........
+     */
+    0x00, 0x02, 0x9f, 0x40, 0x20, 0x10, 0x88, 0x00,
+    0x02, 0x01, 0x00, 0x04, 0x06, 0x05, 0x1f, 0x00,
+
+    /* Index: 0xbc, char: \xbd, offset: 0x0bc0
+     * ..#.....
+     * .##.....
+     * ..#.....
+     * ..#...#.
+     * ..#..#..
+     * ....#...
+     * ...#....
+     * ..#.....
+     * .#..##..
+     * #..#..#.
+     * .....#..
+     * ....#...
+     * ...####.
+     * ........
+     */
+    0x00, 0x02, 0x9f, 0x40, 0x20, 0x10, 0x08, 0x00,
+    0x02, 0x01, 0x00, 0x12, 0x19, 0x15, 0x12, 0x00,
+
+    /* Index: 0xbd, char: \xbe, offset: 0x0bd0
+     * ###.....
+     * ...#....
+     * .##.....
+     * ...#..#.
+     * ###..#..
+     * ....#...
+     * ...#....
+     * ..#...#.
+     * .#...##.
+     * #...#.#.
+     * ...####.
+     * ......#.
+     * ......#.
+     * ........
+     */
+    0x11, 0x15, 0x95, 0x4a, 0x20, 0x10, 0x88, 0x00,
+    0x02, 0x01, 0x00, 0x04, 0x06, 0x05, 0x1f, 0x00,
+
+    /* Index: 0xbe, char: \xbf, offset: 0x0be0
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ........
+     * ...#....
+     * ...#....
+     * ..#.....
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x80, 0x6c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xbf, char: \xc0, offset: 0x0bf0
+     * ...#....
+     * ....#...
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xf0, 0x88, 0x89, 0x8a, 0x88, 0xf0, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0xc0, char: \xc1, offset: 0x0c00
+     * ....#...
+     * ...#....
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xf0, 0x88, 0x8a, 0x89, 0x88, 0xf0, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0xc1, char: \xc2, offset: 0x0c10
+     * ...##...
+     * ..#..#..
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xf0, 0x8a, 0x89, 0x89, 0x8a, 0xf0, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0xc2, char: \xc3, offset: 0x0c20
+     * ..##..#.
+     * .#..##..
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xf2, 0x89, 0x89, 0x8a, 0x8a, 0xf1, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0xc3, char: \xc4, offset: 0x0c30
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xf0, 0x8b, 0x88, 0x88, 0x8b, 0xf0, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0xc4, char: \xc5, offset: 0x0c40
+     * ...##...
+     * ..#..#..
+     * ...##...
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xf0, 0x8a, 0x8d, 0x8d, 0x8a, 0xf0, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0xc5, char: \xc6, offset: 0x0c50
+     * ........
+     * ........
+     * .######.
+     * #..#....
+     * #..#....
+     * #..#....
+     * ######..
+     * #..#....
+     * #..#....
+     * #..#....
+     * #..#....
+     * #..####.
+     * ........
+     * ........
+     */
+    0xf8, 0x44, 0x44, 0xfc, 0x44, 0x44, 0x04, 0x00,
+    0x0f, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0xc6, char: \xc7, offset: 0x0c60
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ...#....
+     * ..#.....
+     */
+    0x00, 0xf8, 0x04, 0x04, 0x04, 0x04, 0x18, 0x00,
+    0x00, 0x07, 0x28, 0x18, 0x08, 0x08, 0x06, 0x00,
+
+    /* Index: 0xc7, char: \xc8, offset: 0x0c70
+     * ...#....
+     * ....#...
+     * ........
+     * .######.
+     * .#......
+     * .#......
+     * .#......
+     * .####...
+     * .#......
+     * .#......
+     * .#......
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x88, 0x89, 0x8a, 0x08, 0x08, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0xc8, char: \xc9, offset: 0x0c80
+     * ....#...
+     * ...#....
+     * ........
+     * .######.
+     * .#......
+     * .#......
+     * .#......
+     * .####...
+     * .#......
+     * .#......
+     * .#......
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x88, 0x8a, 0x89, 0x08, 0x08, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0xc9, char: \xca, offset: 0x0c90
+     * ...##...
+     * ..#..#..
+     * ........
+     * .######.
+     * .#......
+     * .#......
+     * .#......
+     * .####...
+     * .#......
+     * .#......
+     * .#......
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x8a, 0x89, 0x89, 0x0a, 0x08, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0xca, char: \xcb, offset: 0x0ca0
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * .######.
+     * .#......
+     * .#......
+     * .#......
+     * .####...
+     * .#......
+     * .#......
+     * .#......
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x8b, 0x88, 0x88, 0x0b, 0x08, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0xcb, char: \xcc, offset: 0x0cb0
+     * ..#.....
+     * ...#....
+     * ........
+     * ..###...
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x09, 0xfa, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0f, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0xcc, char: \xcd, offset: 0x0cc0
+     * ....#...
+     * ...#....
+     * ........
+     * ..###...
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x08, 0xfa, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0f, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0xcd, char: \xce, offset: 0x0cd0
+     * ...##...
+     * ..#..#..
+     * ........
+     * ..###...
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x0a, 0xf9, 0x09, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0f, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0xce, char: \xcf, offset: 0x0ce0
+     * .#...#..
+     * .#...#..
+     * ........
+     * ..###...
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x03, 0x08, 0xf8, 0x08, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0f, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0xcf, char: \xd0, offset: 0x0cf0
+     * ........
+     * ........
+     * .####...
+     * .#...#..
+     * .#....#.
+     * .#....#.
+     * ####..#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#...#..
+     * .####...
+     * ........
+     * ........
+     */
+    0x40, 0xfc, 0x44, 0x44, 0x04, 0x08, 0xf0, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x04, 0x03, 0x00,
+
+    /* Index: 0xd0, char: \xd1, offset: 0x0d00
+     * ..##..#.
+     * .#..##..
+     * ........
+     * .#....#.
+     * .#....#.
+     * .##...#.
+     * .#.#..#.
+     * .#..#.#.
+     * .#...##.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xfa, 0x21, 0x41, 0x82, 0x02, 0xf9, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x00,
+
+    /* Index: 0xd1, char: \xd2, offset: 0x0d10
+     * ...#....
+     * ....#...
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf0, 0x08, 0x09, 0x0a, 0x08, 0xf0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xd2, char: \xd3, offset: 0x0d20
+     * ....#...
+     * ...#....
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf0, 0x08, 0x0a, 0x09, 0x08, 0xf0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xd3, char: \xd4, offset: 0x0d30
+     * ...##...
+     * ..#..#..
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf0, 0x0a, 0x09, 0x09, 0x0a, 0xf0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xd4, char: \xd5, offset: 0x0d40
+     * ..##..#.
+     * .#..##..
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf2, 0x09, 0x09, 0x0a, 0x0a, 0xf1, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xd5, char: \xd6, offset: 0x0d50
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf0, 0x0b, 0x08, 0x08, 0x0b, 0xf0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xd6, char: \xd7, offset: 0x0d60
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * ..#..#..
+     * ...##...
+     * ...##...
+     * ..#..#..
+     * .#....#.
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x20, 0x40, 0x80, 0x80, 0x40, 0x20, 0x00,
+    0x00, 0x04, 0x02, 0x01, 0x01, 0x02, 0x04, 0x00,
+
+    /* Index: 0xd7, char: \xd8, offset: 0x0d70
+     * ........
+     * ........
+     * ..####..
+     * .#....##
+     * .#....#.
+     * .#...##.
+     * .#..#.#.
+     * .#.#..#.
+     * .##...#.
+     * .#....#.
+     * ##....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x04, 0x84, 0x44, 0x24, 0xf8, 0x08,
+    0x04, 0x07, 0x09, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xd8, char: \xd9, offset: 0x0d80
+     * ...#....
+     * ....#...
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x00, 0x01, 0x02, 0x00, 0xfc, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xd9, char: \xda, offset: 0x0d90
+     * ....#...
+     * ...#....
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x00, 0x02, 0x01, 0x00, 0xfc, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xda, char: \xdb, offset: 0x0da0
+     * ...##...
+     * ..#..#..
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x02, 0x01, 0x01, 0x02, 0xf8, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xdb, char: \xdc, offset: 0x0db0
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x03, 0x00, 0x00, 0x03, 0xf8, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xdc, char: \xdd, offset: 0x0dc0
+     * ....#...
+     * ...#....
+     * #.....#.
+     * #.....#.
+     * .#...#..
+     * .#...#..
+     * ..#.#...
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x0c, 0x30, 0x40, 0x82, 0x41, 0x30, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xdd, char: \xde, offset: 0x0dd0
+     * ........
+     * ........
+     * .#......
+     * .#......
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * .#......
+     * .#......
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x10, 0x10, 0x10, 0x10, 0xe0, 0x00,
+    0x00, 0x0f, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00,
+
+    /* Index: 0xde, char: \xdf, offset: 0x0de0
+     * ........
+     * ........
+     * ..###...
+     * .#...#..
+     * .#...#..
+     * .#..#...
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .##...#.
+     * .#.###..
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x44, 0x44, 0x64, 0x58, 0x80, 0x00,
+    0x00, 0x0f, 0x04, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xdf, char: \xe0, offset: 0x0df0
+     * ........
+     * ........
+     * ...#....
+     * ....#...
+     * ........
+     * ..####..
+     * ......#.
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xa0, 0xa4, 0xa8, 0xa0, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0xe0, char: \xe1, offset: 0x0e00
+     * ........
+     * ........
+     * ....#...
+     * ...#....
+     * ........
+     * ..####..
+     * ......#.
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xa0, 0xa8, 0xa4, 0xa0, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0xe1, char: \xe2, offset: 0x0e10
+     * ........
+     * ........
+     * ...##...
+     * ..#..#..
+     * ........
+     * ..####..
+     * ......#.
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xa8, 0xa4, 0xa4, 0xa8, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0xe2, char: \xe3, offset: 0x0e20
+     * ........
+     * ........
+     * ..##..#.
+     * .#..##..
+     * ........
+     * ..####..
+     * ......#.
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0x08, 0xa4, 0xa4, 0xa8, 0xa8, 0xc4, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0xe3, char: \xe4, offset: 0x0e30
+     * ........
+     * ........
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * ..####..
+     * ......#.
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xac, 0xa0, 0xa0, 0xac, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0xe4, char: \xe5, offset: 0x0e40
+     * ........
+     * ........
+     * ...##...
+     * ..#..#..
+     * ...##...
+     * ..####..
+     * ......#.
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xa8, 0xb4, 0xb4, 0xa8, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0xe5, char: \xe6, offset: 0x0e50
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .##.##..
+     * ...#..#.
+     * .###..#.
+     * #..####.
+     * #..#....
+     * #..#....
+     * .##.##..
+     * ........
+     * ........
+     */
+    0x00, 0xa0, 0xa0, 0xc0, 0x20, 0x20, 0xc0, 0x00,
+    0x07, 0x08, 0x08, 0x07, 0x09, 0x09, 0x01, 0x00,
+
+    /* Index: 0xe6, char: \xe7, offset: 0x0e60
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#......
+     * .#......
+     * .#......
+     * .#....#.
+     * ..####..
+     * ...#....
+     * ..#.....
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0x40, 0x00,
+    0x00, 0x07, 0x28, 0x18, 0x08, 0x08, 0x04, 0x00,
+
+    /* Index: 0xe7, char: \xe8, offset: 0x0e70
+     * ........
+     * ........
+     * ...#....
+     * ....#...
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#......
+     * .#......
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x24, 0x28, 0x20, 0xc0, 0x00,
+    0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x01, 0x00,
+
+    /* Index: 0xe8, char: \xe9, offset: 0x0e80
+     * ........
+     * ........
+     * ....#...
+     * ...#....
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#......
+     * .#......
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x28, 0x24, 0x20, 0xc0, 0x00,
+    0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x01, 0x00,
+
+    /* Index: 0xe9, char: \xea, offset: 0x0e90
+     * ........
+     * ........
+     * ...##...
+     * ..#..#..
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#......
+     * .#......
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x28, 0x24, 0x24, 0x28, 0xc0, 0x00,
+    0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x01, 0x00,
+
+    /* Index: 0xea, char: \xeb, offset: 0x0ea0
+     * ........
+     * ........
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#......
+     * .#......
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x2c, 0x20, 0x20, 0x2c, 0xc0, 0x00,
+    0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x01, 0x00,
+
+    /* Index: 0xeb, char: \xec, offset: 0x0eb0
+     * ........
+     * ........
+     * ..#.....
+     * ...#....
+     * ........
+     * ..##....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x24, 0xe8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0f, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0xec, char: \xed, offset: 0x0ec0
+     * ........
+     * ........
+     * ....#...
+     * ...#....
+     * ........
+     * ..##....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x20, 0xe8, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0f, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0xed, char: \xee, offset: 0x0ed0
+     * ........
+     * ........
+     * ..##....
+     * .#..#...
+     * ........
+     * ..##....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x08, 0x24, 0xe4, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0f, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0xee, char: \xef, offset: 0x0ee0
+     * ........
+     * ........
+     * .#..#...
+     * .#..#...
+     * ........
+     * ..##....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ..###...
+     * ........
+     * ........
+     */
+    0x00, 0x0c, 0x20, 0xe0, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x0f, 0x08, 0x00, 0x00, 0x00,
+
+    /* Index: 0xef, char: \xf0, offset: 0x0ef0
+     * ........
+     * ........
+     * ..#.#...
+     * ...#....
+     * ..#.#...
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x34, 0x28, 0x34, 0x20, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xf0, char: \xf1, offset: 0x0f00
+     * ........
+     * ........
+     * ..##..#.
+     * .#..##..
+     * ........
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xe8, 0x24, 0x24, 0x28, 0x28, 0xc4, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0xf1, char: \xf2, offset: 0x0f10
+     * ........
+     * ........
+     * ...#....
+     * ....#...
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x24, 0x28, 0x20, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xf2, char: \xf3, offset: 0x0f20
+     * ........
+     * ........
+     * ....#...
+     * ...#....
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x28, 0x24, 0x20, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xf3, char: \xf4, offset: 0x0f30
+     * ........
+     * ........
+     * ...##...
+     * ..#..#..
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x28, 0x24, 0x24, 0x28, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xf4, char: \xf5, offset: 0x0f40
+     * ........
+     * ........
+     * ..##..#.
+     * .#..##..
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc8, 0x24, 0x24, 0x28, 0x28, 0xc4, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xf5, char: \xf6, offset: 0x0f50
+     * ........
+     * ........
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x2c, 0x20, 0x20, 0x2c, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xf6, char: \xf7, offset: 0x0f60
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * ...#....
+     * ........
+     * .#####..
+     * ........
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x80, 0x80, 0xb0, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0xf7, char: \xf8, offset: 0x0f70
+     * ........
+     * ........
+     * ........
+     * ........
+     * ......#.
+     * ..####..
+     * .#...##.
+     * .#..#.#.
+     * .#.#..#.
+     * .##...#.
+     * .#....#.
+     * #.####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x20, 0xa0, 0x60, 0xd0, 0x00,
+    0x08, 0x07, 0x0a, 0x09, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xf8, char: \xf9, offset: 0x0f80
+     * ........
+     * ........
+     * ...#....
+     * ....#...
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x00, 0x04, 0x08, 0x00, 0xe0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0xf9, char: \xfa, offset: 0x0f90
+     * ........
+     * ........
+     * ....#...
+     * ...#....
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x00, 0x08, 0x04, 0x00, 0xe0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0xfa, char: \xfb, offset: 0x0fa0
+     * ........
+     * ........
+     * ...##...
+     * ..#..#..
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x08, 0x04, 0x04, 0x08, 0xe0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0xfb, char: \xfc, offset: 0x0fb0
+     * ........
+     * ........
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x0c, 0x00, 0x00, 0x0c, 0xe0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0xfc, char: \xfd, offset: 0x0fc0
+     * ........
+     * ........
+     * ....#...
+     * ...#....
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ......#.
+     * ..####..
+     */
+    0x00, 0xe0, 0x00, 0x08, 0x04, 0x00, 0xe0, 0x00,
+    0x00, 0x07, 0x28, 0x28, 0x28, 0x28, 0x1f, 0x00,
+
+    /* Index: 0xfd, char: \xfe, offset: 0x0fd0
+     * ........
+     * ........
+     * .#......
+     * .#......
+     * .#......
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * .#......
+     * .#......
+     */
+    0x00, 0xfc, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x3f, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0xfe, char: \xff, offset: 0x0fe0
+     * ........
+     * ........
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ......#.
+     * ..####..
+     */
+    0x00, 0xe0, 0x0c, 0x00, 0x00, 0x0c, 0xe0, 0x00,
+    0x00, 0x07, 0x28, 0x28, 0x28, 0x28, 0x1f, 0x00,
+
+    /* Index: 0xff, char: U+0401, offset: 0x0ff0
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * .######.
+     * .#......
+     * .#......
+     * .#......
+     * .####...
+     * .#......
+     * .#......
+     * .#......
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x8b, 0x88, 0x88, 0x0b, 0x08, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0x100, char: U+0410, offset: 0x1000
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x84, 0x84, 0x84, 0x84, 0xf8, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x101, char: U+0411, offset: 0x1010
+     * ........
+     * ........
+     * .#####..
+     * .#......
+     * .#......
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x24, 0x24, 0x24, 0x24, 0xc0, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x102, char: U+0412, offset: 0x1020
+     * ........
+     * ........
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x44, 0x44, 0x44, 0x44, 0xb8, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x103, char: U+0413, offset: 0x1030
+     * ........
+     * ........
+     * .######.
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x104, char: U+0414, offset: 0x1040
+     * ........
+     * ........
+     * ..####..
+     * .#...#..
+     * .#...#..
+     * .#...#..
+     * .#...#..
+     * .#...#..
+     * .#...#..
+     * .#...#..
+     * .#...#..
+     * #######.
+     * #.....#.
+     * ........
+     */
+    0x00, 0xf8, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00,
+    0x18, 0x0f, 0x08, 0x08, 0x08, 0x0f, 0x18, 0x00,
+
+    /* Index: 0x105, char: U+0415, offset: 0x1050
+     * ........
+     * ........
+     * .######.
+     * .#......
+     * .#......
+     * .#......
+     * .####...
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .######.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x44, 0x44, 0x44, 0x04, 0x04, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+
+    /* Index: 0x106, char: U+0416, offset: 0x1060
+     * ........
+     * ........
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * .#.#.#..
+     * ..###...
+     * .#.#.#..
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * ........
+     * ........
+     */
+    0x1c, 0xa0, 0x40, 0xfc, 0x40, 0xa0, 0x1c, 0x00,
+    0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x107, char: U+0417, offset: 0x1070
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * ......#.
+     * ...###..
+     * ......#.
+     * ......#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0x18, 0x04, 0x44, 0x44, 0x44, 0xb8, 0x00,
+    0x00, 0x06, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x108, char: U+0418, offset: 0x1080
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#...##.
+     * .#..#.#.
+     * .#.#..#.
+     * .##...#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x00, 0x80, 0x40, 0x20, 0xfc, 0x00,
+    0x00, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x109, char: U+0419, offset: 0x1090
+     * ..#..#..
+     * ...##...
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#...##.
+     * .#..#.#.
+     * .#.#..#.
+     * .##...#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x01, 0x82, 0x42, 0x21, 0xfc, 0x00,
+    0x00, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x10a, char: U+041A, offset: 0x10a0
+     * ........
+     * ........
+     * .#....#.
+     * .#...#..
+     * .#..#...
+     * .#.#....
+     * .##.....
+     * .##.....
+     * .#.#....
+     * .#..#...
+     * .#...#..
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0xc0, 0x20, 0x10, 0x08, 0x04, 0x00,
+    0x00, 0x0f, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00,
+
+    /* Index: 0x10b, char: U+041B, offset: 0x10b0
+     * ........
+     * ........
+     * ....###.
+     * ...#..#.
+     * ..#...#.
+     * ..#...#.
+     * ..#...#.
+     * ..#...#.
+     * ..#...#.
+     * ..#...#.
+     * ..#...#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xf0, 0x08, 0x04, 0x04, 0xfc, 0x00,
+    0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x10c, char: U+041C, offset: 0x10c0
+     * ........
+     * ........
+     * #.....#.
+     * ##...##.
+     * #.#.#.#.
+     * #..#..#.
+     * #..#..#.
+     * #.....#.
+     * #.....#.
+     * #.....#.
+     * #.....#.
+     * #.....#.
+     * ........
+     * ........
+     */
+    0xfc, 0x08, 0x10, 0x60, 0x10, 0x08, 0xfc, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x10d, char: U+041D, offset: 0x10d0
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x40, 0x40, 0x40, 0x40, 0xfc, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x10e, char: U+041E, offset: 0x10e0
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x04, 0x04, 0x04, 0x04, 0xf8, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x10f, char: U+041F, offset: 0x10f0
+     * ........
+     * ........
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x04, 0x04, 0x04, 0x04, 0xfc, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x110, char: U+0420, offset: 0x1100
+     * ........
+     * ........
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x84, 0x84, 0x84, 0x84, 0x78, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x111, char: U+0421, offset: 0x1110
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x04, 0x04, 0x04, 0x04, 0x18, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x06, 0x00,
+
+    /* Index: 0x112, char: U+0422, offset: 0x1120
+     * ........
+     * ........
+     * #######.
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x04, 0x04, 0x04, 0xfc, 0x04, 0x04, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x113, char: U+0423, offset: 0x1130
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ......#.
+     * ......#.
+     * ......#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0x7c, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x114, char: U+0424, offset: 0x1140
+     * ........
+     * ...#....
+     * .#####..
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * .#####..
+     * ...#....
+     * ........
+     */
+    0xf8, 0x04, 0x04, 0xfe, 0x04, 0x04, 0xf8, 0x00,
+    0x07, 0x08, 0x08, 0x1f, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x115, char: U+0425, offset: 0x1150
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * ..#..#..
+     * ..#..#..
+     * ...##...
+     * ...##...
+     * ..#..#..
+     * ..#..#..
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0x0c, 0x30, 0xc0, 0xc0, 0x30, 0x0c, 0x00,
+    0x00, 0x0c, 0x03, 0x00, 0x00, 0x03, 0x0c, 0x00,
+
+    /* Index: 0x116, char: U+0426, offset: 0x1160
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..######
+     * .......#
+     * .......#
+     */
+    0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x38,
+
+    /* Index: 0x117, char: U+0427, offset: 0x1170
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ......#.
+     * ......#.
+     * ......#.
+     * ......#.
+     * ........
+     * ........
+     */
+    0x00, 0x7c, 0x80, 0x80, 0x80, 0x80, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x118, char: U+0428, offset: 0x1180
+     * ........
+     * ........
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * .######.
+     * ........
+     * ........
+     */
+    0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x07, 0x08, 0x08, 0x0f, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0x119, char: U+0429, offset: 0x1190
+     * ........
+     * ........
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * .#######
+     * .......#
+     * .......#
+     */
+    0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+    0x07, 0x08, 0x08, 0x0f, 0x08, 0x08, 0x0f, 0x38,
+
+    /* Index: 0x11a, char: U+042A, offset: 0x11a0
+     * ........
+     * ........
+     * ##......
+     * .#......
+     * .#......
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * ........
+     * ........
+     */
+    0x04, 0xfc, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x11b, char: U+042B, offset: 0x11b0
+     * ........
+     * ........
+     * #.....#.
+     * #.....#.
+     * #.....#.
+     * ####..#.
+     * #...#.#.
+     * #...#.#.
+     * #...#.#.
+     * #...#.#.
+     * #...#.#.
+     * ####..#.
+     * ........
+     * ........
+     */
+    0xfc, 0x20, 0x20, 0x20, 0xc0, 0x00, 0xfc, 0x00,
+    0x0f, 0x08, 0x08, 0x08, 0x07, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x11c, char: U+042C, offset: 0x11c0
+     * ........
+     * ........
+     * .#......
+     * .#......
+     * .#......
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * ........
+     * ........
+     */
+    0x00, 0xfc, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x11d, char: U+042D, offset: 0x11d0
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * ......#.
+     * ......#.
+     * ...####.
+     * ......#.
+     * ......#.
+     * ......#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0x08, 0x04, 0x44, 0x44, 0x44, 0xf8, 0x00,
+    0x00, 0x04, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x11e, char: U+042E, offset: 0x11e0
+     * ........
+     * ........
+     * #...##..
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * ####..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #...##..
+     * ........
+     * ........
+     */
+    0xfc, 0x80, 0x80, 0xf8, 0x04, 0x04, 0xf8, 0x00,
+    0x0f, 0x00, 0x00, 0x07, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x11f, char: U+042F, offset: 0x11f0
+     * ........
+     * ........
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ....#.#.
+     * ...#..#.
+     * ..#...#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0x78, 0x84, 0x84, 0x84, 0x84, 0xfc, 0x00,
+    0x00, 0x08, 0x04, 0x02, 0x01, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x120, char: U+0430, offset: 0x1200
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * ......#.
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xa0, 0xa0, 0xa0, 0xa0, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0x121, char: U+0431, offset: 0x1210
+     * ........
+     * ........
+     * ..####..
+     * .#......
+     * .#......
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x24, 0x24, 0x24, 0x24, 0xc0, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x122, char: U+0432, offset: 0x1220
+     * ........
+     * ........
+     * ..###...
+     * .#...#..
+     * .#...#..
+     * .#..#...
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * ........
+     * ........
+     */
+    0x00, 0xf8, 0x44, 0x44, 0x64, 0x58, 0x80, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x123, char: U+0433, offset: 0x1230
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .######.
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * .#......
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x124, char: U+0434, offset: 0x1240
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ......#.
+     * ..####..
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x00,
+    0x00, 0x07, 0x28, 0x28, 0x28, 0x28, 0x1f, 0x00,
+
+    /* Index: 0x125, char: U+0435, offset: 0x1250
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#......
+     * .#......
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x01, 0x00,
+
+    /* Index: 0x126, char: U+0436, offset: 0x1260
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * #..#..#.
+     * #..#..#.
+     * .#.#.#..
+     * ..###...
+     * .#.#.#..
+     * #..#..#.
+     * #..#..#.
+     * ........
+     * ........
+     */
+    0x60, 0x80, 0x00, 0xe0, 0x00, 0x80, 0x60, 0x00,
+    0x0c, 0x02, 0x01, 0x0f, 0x01, 0x02, 0x0c, 0x00,
+
+    /* Index: 0x127, char: U+0437, offset: 0x1270
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * ......#.
+     * ...###..
+     * ......#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0x40, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x04, 0x08, 0x09, 0x09, 0x09, 0x06, 0x00,
+
+    /* Index: 0x128, char: U+0438, offset: 0x1280
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0x129, char: U+0439, offset: 0x1290
+     * ........
+     * ........
+     * ..#..#..
+     * ...##...
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x04, 0x08, 0x08, 0x04, 0xe0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0x12a, char: U+043A, offset: 0x12a0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * .#...#..
+     * .#..#...
+     * .###....
+     * .#..#...
+     * .#...#..
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x00, 0x00, 0x80, 0x40, 0x20, 0x00,
+    0x00, 0x0f, 0x01, 0x01, 0x02, 0x04, 0x08, 0x00,
+
+    /* Index: 0x12b, char: U+043B, offset: 0x12b0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...####.
+     * ..#...#.
+     * ..#...#.
+     * ..#...#.
+     * ..#...#.
+     * ..#...#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xc0, 0x20, 0x20, 0x20, 0xe0, 0x00,
+    0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x12c, char: U+043C, offset: 0x12c0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * #.....#.
+     * ##...##.
+     * #.#.#.#.
+     * #..#..#.
+     * #.....#.
+     * #.....#.
+     * #.....#.
+     * ........
+     * ........
+     */
+    0xe0, 0x40, 0x80, 0x00, 0x80, 0x40, 0xe0, 0x00,
+    0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x12d, char: U+043D, offset: 0x12d0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x0f, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x00,
+
+    /* Index: 0x12e, char: U+043E, offset: 0x12e0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x12f, char: U+043F, offset: 0x12f0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .######.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x130, char: U+0440, offset: 0x1300
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#####..
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#####..
+     * .#......
+     * .#......
+     */
+    0x00, 0xe0, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x3f, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x131, char: U+0441, offset: 0x1310
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * .#......
+     * .#......
+     * .#......
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0x40, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x04, 0x00,
+
+    /* Index: 0x132, char: U+0442, offset: 0x1320
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * #######.
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ........
+     * ........
+     */
+    0x20, 0x20, 0x20, 0xe0, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x133, char: U+0443, offset: 0x1330
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ......#.
+     * ..####..
+     */
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x07, 0x28, 0x28, 0x28, 0x28, 0x1f, 0x00,
+
+    /* Index: 0x134, char: U+0444, offset: 0x1340
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#....
+     * .#####..
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * .#####..
+     * ...#....
+     * ........
+     */
+    0xc0, 0x20, 0x20, 0xf0, 0x20, 0x20, 0xc0, 0x00,
+    0x07, 0x08, 0x08, 0x1f, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x135, char: U+0445, offset: 0x1350
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * ..#..#..
+     * ...##...
+     * ..#..#..
+     * .#....#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0x60, 0x80, 0x00, 0x00, 0x80, 0x60, 0x00,
+    0x00, 0x0c, 0x02, 0x01, 0x01, 0x02, 0x0c, 0x00,
+
+    /* Index: 0x136, char: U+0446, offset: 0x1360
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..######
+     * .......#
+     * .......#
+     */
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x38,
+
+    /* Index: 0x137, char: U+0447, offset: 0x1370
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#....#.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ......#.
+     * ......#.
+     * ......#.
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x00,
+
+    /* Index: 0x138, char: U+0448, offset: 0x1380
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * .######.
+     * ........
+     * ........
+     */
+    0xe0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe0, 0x00,
+    0x07, 0x08, 0x08, 0x0f, 0x08, 0x08, 0x0f, 0x00,
+
+    /* Index: 0x139, char: U+0449, offset: 0x1390
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * #..#..#.
+     * .#######
+     * .......#
+     * .......#
+     */
+    0xe0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe0, 0x00,
+    0x07, 0x08, 0x08, 0x0f, 0x08, 0x08, 0x0f, 0x38,
+
+    /* Index: 0x13a, char: U+044A, offset: 0x13a0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .##.....
+     * ..#.....
+     * ..####..
+     * ..#...#.
+     * ..#...#.
+     * ..#...#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0x20, 0xe0, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x08, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x13b, char: U+044B, offset: 0x13b0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * #.....#.
+     * #.....#.
+     * ####..#.
+     * #...#.#.
+     * #...#.#.
+     * #...#.#.
+     * ####..#.
+     * ........
+     * ........
+     */
+    0xe0, 0x80, 0x80, 0x80, 0x00, 0x00, 0xe0, 0x00,
+    0x0f, 0x08, 0x08, 0x08, 0x07, 0x00, 0x0f, 0x00,
+
+    /* Index: 0x13c, char: U+044C, offset: 0x13c0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * .#......
+     * .#......
+     * .####...
+     * .#...#..
+     * .#...#..
+     * .#...#..
+     * .####...
+     * ........
+     * ........
+     */
+    0x00, 0xe0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00,
+
+    /* Index: 0x13d, char: U+044D, offset: 0x13d0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * .#....#.
+     * ......#.
+     * ...####.
+     * ......#.
+     * .#....#.
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0x40, 0x20, 0x20, 0x20, 0x20, 0xc0, 0x00,
+    0x00, 0x04, 0x08, 0x09, 0x09, 0x09, 0x07, 0x00,
+
+    /* Index: 0x13e, char: U+044E, offset: 0x13e0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * #...##..
+     * #..#..#.
+     * #..#..#.
+     * ####..#.
+     * #..#..#.
+     * #..#..#.
+     * #...##..
+     * ........
+     * ........
+     */
+    0xe0, 0x00, 0x00, 0xc0, 0x20, 0x20, 0xc0, 0x00,
+    0x0f, 0x01, 0x01, 0x07, 0x08, 0x08, 0x07, 0x00,
+
+    /* Index: 0x13f, char: U+044F, offset: 0x13f0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..#####.
+     * .#....#.
+     * .#....#.
+     * ..#####.
+     * ...#..#.
+     * ..#...#.
+     * .#....#.
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x00,
+    0x00, 0x08, 0x05, 0x03, 0x01, 0x01, 0x0f, 0x00,
+
+    /* Index: 0x140, char: U+0451, offset: 0x1400
+     * ........
+     * ........
+     * ..#..#..
+     * ..#..#..
+     * ........
+     * ..####..
+     * .#....#.
+     * .#....#.
+     * .######.
+     * .#......
+     * .#......
+     * ..####..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x2c, 0x20, 0x20, 0x2c, 0xc0, 0x00,
+    0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x01, 0x00,
+
+    /* Index: 0x141, char: U+2219, offset: 0x1410
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...##...
+     * ...##...
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x142, char: U+221A, offset: 0x1420
+     * ........
+     * .....##.
+     * .....#..
+     * .....#..
+     * .....#..
+     * .....#..
+     * .#...#..
+     * .#...#..
+     * .#...#..
+     * ..#..#..
+     * ...#.#..
+     * ....##..
+     * ........
+     * ........
+     */
+    0x00, 0xc0, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x00,
+    0x00, 0x01, 0x02, 0x04, 0x08, 0x0f, 0x00, 0x00,
+
+    /* Index: 0x143, char: U+2248, offset: 0x1430
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..##..#.
+     * .#..##..
+     * ........
+     * ..##..#.
+     * .#..##..
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x40, 0x20, 0x20, 0x40, 0x40, 0x20, 0x00,
+    0x00, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00,
+
+    /* Index: 0x144, char: U+2264, offset: 0x1440
+     * ........
+     * ........
+     * ........
+     * .....#..
+     * ....#...
+     * ...#....
+     * ..#.....
+     * ...#....
+     * ....#...
+     * .....#..
+     * ........
+     * ..#####.
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x40, 0xa0, 0x10, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x08, 0x09, 0x0a, 0x08, 0x00,
+
+    /* Index: 0x145, char: U+2265, offset: 0x1450
+     * ........
+     * ........
+     * ........
+     * ..#.....
+     * ...#....
+     * ....#...
+     * .....#..
+     * ....#...
+     * ...#....
+     * ..#.....
+     * ........
+     * .#####..
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x08, 0x10, 0xa0, 0x40, 0x00, 0x00,
+    0x00, 0x08, 0x0a, 0x09, 0x08, 0x08, 0x00, 0x00,
+
+    /* Index: 0x146, char: U+2320, offset: 0x1460
+     * ........
+     * ........
+     * ....##..
+     * ...#..#.
+     * ...#..#.
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x00, 0x00, 0x00, 0xf8, 0x04, 0x04, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x147, char: U+2321, offset: 0x1470
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * #..#....
+     * #..#....
+     * .##.....
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x148, char: U+2500, offset: 0x1480
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ########
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x149, char: U+2502, offset: 0x1490
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x14a, char: U+250C, offset: 0x14a0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#####
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x00, 0x00, 0x00, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x14b, char: U+2510, offset: 0x14b0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ####....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x40, 0x40, 0x40, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x14c, char: U+2514, offset: 0x14c0
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#####
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0x7f, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x14d, char: U+2518, offset: 0x14d0
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ####....
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x40, 0x40, 0x40, 0x7f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x14e, char: U+251C, offset: 0x14e0
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#####
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x00, 0x00, 0x00, 0xff, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x14f, char: U+2524, offset: 0x14f0
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ####....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x40, 0x40, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x150, char: U+252C, offset: 0x1500
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ########
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x40, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x151, char: U+2534, offset: 0x1510
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ########
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x40, 0x40, 0x40, 0x7f, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x152, char: U+253C, offset: 0x1520
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ########
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x153, char: U+2550, offset: 0x1530
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ########
+     * ........
+     * ########
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x154, char: U+2551, offset: 0x1540
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x155, char: U+2552, offset: 0x1550
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ...#####
+     * ...#....
+     * ...#####
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x00, 0x00, 0x00, 0xe0, 0xa0, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x156, char: U+2553, offset: 0x1560
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..######
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0x00, 0x00, 0xc0, 0x40, 0xc0, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x157, char: U+2554, offset: 0x1570
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..######
+     * ..#.....
+     * ..#.####
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0x00, 0x00, 0xe0, 0x20, 0xa0, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x158, char: U+2555, offset: 0x1580
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ####....
+     * ...#....
+     * ####....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0xa0, 0xa0, 0xa0, 0xe0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x159, char: U+2556, offset: 0x1590
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * #####...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0x40, 0x40, 0xc0, 0x40, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x15a, char: U+2557, offset: 0x15a0
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * #####...
+     * ....#...
+     * ###.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0xa0, 0xa0, 0xa0, 0x20, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x15b, char: U+2558, offset: 0x15b0
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#####
+     * ...#....
+     * ...#####
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x00, 0xff, 0xa0, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x15c, char: U+2559, offset: 0x15c0
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..######
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0x7f, 0x40, 0x7f, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x15d, char: U+255A, offset: 0x15d0
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.####
+     * ..#.....
+     * ..######
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xff, 0x80, 0xbf, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x15e, char: U+255B, offset: 0x15e0
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ####....
+     * ...#....
+     * ####....
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0xa0, 0xa0, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x15f, char: U+255C, offset: 0x15f0
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * #####...
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x40, 0x40, 0x7f, 0x40, 0x7f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x160, char: U+255D, offset: 0x1600
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ###.#...
+     * ....#...
+     * #####...
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0xa0, 0xa0, 0xbf, 0x80, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x161, char: U+255E, offset: 0x1610
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#####
+     * ...#....
+     * ...#####
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0x00, 0x00, 0x00, 0xff, 0xa0, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x162, char: U+255F, offset: 0x1620
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.####
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0x00, 0x00, 0xff, 0x00, 0xff, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x163, char: U+2560, offset: 0x1630
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.####
+     * ..#.....
+     * ..#.####
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0x00, 0x00, 0xff, 0x00, 0xbf, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x164, char: U+2561, offset: 0x1640
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ####....
+     * ...#....
+     * ####....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0xa0, 0xa0, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x165, char: U+2562, offset: 0x1650
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ###.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0x40, 0x40, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x166, char: U+2563, offset: 0x1660
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ###.#...
+     * ....#...
+     * ###.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0xa0, 0xa0, 0xbf, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x167, char: U+2564, offset: 0x1670
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ########
+     * ........
+     * ########
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x168, char: U+2565, offset: 0x1680
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ########
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0x40, 0x40, 0xc0, 0x40, 0xc0, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x169, char: U+2566, offset: 0x1690
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ########
+     * ........
+     * ###.####
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0xa0, 0xa0, 0xa0, 0x20, 0xa0, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x16a, char: U+2567, offset: 0x16a0
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ########
+     * ........
+     * ########
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0xa0, 0xa0, 0xa0, 0xbf, 0xa0, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x16b, char: U+2568, offset: 0x16b0
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ########
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x40, 0x40, 0x7f, 0x40, 0x7f, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x16c, char: U+2569, offset: 0x16c0
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ###.####
+     * ........
+     * ########
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0xa0, 0xa0, 0xbf, 0x80, 0xbf, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x16d, char: U+256A, offset: 0x16d0
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ########
+     * ...#....
+     * ########
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     * ...#....
+     */
+    0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x16e, char: U+256B, offset: 0x16e0
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ########
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0x40, 0x40, 0xff, 0x40, 0xff, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x16f, char: U+256C, offset: 0x16f0
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ###.####
+     * ........
+     * ###.####
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     * ..#.#...
+     */
+    0xa0, 0xa0, 0xbf, 0x00, 0xbf, 0xa0, 0xa0, 0xa0,
+    0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00,
+
+    /* Index: 0x170, char: U+2580, offset: 0x1700
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x171, char: U+2584, offset: 0x1710
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ........
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     */
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+
+    /* Index: 0x172, char: U+2588, offset: 0x1720
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     * ########
+     */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+
+    /* Index: 0x173, char: U+258C, offset: 0x1730
+     * ####....
+     * ####....
+     * ####....
+     * ####....
+     * ####....
+     * ####....
+     * ####....
+     * ####....
+     * ####....
+     * ####....
+     * ####....
+     * ####....
+     * ####....
+     * ####....
+     */
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00,
+
+    /* Index: 0x174, char: U+2590, offset: 0x1740
+     * ....####
+     * ....####
+     * ....####
+     * ....####
+     * ....####
+     * ....####
+     * ....####
+     * ....####
+     * ....####
+     * ....####
+     * ....####
+     * ....####
+     * ....####
+     * ....####
+     */
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f,
+
+    /* Index: 0x175, char: U+2591, offset: 0x1750
+     * #...#...
+     * ..#...#.
+     * #...#...
+     * ..#...#.
+     * #...#...
+     * ..#...#.
+     * #...#...
+     * ..#...#.
+     * #...#...
+     * ..#...#.
+     * #...#...
+     * ..#...#.
+     * #...#...
+     * ..#...#.
+     */
+    0x55, 0x00, 0xaa, 0x00, 0x55, 0x00, 0xaa, 0x00,
+    0x15, 0x00, 0x2a, 0x00, 0x15, 0x00, 0x2a, 0x00,
+
+    /* Index: 0x176, char: U+2592, offset: 0x1760
+     * #.#.#.#.
+     * .#.#.#.#
+     * #.#.#.#.
+     * .#.#.#.#
+     * #.#.#.#.
+     * .#.#.#.#
+     * #.#.#.#.
+     * .#.#.#.#
+     * #.#.#.#.
+     * .#.#.#.#
+     * #.#.#.#.
+     * .#.#.#.#
+     * #.#.#.#.
+     * .#.#.#.#
+     */
+    0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa,
+    0x15, 0x2a, 0x15, 0x2a, 0x15, 0x2a, 0x15, 0x2a,
+
+    /* Index: 0x177, char: U+2593, offset: 0x1770
+     * ###.###.
+     * #.###.##
+     * ###.###.
+     * #.###.##
+     * ###.###.
+     * #.###.##
+     * ###.###.
+     * #.###.##
+     * ###.###.
+     * #.###.##
+     * ###.###.
+     * #.###.##
+     * ###.###.
+     * #.###.##
+     */
+    0xff, 0x55, 0xff, 0xaa, 0xff, 0x55, 0xff, 0xaa,
+    0x3f, 0x15, 0x3f, 0x2a, 0x3f, 0x15, 0x3f, 0x2a,
+
+    /* Index: 0x178, char: U+25A0, offset: 0x1780
+     * ........
+     * ........
+     * ........
+     * ........
+     * ..####..
+     * ..####..
+     * ..####..
+     * ..####..
+     * ..####..
+     * ..####..
+     * ........
+     * ........
+     * ........
+     * ........
+     */
+    0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+};
+
+static const font_range_t _fonts_terminus_8x14_unicode_ranges[] = {
+    { 0x0001, 0x00ff,    0 },
+    { 0x0401, 0x0401,  255 },
+    { 0x0410, 0x044f,  256 },
+    { 0x0451, 0x0451,  320 },
+    { 0x2219, 0x221a,  321 },
+    { 0x2248, 0x2248,  323 },
+    { 0x2264, 0x2265,  324 },
+    { 0x2320, 0x2321,  326 },
+    { 0x2500, 0x2500,  328 },
+    { 0x2502, 0x2502,  329 },
+    { 0x250c, 0x250c,  330 },
+    { 0x2510, 0x2510,  331 },
+    { 0x2514, 0x2514,  332 },
+    { 0x2518, 0x2518,  333 },
+    { 0x251c, 0x251c,  334 },
+    { 0x2524, 0x2524,  335 },
+    { 0x252c, 0x252c,  336 },
+    { 0x2534, 0x2534,  337 },
+    { 0x253c, 0x253c,  338 },
+    { 0x2550, 0x256c,  339 },
+    { 0x2580, 0x2580,  368 },
+    { 0x2584, 0x2584,  369 },
+    { 0x2588, 0x2588,  370 },
+    { 0x258c, 0x258c,  371 },
+    { 0x2590, 0x2593,  372 },
+    { 0x25a0, 0x25a0,  376 },
+};
+
+const font_info_t _fonts_terminus_8x14_unicode_info =
+{
+    .height           = 14, /* Character height */
+    .c                = 0, /* C */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
+    .bitmap           = _fonts_terminus_8x14_unicode_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_PAGES | FONT_FLAG_MONO, /* Flags */
+    .width            = 8, /* Glyph width */
+    .stride           = 16, /* Bytes per glyph */
+    .ranges           = _fonts_terminus_8x14_unicode_ranges, /* Code point ranges */
+    .num_ranges       = 26, /* Number of ranges */
+};
+
+#endif /* _EXTRAS_FONTS_FONT_TERMINUS_8X14_UNICODE_H_ */
@@ -5118,272 +5118,17 @@ static const uint8_t _fonts_terminus_bold_10x18_iso8859_1_bitmaps[] = {
     0x3f, 0x00, /* ..######........ */
 };
 
-const font_char_desc_t _fonts_terminus_bold_10x18_iso8859_1_descriptors[] = {
-    { 0x0a, 0x0000 }, /* Index: 0x00, char: \x01 */
-    { 0x0a, 0x0024 }, /* Index: 0x01, char: \x02 */
-    { 0x0a, 0x0048 }, /* Index: 0x02, char: \x03 */
-    { 0x0a, 0x006c }, /* Index: 0x03, char: \x04 */
-    { 0x0a, 0x0090 }, /* Index: 0x04, char: \x05 */
-    { 0x0a, 0x00b4 }, /* Index: 0x05, char: \x06 */
-    { 0x0a, 0x00d8 }, /* Index: 0x06, char: \x07 */
-    { 0x0a, 0x00fc }, /* Index: 0x07, char: \x08 */
-    { 0x0a, 0x0120 }, /* Index: 0x08, char: \x09 */
-    { 0x0a, 0x0144 }, /* Index: 0x09, char: \x0a */
-    { 0x0a, 0x0168 }, /* Index: 0x0a, char: \x0b */
-    { 0x0a, 0x018c }, /* Index: 0x0b, char: \x0c */
-    { 0x0a, 0x01b0 }, /* Index: 0x0c, char: \x0d */
-    { 0x0a, 0x01d4 }, /* Index: 0x0d, char: \x0e */
-    { 0x0a, 0x01f8 }, /* Index: 0x0e, char: \x0f */
-    { 0x0a, 0x021c }, /* Index: 0x0f, char: \x10 */
-    { 0x0a, 0x0240 }, /* Index: 0x10, char: \x11 */
-    { 0x0a, 0x0264 }, /* Index: 0x11, char: \x12 */
-    { 0x0a, 0x0288 }, /* Index: 0x12, char: \x13 */
-    { 0x0a, 0x02ac }, /* Index: 0x13, char: \x14 */
-    { 0x0a, 0x02d0 }, /* Index: 0x14, char: \x15 */
-    { 0x0a, 0x02f4 }, /* Index: 0x15, char: \x16 */
-    { 0x0a, 0x0318 }, /* Index: 0x16, char: \x17 */
-    { 0x0a, 0x033c }, /* Index: 0x17, char: \x18 */
-    { 0x0a, 0x0360 }, /* Index: 0x18, char: \x19 */
-    { 0x0a, 0x0384 }, /* Index: 0x19, char: \x1a */
-    { 0x0a, 0x03a8 }, /* Index: 0x1a, char: \x1b */
-    { 0x0a, 0x03cc }, /* Index: 0x1b, char: \x1c */
-    { 0x0a, 0x03f0 }, /* Index: 0x1c, char: \x1d */
-    { 0x0a, 0x0414 }, /* Index: 0x1d, char: \x1e */
-    { 0x0a, 0x0438 }, /* Index: 0x1e, char: \x1f */
-    { 0x0a, 0x045c }, /* Index: 0x1f, char: \x20 */
-    { 0x0a, 0x0480 }, /* Index: 0x20, char: \x21 */
-    { 0x0a, 0x04a4 }, /* Index: 0x21, char: \x22 */
-    { 0x0a, 0x04c8 }, /* Index: 0x22, char: \x23 */
-    { 0x0a, 0x04ec }, /* Index: 0x23, char: \x24 */
-    { 0x0a, 0x0510 }, /* Index: 0x24, char: \x25 */
-    { 0x0a, 0x0534 }, /* Index: 0x25, char: \x26 */
-    { 0x0a, 0x0558 }, /* Index: 0x26, char: \x27 */
-    { 0x0a, 0x057c }, /* Index: 0x27, char: \x28 */
-    { 0x0a, 0x05a0 }, /* Index: 0x28, char: \x29 */
-    { 0x0a, 0x05c4 }, /* Index: 0x29, char: \x2a */
-    { 0x0a, 0x05e8 }, /* Index: 0x2a, char: \x2b */
-    { 0x0a, 0x060c }, /* Index: 0x2b, char: \x2c */
-    { 0x0a, 0x0630 }, /* Index: 0x2c, char: \x2d */
-    { 0x0a, 0x0654 }, /* Index: 0x2d, char: \x2e */
-    { 0x0a, 0x0678 }, /* Index: 0x2e, char: \x2f */
-    { 0x0a, 0x069c }, /* Index: 0x2f, char: \x30 */
-    { 0x0a, 0x06c0 }, /* Index: 0x30, char: \x31 */
-    { 0x0a, 0x06e4 }, /* Index: 0x31, char: \x32 */
-    { 0x0a, 0x0708 }, /* Index: 0x32, char: \x33 */
-    { 0x0a, 0x072c }, /* Index: 0x33, char: \x34 */
-    { 0x0a, 0x0750 }, /* Index: 0x34, char: \x35 */
-    { 0x0a, 0x0774 }, /* Index: 0x35, char: \x36 */
-    { 0x0a, 0x0798 }, /* Index: 0x36, char: \x37 */
-    { 0x0a, 0x07bc }, /* Index: 0x37, char: \x38 */
-    { 0x0a, 0x07e0 }, /* Index: 0x38, char: \x39 */
-    { 0x0a, 0x0804 }, /* Index: 0x39, char: \x3a */
-    { 0x0a, 0x0828 }, /* Index: 0x3a, char: \x3b */
-    { 0x0a, 0x084c }, /* Index: 0x3b, char: \x3c */
-    { 0x0a, 0x0870 }, /* Index: 0x3c, char: \x3d */
-    { 0x0a, 0x0894 }, /* Index: 0x3d, char: \x3e */
-    { 0x0a, 0x08b8 }, /* Index: 0x3e, char: \x3f */
-    { 0x0a, 0x08dc }, /* Index: 0x3f, char: \x40 */
-    { 0x0a, 0x0900 }, /* Index: 0x40, char: \x41 */
-    { 0x0a, 0x0924 }, /* Index: 0x41, char: \x42 */
-    { 0x0a, 0x0948 }, /* Index: 0x42, char: \x43 */
-    { 0x0a, 0x096c }, /* Index: 0x43, char: \x44 */
-    { 0x0a, 0x0990 }, /* Index: 0x44, char: \x45 */
-    { 0x0a, 0x09b4 }, /* Index: 0x45, char: \x46 */
-    { 0x0a, 0x09d8 }, /* Index: 0x46, char: \x47 */
-    { 0x0a, 0x09fc }, /* Index: 0x47, char: \x48 */
-    { 0x0a, 0x0a20 }, /* Index: 0x48, char: \x49 */
-    { 0x0a, 0x0a44 }, /* Index: 0x49, char: \x4a */
-    { 0x0a, 0x0a68 }, /* Index: 0x4a, char: \x4b */
-    { 0x0a, 0x0a8c }, /* Index: 0x4b, char: \x4c */
-    { 0x0a, 0x0ab0 }, /* Index: 0x4c, char: \x4d */
-    { 0x0a, 0x0ad4 }, /* Index: 0x4d, char: \x4e */
-    { 0x0a, 0x0af8 }, /* Index: 0x4e, char: \x4f */
-    { 0x0a, 0x0b1c }, /* Index: 0x4f, char: \x50 */
-    { 0x0a, 0x0b40 }, /* Index: 0x50, char: \x51 */
-    { 0x0a, 0x0b64 }, /* Index: 0x51, char: \x52 */
-    { 0x0a, 0x0b88 }, /* Index: 0x52, char: \x53 */
-    { 0x0a, 0x0bac }, /* Index: 0x53, char: \x54 */
-    { 0x0a, 0x0bd0 }, /* Index: 0x54, char: \x55 */
-    { 0x0a, 0x0bf4 }, /* Index: 0x55, char: \x56 */
-    { 0x0a, 0x0c18 }, /* Index: 0x56, char: \x57 */
-    { 0x0a, 0x0c3c }, /* Index: 0x57, char: \x58 */
-    { 0x0a, 0x0c60 }, /* Index: 0x58, char: \x59 */
-    { 0x0a, 0x0c84 }, /* Index: 0x59, char: \x5a */
-    { 0x0a, 0x0ca8 }, /* Index: 0x5a, char: \x5b */
-    { 0x0a, 0x0ccc }, /* Index: 0x5b, char: \x5c */
-    { 0x0a, 0x0cf0 }, /* Index: 0x5c, char: \x5d */
-    { 0x0a, 0x0d14 }, /* Index: 0x5d, char: \x5e */
-    { 0x0a, 0x0d38 }, /* Index: 0x5e, char: \x5f */
-    { 0x0a, 0x0d5c }, /* Index: 0x5f, char: \x60 */
-    { 0x0a, 0x0d80 }, /* Index: 0x60, char: \x61 */
-    { 0x0a, 0x0da4 }, /* Index: 0x61, char: \x62 */
-    { 0x0a, 0x0dc8 }, /* Index: 0x62, char: \x63 */
-    { 0x0a, 0x0dec }, /* Index: 0x63, char: \x64 */
-    { 0x0a, 0x0e10 }, /* Index: 0x64, char: \x65 */
-    { 0x0a, 0x0e34 }, /* Index: 0x65, char: \x66 */
-    { 0x0a, 0x0e58 }, /* Index: 0x66, char: \x67 */
-    { 0x0a, 0x0e7c }, /* Index: 0x67, char: \x68 */
-    { 0x0a, 0x0ea0 }, /* Index: 0x68, char: \x69 */
-    { 0x0a, 0x0ec4 }, /* Index: 0x69, char: \x6a */
-    { 0x0a, 0x0ee8 }, /* Index: 0x6a, char: \x6b */
-    { 0x0a, 0x0f0c }, /* Index: 0x6b, char: \x6c */
-    { 0x0a, 0x0f30 }, /* Index: 0x6c, char: \x6d */
-    { 0x0a, 0x0f54 }, /* Index: 0x6d, char: \x6e */
-    { 0x0a, 0x0f78 }, /* Index: 0x6e, char: \x6f */
-    { 0x0a, 0x0f9c }, /* Index: 0x6f, char: \x70 */
-    { 0x0a, 0x0fc0 }, /* Index: 0x70, char: \x71 */
-    { 0x0a, 0x0fe4 }, /* Index: 0x71, char: \x72 */
-    { 0x0a, 0x1008 }, /* Index: 0x72, char: \x73 */
-    { 0x0a, 0x102c }, /* Index: 0x73, char: \x74 */
-    { 0x0a, 0x1050 }, /* Index: 0x74, char: \x75 */
-    { 0x0a, 0x1074 }, /* Index: 0x75, char: \x76 */
-    { 0x0a, 0x1098 }, /* Index: 0x76, char: \x77 */
-    { 0x0a, 0x10bc }, /* Index: 0x77, char: \x78 */
-    { 0x0a, 0x10e0 }, /* Index: 0x78, char: \x79 */
-    { 0x0a, 0x1104 }, /* Index: 0x79, char: \x7a */
-    { 0x0a, 0x1128 }, /* Index: 0x7a, char: \x7b */
-    { 0x0a, 0x114c }, /* Index: 0x7b, char: \x7c */
-    { 0x0a, 0x1170 }, /* Index: 0x7c, char: \x7d */
-    { 0x0a, 0x1194 }, /* Index: 0x7d, char: \x7e */
-    { 0x0a, 0x11b8 }, /* Index: 0x7e, char: \x7f */
-    { 0x0a, 0x11dc }, /* Index: 0x7f, char: \x80 */
-    { 0x0a, 0x1200 }, /* Index: 0x80, char: \x81 */
-    { 0x0a, 0x1224 }, /* Index: 0x81, char: \x82 */
-    { 0x0a, 0x1248 }, /* Index: 0x82, char: \x83 */
-    { 0x0a, 0x126c }, /* Index: 0x83, char: \x84 */
-    { 0x0a, 0x1290 }, /* Index: 0x84, char: \x85 */
-    { 0x0a, 0x12b4 }, /* Index: 0x85, char: \x86 */
-    { 0x0a, 0x12d8 }, /* Index: 0x86, char: \x87 */
-    { 0x0a, 0x12fc }, /* Index: 0x87, char: \x88 */
-    { 0x0a, 0x1320 }, /* Index: 0x88, char: \x89 */
-    { 0x0a, 0x1344 }, /* Index: 0x89, char: \x8a */
-    { 0x0a, 0x1368 }, /* Index: 0x8a, char: \x8b */
-    { 0x0a, 0x138c }, /* Index: 0x8b, char: \x8c */
-    { 0x0a, 0x13b0 }, /* Index: 0x8c, char: \x8d */
-    { 0x0a, 0x13d4 }, /* Index: 0x8d, char: \x8e */
-    { 0x0a, 0x13f8 }, /* Index: 0x8e, char: \x8f */
-    { 0x0a, 0x141c }, /* Index: 0x8f, char: \x90 */
-    { 0x0a, 0x1440 }, /* Index: 0x90, char: \x91 */
-    { 0x0a, 0x1464 }, /* Index: 0x91, char: \x92 */
-    { 0x0a, 0x1488 }, /* Index: 0x92, char: \x93 */
-    { 0x0a, 0x14ac }, /* Index: 0x93, char: \x94 */
-    { 0x0a, 0x14d0 }, /* Index: 0x94, char: \x95 */
-    { 0x0a, 0x14f4 }, /* Index: 0x95, char: \x96 */
-    { 0x0a, 0x1518 }, /* Index: 0x96, char: \x97 */
-    { 0x0a, 0x153c }, /* Index: 0x97, char: \x98 */
-    { 0x0a, 0x1560 }, /* Index: 0x98, char: \x99 */
-    { 0x0a, 0x1584 }, /* Index: 0x99, char: \x9a */
-    { 0x0a, 0x15a8 }, /* Index: 0x9a, char: \x9b */
-    { 0x0a, 0x15cc }, /* Index: 0x9b, char: \x9c */
-    { 0x0a, 0x15f0 }, /* Index: 0x9c, char: \x9d */
-    { 0x0a, 0x1614 }, /* Index: 0x9d, char: \x9e */
-    { 0x0a, 0x1638 }, /* Index: 0x9e, char: \x9f */
-    { 0x0a, 0x165c }, /* Index: 0x9f, char: \xa0 */
-    { 0x0a, 0x1680 }, /* Index: 0xa0, char: \xa1 */
-    { 0x0a, 0x16a4 }, /* Index: 0xa1, char: \xa2 */
-    { 0x0a, 0x16c8 }, /* Index: 0xa2, char: \xa3 */
-    { 0x0a, 0x16ec }, /* Index: 0xa3, char: \xa4 */
-    { 0x0a, 0x1710 }, /* Index: 0xa4, char: \xa5 */
-    { 0x0a, 0x1734 }, /* Index: 0xa5, char: \xa6 */
-    { 0x0a, 0x1758 }, /* Index: 0xa6, char: \xa7 */
-    { 0x0a, 0x177c }, /* Index: 0xa7, char: \xa8 */
-    { 0x0a, 0x17a0 }, /* Index: 0xa8, char: \xa9 */
-    { 0x0a, 0x17c4 }, /* Index: 0xa9, char: \xaa */
-    { 0x0a, 0x17e8 }, /* Index: 0xaa, char: \xab */
-    { 0x0a, 0x180c }, /* Index: 0xab, char: \xac */
-    { 0x0a, 0x1830 }, /* Index: 0xac, char: \xad */
-    { 0x0a, 0x1854 }, /* Index: 0xad, char: \xae */
-    { 0x0a, 0x1878 }, /* Index: 0xae, char: \xaf */
-    { 0x0a, 0x189c }, /* Index: 0xaf, char: \xb0 */
-    { 0x0a, 0x18c0 }, /* Index: 0xb0, char: \xb1 */
-    { 0x0a, 0x18e4 }, /* Index: 0xb1, char: \xb2 */
-    { 0x0a, 0x1908 }, /* Index: 0xb2, char: \xb3 */
-    { 0x0a, 0x192c }, /* Index: 0xb3, char: \xb4 */
-    { 0x0a, 0x1950 }, /* Index: 0xb4, char: \xb5 */
-    { 0x0a, 0x1974 }, /* Index: 0xb5, char: \xb6 */
-    { 0x0a, 0x1998 }, /* Index: 0xb6, char: \xb7 */
-    { 0x0a, 0x19bc }, /* Index: 0xb7, char: \xb8 */
-    { 0x0a, 0x19e0 }, /* Index: 0xb8, char: \xb9 */
-    { 0x0a, 0x1a04 }, /* Index: 0xb9, char: \xba */
-    { 0x0a, 0x1a28 }, /* Index: 0xba, char: \xbb */
-    { 0x0a, 0x1a4c }, /* Index: 0xbb, char: \xbc */
-    { 0x0a, 0x1a70 }, /* Index: 0xbc, char: \xbd */
-    { 0x0a, 0x1a94 }, /* Index: 0xbd, char: \xbe */
-    { 0x0a, 0x1ab8 }, /* Index: 0xbe, char: \xbf */
-    { 0x0a, 0x1adc }, /* Index: 0xbf, char: \xc0 */
-    { 0x0a, 0x1b00 }, /* Index: 0xc0, char: \xc1 */
-    { 0x0a, 0x1b24 }, /* Index: 0xc1, char: \xc2 */
-    { 0x0a, 0x1b48 }, /* Index: 0xc2, char: \xc3 */
-    { 0x0a, 0x1b6c }, /* Index: 0xc3, char: \xc4 */
-    { 0x0a, 0x1b90 }, /* Index: 0xc4, char: \xc5 */
-    { 0x0a, 0x1bb4 }, /* Index: 0xc5, char: \xc6 */
-    { 0x0a, 0x1bd8 }, /* Index: 0xc6, char: \xc7 */
-    { 0x0a, 0x1bfc }, /* Index: 0xc7, char: \xc8 */
-    { 0x0a, 0x1c20 }, /* Index: 0xc8, char: \xc9 */
-    { 0x0a, 0x1c44 }, /* Index: 0xc9, char: \xca */
-    { 0x0a, 0x1c68 }, /* Index: 0xca, char: \xcb */
-    { 0x0a, 0x1c8c }, /* Index: 0xcb, char: \xcc */
-    { 0x0a, 0x1cb0 }, /* Index: 0xcc, char: \xcd */
-    { 0x0a, 0x1cd4 }, /* Index: 0xcd, char: \xce */
-    { 0x0a, 0x1cf8 }, /* Index: 0xce, char: \xcf */
-    { 0x0a, 0x1d1c }, /* Index: 0xcf, char: \xd0 */
-    { 0x0a, 0x1d40 }, /* Index: 0xd0, char: \xd1 */
-    { 0x0a, 0x1d64 }, /* Index: 0xd1, char: \xd2 */
-    { 0x0a, 0x1d88 }, /* Index: 0xd2, char: \xd3 */
-    { 0x0a, 0x1dac }, /* Index: 0xd3, char: \xd4 */
-    { 0x0a, 0x1dd0 }, /* Index: 0xd4, char: \xd5 */
-    { 0x0a, 0x1df4 }, /* Index: 0xd5, char: \xd6 */
-    { 0x0a, 0x1e18 }, /* Index: 0xd6, char: \xd7 */
-    { 0x0a, 0x1e3c }, /* Index: 0xd7, char: \xd8 */
-    { 0x0a, 0x1e60 }, /* Index: 0xd8, char: \xd9 */
-    { 0x0a, 0x1e84 }, /* Index: 0xd9, char: \xda */
-    { 0x0a, 0x1ea8 }, /* Index: 0xda, char: \xdb */
-    { 0x0a, 0x1ecc }, /* Index: 0xdb, char: \xdc */
-    { 0x0a, 0x1ef0 }, /* Index: 0xdc, char: \xdd */
-    { 0x0a, 0x1f14 }, /* Index: 0xdd, char: \xde */
-    { 0x0a, 0x1f38 }, /* Index: 0xde, char: \xdf */
-    { 0x0a, 0x1f5c }, /* Index: 0xdf, char: \xe0 */
-    { 0x0a, 0x1f80 }, /* Index: 0xe0, char: \xe1 */
-    { 0x0a, 0x1fa4 }, /* Index: 0xe1, char: \xe2 */
-    { 0x0a, 0x1fc8 }, /* Index: 0xe2, char: \xe3 */
-    { 0x0a, 0x1fec }, /* Index: 0xe3, char: \xe4 */
-    { 0x0a, 0x2010 }, /* Index: 0xe4, char: \xe5 */
-    { 0x0a, 0x2034 }, /* Index: 0xe5, char: \xe6 */
-    { 0x0a, 0x2058 }, /* Index: 0xe6, char: \xe7 */
-    { 0x0a, 0x207c }, /* Index: 0xe7, char: \xe8 */
-    { 0x0a, 0x20a0 }, /* Index: 0xe8, char: \xe9 */
-    { 0x0a, 0x20c4 }, /* Index: 0xe9, char: \xea */
-    { 0x0a, 0x20e8 }, /* Index: 0xea, char: \xeb */
-    { 0x0a, 0x210c }, /* Index: 0xeb, char: \xec */
-    { 0x0a, 0x2130 }, /* Index: 0xec, char: \xed */
-    { 0x0a, 0x2154 }, /* Index: 0xed, char: \xee */
-    { 0x0a, 0x2178 }, /* Index: 0xee, char: \xef */
-    { 0x0a, 0x219c }, /* Index: 0xef, char: \xf0 */
-    { 0x0a, 0x21c0 }, /* Index: 0xf0, char: \xf1 */
-    { 0x0a, 0x21e4 }, /* Index: 0xf1, char: \xf2 */
-    { 0x0a, 0x2208 }, /* Index: 0xf2, char: \xf3 */
-    { 0x0a, 0x222c }, /* Index: 0xf3, char: \xf4 */
-    { 0x0a, 0x2250 }, /* Index: 0xf4, char: \xf5 */
-    { 0x0a, 0x2274 }, /* Index: 0xf5, char: \xf6 */
-    { 0x0a, 0x2298 }, /* Index: 0xf6, char: \xf7 */
-    { 0x0a, 0x22bc }, /* Index: 0xf7, char: \xf8 */
-    { 0x0a, 0x22e0 }, /* Index: 0xf8, char: \xf9 */
-    { 0x0a, 0x2304 }, /* Index: 0xf9, char: \xfa */
-    { 0x0a, 0x2328 }, /* Index: 0xfa, char: \xfb */
-    { 0x0a, 0x234c }, /* Index: 0xfb, char: \xfc */
-    { 0x0a, 0x2370 }, /* Index: 0xfc, char: \xfd */
-    { 0x0a, 0x2394 }, /* Index: 0xfd, char: \xfe */
-    { 0x0a, 0x23b8 }, /* Index: 0xfe, char: \xff */
-};
-
 const font_info_t _fonts_terminus_bold_10x18_iso8859_1_info =
 {
     .height           = 18, /* Character height */
     .c                = 0, /* C */
     .char_start       = 1, /* Start character */
     .char_end         = 255, /* End character */
-    .char_descriptors = _fonts_terminus_bold_10x18_iso8859_1_descriptors, /* Character descriptor array */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
     .bitmap           = _fonts_terminus_bold_10x18_iso8859_1_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 10, /* Glyph width */
+    .stride           = 36, /* Bytes per glyph */
 };
 
 #endif /* _EXTRAS_FONTS_FONT_TERMINUS_BOLD_10X18_ISO8859_1_H_ */
@@ -6138,272 +6138,17 @@ static const uint8_t _fonts_terminus_bold_11x22_iso8859_1_bitmaps[] = {
     0x00, 0x00, /* ................ */
 };
 
-const font_char_desc_t _fonts_terminus_bold_11x22_iso8859_1_descriptors[] = {
-    { 0x0b, 0x0000 }, /* Index: 0x00, char: \x01 */
-    { 0x0b, 0x002c }, /* Index: 0x01, char: \x02 */
-    { 0x0b, 0x0058 }, /* Index: 0x02, char: \x03 */
-    { 0x0b, 0x0084 }, /* Index: 0x03, char: \x04 */
-    { 0x0b, 0x00b0 }, /* Index: 0x04, char: \x05 */
-    { 0x0b, 0x00dc }, /* Index: 0x05, char: \x06 */
-    { 0x0b, 0x0108 }, /* Index: 0x06, char: \x07 */
-    { 0x0b, 0x0134 }, /* Index: 0x07, char: \x08 */
-    { 0x0b, 0x0160 }, /* Index: 0x08, char: \x09 */
-    { 0x0b, 0x018c }, /* Index: 0x09, char: \x0a */
-    { 0x0b, 0x01b8 }, /* Index: 0x0a, char: \x0b */
-    { 0x0b, 0x01e4 }, /* Index: 0x0b, char: \x0c */
-    { 0x0b, 0x0210 }, /* Index: 0x0c, char: \x0d */
-    { 0x0b, 0x023c }, /* Index: 0x0d, char: \x0e */
-    { 0x0b, 0x0268 }, /* Index: 0x0e, char: \x0f */
-    { 0x0b, 0x0294 }, /* Index: 0x0f, char: \x10 */
-    { 0x0b, 0x02c0 }, /* Index: 0x10, char: \x11 */
-    { 0x0b, 0x02ec }, /* Index: 0x11, char: \x12 */
-    { 0x0b, 0x0318 }, /* Index: 0x12, char: \x13 */
-    { 0x0b, 0x0344 }, /* Index: 0x13, char: \x14 */
-    { 0x0b, 0x0370 }, /* Index: 0x14, char: \x15 */
-    { 0x0b, 0x039c }, /* Index: 0x15, char: \x16 */
-    { 0x0b, 0x03c8 }, /* Index: 0x16, char: \x17 */
-    { 0x0b, 0x03f4 }, /* Index: 0x17, char: \x18 */
-    { 0x0b, 0x0420 }, /* Index: 0x18, char: \x19 */
-    { 0x0b, 0x044c }, /* Index: 0x19, char: \x1a */
-    { 0x0b, 0x0478 }, /* Index: 0x1a, char: \x1b */
-    { 0x0b, 0x04a4 }, /* Index: 0x1b, char: \x1c */
-    { 0x0b, 0x04d0 }, /* Index: 0x1c, char: \x1d */
-    { 0x0b, 0x04fc }, /* Index: 0x1d, char: \x1e */
-    { 0x0b, 0x0528 }, /* Index: 0x1e, char: \x1f */
-    { 0x0b, 0x0554 }, /* Index: 0x1f, char: \x20 */
-    { 0x0b, 0x0580 }, /* Index: 0x20, char: \x21 */
-    { 0x0b, 0x05ac }, /* Index: 0x21, char: \x22 */
-    { 0x0b, 0x05d8 }, /* Index: 0x22, char: \x23 */
-    { 0x0b, 0x0604 }, /* Index: 0x23, char: \x24 */
-    { 0x0b, 0x0630 }, /* Index: 0x24, char: \x25 */
-    { 0x0b, 0x065c }, /* Index: 0x25, char: \x26 */
-    { 0x0b, 0x0688 }, /* Index: 0x26, char: \x27 */
-    { 0x0b, 0x06b4 }, /* Index: 0x27, char: \x28 */
-    { 0x0b, 0x06e0 }, /* Index: 0x28, char: \x29 */
-    { 0x0b, 0x070c }, /* Index: 0x29, char: \x2a */
-    { 0x0b, 0x0738 }, /* Index: 0x2a, char: \x2b */
-    { 0x0b, 0x0764 }, /* Index: 0x2b, char: \x2c */
-    { 0x0b, 0x0790 }, /* Index: 0x2c, char: \x2d */
-    { 0x0b, 0x07bc }, /* Index: 0x2d, char: \x2e */
-    { 0x0b, 0x07e8 }, /* Index: 0x2e, char: \x2f */
-    { 0x0b, 0x0814 }, /* Index: 0x2f, char: \x30 */
-    { 0x0b, 0x0840 }, /* Index: 0x30, char: \x31 */
-    { 0x0b, 0x086c }, /* Index: 0x31, char: \x32 */
-    { 0x0b, 0x0898 }, /* Index: 0x32, char: \x33 */
-    { 0x0b, 0x08c4 }, /* Index: 0x33, char: \x34 */
-    { 0x0b, 0x08f0 }, /* Index: 0x34, char: \x35 */
-    { 0x0b, 0x091c }, /* Index: 0x35, char: \x36 */
-    { 0x0b, 0x0948 }, /* Index: 0x36, char: \x37 */
-    { 0x0b, 0x0974 }, /* Index: 0x37, char: \x38 */
-    { 0x0b, 0x09a0 }, /* Index: 0x38, char: \x39 */
-    { 0x0b, 0x09cc }, /* Index: 0x39, char: \x3a */
-    { 0x0b, 0x09f8 }, /* Index: 0x3a, char: \x3b */
-    { 0x0b, 0x0a24 }, /* Index: 0x3b, char: \x3c */
-    { 0x0b, 0x0a50 }, /* Index: 0x3c, char: \x3d */
-    { 0x0b, 0x0a7c }, /* Index: 0x3d, char: \x3e */
-    { 0x0b, 0x0aa8 }, /* Index: 0x3e, char: \x3f */
-    { 0x0b, 0x0ad4 }, /* Index: 0x3f, char: \x40 */
-    { 0x0b, 0x0b00 }, /* Index: 0x40, char: \x41 */
-    { 0x0b, 0x0b2c }, /* Index: 0x41, char: \x42 */
-    { 0x0b, 0x0b58 }, /* Index: 0x42, char: \x43 */
-    { 0x0b, 0x0b84 }, /* Index: 0x43, char: \x44 */
-    { 0x0b, 0x0bb0 }, /* Index: 0x44, char: \x45 */
-    { 0x0b, 0x0bdc }, /* Index: 0x45, char: \x46 */
-    { 0x0b, 0x0c08 }, /* Index: 0x46, char: \x47 */
-    { 0x0b, 0x0c34 }, /* Index: 0x47, char: \x48 */
-    { 0x0b, 0x0c60 }, /* Index: 0x48, char: \x49 */
-    { 0x0b, 0x0c8c }, /* Index: 0x49, char: \x4a */
-    { 0x0b, 0x0cb8 }, /* Index: 0x4a, char: \x4b */
-    { 0x0b, 0x0ce4 }, /* Index: 0x4b, char: \x4c */
-    { 0x0b, 0x0d10 }, /* Index: 0x4c, char: \x4d */
-    { 0x0b, 0x0d3c }, /* Index: 0x4d, char: \x4e */
-    { 0x0b, 0x0d68 }, /* Index: 0x4e, char: \x4f */
-    { 0x0b, 0x0d94 }, /* Index: 0x4f, char: \x50 */
-    { 0x0b, 0x0dc0 }, /* Index: 0x50, char: \x51 */
-    { 0x0b, 0x0dec }, /* Index: 0x51, char: \x52 */
-    { 0x0b, 0x0e18 }, /* Index: 0x52, char: \x53 */
-    { 0x0b, 0x0e44 }, /* Index: 0x53, char: \x54 */
-    { 0x0b, 0x0e70 }, /* Index: 0x54, char: \x55 */
-    { 0x0b, 0x0e9c }, /* Index: 0x55, char: \x56 */
-    { 0x0b, 0x0ec8 }, /* Index: 0x56, char: \x57 */
-    { 0x0b, 0x0ef4 }, /* Index: 0x57, char: \x58 */
-    { 0x0b, 0x0f20 }, /* Index: 0x58, char: \x59 */
-    { 0x0b, 0x0f4c }, /* Index: 0x59, char: \x5a */
-    { 0x0b, 0x0f78 }, /* Index: 0x5a, char: \x5b */
-    { 0x0b, 0x0fa4 }, /* Index: 0x5b, char: \x5c */
-    { 0x0b, 0x0fd0 }, /* Index: 0x5c, char: \x5d */
-    { 0x0b, 0x0ffc }, /* Index: 0x5d, char: \x5e */
-    { 0x0b, 0x1028 }, /* Index: 0x5e, char: \x5f */
-    { 0x0b, 0x1054 }, /* Index: 0x5f, char: \x60 */
-    { 0x0b, 0x1080 }, /* Index: 0x60, char: \x61 */
-    { 0x0b, 0x10ac }, /* Index: 0x61, char: \x62 */
-    { 0x0b, 0x10d8 }, /* Index: 0x62, char: \x63 */
-    { 0x0b, 0x1104 }, /* Index: 0x63, char: \x64 */
-    { 0x0b, 0x1130 }, /* Index: 0x64, char: \x65 */
-    { 0x0b, 0x115c }, /* Index: 0x65, char: \x66 */
-    { 0x0b, 0x1188 }, /* Index: 0x66, char: \x67 */
-    { 0x0b, 0x11b4 }, /* Index: 0x67, char: \x68 */
-    { 0x0b, 0x11e0 }, /* Index: 0x68, char: \x69 */
-    { 0x0b, 0x120c }, /* Index: 0x69, char: \x6a */
-    { 0x0b, 0x1238 }, /* Index: 0x6a, char: \x6b */
-    { 0x0b, 0x1264 }, /* Index: 0x6b, char: \x6c */
-    { 0x0b, 0x1290 }, /* Index: 0x6c, char: \x6d */
-    { 0x0b, 0x12bc }, /* Index: 0x6d, char: \x6e */
-    { 0x0b, 0x12e8 }, /* Index: 0x6e, char: \x6f */
-    { 0x0b, 0x1314 }, /* Index: 0x6f, char: \x70 */
-    { 0x0b, 0x1340 }, /* Index: 0x70, char: \x71 */
-    { 0x0b, 0x136c }, /* Index: 0x71, char: \x72 */
-    { 0x0b, 0x1398 }, /* Index: 0x72, char: \x73 */
-    { 0x0b, 0x13c4 }, /* Index: 0x73, char: \x74 */
-    { 0x0b, 0x13f0 }, /* Index: 0x74, char: \x75 */
-    { 0x0b, 0x141c }, /* Index: 0x75, char: \x76 */
-    { 0x0b, 0x1448 }, /* Index: 0x76, char: \x77 */
-    { 0x0b, 0x1474 }, /* Index: 0x77, char: \x78 */
-    { 0x0b, 0x14a0 }, /* Index: 0x78, char: \x79 */
-    { 0x0b, 0x14cc }, /* Index: 0x79, char: \x7a */
-    { 0x0b, 0x14f8 }, /* Index: 0x7a, char: \x7b */
-    { 0x0b, 0x1524 }, /* Index: 0x7b, char: \x7c */
-    { 0x0b, 0x1550 }, /* Index: 0x7c, char: \x7d */
-    { 0x0b, 0x157c }, /* Index: 0x7d, char: \x7e */
-    { 0x0b, 0x15a8 }, /* Index: 0x7e, char: \x7f */
-    { 0x0b, 0x15d4 }, /* Index: 0x7f, char: \x80 */
-    { 0x0b, 0x1600 }, /* Index: 0x80, char: \x81 */
-    { 0x0b, 0x162c }, /* Index: 0x81, char: \x82 */
-    { 0x0b, 0x1658 }, /* Index: 0x82, char: \x83 */
-    { 0x0b, 0x1684 }, /* Index: 0x83, char: \x84 */
-    { 0x0b, 0x16b0 }, /* Index: 0x84, char: \x85 */
-    { 0x0b, 0x16dc }, /* Index: 0x85, char: \x86 */
-    { 0x0b, 0x1708 }, /* Index: 0x86, char: \x87 */
-    { 0x0b, 0x1734 }, /* Index: 0x87, char: \x88 */
-    { 0x0b, 0x1760 }, /* Index: 0x88, char: \x89 */
-    { 0x0b, 0x178c }, /* Index: 0x89, char: \x8a */
-    { 0x0b, 0x17b8 }, /* Index: 0x8a, char: \x8b */
-    { 0x0b, 0x17e4 }, /* Index: 0x8b, char: \x8c */
-    { 0x0b, 0x1810 }, /* Index: 0x8c, char: \x8d */
-    { 0x0b, 0x183c }, /* Index: 0x8d, char: \x8e */
-    { 0x0b, 0x1868 }, /* Index: 0x8e, char: \x8f */
-    { 0x0b, 0x1894 }, /* Index: 0x8f, char: \x90 */
-    { 0x0b, 0x18c0 }, /* Index: 0x90, char: \x91 */
-    { 0x0b, 0x18ec }, /* Index: 0x91, char: \x92 */
-    { 0x0b, 0x1918 }, /* Index: 0x92, char: \x93 */
-    { 0x0b, 0x1944 }, /* Index: 0x93, char: \x94 */
-    { 0x0b, 0x1970 }, /* Index: 0x94, char: \x95 */
-    { 0x0b, 0x199c }, /* Index: 0x95, char: \x96 */
-    { 0x0b, 0x19c8 }, /* Index: 0x96, char: \x97 */
-    { 0x0b, 0x19f4 }, /* Index: 0x97, char: \x98 */
-    { 0x0b, 0x1a20 }, /* Index: 0x98, char: \x99 */
-    { 0x0b, 0x1a4c }, /* Index: 0x99, char: \x9a */
-    { 0x0b, 0x1a78 }, /* Index: 0x9a, char: \x9b */
-    { 0x0b, 0x1aa4 }, /* Index: 0x9b, char: \x9c */
-    { 0x0b, 0x1ad0 }, /* Index: 0x9c, char: \x9d */
-    { 0x0b, 0x1afc }, /* Index: 0x9d, char: \x9e */
-    { 0x0b, 0x1b28 }, /* Index: 0x9e, char: \x9f */
-    { 0x0b, 0x1b54 }, /* Index: 0x9f, char: \xa0 */
-    { 0x0b, 0x1b80 }, /* Index: 0xa0, char: \xa1 */
-    { 0x0b, 0x1bac }, /* Index: 0xa1, char: \xa2 */
-    { 0x0b, 0x1bd8 }, /* Index: 0xa2, char: \xa3 */
-    { 0x0b, 0x1c04 }, /* Index: 0xa3, char: \xa4 */
-    { 0x0b, 0x1c30 }, /* Index: 0xa4, char: \xa5 */
-    { 0x0b, 0x1c5c }, /* Index: 0xa5, char: \xa6 */
-    { 0x0b, 0x1c88 }, /* Index: 0xa6, char: \xa7 */
-    { 0x0b, 0x1cb4 }, /* Index: 0xa7, char: \xa8 */
-    { 0x0b, 0x1ce0 }, /* Index: 0xa8, char: \xa9 */
-    { 0x0b, 0x1d0c }, /* Index: 0xa9, char: \xaa */
-    { 0x0b, 0x1d38 }, /* Index: 0xaa, char: \xab */
-    { 0x0b, 0x1d64 }, /* Index: 0xab, char: \xac */
-    { 0x0b, 0x1d90 }, /* Index: 0xac, char: \xad */
-    { 0x0b, 0x1dbc }, /* Index: 0xad, char: \xae */
-    { 0x0b, 0x1de8 }, /* Index: 0xae, char: \xaf */
-    { 0x0b, 0x1e14 }, /* Index: 0xaf, char: \xb0 */
-    { 0x0b, 0x1e40 }, /* Index: 0xb0, char: \xb1 */
-    { 0x0b, 0x1e6c }, /* Index: 0xb1, char: \xb2 */
-    { 0x0b, 0x1e98 }, /* Index: 0xb2, char: \xb3 */
-    { 0x0b, 0x1ec4 }, /* Index: 0xb3, char: \xb4 */
-    { 0x0b, 0x1ef0 }, /* Index: 0xb4, char: \xb5 */
-    { 0x0b, 0x1f1c }, /* Index: 0xb5, char: \xb6 */
-    { 0x0b, 0x1f48 }, /* Index: 0xb6, char: \xb7 */
-    { 0x0b, 0x1f74 }, /* Index: 0xb7, char: \xb8 */
-    { 0x0b, 0x1fa0 }, /* Index: 0xb8, char: \xb9 */
-    { 0x0b, 0x1fcc }, /* Index: 0xb9, char: \xba */
-    { 0x0b, 0x1ff8 }, /* Index: 0xba, char: \xbb */
-    { 0x0b, 0x2024 }, /* Index: 0xbb, char: \xbc */
-    { 0x0b, 0x2050 }, /* Index: 0xbc, char: \xbd */
-    { 0x0b, 0x207c }, /* Index: 0xbd, char: \xbe */
-    { 0x0b, 0x20a8 }, /* Index: 0xbe, char: \xbf */
-    { 0x0b, 0x20d4 }, /* Index: 0xbf, char: \xc0 */
-    { 0x0b, 0x2100 }, /* Index: 0xc0, char: \xc1 */
-    { 0x0b, 0x212c }, /* Index: 0xc1, char: \xc2 */
-    { 0x0b, 0x2158 }, /* Index: 0xc2, char: \xc3 */
-    { 0x0b, 0x2184 }, /* Index: 0xc3, char: \xc4 */
-    { 0x0b, 0x21b0 }, /* Index: 0xc4, char: \xc5 */
-    { 0x0b, 0x21dc }, /* Index: 0xc5, char: \xc6 */
-    { 0x0b, 0x2208 }, /* Index: 0xc6, char: \xc7 */
-    { 0x0b, 0x2234 }, /* Index: 0xc7, char: \xc8 */
-    { 0x0b, 0x2260 }, /* Index: 0xc8, char: \xc9 */
-    { 0x0b, 0x228c }, /* Index: 0xc9, char: \xca */
-    { 0x0b, 0x22b8 }, /* Index: 0xca, char: \xcb */
-    { 0x0b, 0x22e4 }, /* Index: 0xcb, char: \xcc */
-    { 0x0b, 0x2310 }, /* Index: 0xcc, char: \xcd */
-    { 0x0b, 0x233c }, /* Index: 0xcd, char: \xce */
-    { 0x0b, 0x2368 }, /* Index: 0xce, char: \xcf */
-    { 0x0b, 0x2394 }, /* Index: 0xcf, char: \xd0 */
-    { 0x0b, 0x23c0 }, /* Index: 0xd0, char: \xd1 */
-    { 0x0b, 0x23ec }, /* Index: 0xd1, char: \xd2 */
-    { 0x0b, 0x2418 }, /* Index: 0xd2, char: \xd3 */
-    { 0x0b, 0x2444 }, /* Index: 0xd3, char: \xd4 */
-    { 0x0b, 0x2470 }, /* Index: 0xd4, char: \xd5 */
-    { 0x0b, 0x249c }, /* Index: 0xd5, char: \xd6 */
-    { 0x0b, 0x24c8 }, /* Index: 0xd6, char: \xd7 */
-    { 0x0b, 0x24f4 }, /* Index: 0xd7, char: \xd8 */
-    { 0x0b, 0x2520 }, /* Index: 0xd8, char: \xd9 */
-    { 0x0b, 0x254c }, /* Index: 0xd9, char: \xda */
-    { 0x0b, 0x2578 }, /* Index: 0xda, char: \xdb */
-    { 0x0b, 0x25a4 }, /* Index: 0xdb, char: \xdc */
-    { 0x0b, 0x25d0 }, /* Index: 0xdc, char: \xdd */
-    { 0x0b, 0x25fc }, /* Index: 0xdd, char: \xde */
-    { 0x0b, 0x2628 }, /* Index: 0xde, char: \xdf */
-    { 0x0b, 0x2654 }, /* Index: 0xdf, char: \xe0 */
-    { 0x0b, 0x2680 }, /* Index: 0xe0, char: \xe1 */
-    { 0x0b, 0x26ac }, /* Index: 0xe1, char: \xe2 */
-    { 0x0b, 0x26d8 }, /* Index: 0xe2, char: \xe3 */
-    { 0x0b, 0x2704 }, /* Index: 0xe3, char: \xe4 */
-    { 0x0b, 0x2730 }, /* Index: 0xe4, char: \xe5 */
-    { 0x0b, 0x275c }, /* Index: 0xe5, char: \xe6 */
-    { 0x0b, 0x2788 }, /* Index: 0xe6, char: \xe7 */
-    { 0x0b, 0x27b4 }, /* Index: 0xe7, char: \xe8 */
-    { 0x0b, 0x27e0 }, /* Index: 0xe8, char: \xe9 */
-    { 0x0b, 0x280c }, /* Index: 0xe9, char: \xea */
-    { 0x0b, 0x2838 }, /* Index: 0xea, char: \xeb */
-    { 0x0b, 0x2864 }, /* Index: 0xeb, char: \xec */
-    { 0x0b, 0x2890 }, /* Index: 0xec, char: \xed */
-    { 0x0b, 0x28bc }, /* Index: 0xed, char: \xee */
-    { 0x0b, 0x28e8 }, /* Index: 0xee, char: \xef */
-    { 0x0b, 0x2914 }, /* Index: 0xef, char: \xf0 */
-    { 0x0b, 0x2940 }, /* Index: 0xf0, char: \xf1 */
-    { 0x0b, 0x296c }, /* Index: 0xf1, char: \xf2 */
-    { 0x0b, 0x2998 }, /* Index: 0xf2, char: \xf3 */
-    { 0x0b, 0x29c4 }, /* Index: 0xf3, char: \xf4 */
-    { 0x0b, 0x29f0 }, /* Index: 0xf4, char: \xf5 */
-    { 0x0b, 0x2a1c }, /* Index: 0xf5, char: \xf6 */
-    { 0x0b, 0x2a48 }, /* Index: 0xf6, char: \xf7 */
-    { 0x0b, 0x2a74 }, /* Index: 0xf7, char: \xf8 */
-    { 0x0b, 0x2aa0 }, /* Index: 0xf8, char: \xf9 */
-    { 0x0b, 0x2acc }, /* Index: 0xf9, char: \xfa */
-    { 0x0b, 0x2af8 }, /* Index: 0xfa, char: \xfb */
-    { 0x0b, 0x2b24 }, /* Index: 0xfb, char: \xfc */
-    { 0x0b, 0x2b50 }, /* Index: 0xfc, char: \xfd */
-    { 0x0b, 0x2b7c }, /* Index: 0xfd, char: \xfe */
-    { 0x0b, 0x2ba8 }, /* Index: 0xfe, char: \xff */
-};
-
 const font_info_t _fonts_terminus_bold_11x22_iso8859_1_info =
 {
     .height           = 22, /* Character height */
     .c                = 0, /* C */
     .char_start       = 1, /* Start character */
     .char_end         = 255, /* End character */
-    .char_descriptors = _fonts_terminus_bold_11x22_iso8859_1_descriptors, /* Character descriptor array */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
     .bitmap           = _fonts_terminus_bold_11x22_iso8859_1_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 11, /* Glyph width */
+    .stride           = 44, /* Bytes per glyph */
 };
 
 #endif /* _EXTRAS_FONTS_FONT_TERMINUS_BOLD_11X22_ISO8859_1_H_ */
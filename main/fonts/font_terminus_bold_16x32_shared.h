@@ -0,0 +1,10249 @@
+/**
+ * This file contains generated binary font data.
+ *
+ * Font:    terminus_bold_16x32_iso8859_1
+ * Height:  32
+ * Layout:  row-major, monospace
+ * 255 characters in 50 ranges (1..255)
+ * 43 glyphs identical to an earlier one, stored once
+ *
+ * Font:    terminus_bold_16x32_koi8_r
+ * Height:  32
+ * Layout:  row-major, monospace
+ * 255 characters in 73 ranges (1..255)
+ * 171 glyphs identical to an earlier one, stored once
+ *
+ * Copyright (c) 2015 Dimitar Toshkov Zhekov
+ * License: SIL Open Font License, Version 1.1. The license is included as OFL.TXT, and is
+ *      also available with a FAQ at http://scripts.sil.org/OFL
+ *
+ * Source:  builtin:terminus_bold_16x32_iso8859_1, builtin:terminus_bold_16x32_koi8_r
+ * Generated by tools/fontc, do not edit. Command:
+ *     fontc -q --mono --rows --pool terminus_bold_16x32_shared --comment ../../main/fonts/src/terminus.txt -o ../../main/fonts/font_terminus_bold_16x32_shared.h builtin:terminus_bold_16x32_iso8859_1 builtin:terminus_bold_16x32_koi8_r
+ */
+#ifndef _EXTRAS_FONTS_FONT_TERMINUS_BOLD_16X32_SHARED_H_
+#define _EXTRAS_FONTS_FONT_TERMINUS_BOLD_16X32_SHARED_H_
+
+static const uint8_t _fonts_terminus_bold_16x32_shared_bitmaps[] = {
+
+    /* Index: 0x00, char: \x01, offset: 0x0000 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x7f, 0xfc, /* .#############.. */
+    0xff, 0xfe, /* ###############. */
+    0xff, 0xfe, /* ###############. */
+    0x7f, 0xfc, /* .#############.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x01, char: \x02, offset: 0x0040 */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x55, 0x55, /* .#.#.#.#.#.#.#.# */
+
+    /* Index: 0x02, char: \x03, offset: 0x0080 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x71, 0xc0, /* .###...###...... */
+    0x71, 0xc0, /* .###...###...... */
+    0x71, 0xc0, /* .###...###...... */
+    0x7f, 0xc0, /* .#########...... */
+    0x7f, 0xc0, /* .#########...... */
+    0x71, 0xc0, /* .###...###...... */
+    0x71, 0xc0, /* .###...###...... */
+    0x71, 0xc0, /* .###...###...... */
+    0x71, 0xc0, /* .###...###...... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0xfe, /* ......#########. */
+    0x03, 0xfe, /* ......#########. */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x03, char: \x04, offset: 0x00c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xc0, /* .#########...... */
+    0x7f, 0xc0, /* .#########...... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0x00, /* .#######........ */
+    0x7f, 0x00, /* .#######........ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0xfe, /* ......#########. */
+    0x03, 0xfe, /* ......#########. */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0xf8, /* ......#######... */
+    0x03, 0xf8, /* ......#######... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x04, char: \x05, offset: 0x0100 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0x80, /* ..#######....... */
+    0x7f, 0xc0, /* .#########...... */
+    0x71, 0xc0, /* .###...###...... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x71, 0xc0, /* .###...###...... */
+    0x7f, 0xc0, /* .#########...... */
+    0x3f, 0x80, /* ..#######....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0xfc, /* ......########.. */
+    0x03, 0xfe, /* ......#########. */
+    0x03, 0x8e, /* ......###...###. */
+    0x03, 0x8e, /* ......###...###. */
+    0x03, 0xfc, /* ......########.. */
+    0x03, 0xf0, /* ......######.... */
+    0x03, 0xb8, /* ......###.###... */
+    0x03, 0x9c, /* ......###..###.. */
+    0x03, 0x8e, /* ......###...###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x05, char: \x06, offset: 0x0140 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xc0, /* .#########...... */
+    0x7f, 0xc0, /* .#########...... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0xfe, /* ......#########. */
+    0x03, 0xfe, /* ......#########. */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0xf8, /* ......#######... */
+    0x03, 0xf8, /* ......#######... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x06, char: \x07, offset: 0x0180 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xe0, /* ....#######..... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x07, char: \x08, offset: 0x01c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x08, char: \x09, offset: 0x0200 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x71, 0xc0, /* .###...###...... */
+    0x71, 0xc0, /* .###...###...... */
+    0x79, 0xc0, /* .####..###...... */
+    0x7d, 0xc0, /* .#####.###...... */
+    0x7f, 0xc0, /* .#########...... */
+    0x77, 0xc0, /* .###.#####...... */
+    0x73, 0xc0, /* .###..####...... */
+    0x71, 0xc0, /* .###...###...... */
+    0x71, 0xc0, /* .###...###...... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0xfe, /* ......#########. */
+    0x03, 0xfe, /* ......#########. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x09, char: \x0a, offset: 0x0240 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x0a, char: \x0b, offset: 0x0280 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x0b, char: \x0c, offset: 0x02c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0x0c, char: \x0d, offset: 0x0300 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0x0d, char: \x0e, offset: 0x0340 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x0e, char: \x0f, offset: 0x0380 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0x11, char: \x12, offset: 0x03c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x14, char: \x15, offset: 0x0400 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0x15, char: \x16, offset: 0x0440 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0x16, char: \x17, offset: 0x0480 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x17, char: \x18, offset: 0x04c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0x18, char: \x19, offset: 0x0500 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0x19, char: \x1a, offset: 0x0540 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x01, 0xc0, /* .......###...... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xfc, /* ..############.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x1a, char: \x1b, offset: 0x0580 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x01, 0xc0, /* .......###...... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xfc, /* ..############.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x1b, char: \x1c, offset: 0x05c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x1c, char: \x1d, offset: 0x0600 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x0e, /* ............###. */
+    0x00, 0x1c, /* ...........###.. */
+    0x7f, 0xfe, /* .##############. */
+    0x7f, 0xfe, /* .##############. */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x7f, 0xfe, /* .##############. */
+    0x7f, 0xfe, /* .##############. */
+    0x38, 0x00, /* ..###........... */
+    0x70, 0x00, /* .###............ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x1d, char: \x1e, offset: 0x0640 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x07, 0xe0, /* .....######..... */
+    0x0f, 0xf0, /* ....########.... */
+    0x1e, 0x78, /* ...####..####... */
+    0x1c, 0x38, /* ...###....###... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x7f, 0xe0, /* .##########..... */
+    0x7f, 0xe0, /* .##########..... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x1e, char: \x1f, offset: 0x0680 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x20, char: !, offset: 0x06c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x21, char: ", offset: 0x0700 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x22, char: #, offset: 0x0740 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x23, char: $, offset: 0x0780 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x7b, 0xbc, /* .####.###.####.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x80, /* .###..###....... */
+    0x73, 0x80, /* .###..###....... */
+    0x73, 0x80, /* .###..###....... */
+    0x7b, 0x80, /* .####.###....... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x1f, 0xf8, /* ...##########... */
+    0x03, 0xbc, /* ......###.####.. */
+    0x03, 0x9c, /* ......###..###.. */
+    0x03, 0x9c, /* ......###..###.. */
+    0x03, 0x9c, /* ......###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x7b, 0xbc, /* .####.###.####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x24, char: %, offset: 0x07c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0x1c, /* ...#####...###.. */
+    0x3f, 0x9c, /* ..#######..###.. */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x1f, 0x70, /* ...#####.###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0xf8, /* ....###.#####... */
+    0x0f, 0xfc, /* ....##########.. */
+    0x1d, 0xdc, /* ...###.###.###.. */
+    0x1d, 0xdc, /* ...###.###.###.. */
+    0x39, 0xfc, /* ..###..#######.. */
+    0x38, 0xf8, /* ..###...#####... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x25, char: &, offset: 0x0800 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xc0, /* ....######...... */
+    0x1f, 0xe0, /* ...########..... */
+    0x38, 0x70, /* ..###....###.... */
+    0x38, 0x70, /* ..###....###.... */
+    0x38, 0x70, /* ..###....###.... */
+    0x38, 0x70, /* ..###....###.... */
+    0x38, 0x70, /* ..###....###.... */
+    0x1c, 0xe0, /* ...###..###..... */
+    0x0f, 0xc0, /* ....######...... */
+    0x0f, 0x80, /* ....#####....... */
+    0x1f, 0xce, /* ...#######..###. */
+    0x38, 0xee, /* ..###...###.###. */
+    0x70, 0x7c, /* .###.....#####.. */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x38, /* .###......###... */
+    0x78, 0x7c, /* .####....#####.. */
+    0x3f, 0xee, /* ..#########.###. */
+    0x1f, 0xce, /* ...#######..###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x26, char: ', offset: 0x0840 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x27, char: (, offset: 0x0880 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x01, 0xc0, /* .......###...... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x28, char: ), offset: 0x08c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x01, 0xc0, /* .......###...... */
+    0x01, 0xc0, /* .......###...... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x29, char: \x2a, offset: 0x0900 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x38, 0x38, /* ..###.....###... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x03, 0x80, /* ......###....... */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x38, 0x38, /* ..###.....###... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x2a, char: +, offset: 0x0940 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x2b, char: ,, offset: 0x0980 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x2c, char: -, offset: 0x09c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x2d, char: ., offset: 0x0a00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x2e, char: \x2f, offset: 0x0a40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x2f, char: 0, offset: 0x0a80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x7c, /* .###.....#####.. */
+    0x70, 0xfc, /* .###....######.. */
+    0x71, 0xdc, /* .###...###.###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x77, 0x1c, /* .###.###...###.. */
+    0x7e, 0x1c, /* .######....###.. */
+    0x7c, 0x1c, /* .#####.....###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x30, char: 1, offset: 0x0ac0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x80, /* .....####....... */
+    0x0f, 0x80, /* ....#####....... */
+    0x1f, 0x80, /* ...######....... */
+    0x1f, 0x80, /* ...######....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x31, char: 2, offset: 0x0b00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x38, 0x00, /* ..###........... */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x32, char: 3, offset: 0x0b40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x3c, /* ..........####.. */
+    0x0f, 0xf8, /* ....#########... */
+    0x0f, 0xf8, /* ....#########... */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x33, char: 4, offset: 0x0b80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x7c, /* .........#####.. */
+    0x00, 0xfc, /* ........######.. */
+    0x01, 0xdc, /* .......###.###.. */
+    0x03, 0x9c, /* ......###..###.. */
+    0x07, 0x1c, /* .....###...###.. */
+    0x0e, 0x1c, /* ....###....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x34, char: 5, offset: 0x0bc0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x35, char: 6, offset: 0x0c00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf8, /* ...##########... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x00, /* .####........... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x36, char: 7, offset: 0x0c40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x38, /* .###......###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x37, char: 8, offset: 0x0c80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x38, char: 9, offset: 0x0cc0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x3c, /* ..........####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x39, char: :, offset: 0x0d00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x3a, char: ;, offset: 0x0d40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x3b, char: <, offset: 0x0d80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x01, 0xc0, /* .......###...... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x3c, char: =, offset: 0x0dc0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x3d, char: >, offset: 0x0e00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x38, 0x00, /* ..###........... */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x01, 0xc0, /* .......###...... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x38, 0x00, /* ..###........... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x3e, char: ?, offset: 0x0e40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x3f, char: @, offset: 0x0e80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf8, /* ...##########... */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x0e, /* .####.......###. */
+    0x70, 0x06, /* .###.........##. */
+    0x71, 0xfe, /* .###...########. */
+    0x73, 0xfe, /* .###..#########. */
+    0x77, 0x8e, /* .###.####...###. */
+    0x77, 0x0e, /* .###.###....###. */
+    0x77, 0x0e, /* .###.###....###. */
+    0x77, 0x0e, /* .###.###....###. */
+    0x77, 0x0e, /* .###.###....###. */
+    0x77, 0x0e, /* .###.###....###. */
+    0x77, 0x0e, /* .###.###....###. */
+    0x77, 0x9e, /* .###.####..####. */
+    0x73, 0xfe, /* .###..#########. */
+    0x71, 0xf6, /* .###...#####.##. */
+    0x70, 0x00, /* .###............ */
+    0x78, 0x00, /* .####........... */
+    0x3f, 0xfe, /* ..#############. */
+    0x1f, 0xfe, /* ...############. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x40, char: A, offset: 0x0ec0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x41, char: B, offset: 0x0f00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x38, /* .###......###... */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf0, /* .###########.... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x7f, 0xf8, /* .############... */
+    0x7f, 0xf0, /* .###########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x42, char: C, offset: 0x0f40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x43, char: D, offset: 0x0f80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xc0, /* .#########...... */
+    0x7f, 0xf0, /* .###########.... */
+    0x70, 0x78, /* .###.....####... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x78, /* .###.....####... */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xc0, /* .#########...... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x44, char: E, offset: 0x0fc0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xe0, /* .##########..... */
+    0x7f, 0xe0, /* .##########..... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x45, char: F, offset: 0x1000 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xe0, /* .##########..... */
+    0x7f, 0xe0, /* .##########..... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x46, char: G, offset: 0x1040 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x71, 0xfc, /* .###...#######.. */
+    0x71, 0xfc, /* .###...#######.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x47, char: H, offset: 0x1080 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x48, char: I, offset: 0x10c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x49, char: J, offset: 0x1100 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0xfe, /* ........#######. */
+    0x00, 0xfe, /* ........#######. */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x38, /* .###......###... */
+    0x78, 0x78, /* .####....####... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x1f, 0xe0, /* ...########..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x4a, char: K, offset: 0x1140 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x0c, /* .###........##.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x70, /* .###.....###.... */
+    0x70, 0xe0, /* .###....###..... */
+    0x71, 0xc0, /* .###...###...... */
+    0x73, 0x80, /* .###..###....... */
+    0x77, 0x00, /* .###.###........ */
+    0x7e, 0x00, /* .######......... */
+    0x7c, 0x00, /* .#####.......... */
+    0x7c, 0x00, /* .#####.......... */
+    0x7e, 0x00, /* .######......... */
+    0x77, 0x00, /* .###.###........ */
+    0x73, 0x80, /* .###..###....... */
+    0x71, 0xc0, /* .###...###...... */
+    0x70, 0xe0, /* .###....###..... */
+    0x70, 0x70, /* .###.....###.... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x0c, /* .###........##.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x4b, char: L, offset: 0x1180 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x4c, char: M, offset: 0x11c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x78, 0x1e, /* .####......####. */
+    0x7c, 0x3e, /* .#####....#####. */
+    0x7e, 0x7e, /* .######..######. */
+    0x7e, 0x7e, /* .######..######. */
+    0x77, 0xee, /* .###.######.###. */
+    0x73, 0xce, /* .###..####..###. */
+    0x73, 0xce, /* .###..####..###. */
+    0x71, 0x8e, /* .###...##...###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x4d, char: N, offset: 0x1200 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x7c, 0x1c, /* .#####.....###.. */
+    0x7e, 0x1c, /* .######....###.. */
+    0x77, 0x1c, /* .###.###...###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x71, 0xdc, /* .###...###.###.. */
+    0x70, 0xfc, /* .###....######.. */
+    0x70, 0x7c, /* .###.....#####.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x4e, char: O, offset: 0x1240 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x4f, char: P, offset: 0x1280 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x7f, 0xf8, /* .############... */
+    0x7f, 0xf0, /* .###########.... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x50, char: Q, offset: 0x12c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x79, 0xfc, /* .####..#######.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x51, char: R, offset: 0x1300 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x7f, 0xf8, /* .############... */
+    0x7f, 0xf0, /* .###########.... */
+    0x7e, 0x00, /* .######......... */
+    0x77, 0x00, /* .###.###........ */
+    0x73, 0x80, /* .###..###....... */
+    0x71, 0xc0, /* .###...###...... */
+    0x70, 0xe0, /* .###....###..... */
+    0x70, 0x70, /* .###.....###.... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x52, char: S, offset: 0x1340 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x78, 0x00, /* .####........... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x1f, 0xf8, /* ...##########... */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x53, char: T, offset: 0x1380 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x54, char: U, offset: 0x13c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x55, char: V, offset: 0x1400 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x07, 0xc0, /* .....#####...... */
+    0x07, 0xc0, /* .....#####...... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x56, char: W, offset: 0x1440 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x71, 0x8e, /* .###...##...###. */
+    0x73, 0xce, /* .###..####..###. */
+    0x73, 0xce, /* .###..####..###. */
+    0x77, 0xee, /* .###.######.###. */
+    0x7e, 0x7e, /* .######..######. */
+    0x7e, 0x7e, /* .######..######. */
+    0x7c, 0x3e, /* .#####....#####. */
+    0x78, 0x1e, /* .####......####. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x57, char: X, offset: 0x1480 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x07, 0xc0, /* .....#####...... */
+    0x07, 0xc0, /* .....#####...... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x58, char: Y, offset: 0x14c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x07, 0xc0, /* .....#####...... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x59, char: Z, offset: 0x1500 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x38, 0x00, /* ..###........... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x5a, char: [, offset: 0x1540 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xf0, /* ....########.... */
+    0x0f, 0xf0, /* ....########.... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0f, 0xf0, /* ....########.... */
+    0x0f, 0xf0, /* ....########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x5b, char: \x5c, offset: 0x1580 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x01, 0xc0, /* .......###...... */
+    0x01, 0xc0, /* .......###...... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0xe0, /* ........###..... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x5c, char: ], offset: 0x15c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xf0, /* ....########.... */
+    0x0f, 0xf0, /* ....########.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x0f, 0xf0, /* ....########.... */
+    0x0f, 0xf0, /* ....########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x5d, char: ^, offset: 0x1600 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x38, 0x38, /* ..###.....###... */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x5e, char: _, offset: 0x1640 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x5f, char: `, offset: 0x1680 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x60, char: a, offset: 0x16c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xf0, /* ..##########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x61, char: b, offset: 0x1700 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x7f, 0xf8, /* .############... */
+    0x7f, 0xf0, /* .###########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x62, char: c, offset: 0x1740 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x63, char: d, offset: 0x1780 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x64, char: e, offset: 0x17c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xf8, /* ...##########... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x65, char: f, offset: 0x1800 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0xfe, /* ........#######. */
+    0x01, 0xfe, /* .......########. */
+    0x03, 0xc0, /* ......####...... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf8, /* ..###########... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x66, char: g, offset: 0x1840 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xfc, /* ...###########.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x3c, /* ..........####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x67, char: h, offset: 0x1880 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x68, char: i, offset: 0x18c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0x80, /* ....#####....... */
+    0x0f, 0x80, /* ....#####....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x69, char: j, offset: 0x1900 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0xf8, /* ........#####... */
+    0x00, 0xf8, /* ........#####... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x3c, 0x78, /* ..####...####... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x6a, char: k, offset: 0x1940 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x70, /* ..###....###.... */
+    0x38, 0xe0, /* ..###...###..... */
+    0x39, 0xc0, /* ..###..###...... */
+    0x3b, 0x80, /* ..###.###....... */
+    0x3f, 0x00, /* ..######........ */
+    0x3f, 0x00, /* ..######........ */
+    0x3b, 0x80, /* ..###.###....... */
+    0x39, 0xc0, /* ..###..###...... */
+    0x38, 0xe0, /* ..###...###..... */
+    0x38, 0x70, /* ..###....###.... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x1c, /* ..###......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x6b, char: l, offset: 0x1980 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0x80, /* ....#####....... */
+    0x0f, 0x80, /* ....#####....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x6c, char: m, offset: 0x19c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x73, 0xbc, /* .###..###.####.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x6d, char: n, offset: 0x1a00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x6e, char: o, offset: 0x1a40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x6f, char: p, offset: 0x1a80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x7f, 0xf8, /* .############... */
+    0x7f, 0xf0, /* .###########.... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x70, char: q, offset: 0x1ac0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xfc, /* ...###########.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x71, char: r, offset: 0x1b00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x73, 0xfc, /* .###..########.. */
+    0x77, 0xfc, /* .###.#########.. */
+    0x7e, 0x00, /* .######......... */
+    0x7c, 0x00, /* .#####.......... */
+    0x78, 0x00, /* .####........... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x72, char: s, offset: 0x1b40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x78, 0x00, /* .####........... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x1f, 0xf8, /* ...##########... */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x73, char: t, offset: 0x1b80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf0, /* .###########.... */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x80, /* .....####....... */
+    0x03, 0xfc, /* ......########.. */
+    0x01, 0xfc, /* .......#######.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x74, char: u, offset: 0x1bc0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x75, char: v, offset: 0x1c00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x07, 0xc0, /* .....#####...... */
+    0x07, 0xc0, /* .....#####...... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x76, char: w, offset: 0x1c40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x7b, 0xbc, /* .####.###.####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x77, char: x, offset: 0x1c80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x38, 0x38, /* ..###.....###... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x38, 0x38, /* ..###.....###... */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x78, char: y, offset: 0x1cc0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x3c, /* ..........####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x79, char: z, offset: 0x1d00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x38, 0x00, /* ..###........... */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x7a, char: {, offset: 0x1d40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x01, 0xf0, /* .......#####.... */
+    0x03, 0xf0, /* ......######.... */
+    0x07, 0x80, /* .....####....... */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x3e, 0x00, /* ..#####......... */
+    0x3e, 0x00, /* ..#####......... */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x00, /* .....###........ */
+    0x07, 0x80, /* .....####....... */
+    0x03, 0xf0, /* ......######.... */
+    0x01, 0xf0, /* .......#####.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x7b, char: |, offset: 0x1d80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x7c, char: }, offset: 0x1dc0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3e, 0x00, /* ..#####......... */
+    0x3f, 0x00, /* ..######........ */
+    0x07, 0x80, /* .....####....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x01, 0xf0, /* .......#####.... */
+    0x01, 0xf0, /* .......#####.... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x80, /* .....####....... */
+    0x3f, 0x00, /* ..######........ */
+    0x3e, 0x00, /* ..#####......... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x7d, char: ~, offset: 0x1e00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1e, 0x1c, /* ...####....###.. */
+    0x3f, 0x1c, /* ..######...###.. */
+    0x77, 0x9c, /* .###.####..###.. */
+    0x73, 0xdc, /* .###..####.###.. */
+    0x71, 0xf8, /* .###...######... */
+    0x70, 0xf0, /* .###....####.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xa0, char: \xa1, offset: 0x1e40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xa1, char: \xa2, offset: 0x1e80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x7b, 0xbc, /* .####.###.####.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x80, /* .###..###....... */
+    0x73, 0x80, /* .###..###....... */
+    0x73, 0x80, /* .###..###....... */
+    0x73, 0x80, /* .###..###....... */
+    0x73, 0x80, /* .###..###....... */
+    0x73, 0x80, /* .###..###....... */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x7b, 0xbc, /* .####.###.####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xa3, char: \xa4, offset: 0x1ec0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x38, 0x38, /* ..###.....###... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x38, 0x38, /* ..###.....###... */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xa4, char: \xa5, offset: 0x1f00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x07, 0xc0, /* .....#####...... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf8, /* ..###########... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf8, /* ..###########... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xa5, char: \xa6, offset: 0x1f40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xa6, char: \xa7, offset: 0x1f80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x07, 0xe0, /* .....######..... */
+    0x0f, 0xf0, /* ....########.... */
+    0x1e, 0x78, /* ...####..####... */
+    0x1c, 0x38, /* ...###....###... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1e, 0x00, /* ...####......... */
+    0x0f, 0xc0, /* ....######...... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x1c, 0xf0, /* ...###..####.... */
+    0x1c, 0x78, /* ...###...####... */
+    0x1c, 0x38, /* ...###....###... */
+    0x1c, 0x38, /* ...###....###... */
+    0x1c, 0x38, /* ...###....###... */
+    0x1e, 0x38, /* ...####...###... */
+    0x0f, 0x38, /* ....####..###... */
+    0x07, 0xf0, /* .....#######.... */
+    0x03, 0xf0, /* ......######.... */
+    0x00, 0x78, /* .........####... */
+    0x00, 0x38, /* ..........###... */
+    0x1c, 0x38, /* ...###....###... */
+    0x1e, 0x78, /* ...####..####... */
+    0x0f, 0xf0, /* ....########.... */
+    0x07, 0xe0, /* .....######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xa7, char: \xa8, offset: 0x1fc0 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xa8, char: \xa9, offset: 0x2000 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf8, /* ...##########... */
+    0x3f, 0xfc, /* ..############.. */
+    0x70, 0x0e, /* .###........###. */
+    0x67, 0xe6, /* .##..######..##. */
+    0x6f, 0xf6, /* .##.########.##. */
+    0x6e, 0x76, /* .##.###..###.##. */
+    0x6e, 0x06, /* .##.###......##. */
+    0x6e, 0x06, /* .##.###......##. */
+    0x6e, 0x06, /* .##.###......##. */
+    0x6e, 0x06, /* .##.###......##. */
+    0x6e, 0x76, /* .##.###..###.##. */
+    0x6f, 0xf6, /* .##.########.##. */
+    0x67, 0xe6, /* .##..######..##. */
+    0x70, 0x0e, /* .###........###. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xf8, /* ...##########... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xa9, char: \xaa, offset: 0x2040 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xe0, /* ...########..... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x0f, 0xf8, /* ....#########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x1f, 0xf8, /* ...##########... */
+    0x0f, 0xf8, /* ....#########... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf8, /* ..###########... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xaa, char: \xab, offset: 0x2080 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x01, 0xce, /* .......###..###. */
+    0x03, 0x9c, /* ......###..###.. */
+    0x07, 0x38, /* .....###..###... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x1c, 0xe0, /* ...###..###..... */
+    0x39, 0xc0, /* ..###..###...... */
+    0x73, 0x80, /* .###..###....... */
+    0x73, 0x80, /* .###..###....... */
+    0x39, 0xc0, /* ..###..###...... */
+    0x1c, 0xe0, /* ...###..###..... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x07, 0x38, /* .....###..###... */
+    0x03, 0x9c, /* ......###..###.. */
+    0x01, 0xce, /* .......###..###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xab, char: \xac, offset: 0x20c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xac, char: \xad, offset: 0x2100 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf8, /* ..###########... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xad, char: \xae, offset: 0x2140 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf8, /* ...##########... */
+    0x3f, 0xfc, /* ..############.. */
+    0x70, 0x0e, /* .###........###. */
+    0x6f, 0xe6, /* .##.#######..##. */
+    0x6f, 0xf6, /* .##.########.##. */
+    0x6e, 0x76, /* .##.###..###.##. */
+    0x6e, 0x76, /* .##.###..###.##. */
+    0x6e, 0x76, /* .##.###..###.##. */
+    0x6f, 0xe6, /* .##.#######..##. */
+    0x6f, 0xc6, /* .##.######...##. */
+    0x6f, 0xc6, /* .##.######...##. */
+    0x6e, 0xe6, /* .##.###.###..##. */
+    0x6e, 0x76, /* .##.###..###.##. */
+    0x70, 0x0e, /* .###........###. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xf8, /* ...##########... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xae, char: \xaf, offset: 0x2180 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xb1, char: \xb2, offset: 0x21c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xe0, /* ....#######..... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xb2, char: \xb3, offset: 0x2200 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xe0, /* ....#######..... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x70, /* .........###.... */
+    0x03, 0xe0, /* ......#####..... */
+    0x03, 0xe0, /* ......#####..... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xb3, char: \xb4, offset: 0x2240 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xb4, char: \xb5, offset: 0x2280 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x7c, /* .###.....#####.. */
+    0x70, 0xfc, /* .###....######.. */
+    0x7f, 0xdc, /* .#########.###.. */
+    0x7f, 0x9c, /* .########..###.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xb5, char: \xb6, offset: 0x22c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xfe, /* ...############. */
+    0x3f, 0xfe, /* ..#############. */
+    0x79, 0xce, /* .####..###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x79, 0xce, /* .####..###..###. */
+    0x3f, 0xce, /* ..########..###. */
+    0x1f, 0xce, /* ...#######..###. */
+    0x01, 0xce, /* .......###..###. */
+    0x01, 0xce, /* .......###..###. */
+    0x01, 0xce, /* .......###..###. */
+    0x01, 0xce, /* .......###..###. */
+    0x01, 0xce, /* .......###..###. */
+    0x01, 0xce, /* .......###..###. */
+    0x01, 0xce, /* .......###..###. */
+    0x01, 0xce, /* .......###..###. */
+    0x01, 0xce, /* .......###..###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xb7, char: \xb8, offset: 0x2300 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xb8, char: \xb9, offset: 0x2340 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x80, /* .....####....... */
+    0x0f, 0x80, /* ....#####....... */
+    0x0f, 0x80, /* ....#####....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xb9, char: \xba, offset: 0x2380 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xe0, /* ....#######..... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf8, /* ..###########... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xba, char: \xbb, offset: 0x23c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x73, 0x80, /* .###..###....... */
+    0x39, 0xc0, /* ..###..###...... */
+    0x1c, 0xe0, /* ...###..###..... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x07, 0x38, /* .....###..###... */
+    0x03, 0x9c, /* ......###..###.. */
+    0x01, 0xce, /* .......###..###. */
+    0x01, 0xce, /* .......###..###. */
+    0x03, 0x9c, /* ......###..###.. */
+    0x07, 0x38, /* .....###..###... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x1c, 0xe0, /* ...###..###..... */
+    0x39, 0xc0, /* ..###..###...... */
+    0x73, 0x80, /* .###..###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xbb, char: \xbc, offset: 0x2400 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0e, 0x00, /* ....###......... */
+    0x1e, 0x00, /* ...####......... */
+    0x3e, 0x00, /* ..#####......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x06, /* ....###......##. */
+    0x0e, 0x0e, /* ....###.....###. */
+    0x0e, 0x1c, /* ....###....###.. */
+    0x0e, 0x38, /* ....###...###... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xce, /* .......###..###. */
+    0x03, 0x9e, /* ......###..####. */
+    0x07, 0x3e, /* .....###..#####. */
+    0x0e, 0x7e, /* ....###..######. */
+    0x1c, 0xee, /* ...###..###.###. */
+    0x39, 0xce, /* ..###..###..###. */
+    0x73, 0xfe, /* .###..#########. */
+    0x63, 0xfe, /* .##...#########. */
+    0x00, 0x0e, /* ............###. */
+    0x00, 0x0e, /* ............###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xbc, char: \xbd, offset: 0x2440 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x3c, 0x00, /* ..####.......... */
+    0x7c, 0x06, /* .#####.......##. */
+    0x1c, 0x0e, /* ...###......###. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x38, /* ...###....###... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0xe0, /* ...###..###..... */
+    0x1d, 0xc0, /* ...###.###...... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0xfc, /* ....###.######.. */
+    0x1d, 0xfe, /* ...###.########. */
+    0x39, 0xce, /* ..###..###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x60, 0x1c, /* .##........###.. */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xfe, /* ........#######. */
+    0x01, 0xfe, /* .......########. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xbd, char: \xbe, offset: 0x2480 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0x80, /* ..#######....... */
+    0x7f, 0xc0, /* .#########...... */
+    0x71, 0xc0, /* .###...###...... */
+    0x0f, 0x80, /* ....#####....... */
+    0x0f, 0x80, /* ....#####....... */
+    0x01, 0xc6, /* .......###...##. */
+    0x71, 0xce, /* .###...###..###. */
+    0x7f, 0xdc, /* .#########.###.. */
+    0x3f, 0xb8, /* ..#######.###... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xee, /* ........###.###. */
+    0x01, 0xde, /* .......###.####. */
+    0x03, 0xbe, /* ......###.#####. */
+    0x07, 0x7e, /* .....###.######. */
+    0x0e, 0xee, /* ....###.###.###. */
+    0x1d, 0xce, /* ...###.###..###. */
+    0x3b, 0xfe, /* ..###.#########. */
+    0x73, 0xfe, /* .###..#########. */
+    0x60, 0x0e, /* .##.........###. */
+    0x00, 0x0e, /* ............###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xbe, char: \xbf, offset: 0x24c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x38, 0x00, /* ..###........... */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xbf, char: \xc0, offset: 0x2500 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc0, char: \xc1, offset: 0x2540 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc1, char: \xc2, offset: 0x2580 */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc2, char: \xc3, offset: 0x25c0 */
+    0x00, 0x00, /* ................ */
+    0x1f, 0x38, /* ...#####..###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x39, 0xf0, /* ..###..#####.... */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc3, char: \xc4, offset: 0x2600 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc4, char: \xc5, offset: 0x2640 */
+    0x00, 0x00, /* ................ */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc5, char: \xc6, offset: 0x2680 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xfe, /* ..#############. */
+    0x7f, 0xfe, /* .##############. */
+    0xf1, 0xc0, /* ####...###...... */
+    0xe1, 0xc0, /* ###....###...... */
+    0xe1, 0xc0, /* ###....###...... */
+    0xe1, 0xc0, /* ###....###...... */
+    0xe1, 0xc0, /* ###....###...... */
+    0xe1, 0xc0, /* ###....###...... */
+    0xe1, 0xc0, /* ###....###...... */
+    0xff, 0xfe, /* ###############. */
+    0xff, 0xfe, /* ###############. */
+    0xe1, 0xc0, /* ###....###...... */
+    0xe1, 0xc0, /* ###....###...... */
+    0xe1, 0xc0, /* ###....###...... */
+    0xe1, 0xc0, /* ###....###...... */
+    0xe1, 0xc0, /* ###....###...... */
+    0xe1, 0xc0, /* ###....###...... */
+    0xe1, 0xc0, /* ###....###...... */
+    0xe1, 0xfe, /* ###....########. */
+    0xe1, 0xfe, /* ###....########. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc6, char: \xc7, offset: 0x26c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc7, char: \xc8, offset: 0x2700 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xe0, /* .##########..... */
+    0x7f, 0xe0, /* .##########..... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc8, char: \xc9, offset: 0x2740 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xe0, /* .##########..... */
+    0x7f, 0xe0, /* .##########..... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc9, char: \xca, offset: 0x2780 */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xe0, /* .##########..... */
+    0x7f, 0xe0, /* .##########..... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xca, char: \xcb, offset: 0x27c0 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xe0, /* .##########..... */
+    0x7f, 0xe0, /* .##########..... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xcb, char: \xcc, offset: 0x2800 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xcc, char: \xcd, offset: 0x2840 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xcd, char: \xce, offset: 0x2880 */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xce, char: \xcf, offset: 0x28c0 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xcf, char: \xd0, offset: 0x2900 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xc0, /* .#########...... */
+    0x7f, 0xf0, /* .###########.... */
+    0x70, 0x78, /* .###.....####... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0xff, 0x9c, /* #########..###.. */
+    0xff, 0x9c, /* #########..###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x78, /* .###.....####... */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xc0, /* .#########...... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd0, char: \xd1, offset: 0x2940 */
+    0x00, 0x00, /* ................ */
+    0x1f, 0x38, /* ...#####..###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x39, 0xf0, /* ..###..#####.... */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x7c, 0x1c, /* .#####.....###.. */
+    0x7e, 0x1c, /* .######....###.. */
+    0x77, 0x1c, /* .###.###...###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x71, 0xdc, /* .###...###.###.. */
+    0x70, 0xfc, /* .###....######.. */
+    0x70, 0x7c, /* .###.....#####.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd1, char: \xd2, offset: 0x2980 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd2, char: \xd3, offset: 0x29c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd3, char: \xd4, offset: 0x2a00 */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd4, char: \xd5, offset: 0x2a40 */
+    0x00, 0x00, /* ................ */
+    0x1f, 0x38, /* ...#####..###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x39, 0xf0, /* ..###..#####.... */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd5, char: \xd6, offset: 0x2a80 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd6, char: \xd7, offset: 0x2ac0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x0e, /* .###........###. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x1c, 0x38, /* ...###....###... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x07, 0xe0, /* .....######..... */
+    0x03, 0xc0, /* ......####...... */
+    0x03, 0xc0, /* ......####...... */
+    0x07, 0xe0, /* .....######..... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x1c, 0x38, /* ...###....###... */
+    0x38, 0x1c, /* ..###......###.. */
+    0x70, 0x0e, /* .###........###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd7, char: \xd8, offset: 0x2b00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3e, /* .####.....#####. */
+    0x70, 0x1e, /* .###.......####. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x7c, /* .###.....#####.. */
+    0x70, 0xfc, /* .###....######.. */
+    0x71, 0xdc, /* .###...###.###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x77, 0x1c, /* .###.###...###.. */
+    0x7e, 0x1c, /* .######....###.. */
+    0x7c, 0x1c, /* .#####.....###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0xf0, 0x1c, /* ####.......###.. */
+    0xf0, 0x1c, /* ####.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd8, char: \xd9, offset: 0x2b40 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd9, char: \xda, offset: 0x2b80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xda, char: \xdb, offset: 0x2bc0 */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xdb, char: \xdc, offset: 0x2c00 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xdc, char: \xdd, offset: 0x2c40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x07, 0xc0, /* .....#####...... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xdd, char: \xde, offset: 0x2c80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x7f, 0xf8, /* .############... */
+    0x7f, 0xf0, /* .###########.... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xde, char: \xdf, offset: 0x2cc0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xe0, /* ..#########..... */
+    0x7f, 0xf0, /* .###########.... */
+    0x70, 0x78, /* .###.....####... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x70, /* .###.....###.... */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf0, /* .###########.... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x7c, 0x3c, /* .#####....####.. */
+    0x77, 0xf8, /* .###.########... */
+    0x73, 0xf0, /* .###..######.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xdf, char: \xe0, offset: 0x2d00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xf0, /* ..##########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe0, char: \xe1, offset: 0x2d40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xf0, /* ..##########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe1, char: \xe2, offset: 0x2d80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xf0, /* ..##########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe2, char: \xe3, offset: 0x2dc0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0x38, /* ...#####..###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x39, 0xf0, /* ..###..#####.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xf0, /* ..##########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe3, char: \xe4, offset: 0x2e00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xf0, /* ..##########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe4, char: \xe5, offset: 0x2e40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xf0, /* ..##########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe5, char: \xe6, offset: 0x2e80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xf8, /* .############... */
+    0x7f, 0xfc, /* .#############.. */
+    0x03, 0x9e, /* ......###..####. */
+    0x03, 0x8e, /* ......###...###. */
+    0x03, 0x8e, /* ......###...###. */
+    0x3f, 0x8e, /* ..#######...###. */
+    0x7f, 0xfe, /* .##############. */
+    0xf3, 0xfe, /* ####..#########. */
+    0xe3, 0x80, /* ###...###....... */
+    0xe3, 0x80, /* ###...###....... */
+    0xe3, 0x80, /* ###...###....... */
+    0xf3, 0xce, /* ####..####..###. */
+    0x7f, 0xfe, /* .##############. */
+    0x3e, 0xfc, /* ..#####.######.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe6, char: \xe7, offset: 0x2ec0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0x00, /* .....###........ */
+    0x0e, 0x00, /* ....###......... */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe7, char: \xe8, offset: 0x2f00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xf8, /* ...##########... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe8, char: \xe9, offset: 0x2f40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xf8, /* ...##########... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe9, char: \xea, offset: 0x2f80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xf8, /* ...##########... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xea, char: \xeb, offset: 0x2fc0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xf8, /* ...##########... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xeb, char: \xec, offset: 0x3000 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0x80, /* ....#####....... */
+    0x0f, 0x80, /* ....#####....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xec, char: \xed, offset: 0x3040 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0x80, /* ....#####....... */
+    0x0f, 0x80, /* ....#####....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xed, char: \xee, offset: 0x3080 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0x80, /* ....#####....... */
+    0x0f, 0x80, /* ....#####....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xee, char: \xef, offset: 0x30c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0x80, /* ....#####....... */
+    0x0f, 0x80, /* ....#####....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xef, char: \xf0, offset: 0x3100 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1d, 0xc0, /* ...###.###...... */
+    0x0f, 0x80, /* ....#####....... */
+    0x1f, 0x00, /* ...#####........ */
+    0x3b, 0x80, /* ..###.###....... */
+    0x01, 0xc0, /* .......###...... */
+    0x00, 0xe0, /* ........###..... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf0, char: \xf1, offset: 0x3140 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0x38, /* ...#####..###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x39, 0xf0, /* ..###..#####.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf1, char: \xf2, offset: 0x3180 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf2, char: \xf3, offset: 0x31c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf3, char: \xf4, offset: 0x3200 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf4, char: \xf5, offset: 0x3240 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0x38, /* ...#####..###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x39, 0xf0, /* ..###..#####.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf5, char: \xf6, offset: 0x3280 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf6, char: \xf7, offset: 0x32c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf7, char: \xf8, offset: 0x3300 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf6, /* ...#########.##. */
+    0x3f, 0xfe, /* ..#############. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x7c, /* .###.....#####.. */
+    0x70, 0xfc, /* .###....######.. */
+    0x71, 0xdc, /* .###...###.###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x77, 0x1c, /* .###.###...###.. */
+    0x7e, 0x1c, /* .######....###.. */
+    0x7c, 0x1c, /* .#####.....###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0xff, 0xf8, /* #############... */
+    0xdf, 0xf0, /* ##.#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf8, char: \xf9, offset: 0x3340 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x00, /* ...###.......... */
+    0x0e, 0x00, /* ....###......... */
+    0x07, 0x00, /* .....###........ */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf9, char: \xfa, offset: 0x3380 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xfa, char: \xfb, offset: 0x33c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x07, 0xc0, /* .....#####...... */
+    0x0e, 0xe0, /* ....###.###..... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xfb, char: \xfc, offset: 0x3400 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xfc, char: \xfd, offset: 0x3440 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0xe0, /* ........###..... */
+    0x01, 0xc0, /* .......###...... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x3c, /* ..........####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xfd, char: \xfe, offset: 0x3480 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x7f, 0xf8, /* .############... */
+    0x7f, 0xf0, /* .###########.... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xfe, char: \xff, offset: 0x34c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x3c, /* ..........####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x8a, char: \x8b, offset: 0x3500 */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x8b, char: \x8c, offset: 0x3540 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+
+    /* Index: 0x8c, char: \x8d, offset: 0x3580 */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+
+    /* Index: 0x8d, char: \x8e, offset: 0x35c0 */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+    0xff, 0x00, /* ########........ */
+
+    /* Index: 0x8e, char: \x8f, offset: 0x3600 */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+    0x00, 0xff, /* ........######## */
+
+    /* Index: 0x8f, char: \x90, offset: 0x3640 */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x91, char: \x92, offset: 0x3680 */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+    0xff, 0xff, /* ################ */
+    0xaa, 0xaa, /* #.#.#.#.#.#.#.#. */
+
+    /* Index: 0x92, char: \x93, offset: 0x36c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x01, 0xf8, /* .......######... */
+    0x03, 0xfc, /* ......########.. */
+    0x03, 0x9c, /* ......###..###.. */
+    0x03, 0x9c, /* ......###..###.. */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0x93, char: \x94, offset: 0x3700 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf8, /* ...##########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x94, char: \x95, offset: 0x3740 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0xc0, /* ......####...... */
+    0x07, 0xe0, /* .....######..... */
+    0x07, 0xe0, /* .....######..... */
+    0x07, 0xe0, /* .....######..... */
+    0x07, 0xe0, /* .....######..... */
+    0x03, 0xc0, /* ......####...... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x95, char: \x96, offset: 0x3780 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x3e, /* ..........#####. */
+    0x00, 0x3e, /* ..........#####. */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x00, 0x38, /* ..........###... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x38, /* .###......###... */
+    0x78, 0x38, /* .####.....###... */
+    0x3c, 0x38, /* ..####....###... */
+    0x1e, 0x38, /* ...####...###... */
+    0x0f, 0x38, /* ....####..###... */
+    0x07, 0xb8, /* .....####.###... */
+    0x03, 0xf8, /* ......#######... */
+    0x01, 0xf8, /* .......######... */
+    0x00, 0xf8, /* ........#####... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x96, char: \x97, offset: 0x37c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3e, 0x1c, /* ..#####....###.. */
+    0x7f, 0xbc, /* .########.####.. */
+    0x7b, 0xfc, /* .####.########.. */
+    0x70, 0xf8, /* .###....#####... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3e, 0x1c, /* ..#####....###.. */
+    0x7f, 0xbc, /* .########.####.. */
+    0x7b, 0xfc, /* .####.########.. */
+    0x70, 0xf8, /* .###....#####... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x9a, char: \x9b, offset: 0x3800 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x73, 0x80, /* .###..###....... */
+    0x73, 0x80, /* .###..###....... */
+    0x7f, 0x80, /* .########....... */
+    0x3f, 0x00, /* ..######........ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0x9f, char: \xa0, offset: 0x3840 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xa0, char: \xa1, offset: 0x3880 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xa1, char: \xa2, offset: 0x38c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0xa3, char: \xa4, offset: 0x3900 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xff, /* ....############ */
+    0x0f, 0xff, /* ....############ */
+    0x0f, 0xff, /* ....############ */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xa4, char: \xa5, offset: 0x3940 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xff, /* ....############ */
+    0x0f, 0xff, /* ....############ */
+    0x0f, 0xff, /* ....############ */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xa5, char: \xa6, offset: 0x3980 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0xa6, char: \xa7, offset: 0x39c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xf0, /* ############.... */
+    0xff, 0xf0, /* ############.... */
+    0xff, 0xf0, /* ############.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xa7, char: \xa8, offset: 0x3a00 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xf0, /* ############.... */
+    0xff, 0xf0, /* ############.... */
+    0xff, 0xf0, /* ############.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xa8, char: \xa9, offset: 0x3a40 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xa9, char: \xaa, offset: 0x3a80 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0f, 0xff, /* ....############ */
+    0x0f, 0xff, /* ....############ */
+    0x0f, 0xff, /* ....############ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xaa, char: \xab, offset: 0x3ac0 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0f, 0xff, /* ....############ */
+    0x0f, 0xff, /* ....############ */
+    0x0f, 0xff, /* ....############ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xab, char: \xac, offset: 0x3b00 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xac, char: \xad, offset: 0x3b40 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0xff, 0xf0, /* ############.... */
+    0xff, 0xf0, /* ############.... */
+    0xff, 0xf0, /* ############.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xad, char: \xae, offset: 0x3b80 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0xff, 0xf0, /* ############.... */
+    0xff, 0xf0, /* ############.... */
+    0xff, 0xf0, /* ############.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xae, char: \xaf, offset: 0x3bc0 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0xff, /* ......########## */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0xaf, char: \xb0, offset: 0x3c00 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xb0, char: \xb1, offset: 0x3c40 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x00, /* ....###......... */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x7f, /* ....###..####### */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xb1, char: \xb2, offset: 0x3c80 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0xff, 0x80, /* #########....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0xb3, char: \xb4, offset: 0x3cc0 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xb4, char: \xb5, offset: 0x3d00 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0x00, 0x70, /* .........###.... */
+    0x00, 0x70, /* .........###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0xfe, 0x70, /* #######..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xb5, char: \xb6, offset: 0x3d40 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0xb6, char: \xb7, offset: 0x3d80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xb7, char: \xb8, offset: 0x3dc0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xfe, 0x7f, /* #######..####### */
+    0xfe, 0x7f, /* #######..####### */
+    0xfe, 0x7f, /* #######..####### */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xb8, char: \xb9, offset: 0x3e00 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xb9, char: \xba, offset: 0x3e40 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xba, char: \xbb, offset: 0x3e80 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0xfe, 0x7f, /* #######..####### */
+    0xfe, 0x7f, /* #######..####### */
+    0xfe, 0x7f, /* #######..####### */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xbb, char: \xbc, offset: 0x3ec0 */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+
+    /* Index: 0xbc, char: \xbd, offset: 0x3f00 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0xff, 0xff, /* ################ */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xbd, char: \xbe, offset: 0x3f40 */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0xfe, 0x7f, /* #######..####### */
+    0xfe, 0x7f, /* #######..####### */
+    0xfe, 0x7f, /* #######..####### */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xfe, 0x7f, /* #######..####### */
+    0xfe, 0x7f, /* #######..####### */
+    0xfe, 0x7f, /* #######..####### */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+    0x0e, 0x70, /* ....###..###.... */
+
+    /* Index: 0xbf, char: \xc0, offset: 0x3f80 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0xf8, /* .###....#####... */
+    0x71, 0xfc, /* .###...#######.. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x7f, 0x8e, /* .########...###. */
+    0x7f, 0x8e, /* .########...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x71, 0xfc, /* .###...#######.. */
+    0x70, 0xf8, /* .###....#####... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc1, char: \xc2, offset: 0x3fc0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x78, 0x00, /* .####........... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x7f, 0xf8, /* .############... */
+    0x7f, 0xf0, /* .###########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc2, char: \xc3, offset: 0x4000 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfe, /* ..#############. */
+    0x1f, 0xff, /* ...############# */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc5, char: \xc6, offset: 0x4040 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x7b, 0xbc, /* .####.###.####.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x7b, 0xbc, /* .####.###.####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc6, char: \xc7, offset: 0x4080 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xc9, char: \xca, offset: 0x40c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xca, char: \xcb, offset: 0x4100 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x70, /* ..###....###.... */
+    0x38, 0xe0, /* ..###...###..... */
+    0x39, 0xc0, /* ..###..###...... */
+    0x3b, 0x80, /* ..###.###....... */
+    0x3f, 0x00, /* ..######........ */
+    0x3f, 0x00, /* ..######........ */
+    0x3b, 0x80, /* ..###.###....... */
+    0x39, 0xc0, /* ..###..###...... */
+    0x38, 0xe0, /* ..###...###..... */
+    0x38, 0x70, /* ..###....###.... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x1c, /* ..###......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xcb, char: \xcc, offset: 0x4140 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x07, 0xfc, /* .....#########.. */
+    0x0f, 0xfc, /* ....##########.. */
+    0x1e, 0x1c, /* ...####....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xcc, char: \xcd, offset: 0x4180 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x60, 0x06, /* .##..........##. */
+    0x70, 0x0e, /* .###........###. */
+    0x78, 0x1e, /* .####......####. */
+    0x7c, 0x3e, /* .#####....#####. */
+    0x7e, 0x7e, /* .######..######. */
+    0x77, 0xee, /* .###.######.###. */
+    0x73, 0xce, /* .###..####..###. */
+    0x71, 0x8e, /* .###...##...###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xcd, char: \xce, offset: 0x41c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd0, char: \xd1, offset: 0x4200 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xfc, /* ...###########.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x01, 0xdc, /* .......###.###.. */
+    0x03, 0x9c, /* ......###..###.. */
+    0x07, 0x1c, /* .....###...###.. */
+    0x0e, 0x1c, /* ....###....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd3, char: \xd4, offset: 0x4240 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd5, char: \xd6, offset: 0x4280 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd6, char: \xd7, offset: 0x42c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x3f, 0xc0, /* ..########...... */
+    0x7f, 0xe0, /* .##########..... */
+    0x70, 0xf0, /* .###....####.... */
+    0x70, 0x70, /* .###.....###.... */
+    0x70, 0x70, /* .###.....###.... */
+    0x70, 0x70, /* .###.....###.... */
+    0x70, 0x70, /* .###.....###.... */
+    0x70, 0xe0, /* .###....###..... */
+    0x7f, 0xe0, /* .##########..... */
+    0x7f, 0xf0, /* .###########.... */
+    0x70, 0x38, /* .###......###... */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x7f, 0xf8, /* .############... */
+    0x7f, 0xf0, /* .###########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd7, char: \xd8, offset: 0x4300 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x3f, 0xe0, /* ..#########..... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x38, 0x78, /* ..###....####... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x78, /* ..###....####... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x3f, 0xe0, /* ..#########..... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd8, char: \xd9, offset: 0x4340 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x7f, 0x0e, /* .#######....###. */
+    0x7f, 0x8e, /* .########...###. */
+    0x73, 0xce, /* .###..####..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x73, 0xce, /* .###..####..###. */
+    0x7f, 0x8e, /* .########...###. */
+    0x7f, 0x0e, /* .#######....###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xd9, char: \xda, offset: 0x4380 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x3c, /* ..........####.. */
+    0x07, 0xf8, /* .....########... */
+    0x07, 0xf8, /* .....########... */
+    0x00, 0x3c, /* ..........####.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xda, char: \xdb, offset: 0x43c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x7b, 0x9c, /* .####.###..###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xdb, char: \xdc, offset: 0x4400 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x07, 0xfc, /* .....#########.. */
+    0x07, 0xfc, /* .....#########.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xdc, char: \xdd, offset: 0x4440 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x7b, 0x9c, /* .####.###..###.. */
+    0x3f, 0xfe, /* ..#############. */
+    0x1f, 0xff, /* ...############# */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xdd, char: \xde, offset: 0x4480 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xde, char: \xdf, offset: 0x44c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7c, 0x00, /* .#####.......... */
+    0x7c, 0x00, /* .#####.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1c, 0x00, /* ...###.......... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x1f, 0xf8, /* ...##########... */
+    0x1c, 0x3c, /* ...###....####.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x3c, /* ...###....####.. */
+    0x1f, 0xf8, /* ...##########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xdf, char: \xe0, offset: 0x4500 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0xf8, /* .###....#####... */
+    0x71, 0xfc, /* .###...#######.. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x7f, 0x8e, /* .########...###. */
+    0x7f, 0x8e, /* .########...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x73, 0x8e, /* .###..###...###. */
+    0x71, 0xfc, /* .###...#######.. */
+    0x70, 0xf8, /* .###....#####... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe1, char: \xe2, offset: 0x4540 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xf8, /* .############... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x7f, 0xf0, /* .###########.... */
+    0x7f, 0xf8, /* .############... */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x7f, 0xf8, /* .############... */
+    0x7f, 0xf0, /* .###########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe2, char: \xe3, offset: 0x4580 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1e, /* .####......####. */
+    0x3f, 0xff, /* ..############## */
+    0x1f, 0xff, /* ...############# */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe3, char: \xe4, offset: 0x45c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x0f, 0xf8, /* ....#########... */
+    0x1f, 0xf8, /* ...##########... */
+    0x3c, 0x38, /* ..####....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x38, 0x38, /* ..###.....###... */
+    0x7f, 0xfc, /* .#############.. */
+    0xff, 0xfe, /* ###############. */
+    0xe0, 0x0e, /* ###.........###. */
+    0xe0, 0x0e, /* ###.........###. */
+    0xe0, 0x0e, /* ###.........###. */
+    0xe0, 0x0e, /* ###.........###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe5, char: \xe6, offset: 0x4600 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x7b, 0xbc, /* .####.###.####.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x7b, 0xbc, /* .####.###.####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x03, 0x80, /* ......###....... */
+    0x03, 0x80, /* ......###....... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe6, char: \xe7, offset: 0x4640 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x70, 0x00, /* .###............ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe8, char: \xe9, offset: 0x4680 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x7c, /* .###.....#####.. */
+    0x70, 0xfc, /* .###....######.. */
+    0x71, 0xdc, /* .###...###.###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x77, 0x1c, /* .###.###...###.. */
+    0x7e, 0x1c, /* .######....###.. */
+    0x7c, 0x1c, /* .#####.....###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xe9, char: \xea, offset: 0x46c0 */
+    0x00, 0x00, /* ................ */
+    0x1c, 0x70, /* ...###...###.... */
+    0x1c, 0x70, /* ...###...###.... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x07, 0xc0, /* .....#####...... */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x3c, /* .###......####.. */
+    0x70, 0x7c, /* .###.....#####.. */
+    0x70, 0xfc, /* .###....######.. */
+    0x71, 0xdc, /* .###...###.###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x77, 0x1c, /* .###.###...###.. */
+    0x7e, 0x1c, /* .######....###.. */
+    0x7c, 0x1c, /* .#####.....###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xeb, char: \xec, offset: 0x4700 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x07, 0xfc, /* .....#########.. */
+    0x0f, 0xfc, /* ....##########.. */
+    0x1e, 0x1c, /* ...####....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xef, char: \xf0, offset: 0x4740 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x7f, 0xfc, /* .#############.. */
+    0x7f, 0xfc, /* .#############.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf0, char: \xf1, offset: 0x4780 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xfc, /* ...###########.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0xfc, /* ........######.. */
+    0x01, 0xdc, /* .......###.###.. */
+    0x03, 0x9c, /* ......###..###.. */
+    0x07, 0x1c, /* .....###...###.. */
+    0x0e, 0x1c, /* ....###....###.. */
+    0x1c, 0x1c, /* ...###.....###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf4, char: \xf5, offset: 0x47c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x3c, /* ..........####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf5, char: \xf6, offset: 0x4800 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x0f, 0xe0, /* ....#######..... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3b, 0xb8, /* ..###.###.###... */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf7, char: \xf8, offset: 0x4840 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x38, 0x3c, /* ..###.....####.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x3c, /* ..###.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xf8, char: \xf9, offset: 0x4880 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x70, 0x0e, /* .###........###. */
+    0x7f, 0x0e, /* .#######....###. */
+    0x7f, 0x8e, /* .########...###. */
+    0x73, 0xce, /* .###..####..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x71, 0xce, /* .###...###..###. */
+    0x73, 0xce, /* .###..####..###. */
+    0x7f, 0x8e, /* .########...###. */
+    0x7f, 0x0e, /* .#######....###. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xfa, char: \xfb, offset: 0x48c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x7b, 0x9c, /* .####.###..###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xfb, char: \xfc, offset: 0x4900 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x1f, 0xf0, /* ...#########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x78, 0x3c, /* .####.....####.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x0f, 0xfc, /* ....##########.. */
+    0x0f, 0xfc, /* ....##########.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x3c, /* .####.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x1f, 0xf0, /* ...#########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xfc, char: \xfd, offset: 0x4940 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x73, 0x9c, /* .###..###..###.. */
+    0x7b, 0x9c, /* .####.###..###.. */
+    0x3f, 0xfe, /* ..#############. */
+    0x1f, 0xff, /* ...############# */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x07, /* .............### */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xfd, char: \xfe, offset: 0x4980 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x70, 0x1c, /* .###.......###.. */
+    0x78, 0x1c, /* .####......###.. */
+    0x3f, 0xfc, /* ..############.. */
+    0x1f, 0xfc, /* ...###########.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x1c, /* ...........###.. */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+
+    /* Index: 0xfe, char: \xff, offset: 0x49c0 */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0xf8, 0x00, /* #####........... */
+    0xf8, 0x00, /* #####........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x38, 0x00, /* ..###........... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x3f, 0xf8, /* ..###########... */
+    0x38, 0x3c, /* ..###.....####.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x1c, /* ..###......###.. */
+    0x38, 0x3c, /* ..###.....####.. */
+    0x3f, 0xf8, /* ..###########... */
+    0x3f, 0xf0, /* ..##########.... */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+    0x00, 0x00, /* ................ */
+};
+
+static const font_range_t _fonts_terminus_bold_16x32_iso8859_1_ranges[] = {
+    { 0x0001, 0x000f,    0 },
+    { 0x0010, 0x0010,    9 },
+    { 0x0011, 0x0011,    9 },
+    { 0x0012, 0x0012,   15 },
+    { 0x0013, 0x0013,    9 },
+    { 0x0014, 0x0014,    9 },
+    { 0x0015, 0x001f,   16 },
+    { 0x0020, 0x0020,    9 },
+    { 0x0021, 0x007e,   27 },
+    { 0x007f, 0x007f,    9 },
+    { 0x0080, 0x0080,    9 },
+    { 0x0081, 0x0081,    9 },
+    { 0x0082, 0x0082,    9 },
+    { 0x0083, 0x0083,    9 },
+    { 0x0084, 0x0084,    9 },
+    { 0x0085, 0x0085,    9 },
+    { 0x0086, 0x0086,    9 },
+    { 0x0087, 0x0087,    9 },
+    { 0x0088, 0x0088,    9 },
+    { 0x0089, 0x0089,    9 },
+    { 0x008a, 0x008a,    9 },
+    { 0x008b, 0x008b,    9 },
+    { 0x008c, 0x008c,    9 },
+    { 0x008d, 0x008d,    9 },
+    { 0x008e, 0x008e,    9 },
+    { 0x008f, 0x008f,    9 },
+    { 0x0090, 0x0090,    9 },
+    { 0x0091, 0x0091,    9 },
+    { 0x0092, 0x0092,    9 },
+    { 0x0093, 0x0093,    9 },
+    { 0x0094, 0x0094,    9 },
+    { 0x0095, 0x0095,    9 },
+    { 0x0096, 0x0096,    9 },
+    { 0x0097, 0x0097,    9 },
+    { 0x0098, 0x0098,    9 },
+    { 0x0099, 0x0099,    9 },
+    { 0x009a, 0x009a,    9 },
+    { 0x009b, 0x009b,    9 },
+    { 0x009c, 0x009c,    9 },
+    { 0x009d, 0x009d,    9 },
+    { 0x009e, 0x009e,    9 },
+    { 0x009f, 0x009f,    9 },
+    { 0x00a0, 0x00a0,    9 },
+    { 0x00a1, 0x00a2,  121 },
+    { 0x00a3, 0x00a3,   25 },
+    { 0x00a4, 0x00af,  123 },
+    { 0x00b0, 0x00b1,    6 },
+    { 0x00b2, 0x00b6,  135 },
+    { 0x00b7, 0x00b7,   26 },
+    { 0x00b8, 0x00ff,  140 },
+};
+
+const font_info_t _fonts_terminus_bold_16x32_iso8859_1_info =
+{
+    .height           = 32, /* Character height */
+    .c                = 0, /* C */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
+    .bitmap           = _fonts_terminus_bold_16x32_shared_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 16, /* Glyph width */
+    .stride           = 64, /* Bytes per glyph */
+    .ranges           = _fonts_terminus_bold_16x32_iso8859_1_ranges, /* Code point ranges */
+    .num_ranges       = 50, /* Number of ranges */
+};
+
+static const font_range_t _fonts_terminus_bold_16x32_koi8_r_ranges[] = {
+    { 0x0001, 0x000f,    0 },
+    { 0x0010, 0x0010,    9 },
+    { 0x0011, 0x0011,    9 },
+    { 0x0012, 0x0012,   15 },
+    { 0x0013, 0x0013,    9 },
+    { 0x0014, 0x0014,    9 },
+    { 0x0015, 0x001f,   16 },
+    { 0x0020, 0x0020,    9 },
+    { 0x0021, 0x007e,   27 },
+    { 0x007f, 0x007f,    9 },
+    { 0x0080, 0x0080,   15 },
+    { 0x0081, 0x0081,   20 },
+    { 0x0082, 0x0082,   12 },
+    { 0x0083, 0x0083,   11 },
+    { 0x0084, 0x0084,   13 },
+    { 0x0085, 0x0085,   10 },
+    { 0x0086, 0x0087,   16 },
+    { 0x0088, 0x0088,   19 },
+    { 0x0089, 0x0089,   18 },
+    { 0x008a, 0x008a,   14 },
+    { 0x008b, 0x0090,  212 },
+    { 0x0091, 0x0091,    1 },
+    { 0x0092, 0x0097,  218 },
+    { 0x0098, 0x0099,   21 },
+    { 0x009a, 0x009a,    9 },
+    { 0x009b, 0x009b,  224 },
+    { 0x009c, 0x009c,    6 },
+    { 0x009d, 0x009d,  135 },
+    { 0x009e, 0x009e,   26 },
+    { 0x009f, 0x009f,  203 },
+    { 0x00a0, 0x00a2,  225 },
+    { 0x00a3, 0x00a3,  191 },
+    { 0x00a4, 0x00b2,  228 },
+    { 0x00b3, 0x00b3,  159 },
+    { 0x00b4, 0x00be,  243 },
+    { 0x00bf, 0x00bf,  128 },
+    { 0x00c0, 0x00c0,  254 },
+    { 0x00c1, 0x00c1,   91 },
+    { 0x00c2, 0x00c3,  255 },
+    { 0x00c4, 0x00c4,   97 },
+    { 0x00c5, 0x00c5,   95 },
+    { 0x00c6, 0x00c7,  257 },
+    { 0x00c8, 0x00c8,  114 },
+    { 0x00c9, 0x00c9,  111 },
+    { 0x00ca, 0x00ce,  259 },
+    { 0x00cf, 0x00cf,  105 },
+    { 0x00d0, 0x00d0,   23 },
+    { 0x00d1, 0x00d1,  264 },
+    { 0x00d2, 0x00d2,  106 },
+    { 0x00d3, 0x00d3,   93 },
+    { 0x00d4, 0x00d4,  265 },
+    { 0x00d5, 0x00d5,  115 },
+    { 0x00d6, 0x00e0,  266 },
+    { 0x00e1, 0x00e1,   59 },
+    { 0x00e2, 0x00e4,  277 },
+    { 0x00e5, 0x00e5,   63 },
+    { 0x00e6, 0x00e7,  280 },
+    { 0x00e8, 0x00e8,   82 },
+    { 0x00e9, 0x00ea,  282 },
+    { 0x00eb, 0x00eb,   69 },
+    { 0x00ec, 0x00ec,  284 },
+    { 0x00ed, 0x00ed,   71 },
+    { 0x00ee, 0x00ee,   66 },
+    { 0x00ef, 0x00ef,   73 },
+    { 0x00f0, 0x00f1,  285 },
+    { 0x00f2, 0x00f2,   74 },
+    { 0x00f3, 0x00f3,   61 },
+    { 0x00f4, 0x00f4,   78 },
+    { 0x00f5, 0x00f6,  287 },
+    { 0x00f7, 0x00f7,   60 },
+    { 0x00f8, 0x00f9,  289 },
+    { 0x00fa, 0x00fa,   45 },
+    { 0x00fb, 0x00ff,  291 },
+};
+
+const font_info_t _fonts_terminus_bold_16x32_koi8_r_info =
+{
+    .height           = 32, /* Character height */
+    .c                = 0, /* C */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
+    .bitmap           = _fonts_terminus_bold_16x32_shared_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 16, /* Glyph width */
+    .stride           = 64, /* Bytes per glyph */
+    .ranges           = _fonts_terminus_bold_16x32_koi8_r_ranges, /* Code point ranges */
+    .num_ranges       = 73, /* Number of ranges */
+};
+
+#endif /* _EXTRAS_FONTS_FONT_TERMINUS_BOLD_16X32_SHARED_H_ */
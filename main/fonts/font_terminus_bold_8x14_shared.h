@@ -0,0 +1,4921 @@
+/**
+ * This file contains generated binary font data.
+ *
+ * Font:    terminus_bold_8x14_iso8859_1
+ * Height:  14
+ * Layout:  row-major, monospace
+ * 255 characters in 50 ranges (1..255)
+ * 43 glyphs identical to an earlier one, stored once
+ *
+ * Font:    terminus_bold_8x14_koi8_r
+ * Height:  14
+ * Layout:  row-major, monospace
+ * 255 characters in 73 ranges (1..255)
+ * 171 glyphs identical to an earlier one, stored once
+ *
+ * Copyright (c) 2015 Dimitar Toshkov Zhekov
+ * License: SIL Open Font License, Version 1.1. The license is included as OFL.TXT, and is
+ *      also available with a FAQ at http://scripts.sil.org/OFL
+ *
+ * Source:  builtin:terminus_bold_8x14_iso8859_1, builtin:terminus_bold_8x14_koi8_r
+ * Generated by tools/fontc, do not edit. Command:
+ *     fontc -q --mono --rows --pool terminus_bold_8x14_shared --comment ../../main/fonts/src/terminus.txt -o ../../main/fonts/font_terminus_bold_8x14_shared.h builtin:terminus_bold_8x14_iso8859_1 builtin:terminus_bold_8x14_koi8_r
+ */
+#ifndef _EXTRAS_FONTS_FONT_TERMINUS_BOLD_8X14_SHARED_H_
+#define _EXTRAS_FONTS_FONT_TERMINUS_BOLD_8X14_SHARED_H_
+
+static const uint8_t _fonts_terminus_bold_8x14_shared_bitmaps[] = {
+
+    /* Index: 0x00, char: \x01, offset: 0x0000 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x7e, /* .######. */
+    0xff, /* ######## */
+    0x7e, /* .######. */
+    0x3c, /* ..####.. */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x01, char: \x02, offset: 0x000e */
+    0xaa, /* #.#.#.#. */
+    0x55, /* .#.#.#.# */
+    0xaa, /* #.#.#.#. */
+    0x55, /* .#.#.#.# */
+    0xaa, /* #.#.#.#. */
+    0x55, /* .#.#.#.# */
+    0xaa, /* #.#.#.#. */
+    0x55, /* .#.#.#.# */
+    0xaa, /* #.#.#.#. */
+    0x55, /* .#.#.#.# */
+    0xaa, /* #.#.#.#. */
+    0x55, /* .#.#.#.# */
+    0xaa, /* #.#.#.#. */
+    0x55, /* .#.#.#.# */
+
+    /* Index: 0x02, char: \x03, offset: 0x001c */
+    0xcc, /* ##..##.. */
+    0xcc, /* ##..##.. */
+    0xfc, /* ######.. */
+    0xcc, /* ##..##.. */
+    0xcc, /* ##..##.. */
+    0xcc, /* ##..##.. */
+    0x00, /* ........ */
+    0x3f, /* ..###### */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x00, /* ........ */
+
+    /* Index: 0x03, char: \x04, offset: 0x002a */
+    0xfc, /* ######.. */
+    0xc0, /* ##...... */
+    0xf0, /* ####.... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x00, /* ........ */
+    0x3f, /* ..###### */
+    0x30, /* ..##.... */
+    0x3c, /* ..####.. */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+
+    /* Index: 0x04, char: \x05, offset: 0x0038 */
+    0x78, /* .####... */
+    0xcc, /* ##..##.. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xcc, /* ##..##.. */
+    0x78, /* .####... */
+    0x00, /* ........ */
+    0x3e, /* ..#####. */
+    0x33, /* ..##..## */
+    0x33, /* ..##..## */
+    0x3e, /* ..#####. */
+    0x36, /* ..##.##. */
+    0x33, /* ..##..## */
+    0x00, /* ........ */
+
+    /* Index: 0x05, char: \x06, offset: 0x0046 */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xf8, /* #####... */
+    0x00, /* ........ */
+    0x3f, /* ..###### */
+    0x30, /* ..##.... */
+    0x3c, /* ..####.. */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+
+    /* Index: 0x06, char: \x07, offset: 0x0054 */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x38, /* ..###... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x07, char: \x08, offset: 0x0062 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x7e, /* .######. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x08, char: \x09, offset: 0x0070 */
+    0xcc, /* ##..##.. */
+    0xec, /* ###.##.. */
+    0xfc, /* ######.. */
+    0xdc, /* ##.###.. */
+    0xcc, /* ##..##.. */
+    0xcc, /* ##..##.. */
+    0x00, /* ........ */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x3f, /* ..###### */
+    0x00, /* ........ */
+
+    /* Index: 0x09, char: \x0a, offset: 0x007e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x0a, char: \x0b, offset: 0x008c */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0xf8, /* #####... */
+    0xf8, /* #####... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x0b, char: \x0c, offset: 0x009a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xf8, /* #####... */
+    0xf8, /* #####... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0x0c, char: \x0d, offset: 0x00a8 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x1f, /* ...##### */
+    0x1f, /* ...##### */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0x0d, char: \x0e, offset: 0x00b6 */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x1f, /* ...##### */
+    0x1f, /* ...##### */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x0e, char: \x0f, offset: 0x00c4 */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0x11, char: \x12, offset: 0x00d2 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x14, char: \x15, offset: 0x00e0 */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x1f, /* ...##### */
+    0x1f, /* ...##### */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0x15, char: \x16, offset: 0x00ee */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0xf8, /* #####... */
+    0xf8, /* #####... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0x16, char: \x17, offset: 0x00fc */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x17, char: \x18, offset: 0x010a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0x18, char: \x19, offset: 0x0118 */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0x19, char: \x1a, offset: 0x0126 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x0c, /* ....##.. */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x1a, char: \x1b, offset: 0x0134 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x0c, /* ....##.. */
+    0x06, /* .....##. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x1b, char: \x1c, offset: 0x0142 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x1c, char: \x1d, offset: 0x0150 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x06, /* .....##. */
+    0xfe, /* #######. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x1d, char: \x1e, offset: 0x015e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x60, /* .##..... */
+    0x60, /* .##..... */
+    0xf8, /* #####... */
+    0x60, /* .##..... */
+    0x60, /* .##..... */
+    0x60, /* .##..... */
+    0x66, /* .##..##. */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x1e, char: \x1f, offset: 0x016c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x20, char: !, offset: 0x017a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x21, char: ", offset: 0x0188 */
+    0x00, /* ........ */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x22, char: #, offset: 0x0196 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0xfe, /* #######. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0xfe, /* #######. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x23, char: $, offset: 0x01a4 */
+    0x00, /* ........ */
+    0x10, /* ...#.... */
+    0x10, /* ...#.... */
+    0x7c, /* .#####.. */
+    0xd6, /* ##.#.##. */
+    0xd0, /* ##.#.... */
+    0xd0, /* ##.#.... */
+    0x7c, /* .#####.. */
+    0x16, /* ...#.##. */
+    0x16, /* ...#.##. */
+    0xd6, /* ##.#.##. */
+    0x7c, /* .#####.. */
+    0x10, /* ...#.... */
+    0x10, /* ...#.... */
+
+    /* Index: 0x24, char: %, offset: 0x01b2 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x66, /* .##..##. */
+    0xd6, /* ##.#.##. */
+    0x6c, /* .##.##.. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x36, /* ..##.##. */
+    0x6b, /* .##.#.## */
+    0x66, /* .##..##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x25, char: &, offset: 0x01c0 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x38, /* ..###... */
+    0x76, /* .###.##. */
+    0xdc, /* ##.###.. */
+    0xcc, /* ##..##.. */
+    0xcc, /* ##..##.. */
+    0xdc, /* ##.###.. */
+    0x76, /* .###.##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x26, char: ', offset: 0x01ce */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x27, char: (, offset: 0x01dc */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x0c, /* ....##.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x28, char: ), offset: 0x01ea */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x29, char: \x2a, offset: 0x01f8 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x6c, /* .##.##.. */
+    0x38, /* ..###... */
+    0xfe, /* #######. */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x2a, char: +, offset: 0x0206 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x7e, /* .######. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x2b, char: ,, offset: 0x0214 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+
+    /* Index: 0x2c, char: -, offset: 0x0222 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x2d, char: ., offset: 0x0230 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x2e, char: \x2f, offset: 0x023e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+    0x60, /* .##..... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x2f, char: 0, offset: 0x024c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xce, /* ##..###. */
+    0xde, /* ##.####. */
+    0xf6, /* ####.##. */
+    0xe6, /* ###..##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x30, char: 1, offset: 0x025a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x38, /* ..###... */
+    0x78, /* .####... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x31, char: 2, offset: 0x0268 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x06, /* .....##. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+    0xc0, /* ##...... */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x32, char: 3, offset: 0x0276 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x06, /* .....##. */
+    0x3c, /* ..####.. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x33, char: 4, offset: 0x0284 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x06, /* .....##. */
+    0x0e, /* ....###. */
+    0x1e, /* ...####. */
+    0x36, /* ..##.##. */
+    0x66, /* .##..##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x34, char: 5, offset: 0x0292 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfc, /* ######.. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x35, char: 6, offset: 0x02a0 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x3c, /* ..####.. */
+    0x60, /* .##..... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x36, char: 7, offset: 0x02ae */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x37, char: 8, offset: 0x02bc */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x38, char: 9, offset: 0x02ca */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x0c, /* ....##.. */
+    0x78, /* .####... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x39, char: :, offset: 0x02d8 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x3a, char: ;, offset: 0x02e6 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+
+    /* Index: 0x3b, char: <, offset: 0x02f4 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x06, /* .....##. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x0c, /* ....##.. */
+    0x06, /* .....##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x3c, char: =, offset: 0x0302 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x3d, char: >, offset: 0x0310 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x60, /* .##..... */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x0c, /* ....##.. */
+    0x06, /* .....##. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x3e, char: ?, offset: 0x031e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x3f, char: @, offset: 0x032c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xce, /* ##..###. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xce, /* ##..###. */
+    0xc0, /* ##...... */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x40, char: A, offset: 0x033a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x41, char: B, offset: 0x0348 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfc, /* ######.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x42, char: C, offset: 0x0356 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x43, char: D, offset: 0x0364 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xf8, /* #####... */
+    0xcc, /* ##..##.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xcc, /* ##..##.. */
+    0xf8, /* #####... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x44, char: E, offset: 0x0372 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xf8, /* #####... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x45, char: F, offset: 0x0380 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xf8, /* #####... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x46, char: G, offset: 0x038e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xde, /* ##.####. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x47, char: H, offset: 0x039c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x48, char: I, offset: 0x03aa */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x3c, /* ..####.. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x49, char: J, offset: 0x03b8 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x1e, /* ...####. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0xcc, /* ##..##.. */
+    0xcc, /* ##..##.. */
+    0x78, /* .####... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x4a, char: K, offset: 0x03c6 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xcc, /* ##..##.. */
+    0xd8, /* ##.##... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xd8, /* ##.##... */
+    0xcc, /* ##..##.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x4b, char: L, offset: 0x03d4 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x4c, char: M, offset: 0x03e2 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x82, /* #.....#. */
+    0xc6, /* ##...##. */
+    0xee, /* ###.###. */
+    0xfe, /* #######. */
+    0xd6, /* ##.#.##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x4d, char: N, offset: 0x03f0 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xe6, /* ###..##. */
+    0xf6, /* ####.##. */
+    0xde, /* ##.####. */
+    0xce, /* ##..###. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x4e, char: O, offset: 0x03fe */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x4f, char: P, offset: 0x040c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfc, /* ######.. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x50, char: Q, offset: 0x041a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xde, /* ##.####. */
+    0x7c, /* .#####.. */
+    0x06, /* .....##. */
+    0x00, /* ........ */
+
+    /* Index: 0x51, char: R, offset: 0x0428 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfc, /* ######.. */
+    0xf0, /* ####.... */
+    0xd8, /* ##.##... */
+    0xcc, /* ##..##.. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x52, char: S, offset: 0x0436 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x7c, /* .#####.. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x53, char: T, offset: 0x0444 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x54, char: U, offset: 0x0452 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x55, char: V, offset: 0x0460 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x38, /* ..###... */
+    0x38, /* ..###... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x56, char: W, offset: 0x046e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xd6, /* ##.#.##. */
+    0xfe, /* #######. */
+    0xee, /* ###.###. */
+    0xc6, /* ##...##. */
+    0x82, /* #.....#. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x57, char: X, offset: 0x047c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x38, /* ..###... */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x58, char: Y, offset: 0x048a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc3, /* ##....## */
+    0xc3, /* ##....## */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x3c, /* ..####.. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x59, char: Z, offset: 0x0498 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x5a, char: [, offset: 0x04a6 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x3c, /* ..####.. */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x5b, char: \x5c, offset: 0x04b4 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x60, /* .##..... */
+    0x60, /* .##..... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x5c, char: ], offset: 0x04c2 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x3c, /* ..####.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x5d, char: ^, offset: 0x04d0 */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x66, /* .##..##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x5e, char: _, offset: 0x04de */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+
+    /* Index: 0x5f, char: `, offset: 0x04ec */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x60, char: a, offset: 0x04fa */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0x06, /* .....##. */
+    0x7e, /* .######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x61, char: b, offset: 0x0508 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfc, /* ######.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x62, char: c, offset: 0x0516 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x63, char: d, offset: 0x0524 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x7e, /* .######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x64, char: e, offset: 0x0532 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x65, char: f, offset: 0x0540 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x1e, /* ...####. */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0xfc, /* ######.. */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x66, char: g, offset: 0x054e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x06, /* .....##. */
+    0x7c, /* .#####.. */
+
+    /* Index: 0x67, char: h, offset: 0x055c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x68, char: i, offset: 0x056a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x69, char: j, offset: 0x0578 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x00, /* ........ */
+    0x0e, /* ....###. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x3c, /* ..####.. */
+
+    /* Index: 0x6a, char: k, offset: 0x0586 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc6, /* ##...##. */
+    0xcc, /* ##..##.. */
+    0xd8, /* ##.##... */
+    0xf0, /* ####.... */
+    0xd8, /* ##.##... */
+    0xcc, /* ##..##.. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x6b, char: l, offset: 0x0594 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x6c, char: m, offset: 0x05a2 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfc, /* ######.. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x6d, char: n, offset: 0x05b0 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x6e, char: o, offset: 0x05be */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x6f, char: p, offset: 0x05cc */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfc, /* ######.. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+
+    /* Index: 0x70, char: q, offset: 0x05da */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+
+    /* Index: 0x71, char: r, offset: 0x05e8 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xde, /* ##.####. */
+    0xf0, /* ####.... */
+    0xe0, /* ###..... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x72, char: s, offset: 0x05f6 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x7c, /* .#####.. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0xfc, /* ######.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x73, char: t, offset: 0x0604 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0xfc, /* ######.. */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x1e, /* ...####. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x74, char: u, offset: 0x0612 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x75, char: v, offset: 0x0620 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x38, /* ..###... */
+    0x38, /* ..###... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x76, char: w, offset: 0x062e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x77, char: x, offset: 0x063c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x6c, /* .##.##.. */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x78, char: y, offset: 0x064a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x06, /* .....##. */
+    0x7c, /* .#####.. */
+
+    /* Index: 0x79, char: z, offset: 0x0658 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+    0xc0, /* ##...... */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x7a, char: {, offset: 0x0666 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x1c, /* ...###.. */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x1c, /* ...###.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x7b, char: |, offset: 0x0674 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x7c, char: }, offset: 0x0682 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x70, /* .###.... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x70, /* .###.... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x7d, char: ~, offset: 0x0690 */
+    0x00, /* ........ */
+    0x73, /* .###..## */
+    0xdb, /* ##.##.## */
+    0xce, /* ##..###. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xa0, char: \xa1, offset: 0x069e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xa1, char: \xa2, offset: 0x06ac */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x10, /* ...#.... */
+    0x10, /* ...#.... */
+    0x7c, /* .#####.. */
+    0xd6, /* ##.#.##. */
+    0xd0, /* ##.#.... */
+    0xd0, /* ##.#.... */
+    0xd0, /* ##.#.... */
+    0xd6, /* ##.#.##. */
+    0x7c, /* .#####.. */
+    0x10, /* ...#.... */
+    0x10, /* ...#.... */
+
+    /* Index: 0xa3, char: \xa4, offset: 0x06ba */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x66, /* .##..##. */
+    0x3c, /* ..####.. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x3c, /* ..####.. */
+    0x66, /* .##..##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xa4, char: \xa5, offset: 0x06c8 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc3, /* ##....## */
+    0xc3, /* ##....## */
+    0x66, /* .##..##. */
+    0x3c, /* ..####.. */
+    0x18, /* ...##... */
+    0x7e, /* .######. */
+    0x18, /* ...##... */
+    0x7e, /* .######. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xa5, char: \xa6, offset: 0x06d6 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xa6, char: \xa7, offset: 0x06e4 */
+    0x00, /* ........ */
+    0x3c, /* ..####.. */
+    0x66, /* .##..##. */
+    0x60, /* .##..... */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x36, /* ..##.##. */
+    0x1c, /* ...###.. */
+    0x06, /* .....##. */
+    0x66, /* .##..##. */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+
+    /* Index: 0xa7, char: \xa8, offset: 0x06f2 */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xa8, char: \xa9, offset: 0x0700 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0x81, /* #......# */
+    0x99, /* #..##..# */
+    0xa5, /* #.#..#.# */
+    0xa1, /* #.#....# */
+    0xa5, /* #.#..#.# */
+    0x99, /* #..##..# */
+    0x81, /* #......# */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xa9, char: \xaa, offset: 0x070e */
+    0x00, /* ........ */
+    0x3c, /* ..####.. */
+    0x06, /* .....##. */
+    0x3e, /* ..#####. */
+    0x66, /* .##..##. */
+    0x3e, /* ..#####. */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xaa, char: \xab, offset: 0x071c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x1b, /* ...##.## */
+    0x36, /* ..##.##. */
+    0x6c, /* .##.##.. */
+    0xd8, /* ##.##... */
+    0x6c, /* .##.##.. */
+    0x36, /* ..##.##. */
+    0x1b, /* ...##.## */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xab, char: \xac, offset: 0x072a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xac, char: \xad, offset: 0x0738 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xad, char: \xae, offset: 0x0746 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0x81, /* #......# */
+    0xb9, /* #.###..# */
+    0xa5, /* #.#..#.# */
+    0xb9, /* #.###..# */
+    0xa9, /* #.#.#..# */
+    0xa5, /* #.#..#.# */
+    0x81, /* #......# */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xae, char: \xaf, offset: 0x0754 */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xb1, char: \xb2, offset: 0x0762 */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xb2, char: \xb3, offset: 0x0770 */
+    0x00, /* ........ */
+    0x78, /* .####... */
+    0x0c, /* ....##.. */
+    0x38, /* ..###... */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x78, /* .####... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xb3, char: \xb4, offset: 0x077e */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xb4, char: \xb5, offset: 0x078c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xce, /* ##..###. */
+    0xf6, /* ####.##. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+
+    /* Index: 0xb5, char: \xb6, offset: 0x079a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x76, /* .###.##. */
+    0x16, /* ...#.##. */
+    0x16, /* ...#.##. */
+    0x16, /* ...#.##. */
+    0x16, /* ...#.##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xb7, char: \xb8, offset: 0x07a8 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+
+    /* Index: 0xb8, char: \xb9, offset: 0x07b6 */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x38, /* ..###... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xb9, char: \xba, offset: 0x07c4 */
+    0x00, /* ........ */
+    0x3c, /* ..####.. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xba, char: \xbb, offset: 0x07d2 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xd8, /* ##.##... */
+    0x6c, /* .##.##.. */
+    0x36, /* ..##.##. */
+    0x1b, /* ...##.## */
+    0x36, /* ..##.##. */
+    0x6c, /* .##.##.. */
+    0xd8, /* ##.##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xbb, char: \xbc, offset: 0x07e0 */
+    0x60, /* .##..... */
+    0xe0, /* ###..... */
+    0x62, /* .##...#. */
+    0x66, /* .##..##. */
+    0x6c, /* .##.##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x66, /* .##..##. */
+    0xce, /* ##..###. */
+    0x9a, /* #..##.#. */
+    0x3e, /* ..#####. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x00, /* ........ */
+
+    /* Index: 0xbc, char: \xbd, offset: 0x07ee */
+    0x60, /* .##..... */
+    0xe0, /* ###..... */
+    0x62, /* .##...#. */
+    0x66, /* .##..##. */
+    0x6c, /* .##.##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+    0xdc, /* ##.###.. */
+    0xb6, /* #.##.##. */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x3e, /* ..#####. */
+    0x00, /* ........ */
+
+    /* Index: 0xbd, char: \xbe, offset: 0x07fc */
+    0xe0, /* ###..... */
+    0x30, /* ..##.... */
+    0x62, /* .##...#. */
+    0x36, /* ..##.##. */
+    0xec, /* ###.##.. */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x66, /* .##..##. */
+    0xce, /* ##..###. */
+    0x9a, /* #..##.#. */
+    0x3e, /* ..#####. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x00, /* ........ */
+
+    /* Index: 0xbe, char: \xbf, offset: 0x080a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0x30, /* ..##.... */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xbf, char: \xc0, offset: 0x0818 */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xc0, char: \xc1, offset: 0x0826 */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xc1, char: \xc2, offset: 0x0834 */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xc2, char: \xc3, offset: 0x0842 */
+    0x76, /* .###.##. */
+    0xdc, /* ##.###.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xc3, char: \xc4, offset: 0x0850 */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xc4, char: \xc5, offset: 0x085e */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x38, /* ..###... */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xc5, char: \xc6, offset: 0x086c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0xd8, /* ##.##... */
+    0xd8, /* ##.##... */
+    0xd8, /* ##.##... */
+    0xfe, /* #######. */
+    0xd8, /* ##.##... */
+    0xd8, /* ##.##... */
+    0xd8, /* ##.##... */
+    0xd8, /* ##.##... */
+    0xde, /* ##.####. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xc6, char: \xc7, offset: 0x087a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+
+    /* Index: 0xc7, char: \xc8, offset: 0x0888 */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xf8, /* #####... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xc8, char: \xc9, offset: 0x0896 */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xf8, /* #####... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xc9, char: \xca, offset: 0x08a4 */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xf8, /* #####... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xca, char: \xcb, offset: 0x08b2 */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xf8, /* #####... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfe, /* #######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xcb, char: \xcc, offset: 0x08c0 */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x3c, /* ..####.. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xcc, char: \xcd, offset: 0x08ce */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x3c, /* ..####.. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xcd, char: \xce, offset: 0x08dc */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x3c, /* ..####.. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xce, char: \xcf, offset: 0x08ea */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x00, /* ........ */
+    0x3c, /* ..####.. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xcf, char: \xd0, offset: 0x08f8 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x78, /* .####... */
+    0x6c, /* .##.##.. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0xf6, /* ####.##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x6c, /* .##.##.. */
+    0x78, /* .####... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd0, char: \xd1, offset: 0x0906 */
+    0x76, /* .###.##. */
+    0xdc, /* ##.###.. */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xe6, /* ###..##. */
+    0xf6, /* ####.##. */
+    0xde, /* ##.####. */
+    0xce, /* ##..###. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd1, char: \xd2, offset: 0x0914 */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd2, char: \xd3, offset: 0x0922 */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd3, char: \xd4, offset: 0x0930 */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd4, char: \xd5, offset: 0x093e */
+    0x76, /* .###.##. */
+    0xdc, /* ##.###.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd5, char: \xd6, offset: 0x094c */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd6, char: \xd7, offset: 0x095a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0x6c, /* .##.##.. */
+    0x38, /* ..###... */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd7, char: \xd8, offset: 0x0968 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc7, /* ##...### */
+    0xc6, /* ##...##. */
+    0xce, /* ##..###. */
+    0xde, /* ##.####. */
+    0xf6, /* ####.##. */
+    0xe6, /* ###..##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd8, char: \xd9, offset: 0x0976 */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd9, char: \xda, offset: 0x0984 */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xda, char: \xdb, offset: 0x0992 */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xdb, char: \xdc, offset: 0x09a0 */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xdc, char: \xdd, offset: 0x09ae */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0xc3, /* ##....## */
+    0xc3, /* ##....## */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x3c, /* ..####.. */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xdd, char: \xde, offset: 0x09bc */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfc, /* ######.. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xde, char: \xdf, offset: 0x09ca */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x78, /* .####... */
+    0xcc, /* ##..##.. */
+    0xcc, /* ##..##.. */
+    0xc8, /* ##..#... */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xe6, /* ###..##. */
+    0xdc, /* ##.###.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xdf, char: \xe0, offset: 0x09d8 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0x06, /* .....##. */
+    0x7e, /* .######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe0, char: \xe1, offset: 0x09e6 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0x06, /* .....##. */
+    0x7e, /* .######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe1, char: \xe2, offset: 0x09f4 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0x06, /* .....##. */
+    0x7e, /* .######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe2, char: \xe3, offset: 0x0a02 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x76, /* .###.##. */
+    0xdc, /* ##.###.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0x06, /* .....##. */
+    0x7e, /* .######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe3, char: \xe4, offset: 0x0a10 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0x06, /* .....##. */
+    0x7e, /* .######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe4, char: \xe5, offset: 0x0a1e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x38, /* ..###... */
+    0x7c, /* .#####.. */
+    0x06, /* .....##. */
+    0x7e, /* .######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe5, char: \xe6, offset: 0x0a2c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x6c, /* .##.##.. */
+    0x16, /* ...#.##. */
+    0x16, /* ...#.##. */
+    0x7e, /* .######. */
+    0xd0, /* ##.#.... */
+    0xd0, /* ##.#.... */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe6, char: \xe7, offset: 0x0a3a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x30, /* ..##.... */
+    0x60, /* .##..... */
+
+    /* Index: 0xe7, char: \xe8, offset: 0x0a48 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe8, char: \xe9, offset: 0x0a56 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe9, char: \xea, offset: 0x0a64 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xea, char: \xeb, offset: 0x0a72 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xeb, char: \xec, offset: 0x0a80 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xec, char: \xed, offset: 0x0a8e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x0c, /* ....##.. */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xed, char: \xee, offset: 0x0a9c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xee, char: \xef, offset: 0x0aaa */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x3c, /* ..####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xef, char: \xf0, offset: 0x0ab8 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x68, /* .##.#... */
+    0x30, /* ..##.... */
+    0x58, /* .#.##... */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf0, char: \xf1, offset: 0x0ac6 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x76, /* .###.##. */
+    0xdc, /* ##.###.. */
+    0x00, /* ........ */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf1, char: \xf2, offset: 0x0ad4 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf2, char: \xf3, offset: 0x0ae2 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf3, char: \xf4, offset: 0x0af0 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf4, char: \xf5, offset: 0x0afe */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x76, /* .###.##. */
+    0xdc, /* ##.###.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf5, char: \xf6, offset: 0x0b0c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf6, char: \xf7, offset: 0x0b1a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf7, char: \xf8, offset: 0x0b28 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x3d, /* ..####.# */
+    0x67, /* .##..### */
+    0x6e, /* .##.###. */
+    0x7e, /* .######. */
+    0x76, /* .###.##. */
+    0xe6, /* ###..##. */
+    0xbc, /* #.####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf8, char: \xf9, offset: 0x0b36 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x30, /* ..##.... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf9, char: \xfa, offset: 0x0b44 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xfa, char: \xfb, offset: 0x0b52 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xfb, char: \xfc, offset: 0x0b60 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xfc, char: \xfd, offset: 0x0b6e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x18, /* ...##... */
+    0x30, /* ..##.... */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x06, /* .....##. */
+    0x7c, /* .#####.. */
+
+    /* Index: 0xfd, char: \xfe, offset: 0x0b7c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfc, /* ######.. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+
+    /* Index: 0xfe, char: \xff, offset: 0x0b8a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x06, /* .....##. */
+    0x7c, /* .#####.. */
+
+    /* Index: 0x8a, char: \x8b, offset: 0x0b98 */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x8b, char: \x8c, offset: 0x0ba6 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+
+    /* Index: 0x8c, char: \x8d, offset: 0x0bb4 */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0xff, /* ######## */
+
+    /* Index: 0x8d, char: \x8e, offset: 0x0bc2 */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+    0xf0, /* ####.... */
+
+    /* Index: 0x8e, char: \x8f, offset: 0x0bd0 */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+    0x0f, /* ....#### */
+
+    /* Index: 0x8f, char: \x90, offset: 0x0bde */
+    0x88, /* #...#... */
+    0x22, /* ..#...#. */
+    0x88, /* #...#... */
+    0x22, /* ..#...#. */
+    0x88, /* #...#... */
+    0x22, /* ..#...#. */
+    0x88, /* #...#... */
+    0x22, /* ..#...#. */
+    0x88, /* #...#... */
+    0x22, /* ..#...#. */
+    0x88, /* #...#... */
+    0x22, /* ..#...#. */
+    0x88, /* #...#... */
+    0x22, /* ..#...#. */
+
+    /* Index: 0x91, char: \x92, offset: 0x0bec */
+    0xee, /* ###.###. */
+    0xbb, /* #.###.## */
+    0xee, /* ###.###. */
+    0xbb, /* #.###.## */
+    0xee, /* ###.###. */
+    0xbb, /* #.###.## */
+    0xee, /* ###.###. */
+    0xbb, /* #.###.## */
+    0xee, /* ###.###. */
+    0xbb, /* #.###.## */
+    0xee, /* ###.###. */
+    0xbb, /* #.###.## */
+    0xee, /* ###.###. */
+    0xbb, /* #.###.## */
+
+    /* Index: 0x92, char: \x93, offset: 0x0bfa */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x0e, /* ....###. */
+    0x1b, /* ...##.## */
+    0x1b, /* ...##.## */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0x93, char: \x94, offset: 0x0c08 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0x7c, /* .#####.. */
+    0x7c, /* .#####.. */
+    0x7c, /* .#####.. */
+    0x7c, /* .#####.. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x94, char: \x95, offset: 0x0c16 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x38, /* ..###... */
+    0x38, /* ..###... */
+    0x38, /* ..###... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x95, char: \x96, offset: 0x0c24 */
+    0x00, /* ........ */
+    0x0e, /* ....###. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0x0c, /* ....##.. */
+    0xcc, /* ##..##.. */
+    0xcc, /* ##..##.. */
+    0xcc, /* ##..##.. */
+    0x6c, /* .##.##.. */
+    0x3c, /* ..####.. */
+    0x1c, /* ...###.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x96, char: \x97, offset: 0x0c32 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x76, /* .###.##. */
+    0xdc, /* ##.###.. */
+    0x00, /* ........ */
+    0x76, /* .###.##. */
+    0xdc, /* ##.###.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x9a, char: \x9b, offset: 0x0c40 */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0xd8, /* ##.##... */
+    0xd8, /* ##.##... */
+    0x70, /* .###.... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0x9f, char: \xa0, offset: 0x0c4e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xa0, char: \xa1, offset: 0x0c5c */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xa1, char: \xa2, offset: 0x0c6a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x1f, /* ...##### */
+    0x1f, /* ...##### */
+    0x18, /* ...##... */
+    0x1f, /* ...##### */
+    0x1f, /* ...##### */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0xa3, char: \xa4, offset: 0x0c78 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7f, /* .####### */
+    0x7f, /* .####### */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xa4, char: \xa5, offset: 0x0c86 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7f, /* .####### */
+    0x7f, /* .####### */
+    0x60, /* .##..... */
+    0x6f, /* .##.#### */
+    0x6f, /* .##.#### */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xa5, char: \xa6, offset: 0x0c94 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xf8, /* #####... */
+    0xf8, /* #####... */
+    0x18, /* ...##... */
+    0xf8, /* #####... */
+    0xf8, /* #####... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0xa6, char: \xa7, offset: 0x0ca2 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfc, /* ######.. */
+    0xfc, /* ######.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xa7, char: \xa8, offset: 0x0cb0 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfc, /* ######.. */
+    0xfc, /* ######.. */
+    0x0c, /* ....##.. */
+    0xec, /* ###.##.. */
+    0xec, /* ###.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xa8, char: \xa9, offset: 0x0cbe */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x1f, /* ...##### */
+    0x1f, /* ...##### */
+    0x18, /* ...##... */
+    0x1f, /* ...##### */
+    0x1f, /* ...##### */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xa9, char: \xaa, offset: 0x0ccc */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x7f, /* .####### */
+    0x7f, /* .####### */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xaa, char: \xab, offset: 0x0cda */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6f, /* .##.#### */
+    0x6f, /* .##.#### */
+    0x60, /* .##..... */
+    0x7f, /* .####### */
+    0x7f, /* .####### */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xab, char: \xac, offset: 0x0ce8 */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0xf8, /* #####... */
+    0xf8, /* #####... */
+    0x18, /* ...##... */
+    0xf8, /* #####... */
+    0xf8, /* #####... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xac, char: \xad, offset: 0x0cf6 */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0xfc, /* ######.. */
+    0xfc, /* ######.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xad, char: \xae, offset: 0x0d04 */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0xec, /* ###.##.. */
+    0xec, /* ###.##.. */
+    0x0c, /* ....##.. */
+    0xfc, /* ######.. */
+    0xfc, /* ######.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xae, char: \xaf, offset: 0x0d12 */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x1f, /* ...##### */
+    0x1f, /* ...##### */
+    0x18, /* ...##... */
+    0x1f, /* ...##### */
+    0x1f, /* ...##### */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0xaf, char: \xb0, offset: 0x0d20 */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6f, /* .##.#### */
+    0x6f, /* .##.#### */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xb0, char: \xb1, offset: 0x0d2e */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6f, /* .##.#### */
+    0x6f, /* .##.#### */
+    0x60, /* .##..... */
+    0x6f, /* .##.#### */
+    0x6f, /* .##.#### */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xb1, char: \xb2, offset: 0x0d3c */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0xf8, /* #####... */
+    0xf8, /* #####... */
+    0x18, /* ...##... */
+    0xf8, /* #####... */
+    0xf8, /* #####... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0xb3, char: \xb4, offset: 0x0d4a */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0xec, /* ###.##.. */
+    0xec, /* ###.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xb4, char: \xb5, offset: 0x0d58 */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0xec, /* ###.##.. */
+    0xec, /* ###.##.. */
+    0x0c, /* ....##.. */
+    0xec, /* ###.##.. */
+    0xec, /* ###.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xb5, char: \xb6, offset: 0x0d66 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0xb6, char: \xb7, offset: 0x0d74 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xb7, char: \xb8, offset: 0x0d82 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x00, /* ........ */
+    0xef, /* ###.#### */
+    0xef, /* ###.#### */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xb8, char: \xb9, offset: 0x0d90 */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xb9, char: \xba, offset: 0x0d9e */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xba, char: \xbb, offset: 0x0dac */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0xef, /* ###.#### */
+    0xef, /* ###.#### */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xbb, char: \xbc, offset: 0x0dba */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x18, /* ...##... */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+
+    /* Index: 0xbc, char: \xbd, offset: 0x0dc8 */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0xff, /* ######## */
+    0xff, /* ######## */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xbd, char: \xbe, offset: 0x0dd6 */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0xef, /* ###.#### */
+    0xef, /* ###.#### */
+    0x00, /* ........ */
+    0xef, /* ###.#### */
+    0xef, /* ###.#### */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+    0x6c, /* .##.##.. */
+
+    /* Index: 0xbf, char: \xc0, offset: 0x0de4 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xcc, /* ##..##.. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xf6, /* ####.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xcc, /* ##..##.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xc1, char: \xc2, offset: 0x0df2 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfc, /* ######.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xc2, char: \xc3, offset: 0x0e00 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7f, /* .####### */
+    0x03, /* ......## */
+    0x03, /* ......## */
+
+    /* Index: 0xc5, char: \xc6, offset: 0x0e0e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x10, /* ...#.... */
+    0x7c, /* .#####.. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x7c, /* .#####.. */
+    0x10, /* ...#.... */
+    0x00, /* ........ */
+
+    /* Index: 0xc6, char: \xc7, offset: 0x0e1c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xc9, char: \xca, offset: 0x0e2a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x6c, /* .##.##.. */
+    0x38, /* ..###... */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xca, char: \xcb, offset: 0x0e38 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xcc, /* ##..##.. */
+    0xd8, /* ##.##... */
+    0xf0, /* ####.... */
+    0xd8, /* ##.##... */
+    0xcc, /* ##..##.. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xcb, char: \xcc, offset: 0x0e46 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x3e, /* ..#####. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xcc, char: \xcd, offset: 0x0e54 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xee, /* ###.###. */
+    0xfe, /* #######. */
+    0xd6, /* ##.#.##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xcd, char: \xce, offset: 0x0e62 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfe, /* #######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd0, char: \xd1, offset: 0x0e70 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x36, /* ..##.##. */
+    0x66, /* .##..##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd3, char: \xd4, offset: 0x0e7e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xff, /* ######## */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x18, /* ...##... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd5, char: \xd6, offset: 0x0e8c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x7c, /* .#####.. */
+    0x38, /* ..###... */
+    0x7c, /* .#####.. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd6, char: \xd7, offset: 0x0e9a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x78, /* .####... */
+    0xcc, /* ##..##.. */
+    0xcc, /* ##..##.. */
+    0xc8, /* ##..#... */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfc, /* ######.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd7, char: \xd8, offset: 0x0ea8 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x60, /* .##..... */
+    0x60, /* .##..... */
+    0x7c, /* .#####.. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd8, char: \xd9, offset: 0x0eb6 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xe6, /* ###..##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xe6, /* ###..##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xd9, char: \xda, offset: 0x0ec4 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0x06, /* .....##. */
+    0x3c, /* ..####.. */
+    0x06, /* .....##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xda, char: \xdb, offset: 0x0ed2 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xdb, char: \xdc, offset: 0x0ee0 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0x06, /* .....##. */
+    0x3e, /* ..#####. */
+    0x06, /* .....##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xdc, char: \xdd, offset: 0x0eee */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x7f, /* .####### */
+    0x03, /* ......## */
+    0x03, /* ......## */
+
+    /* Index: 0xdd, char: \xde, offset: 0x0efc */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xde, char: \xdf, offset: 0x0f0a */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xe0, /* ###..... */
+    0x60, /* .##..... */
+    0x7c, /* .#####.. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xdf, char: \xe0, offset: 0x0f18 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xcc, /* ##..##.. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xf6, /* ####.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xcc, /* ##..##.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe1, char: \xe2, offset: 0x0f26 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfc, /* ######.. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xfc, /* ######.. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xfc, /* ######.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe2, char: \xe3, offset: 0x0f34 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7f, /* .####### */
+    0x03, /* ......## */
+    0x03, /* ......## */
+
+    /* Index: 0xe3, char: \xe4, offset: 0x0f42 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x3e, /* ..#####. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0xff, /* ######## */
+    0xc3, /* ##....## */
+    0x00, /* ........ */
+
+    /* Index: 0xe5, char: \xe6, offset: 0x0f50 */
+    0x00, /* ........ */
+    0x10, /* ...#.... */
+    0x7c, /* .#####.. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x7c, /* .#####.. */
+    0x10, /* ...#.... */
+    0x00, /* ........ */
+
+    /* Index: 0xe6, char: \xe7, offset: 0x0f5e */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0xc0, /* ##...... */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe8, char: \xe9, offset: 0x0f6c */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xce, /* ##..###. */
+    0xde, /* ##.####. */
+    0xf6, /* ####.##. */
+    0xe6, /* ###..##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xe9, char: \xea, offset: 0x0f7a */
+    0x6c, /* .##.##.. */
+    0x38, /* ..###... */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xce, /* ##..###. */
+    0xde, /* ##.####. */
+    0xf6, /* ####.##. */
+    0xe6, /* ###..##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xeb, char: \xec, offset: 0x0f88 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x1e, /* ...####. */
+    0x36, /* ..##.##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xef, char: \xf0, offset: 0x0f96 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xfe, /* #######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf0, char: \xf1, offset: 0x0fa4 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7e, /* .######. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x1e, /* ...####. */
+    0x36, /* ..##.##. */
+    0x66, /* .##..##. */
+    0xc6, /* ##...##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf4, char: \xf5, offset: 0x0fb2 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf5, char: \xf6, offset: 0x0fc0 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x7c, /* .#####.. */
+    0x38, /* ..###... */
+    0x7c, /* .#####.. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf7, char: \xf8, offset: 0x0fce */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x60, /* .##..... */
+    0x60, /* .##..... */
+    0x60, /* .##..... */
+    0x7c, /* .#####.. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xf8, char: \xf9, offset: 0x0fdc */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xe6, /* ###..##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xe6, /* ###..##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xfa, char: \xfb, offset: 0x0fea */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x7e, /* .######. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xfb, char: \xfc, offset: 0x0ff8 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0x7c, /* .#####.. */
+    0xc6, /* ##...##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x3e, /* ..#####. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0xc6, /* ##...##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xfc, char: \xfd, offset: 0x1006 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0xd6, /* ##.#.##. */
+    0x7f, /* .####### */
+    0x03, /* ......## */
+    0x03, /* ......## */
+
+    /* Index: 0xfd, char: \xfe, offset: 0x1014 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0xc6, /* ##...##. */
+    0x7e, /* .######. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x06, /* .....##. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+
+    /* Index: 0xfe, char: \xff, offset: 0x1022 */
+    0x00, /* ........ */
+    0x00, /* ........ */
+    0xe0, /* ###..... */
+    0x60, /* .##..... */
+    0x60, /* .##..... */
+    0x7c, /* .#####.. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x66, /* .##..##. */
+    0x7c, /* .#####.. */
+    0x00, /* ........ */
+    0x00, /* ........ */
+};
+
+static const font_range_t _fonts_terminus_bold_8x14_iso8859_1_ranges[] = {
+    { 0x0001, 0x000f,    0 },
+    { 0x0010, 0x0010,    9 },
+    { 0x0011, 0x0011,    9 },
+    { 0x0012, 0x0012,   15 },
+    { 0x0013, 0x0013,    9 },
+    { 0x0014, 0x0014,    9 },
+    { 0x0015, 0x001f,   16 },
+    { 0x0020, 0x0020,    9 },
+    { 0x0021, 0x007e,   27 },
+    { 0x007f, 0x007f,    9 },
+    { 0x0080, 0x0080,    9 },
+    { 0x0081, 0x0081,    9 },
+    { 0x0082, 0x0082,    9 },
+    { 0x0083, 0x0083,    9 },
+    { 0x0084, 0x0084,    9 },
+    { 0x0085, 0x0085,    9 },
+    { 0x0086, 0x0086,    9 },
+    { 0x0087, 0x0087,    9 },
+    { 0x0088, 0x0088,    9 },
+    { 0x0089, 0x0089,    9 },
+    { 0x008a, 0x008a,    9 },
+    { 0x008b, 0x008b,    9 },
+    { 0x008c, 0x008c,    9 },
+    { 0x008d, 0x008d,    9 },
+    { 0x008e, 0x008e,    9 },
+    { 0x008f, 0x008f,    9 },
+    { 0x0090, 0x0090,    9 },
+    { 0x0091, 0x0091,    9 },
+    { 0x0092, 0x0092,    9 },
+    { 0x0093, 0x0093,    9 },
+    { 0x0094, 0x0094,    9 },
+    { 0x0095, 0x0095,    9 },
+    { 0x0096, 0x0096,    9 },
+    { 0x0097, 0x0097,    9 },
+    { 0x0098, 0x0098,    9 },
+    { 0x0099, 0x0099,    9 },
+    { 0x009a, 0x009a,    9 },
+    { 0x009b, 0x009b,    9 },
+    { 0x009c, 0x009c,    9 },
+    { 0x009d, 0x009d,    9 },
+    { 0x009e, 0x009e,    9 },
+    { 0x009f, 0x009f,    9 },
+    { 0x00a0, 0x00a0,    9 },
+    { 0x00a1, 0x00a2,  121 },
+    { 0x00a3, 0x00a3,   25 },
+    { 0x00a4, 0x00af,  123 },
+    { 0x00b0, 0x00b1,    6 },
+    { 0x00b2, 0x00b6,  135 },
+    { 0x00b7, 0x00b7,   26 },
+    { 0x00b8, 0x00ff,  140 },
+};
+
+const font_info_t _fonts_terminus_bold_8x14_iso8859_1_info =
+{
+    .height           = 14, /* Character height */
+    .c                = 0, /* C */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
+    .bitmap           = _fonts_terminus_bold_8x14_shared_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 8, /* Glyph width */
+    .stride           = 14, /* Bytes per glyph */
+    .ranges           = _fonts_terminus_bold_8x14_iso8859_1_ranges, /* Code point ranges */
+    .num_ranges       = 50, /* Number of ranges */
+};
+
+static const font_range_t _fonts_terminus_bold_8x14_koi8_r_ranges[] = {
+    { 0x0001, 0x000f,    0 },
+    { 0x0010, 0x0010,    9 },
+    { 0x0011, 0x0011,    9 },
+    { 0x0012, 0x0012,   15 },
+    { 0x0013, 0x0013,    9 },
+    { 0x0014, 0x0014,    9 },
+    { 0x0015, 0x001f,   16 },
+    { 0x0020, 0x0020,    9 },
+    { 0x0021, 0x007e,   27 },
+    { 0x007f, 0x007f,    9 },
+    { 0x0080, 0x0080,   15 },
+    { 0x0081, 0x0081,   20 },
+    { 0x0082, 0x0082,   12 },
+    { 0x0083, 0x0083,   11 },
+    { 0x0084, 0x0084,   13 },
+    { 0x0085, 0x0085,   10 },
+    { 0x0086, 0x0087,   16 },
+    { 0x0088, 0x0088,   19 },
+    { 0x0089, 0x0089,   18 },
+    { 0x008a, 0x008a,   14 },
+    { 0x008b, 0x0090,  212 },
+    { 0x0091, 0x0091,    1 },
+    { 0x0092, 0x0097,  218 },
+    { 0x0098, 0x0099,   21 },
+    { 0x009a, 0x009a,    9 },
+    { 0x009b, 0x009b,  224 },
+    { 0x009c, 0x009c,    6 },
+    { 0x009d, 0x009d,  135 },
+    { 0x009e, 0x009e,   26 },
+    { 0x009f, 0x009f,  203 },
+    { 0x00a0, 0x00a2,  225 },
+    { 0x00a3, 0x00a3,  191 },
+    { 0x00a4, 0x00b2,  228 },
+    { 0x00b3, 0x00b3,  159 },
+    { 0x00b4, 0x00be,  243 },
+    { 0x00bf, 0x00bf,  128 },
+    { 0x00c0, 0x00c0,  254 },
+    { 0x00c1, 0x00c1,   91 },
+    { 0x00c2, 0x00c3,  255 },
+    { 0x00c4, 0x00c4,   97 },
+    { 0x00c5, 0x00c5,   95 },
+    { 0x00c6, 0x00c7,  257 },
+    { 0x00c8, 0x00c8,  114 },
+    { 0x00c9, 0x00c9,  111 },
+    { 0x00ca, 0x00ce,  259 },
+    { 0x00cf, 0x00cf,  105 },
+    { 0x00d0, 0x00d0,   23 },
+    { 0x00d1, 0x00d1,  264 },
+    { 0x00d2, 0x00d2,  106 },
+    { 0x00d3, 0x00d3,   93 },
+    { 0x00d4, 0x00d4,  265 },
+    { 0x00d5, 0x00d5,  115 },
+    { 0x00d6, 0x00e0,  266 },
+    { 0x00e1, 0x00e1,   59 },
+    { 0x00e2, 0x00e4,  277 },
+    { 0x00e5, 0x00e5,   63 },
+    { 0x00e6, 0x00e7,  280 },
+    { 0x00e8, 0x00e8,   82 },
+    { 0x00e9, 0x00ea,  282 },
+    { 0x00eb, 0x00eb,   69 },
+    { 0x00ec, 0x00ec,  284 },
+    { 0x00ed, 0x00ed,   71 },
+    { 0x00ee, 0x00ee,   66 },
+    { 0x00ef, 0x00ef,   73 },
+    { 0x00f0, 0x00f1,  285 },
+    { 0x00f2, 0x00f2,   74 },
+    { 0x00f3, 0x00f3,   61 },
+    { 0x00f4, 0x00f4,   78 },
+    { 0x00f5, 0x00f6,  287 },
+    { 0x00f7, 0x00f7,   60 },
+    { 0x00f8, 0x00f9,  289 },
+    { 0x00fa, 0x00fa,   45 },
+    { 0x00fb, 0x00ff,  291 },
+};
+
+const font_info_t _fonts_terminus_bold_8x14_koi8_r_info =
+{
+    .height           = 14, /* Character height */
+    .c                = 0, /* C */
+    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */
+    .bitmap           = _fonts_terminus_bold_8x14_shared_bitmaps, /* Character bitmap array */
+    .flags            = FONT_FLAG_MONO, /* Flags */
+    .width            = 8, /* Glyph width */
+    .stride           = 14, /* Bytes per glyph */
+    .ranges           = _fonts_terminus_bold_8x14_koi8_r_ranges, /* Code point ranges */
+    .num_ranges       = 73, /* Number of ranges */
+};
+
+#endif /* _EXTRAS_FONTS_FONT_TERMINUS_BOLD_8X14_SHARED_H_ */
@@ -23,6 +23,7 @@
 
 #ifndef FONTS_H
 #define FONTS_H
+#include "stddef.h"
 #include "stdint.h"
 
 //! @brief Character descriptor
@@ -32,6 +33,81 @@ typedef struct _font_char_desc
     uint16_t offset;    //!< Offset of this character in bitmap
 } font_char_desc_t;
 
+/**
+ * @brief   Bounding box of the ink of a glyph, relative to the top-left corner of its cell
+ * @remark  The bitmap of a glyph with a box only covers the box (w x h pixels, same layout as the font). The
+ *          cell is still descriptor width x font height, pixels outside of the box are blank.
+ */
+typedef struct _font_glyph_box
+{
+    uint8_t x;          //!< First column of the box
+    uint8_t y;          //!< First row of the box
+    uint8_t w;          //!< Box width, 0 for blank glyphs
+    uint8_t h;          //!< Box height, 0 for blank glyphs
+} font_glyph_box_t;
+
+/**
+ * @brief   Run of consecutive code points of a sparse font
+ * @remark  Ranges are sorted by code point and do not overlap. Glyph "index + code - first" in the descriptor
+ *          (or monospace bitmap) and box tables belongs to code point "code".
+ */
+typedef struct _font_range
+{
+    uint16_t first;     //!< First code point of the range
+    uint16_t last;      //!< Last code point of the range
+    uint16_t index;     //!< Table index of the glyph of "first"
+} font_range_t;
+
+
+/**
+ * @brief   Left character of kerning pairs, its pairs are first .. (first of the next entry) - 1
+ */
+typedef struct _font_kern_left
+{
+    uint16_t left;      //!< Code point of the left character
+    uint16_t first;     //!< Index of its first pair in font_kerning_t::rights and font_kerning_t::adjust
+} font_kern_left_t;
+
+/**
+ * @brief   Kerning pairs of a font, the space between a left and a right character is font_info_t::c + adjust
+ * @remark  Pairs are grouped by left character, so a pair takes 3 bytes. Left characters are sorted, the right
+ *          characters of each one as well. "lefts" ends with an entry (left 0xffff) whose first is the number of
+ *          pairs.
+ */
+typedef struct _font_kerning
+{
+    uint16_t num_lefts;             //!< Number of left characters, without the last entry
+    const font_kern_left_t *lefts;  //!< num_lefts + 1 entries
+    const uint16_t *rights;         //!< Code point of the right character of each pair
+    const int8_t *adjust;           //!< Added to the space of each pair, negative moves the characters closer
+} font_kerning_t;
+
+
+/**
+ * @name Font flags
+ * @{
+ */
+/**
+ * @brief   Glyphs are stored page-major like the display buffer: (height + 7) / 8 pages of "width" column bytes
+ *          each, bit 0 of a column byte is the top row of the page. Without this flag glyphs are row-major,
+ *          MSB first, every row padded to whole bytes (TheDotFactory layout).
+ */
+#define FONT_FLAG_PAGES     0x01
+/**
+ * @brief   Page-native glyphs (FONT_FLAG_PAGES is set as well) are run-length coded, the descriptor offset points
+ *          to the code of a glyph. The code is a sequence of runs, covering the column bytes in page order:
+ *          - 0nnnnnnn, followed by n + 1 literal bytes
+ *          - 10nnnnnn, n + 1 zero bytes
+ *          - 11nnnnnn b, n + 1 copies of byte b
+ */
+#define FONT_FLAG_RLE       0x02
+/**
+ * @brief   All glyphs have the same width (font_info_t::width) and size (font_info_t::stride), glyph n starts
+ *          at bitmap + n * stride. There is no descriptor table, char_descriptors is NULL.
+ */
+#define FONT_FLAG_MONO      0x04
+/** @} */
+
 
 //! @brief Font information
 typedef struct _font_info
@@ -42,12 +118,91 @@ typedef struct _font_info
     char char_end;          //!< Last character
     const font_char_desc_t* char_descriptors; //! descriptor for each character
     const uint8_t *bitmap;  //!< Character bitmap
+    uint8_t flags;          //!< FONT_FLAG_xxx, 0 for row-major fonts
+    uint8_t width;          //!< Glyph width of FONT_FLAG_MONO fonts
+    uint16_t stride;        //!< Bytes per glyph of FONT_FLAG_MONO fonts
+    const font_glyph_box_t *boxes;  //!< Ink box of each character, NULL if glyphs cover their cell (not with FONT_FLAG_MONO)
+    const font_range_t *ranges;     //!< Unicode code point ranges, NULL if the font covers char_start..char_end
+    uint16_t num_ranges;            //!< Number of ranges
+    const font_kerning_t *kerning;  //!< Kerning pairs, NULL if characters are always "c" apart
+    uint16_t fallback;              //!< Code point drawn for characters the font does not have, 0 for space
 } font_info_t;
 
 
-#define NUM_FONTS 19    //!< Number of built-in fonts
+/**
+ * @name Built-in font indexes for ssd1306_select_font()
+ * @{
+ */
+#define FONT_BITOCRA_4X7_ASCII                  0
+#define FONT_BITOCRA_6X11_ISO8859_1             1
+#define FONT_BITOCRA_7X13_ISO8859_1             2
+#define FONT_GLCD_5X7                           3
+#define FONT_ROBOTO_8PT                         4
+#define FONT_ROBOTO_10PT                        5
+#define FONT_TERMINUS_6X12_ISO8859_1            6
+#define FONT_TERMINUS_8X14_ISO8859_1            7
+#define FONT_TERMINUS_10X18_ISO8859_1           8
+#define FONT_TERMINUS_11X22_ISO8859_1           9
+#define FONT_TERMINUS_12X24_ISO8859_1          10
+#define FONT_TERMINUS_14X28_ISO8859_1          11
+#define FONT_TERMINUS_16X32_ISO8859_1          12
+#define FONT_TERMINUS_BOLD_8X14_ISO8859_1      13
+#define FONT_TERMINUS_BOLD_10X18_ISO8859_1     14
+#define FONT_TERMINUS_BOLD_11X22_ISO8859_1     15
+#define FONT_TERMINUS_BOLD_12X24_ISO8859_1     16
+#define FONT_TERMINUS_BOLD_14X28_ISO8859_1     17
+#define FONT_TERMINUS_BOLD_16X32_ISO8859_1     18
+#define FONT_TERMINUS_6X12_KOI8_R              19
+#define FONT_TERMINUS_8X14_KOI8_R              20
+#define FONT_TERMINUS_14X28_KOI8_R             21
+#define FONT_TERMINUS_16X32_KOI8_R             22
+#define FONT_TERMINUS_BOLD_8X14_KOI8_R         23
+#define FONT_TERMINUS_BOLD_14X28_KOI8_R        24
+#define FONT_TERMINUS_BOLD_16X32_KOI8_R        25
+#define FONT_TERMINUS_8X14_UNICODE             26
+/** @} */
+
+#define NUM_FONTS 27    //!< Number of built-in fonts
+
+/**
+ * @brief   Built-in fonts, fonts not enabled in menuconfig are NULL
+ * @remark  Referencing this table links every enabled font. Applications that select fonts by pointer
+ *          (ssd1306_select_font_info()) only link the fonts they use.
+ */
+extern const font_info_t * fonts[NUM_FONTS];
 
-extern const font_info_t * fonts[NUM_FONTS];  //!< Built-in fonts
+/**
+ * @name Built-in font information, for ssd1306_select_font_info()
+ * @{
+ */
+extern const font_info_t _fonts_bitocra_4x7_ascii_info;
+extern const font_info_t _fonts_bitocra_6x11_iso8859_1_info;
+extern const font_info_t _fonts_bitocra_7x13_iso8859_1_info;
+extern const font_info_t _fonts_glcd_5x7_info;
+extern const font_info_t _fonts_roboto_8pt_info;
+extern const font_info_t _fonts_roboto_10pt_info;
+extern const font_info_t _fonts_terminus_6x12_iso8859_1_info;
+extern const font_info_t _fonts_terminus_8x14_iso8859_1_info;
+extern const font_info_t _fonts_terminus_10x18_iso8859_1_info;
+extern const font_info_t _fonts_terminus_11x22_iso8859_1_info;
+extern const font_info_t _fonts_terminus_12x24_iso8859_1_info;
+extern const font_info_t _fonts_terminus_14x28_iso8859_1_info;
+extern const font_info_t _fonts_terminus_16x32_iso8859_1_info;
+extern const font_info_t _fonts_terminus_bold_8x14_iso8859_1_info;
+extern const font_info_t _fonts_terminus_bold_10x18_iso8859_1_info;
+extern const font_info_t _fonts_terminus_bold_11x22_iso8859_1_info;
+extern const font_info_t _fonts_terminus_bold_12x24_iso8859_1_info;
+extern const font_info_t _fonts_terminus_bold_14x28_iso8859_1_info;
+extern const font_info_t _fonts_terminus_bold_16x32_iso8859_1_info;
+extern const font_info_t _fonts_terminus_6x12_koi8_r_info;
+extern const font_info_t _fonts_terminus_8x14_koi8_r_info;
+extern const font_info_t _fonts_terminus_14x28_koi8_r_info;
+extern const font_info_t _fonts_terminus_16x32_koi8_r_info;
+extern const font_info_t _fonts_terminus_bold_8x14_koi8_r_info;
+extern const font_info_t _fonts_terminus_bold_14x28_koi8_r_info;
+extern const font_info_t _fonts_terminus_bold_16x32_koi8_r_info;
+extern const font_info_t _fonts_terminus_8x14_unicode_info;
+/** @} */
 
 
 #endif /* FONTS */
@@ -26,6 +26,7 @@
 #ifndef SSD1306_H
 #define SSD1306_H
 #include "stdbool.h"
+#include "fonts.h"
 
 #if CONFIG_OLED_ENABLED
     // I2C OLED Display works with SSD1306 driver
@@ -49,6 +50,9 @@
 #endif // CONFIG_OLED_ENABLED
 
 
+#define SSD1306_NUM_PANELS  2                                   //!< Number of panel IDs (0 and 1)
+#define SSD1306_SURFACE_ID(n)   (SSD1306_NUM_PANELS + (n))      //!< ID of off-screen surface n
+
 
 //! @brief Drawing color
 typedef enum
@@ -60,6 +64,186 @@ typedef enum
 } ssd1306_color_t;
 
 
+//! @brief Raster operation combining source bitmap (S) with destination buffer (D)
+typedef enum
+{
+    SSD1306_ROP_COPY = 0,   //!< D = S
+    SSD1306_ROP_OR,         //!< D = D | S, draw set source pixels in white
+    SSD1306_ROP_AND,        //!< D = D & S
+    SSD1306_ROP_XOR,        //!< D = D ^ S, invert where source is set
+    SSD1306_ROP_ANDNOT,     //!< D = D & ~S, draw set source pixels in black
+} ssd1306_rop_t;
+
+
+//! @brief Polygon vertex
+typedef struct
+{
+    int8_t x;   //!< X coordinate
+    int8_t y;   //!< Y coordinate
+} ssd1306_point_t;
+
+
+//! @brief Polygon fill rule
+typedef enum
+{
+    SSD1306_FILL_EVEN_ODD = 0,  //!< Pixel is inside if a ray from it crosses an odd number of edges
+    SSD1306_FILL_NON_ZERO = 1,  //!< Pixel is inside if the winding number around it is not zero
+} ssd1306_fill_rule_t;
+
+
+//! @brief Horizontal alignment of text box lines
+typedef enum
+{
+    SSD1306_ALIGN_LEFT = 0,     //!< Lines start at the left edge of the box
+    SSD1306_ALIGN_CENTER,       //!< Lines are centred in the box
+    SSD1306_ALIGN_RIGHT,        //!< Lines end at the right edge of the box
+} ssd1306_align_t;
+
+
+//! @brief Text box for #ssd1306_draw_text_box
+typedef struct
+{
+    int8_t x;               //!< X position of the box (top-left corner)
+    int8_t y;               //!< Y position of the box (top-left corner)
+    uint8_t w;              //!< Box width, lines are wrapped or cut to it
+    uint8_t h;              //!< Box height, text is clipped to it
+    int16_t scroll;         //!< Pixels the text is moved up inside the box
+    ssd1306_align_t align;  //!< Horizontal alignment of every line
+    uint8_t line_spacing;   //!< Extra pixels between lines
+    bool wrap;              //!< Break lines at spaces (inside words longer than the box)
+    bool ellipsis;          //!< End lines wider than the box, and the last line that fits if text is left, with "..."
+} ssd1306_text_box_t;
+
+
+#define SSD1306_NUMBER_FIELD_MAX_CELLS  12  //!< Cells of a numeric field, enough for any int32_t with point
+
+
+//! @brief Rectangle
+typedef struct
+{
+    int8_t x;   //!< X coordinate of top-left corner
+    int8_t y;   //!< Y coordinate of top-left corner
+    uint8_t w;  //!< Width, 0 for an empty rectangle
+    uint8_t h;  //!< Height
+} ssd1306_rect_t;
+
+
+/**
+ * @brief   Numeric field drawn into fixed character cells, see #ssd1306_number_field_init
+ * @remark  All members are set by #ssd1306_number_field_init, "shown" tracks what is on the panel.
+ */
+typedef struct
+{
+    int8_t x;                   //!< X position of the field (top-left corner)
+    int8_t y;                   //!< Y position of the field (top-left corner)
+    const font_info_t *font;    //!< Font of the field
+    uint8_t cells;              //!< Number of cells, sign and digits plus one for the decimal point
+    uint8_t decimals;           //!< Digits after the decimal point, 0 for integers
+    uint8_t cell_width;         //!< Width of a sign or digit cell (widest digit of the font)
+    uint8_t point_width;        //!< Width of the decimal point cell
+    uint8_t width;              //!< Width of the whole field
+    int8_t foreground;          //!< Colors the shown cells were drawn with
+    int8_t background;
+    char shown[SSD1306_NUMBER_FIELD_MAX_CELLS]; //!< Characters on the panel, 0 if the cell was not drawn
+} ssd1306_number_field_t;
+
+
+/**
+ * @brief   Text label, rendered once into the panel's label pool and copied from there, see #ssd1306_label_init
+ * @remark  x, y, font and text may be changed at any time. The cache members are set by the driver.
+ */
+typedef struct
+{
+    int8_t x;                   //!< X position of the label (top-left corner)
+    int8_t y;                   //!< Y position of the label (top-left corner)
+    const font_info_t *font;    //!< Font of the label
+    const char *text;           //!< UTF-8 text, a change of its contents is noticed as well
+    uint32_t generation;        //!< Pool generation the bitmap was rendered in, 0 if none
+    uint32_t hash;              //!< Hash of the rendered text
+    const font_info_t *rendered_font;   //!< Font of the rendered bitmap
+    uint16_t offset;            //!< Bitmap position in the pool
+    uint16_t glyphs;            //!< Characters in the bitmap
+    uint8_t width;              //!< Bitmap width, the height is the font height
+} ssd1306_label_t;
+
+
+/**
+ * @brief   Label pool counters, see #ssd1306_label_pool_stats
+ * @remark  The time a pool saves is about glyphs_saved * render_us / glyphs_rendered - blit_us.
+ */
+typedef struct
+{
+    uint32_t hits;              //!< Labels copied from the pool
+    uint32_t renders;           //!< Labels rendered into the pool
+    uint32_t uncached;          //!< Labels drawn from the font because they do not fit the pool
+    uint32_t flushes;           //!< Times the full pool was emptied
+    uint32_t glyphs_rendered;   //!< Characters drawn from font tables (renders and uncached labels)
+    uint32_t glyphs_saved;      //!< Characters not drawn from font tables thanks to hits
+    uint32_t render_us;         //!< Time spent drawing characters from font tables
+    uint32_t blit_us;           //!< Time spent copying labels from the pool
+} ssd1306_label_stats_t;
+
+
+/**
+ * @brief   Text style flags for #ssd1306_select_style, may be combined
+ * @remark  Styles do not change character widths, so text keeps its layout when the style changes.
+ */
+typedef enum
+{
+    SSD1306_STYLE_NORMAL = 0x00,    //!< Glyphs as stored in the font
+    SSD1306_STYLE_BOLD = 0x01,      //!< Glyph ORed with a copy shifted by one column
+    SSD1306_STYLE_OUTLINE = 0x02,   //!< One pixel contour around the glyph, the glyph itself in background color
+    SSD1306_STYLE_UNDERLINE = 0x04, //!< Line one row below the base line
+    SSD1306_STYLE_STRIKE = 0x08,    //!< Line through the middle of lower case letters
+} ssd1306_style_t;
+
+
+//! @brief Rotation of a panel for #ssd1306_set_rotation
+typedef enum
+{
+    SSD1306_ROTATE_0 = 0,   //!< As wired on the usual modules
+    SSD1306_ROTATE_90,      //!< Turned 90 degrees clockwise, portrait
+    SSD1306_ROTATE_180,     //!< Upside down
+    SSD1306_ROTATE_270,     //!< Turned 90 degrees counter-clockwise, portrait
+} ssd1306_rotation_t;
+
+
+//! @brief Direction of a line of text for #ssd1306_draw_string_dir
+typedef enum
+{
+    SSD1306_TEXT_LTR = 0,   //!< Upright, left to right (as #ssd1306_draw_string)
+    SSD1306_TEXT_90,        //!< Turned 90 degrees clockwise, the line runs downwards
+    SSD1306_TEXT_180,       //!< Upside down, the line runs right to left
+    SSD1306_TEXT_270,       //!< Turned 90 degrees counter-clockwise, the line runs upwards
+    SSD1306_TEXT_RTL,       //!< Upright, characters are placed right to left (Hebrew, Arabic presentation forms)
+} ssd1306_text_dir_t;
+
+
+//! @brief Built-in 8x8 stipple patterns for #ssd1306_select_pattern, greys are ordered (Bayer) dithers
+typedef enum
+{
+    SSD1306_PATTERN_SOLID = 0,  //!< Solid fill
+    SSD1306_PATTERN_GREY_87,    //!< 87.5% of pixels set
+    SSD1306_PATTERN_GREY_75,    //!< 75% of pixels set
+    SSD1306_PATTERN_GREY_62,    //!< 62.5% of pixels set
+    SSD1306_PATTERN_GREY_50,    //!< 50% of pixels set (checkerboard)
+    SSD1306_PATTERN_GREY_37,    //!< 37.5% of pixels set
+    SSD1306_PATTERN_GREY_25,    //!< 25% of pixels set
+    SSD1306_PATTERN_GREY_12,    //!< 12.5% of pixels set
+    SSD1306_PATTERN_HATCH_H,    //!< Horizontal lines every 4th row
+    SSD1306_PATTERN_HATCH_V,    //!< Vertical lines every 4th column
+    SSD1306_PATTERN_HATCH_DIAG, //!< Diagonal lines
+    SSD1306_PATTERN_COUNT       //!< Number of built-in patterns
+} ssd1306_pattern_t;
+
+/**
+ * @brief   Built-in stipple patterns
+ * @remark  A pattern is 8 column bytes in display buffer order: byte n covers columns with x % 8 == n,
+ *          bit m of it covers rows with y % 8 == m.
+ */
+extern const uint8_t ssd1306_patterns[SSD1306_PATTERN_COUNT][8];
+
+
 /**
  * @brief   Initialize OLED panel
  * @param   id  Panel ID
@@ -80,6 +264,26 @@ bool ssd1306_init(uint8_t id,uint8_t scl_pin, uint8_t sda_pin);
 void ssd1306_term(uint8_t id);
 
 
+/**
+ * @brief   Initialize off-screen surface
+ * @param   id      Surface ID, see #SSD1306_SURFACE_ID (up to CONFIG_OLED_NUM_SURFACES surfaces)
+ * @param   width   Surface width, at most 128
+ * @param   height  Surface height, at most 128
+ * @param   buffer  Page-major buffer of width * ((height + 7) / 8) bytes, or NULL to allocate (and clear) one
+ * @return  true if successful
+ * @remark  A surface behaves like a panel for every drawing function, #ssd1306_refresh and
+ *          #ssd1306_invert_display do nothing on it. Use #ssd1306_composite to put it onto a panel.
+ */
+bool ssd1306_surface_init(uint8_t id, uint8_t width, uint8_t height, uint8_t *buffer);
+
+
+/**
+ * @brief   De-initialize off-screen surface, free its buffer if it was allocated by #ssd1306_surface_init
+ * @param   id  Surface ID
+ */
+void ssd1306_surface_term(uint8_t id);
+
+
 /**
  * @brief   Return OLED panel width
  * @param   id  Panel ID
@@ -98,6 +302,8 @@ uint8_t ssd1306_get_height(uint8_t id);
 /**
  * @brief   Clear display buffer (fill with black)
  * @param   id Panel ID
+ * @remark  In page-band mode the display list is emptied, drawing starts again from the current font, pattern and
+ *          style.
  */
 void ssd1306_clear(uint8_t id);
 
@@ -106,6 +312,7 @@ void ssd1306_clear(uint8_t id);
  * @param   id      Panel ID
  * @param   force   The program automatically tracks "dirty" region to minimize refresh area. Set #force to true
  *                  ignores the dirty region and refresh the whole screen.
+ * @remark  In page-band mode the whole screen is drawn from the display list and sent, page by page.
  */
 void ssd1306_refresh(uint8_t id, bool force);
 
@@ -184,44 +391,329 @@ void ssd1306_draw_circle(uint8_t id, int8_t x0, int8_t y0, uint8_t r, ssd1306_co
  */
 void ssd1306_fill_circle(uint8_t id, int8_t x0, int8_t y0, uint8_t r, ssd1306_color_t color);
 
+/**
+ * @brief   Draw a filled triangle
+ * @param   id      Panel ID
+ * @param   x0      X coordinate of first vertex
+ * @param   y0      Y coordinate of first vertex
+ * @param   x1      X coordinate of second vertex
+ * @param   y1      Y coordinate of second vertex
+ * @param   x2      X coordinate of third vertex
+ * @param   y2      Y coordinate of third vertex
+ * @param   color   Color of the triangle
+ * @remark  Same coverage rules as #ssd1306_fill_polygon
+ */
+void ssd1306_fill_triangle(uint8_t id, int8_t x0, int8_t y0, int8_t x1, int8_t y1, int8_t x2, int8_t y2,
+                           ssd1306_color_t color);
+
+/**
+ * @brief   Draw a filled polygon (convex, concave or self-intersecting)
+ * @param   id      Panel ID
+ * @param   points  Polygon vertices, the last vertex is connected back to the first one
+ * @param   n       Number of vertices, at most CONFIG_OLED_POLYGON_MAX_VERTICES
+ * @param   rule    Fill rule deciding which pixels are inside
+ * @param   color   Color of the polygon
+ * @remark  Pixels are sampled at their centre with a top-left convention: the bottom and right edges are
+ *          not filled. Polygons sharing an edge therefore cover every pixel exactly once, which keeps
+ *          SSD1306_COLOR_INVERT stable for adjacent shapes.
+ */
+void ssd1306_fill_polygon(uint8_t id, const ssd1306_point_t *points, uint8_t n, ssd1306_fill_rule_t rule,
+                          ssd1306_color_t color);
+
+/**
+ * @brief   Fill the connected region around a pixel
+ * @param   id      Panel ID
+ * @param   x       X coordinate of seed pixel
+ * @param   y       Y coordinate of seed pixel
+ * @param   color   New color of the region
+ * @return  true if the whole region was filled, false if the span stack (CONFIG_OLED_FLOOD_FILL_STACK)
+ *          overflowed and the fill is incomplete
+ * @remark  The region consists of all pixels 4-connected to the seed that have the same color as the seed.
+ *          Selected stipple patterns are ignored.
+ */
+bool ssd1306_flood_fill(uint8_t id, int8_t x, int8_t y, ssd1306_color_t color);
+
+/**
+ * @brief   Select stipple pattern for fill primitives
+ * @param   id      Panel ID
+ * @param   pattern 8 column bytes (see #ssd1306_patterns), or NULL for solid fill
+ * @remark  The pattern is anchored to the panel origin and applies to #ssd1306_fill_rectangle,
+ *          #ssd1306_fill_circle, #ssd1306_fill_triangle and #ssd1306_fill_polygon. Only pixels set in the
+ *          pattern are drawn, the fill color acts as raster operation (WHITE sets, BLACK clears, INVERT
+ *          toggles). The pattern is not copied and must stay valid while selected.
+ */
+void ssd1306_select_pattern(uint8_t id, const uint8_t *pattern);
+
 /**
  * @brief   Select font for drawing
  * @param   id      Panel ID
- * @param   idx     Font index, see fonts.c
+ * @param   idx     Font index (FONT_xxx, see fonts.h)
+ * @remark  Fonts disabled in menuconfig are ignored, the selected font does not change.
  */
 void ssd1306_select_font(uint8_t id, uint8_t idx);
 
+/**
+ * @brief   Select font for drawing by pointer
+ * @param   id      Panel ID
+ * @param   font    Font information, a built-in font (e.g. &_fonts_glcd_5x7_info) or one generated by fontc
+ * @remark  Unlike #ssd1306_select_font this does not pull the table of all built-in fonts into the
+ *          binary, the linker drops every font that is not referenced. The font is not copied and must
+ *          stay valid while selected.
+ */
+void ssd1306_select_font_info(uint8_t id, const font_info_t *font);
+
+/**
+ * @brief   Select text style
+ * @param   id      Panel ID
+ * @param   style   SSD1306_STYLE_xxx flags, ORed
+ * @remark  Styles are applied to the column bytes of a glyph while it is drawn, a regular font with
+ *          SSD1306_STYLE_BOLD looks like its bold variant (Terminus bold is Terminus with every pixel doubled to
+ *          the left), so the bold font tables are not needed. Bold ink and the contour may reach one column into
+ *          the space between characters, lines are drawn across it. Glyphs larger than 64x32 and scaled text
+ *          are drawn without style. Labels of the label pool are always drawn in normal style.
+ */
+void ssd1306_select_style(uint8_t id, uint8_t style);
+
 /**
  * @brief   Draw one character using currently selected font
  * @param   id          Panel ID
  * @param   x           X position of character (top-left corner)
  * @param   y           Y position of character (top-left corner)
- * @param   c           The character to draw
+ * @param   c           The character to draw (8-bit code, Latin-1 for Unicode fonts)
  * @param   foreground  Character color
  * @param   background  Background color
  * @return  Width of the character
  */
 uint8_t ssd1306_draw_char(uint8_t id, uint8_t x, uint8_t y,unsigned char c, ssd1306_color_t foreground, ssd1306_color_t background);
 
+/**
+ * @brief   Draw one Unicode character using currently selected font
+ * @param   id          Panel ID
+ * @param   x           X position of character (top-left corner)
+ * @param   y           Y position of character (top-left corner)
+ * @param   code        Code point. Fonts without ranges (font_info_t::ranges) take it as 8-bit code.
+ * @param   foreground  Character color
+ * @param   background  Background color
+ * @return  Width of the character
+ * @remark  Characters missing in the font are drawn as its fallback glyph (font_info_t::fallback) or as space.
+ *          The glyph is found with a binary search over the ranges of the font, the first range (usually ASCII) is
+ *          checked directly.
+ */
+uint8_t ssd1306_draw_codepoint(uint8_t id, uint8_t x, uint8_t y, uint32_t code, ssd1306_color_t foreground,
+                               ssd1306_color_t background);
+
+/**
+ * @brief   Draw one character magnified using currently selected font
+ * @param   id          Panel ID
+ * @param   x           X position of character (top-left corner)
+ * @param   y           Y position of character (top-left corner)
+ * @param   code        Code point, see #ssd1306_draw_codepoint
+ * @param   scale       Magnification 1..4, every font pixel becomes a scale x scale block
+ * @param   foreground  Character color
+ * @param   background  Background color
+ * @return  Width of the character (scaled), 0 if scale is out of range
+ * @remark  Big digits without big font tables: every column byte of the glyph is expanded to "scale" bytes with
+ *          a 16 entry table per nibble and written to the display buffer a page at a time. Works with all font
+ *          layouts, the glyph cache is not used.
+ */
+uint16_t ssd1306_draw_char_scaled(uint8_t id, uint8_t x, uint8_t y, uint32_t code, uint8_t scale,
+                                  ssd1306_color_t foreground, ssd1306_color_t background);
+
+/**
+ * @brief   Draw string magnified using currently selected font
+ * @param   id          Panel ID
+ * @param   x           X position of string (top-left corner)
+ * @param   y           Y position of string (top-left corner)
+ * @param   str         The string to draw, UTF-8
+ * @param   scale       Magnification 1..4, character spacing is scaled too
+ * @param   foreground  Character color
+ * @param   background  Background color
+ * @return  Width of the string (out-of-display pixels also included)
+ */
+uint16_t ssd1306_draw_string_scaled(uint8_t id, uint8_t x, uint8_t y, const char *str, uint8_t scale,
+                                    ssd1306_color_t foreground, ssd1306_color_t background);
+
+/**
+ * @brief   Decode the next character of a UTF-8 string
+ * @param   str     Pointer into the string, advanced past the character (not past the terminating 0)
+ * @return  Code point, 0 at the end of the string
+ * @remark  Bytes that do not start a valid UTF-8 sequence are returned as they are, so Latin-1 and KOI8-R
+ *          strings still work with fonts of that character set.
+ */
+uint32_t ssd1306_utf8_next(const char **str);
+
+/**
+ * @brief   Enable glyph cache for a panel
+ * @param   id      Panel ID
+ * @param   size    RAM budget in bytes (allocated at once)
+ * @return  true if successful
+ * @remark  Cached glyphs are stored as column bytes, already shifted to the row offset they were drawn at, so
+ *          redrawing them (e.g. the digits of a clock) is a masked copy of a few bytes. The least recently used
+ *          glyph is evicted when the cache is full. A 16x32 glyph takes 92 bytes.
+ */
+bool ssd1306_glyph_cache_init(uint8_t id, uint16_t size);
+
+/**
+ * @brief   Disable glyph cache and free its memory
+ * @param   id      Panel ID
+ */
+void ssd1306_glyph_cache_term(uint8_t id);
+
+/**
+ * @brief   Get glyph cache counters
+ * @param   id      Panel ID
+ * @param   hits    Number of glyphs drawn from cache (may be NULL)
+ * @param   misses  Number of glyphs decoded into the cache (may be NULL)
+ */
+void ssd1306_glyph_cache_stats(uint8_t id, uint32_t *hits, uint32_t *misses);
+
 /**
  * @brief   Draw string using currently selected font
  * @param   id          Panel ID
  * @param   x           X position of string (top-left corner)
  * @param   y           Y position of string (top-left corner)
- * @param   str         The string to draw
+ * @param   str         The string to draw, UTF-8 (see #ssd1306_utf8_next)
  * @param   foreground  Character color
  * @param   background  Background color
  * @return  Width of the string (out-of-display pixels also included)
  */
-uint8_t ssd1306_draw_string(uint8_t id, uint8_t x, uint8_t y, char *str, ssd1306_color_t foreground, ssd1306_color_t background);
+uint16_t ssd1306_draw_string(uint8_t id, uint8_t x, uint8_t y, const char *str, ssd1306_color_t foreground,
+                             ssd1306_color_t background);
+
+/**
+ * @brief   Draw string turned or right to left using currently selected font
+ * @param   id          Panel ID
+ * @param   x           X position of the line (top-left corner of the area it covers)
+ * @param   y           Y position of the line (top-left corner of the area it covers)
+ * @param   str         The string to draw, UTF-8
+ * @param   dir         Direction of the line, turned lines are font height wide and as long as the string
+ * @param   foreground  Character color
+ * @param   background  Background color
+ * @return  Length of the line (out-of-display pixels also included), the width from #ssd1306_measure_string
+ * @remark  Glyphs are turned 8x8 pixels at a time, not pixel by pixel. Kerning, the fallback glyph and the selected
+ *          style apply as for #ssd1306_draw_string, glyphs wider than 30 pixels are only drawn upright or upside
+ *          down. Right-to-left lines keep the glyphs upright and place the first character at the right end, the
+ *          string is expected in logical order without bidirectional reordering.
+ */
+uint16_t ssd1306_draw_string_dir(uint8_t id, uint8_t x, uint8_t y, const char *str, ssd1306_text_dir_t dir,
+                                 ssd1306_color_t foreground, ssd1306_color_t background);
 
 /**
  * @brief   Measure width of string with current selected font
  * @param   id          Panel ID
- * @param   str         String to measure
+ * @param   str         String to measure, UTF-8
  * @return  Width of the string
  */
-uint8_t ssd1306_measure_string(uint8_t id, char *str);
+uint16_t ssd1306_measure_string(uint8_t id, const char *str);
+
+/**
+ * @brief   Draw text into a box with word wrap, alignment and ellipsis using currently selected font
+ * @param   id          Panel ID
+ * @param   box         Position, size and layout of the box
+ * @param   str         The text to draw, UTF-8, '\\n' starts a new line
+ * @param   foreground  Character color
+ * @param   background  Background color, an opaque one fills the whole box
+ * @return  Height of the text (all lines, also those outside the box)
+ * @remark  Lines are laid out in one pass over the string, every character is measured once. Only lines that
+ *          intersect the box are drawn and glyphs are clipped to it, so long texts can be scrolled with
+ *          ssd1306_text_box_t::scroll. The ellipsis is U+2026 if the font has it.
+ */
+uint16_t ssd1306_draw_text_box(uint8_t id, const ssd1306_text_box_t *box, const char *str,
+                               ssd1306_color_t foreground, ssd1306_color_t background);
+
+/**
+ * @brief   Measure text laid out in a box without drawing it
+ * @param   id          Panel ID
+ * @param   box         Position, size and layout of the box
+ * @param   str         Text to measure, UTF-8
+ * @return  Height of the text, same as #ssd1306_draw_text_box returns
+ */
+uint16_t ssd1306_measure_text_box(uint8_t id, const ssd1306_text_box_t *box, const char *str);
+
+/**
+ * @brief   Set up a numeric field
+ * @param   field       Field to set up
+ * @param   x           X position of the field (top-left corner)
+ * @param   y           Y position of the field (top-left corner)
+ * @param   font        Font of the field
+ * @param   digits      Cells for sign and digits (not counting the decimal point), numbers are right aligned
+ * @param   decimals    Digits after the decimal point, 0 for integers
+ * @return  true if successful, false if the field has more than #SSD1306_NUMBER_FIELD_MAX_CELLS cells or no
+ *          digit in front of the point
+ * @remark  Every sign or digit cell is as wide as the widest digit, so digits do not move when the value changes.
+ */
+bool ssd1306_number_field_init(ssd1306_number_field_t *field, int8_t x, int8_t y, const font_info_t *font,
+                               uint8_t digits, uint8_t decimals);
+
+/**
+ * @brief   Show a value in a numeric field, only cells whose character changed are drawn
+ * @param   id          Panel ID
+ * @param   field       Field set up by #ssd1306_number_field_init
+ * @param   value       Value, fixed-point with field->decimals digits after the point (1234 shows as 12.34 with
+ *                      2 decimals)
+ * @param   foreground  Digit color
+ * @param   background  Background color, should be opaque (black or white) to replace the old digits
+ * @param   dirty       Set to the cells that were drawn, w = 0 if nothing changed (may be NULL)
+ * @return  true if any cell was drawn
+ * @remark  Values that do not fit show '-' in every digit cell. Changing colors redraws every cell, after the
+ *          panel was cleared #ssd1306_number_field_invalidate makes the next call draw the whole field.
+ */
+bool ssd1306_number_field_draw(uint8_t id, ssd1306_number_field_t *field, int32_t value,
+                               ssd1306_color_t foreground, ssd1306_color_t background, ssd1306_rect_t *dirty);
+
+/**
+ * @brief   Forget what a numeric field shows, the next #ssd1306_number_field_draw draws every cell
+ * @param   field       Field
+ */
+void ssd1306_number_field_invalidate(ssd1306_number_field_t *field);
+
+/**
+ * @brief   Enable the label pool of a panel
+ * @param   id      Panel ID
+ * @param   size    RAM budget in bytes (allocated at once)
+ * @return  true if successful
+ * @remark  A label takes width * ((font height + 7) / 8) bytes, "TEMP" in Terminus 8x14 takes 64 bytes. When the
+ *          pool is full it is emptied and labels render again as they are drawn, so it should hold every label
+ *          of a screen.
+ */
+bool ssd1306_label_pool_init(uint8_t id, uint16_t size);
+
+/**
+ * @brief   Disable the label pool and free its memory
+ * @param   id      Panel ID
+ */
+void ssd1306_label_pool_term(uint8_t id);
+
+/**
+ * @brief   Get label pool counters
+ * @param   id      Panel ID
+ * @param   stats   Counters since #ssd1306_label_pool_init, all 0 without pool
+ */
+void ssd1306_label_pool_stats(uint8_t id, ssd1306_label_stats_t *stats);
+
+/**
+ * @brief   Set up a label
+ * @param   label   Label to set up
+ * @param   x       X position of the label (top-left corner)
+ * @param   y       Y position of the label (top-left corner)
+ * @param   font    Font of the label
+ * @param   text    UTF-8 text, must stay valid while the label is used
+ */
+void ssd1306_label_init(ssd1306_label_t *label, int8_t x, int8_t y, const font_info_t *font, const char *text);
+
+/**
+ * @brief   Draw a label
+ * @param   id          Panel ID
+ * @param   label       Label set up by #ssd1306_label_init
+ * @param   foreground  Text color
+ * @param   background  Background color, an opaque background fills the whole label including the gaps
+ * @return  Width of the label
+ * @remark  The first draw renders the text into a page-aligned bitmap in the panel's label pool (if enabled),
+ *          later draws copy the bitmap. Changing the text or font renders it again. Labels wider than 128 pixels
+ *          or larger than the pool are drawn from the font every time.
+ */
+uint16_t ssd1306_label_draw(uint8_t id, ssd1306_label_t *label, ssd1306_color_t foreground,
+                            ssd1306_color_t background);
 
 /**
  * @brief   Get the height of current selected font
@@ -237,6 +729,29 @@ uint8_t ssd1306_get_font_height(uint8_t id);
  */
 uint8_t ssd1306_get_font_c(uint8_t id);
 
+/**
+ * @brief   Draw page-major bitmap (same layout as the display buffer)
+ * @param   id      Panel ID
+ * @param   x       X position of bitmap (top-left corner)
+ * @param   y       Y position of bitmap (top-left corner)
+ * @param   w       Bitmap width
+ * @param   h       Bitmap height
+ * @param   bitmap  w * ((h + 7) / 8) bytes, byte n of page p holds column n of rows p * 8 .. p * 8 + 7
+ * @param   rop     Raster operation
+ */
+void ssd1306_draw_bitmap(uint8_t id, int8_t x, int8_t y, uint8_t w, uint8_t h, const uint8_t *bitmap,
+                         ssd1306_rop_t rop);
+
+/**
+ * @brief   Composite a surface onto a panel (or another surface)
+ * @param   dst_id  Destination panel or surface ID
+ * @param   x       X position of the surface on destination (top-left corner)
+ * @param   y       Y position of the surface on destination (top-left corner)
+ * @param   src_id  Source surface (or panel) ID
+ * @param   rop     Raster operation
+ */
+void ssd1306_composite(uint8_t dst_id, int8_t x, int8_t y, uint8_t src_id, ssd1306_rop_t rop);
+
 /**
  * @brief   Set normal or inverted display
  * @param   id          Panel ID
@@ -244,6 +759,31 @@ uint8_t ssd1306_get_font_c(uint8_t id);
  */
 void ssd1306_invert_display(uint8_t id, bool invert);
 
+/**
+ * @brief   Set the display RAM row shown at the top of the panel
+ * @param   id          Panel ID
+ * @param   line        Start line 0..63
+ * @remark  The panel shows RAM rows line, line + 1, ... wrapping at row 63, so moving the start line scrolls the
+ *          whole picture without resending it. Drawing coordinates are RAM coordinates and do not move.
+ *          Does nothing on surfaces.
+ */
+void ssd1306_set_start_line(uint8_t id, uint8_t line);
+
+/**
+ * @brief   Rotate and mirror the picture of a panel
+ * @param   id          Panel ID
+ * @param   rotation    Turn of the picture, clockwise
+ * @param   mirror      Mirror the picture left to right
+ * @return  true if the panel was set up, false for surfaces
+ * @remark  0 and 180 degrees and mirroring are done by the controller (segment remap and COM scan direction) and
+ *          cost nothing. 90 and 270 degrees swap width and height (#ssd1306_get_width), drawing works on the turned
+ *          picture as usual and #ssd1306_refresh transposes the dirty area 8x8 pixels at a time while sending it.
+ *          The buffer is cleared when width and height swap, the whole panel is sent by the next refresh in any
+ *          case. #ssd1306_set_start_line scrolls the panel, for quarter turns that is left to right in the picture.
+ *          The rotation after #ssd1306_init is set in menuconfig (OLED_ROTATION, OLED_MIRROR).
+ */
+bool ssd1306_set_rotation(uint8_t id, ssd1306_rotation_t rotation, bool mirror);
+
 /**
  * @brief   Direct update display buffer
  * @param   id          Panel ID
@@ -252,6 +792,38 @@ void ssd1306_invert_display(uint8_t id, bool invert);
  */
 void ssd1306_update_buffer(uint8_t id, uint8_t* data, uint16_t length);
 
+/**
+ * @brief   Switch a panel to page-band mode, the frame buffer shrinks to one page (128 bytes)
+ * @param   id      Panel ID
+ * @param   size    Bytes for the display list (allocated at once)
+ * @return  true if successful
+ * @remark  Draw calls are recorded into the display list with their arguments. Strings, text boxes and vertices
+ *          are copied, bitmaps are not (they must stay unchanged until the refresh). #ssd1306_refresh draws the
+ *          list once for every page into the page buffer, with the same code as a full frame buffer, and sends the
+ *          page: 128 + size bytes of RAM instead of 1024, the list is drawn 8 times (4 on 128x32 panels) per refresh.
+ *          The list grows until #ssd1306_clear, so every screen starts with a clear. Calls that read the picture
+ *          back are not available: #ssd1306_flood_fill and #ssd1306_update_buffer fail, labels are drawn as text,
+ *          the console needs the frame buffer and rotation is limited to 0 and 180 degrees. Panel 0 starts in
+ *          this mode with menuconfig OLED_BAND_LIST_SIZE.
+ */
+bool ssd1306_band_init(uint8_t id, uint16_t size);
+
+/**
+ * @brief   Leave page-band mode, the frame buffer is allocated again and cleared
+ * @param   id      Panel ID
+ * @return  true if the panel now has a frame buffer
+ */
+bool ssd1306_band_term(uint8_t id);
+
+/**
+ * @brief   Get display list counters
+ * @param   id      Panel ID
+ * @param   used    Bytes of the display list in use (may be NULL)
+ * @param   dropped Draw calls that did not fit since #ssd1306_clear and are missing from the picture (may be NULL)
+ * @return  true if the panel is in page-band mode
+ */
+bool ssd1306_band_stats(uint8_t id, uint16_t *used, uint16_t *dropped);
+
 
 
 #endif  /* SSD1306_H */
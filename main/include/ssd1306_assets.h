@@ -0,0 +1,179 @@
+/**
+  ******************************************************************************
+  * @file    ssd1306_assets.h
+  * @brief   Font and image asset packs for the SSD1306 OLED driver, loaded at runtime
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#ifndef SSD1306_ASSETS_H
+#define SSD1306_ASSETS_H
+#include "stdbool.h"
+#include "fonts.h"
+
+
+/**
+ * @name Asset pack format
+ * @remark  A pack is written by tools/fontc (--pack). All numbers are little-endian, offsets count from the start
+ *          of the pack and every table starts at a multiple of 4, so the tables of a font are used where they are
+ *          (they have the layout of font_char_desc_t, font_glyph_box_t, font_range_t and the kerning arrays of
+ *          font_kerning_t on the target). Only the font information and kerning, which hold pointers, are built
+ *          in RAM.
+ * @{
+ */
+#define SSD1306_ASSETS_MAGIC    0x44454c4f  //!< "OLED"
+#define SSD1306_ASSETS_VERSION  2
+#define SSD1306_ASSET_NAME_SIZE 32          //!< Size of an entry name, including the terminating NUL
+
+#define SSD1306_ASSET_FONT      1           //!< Entry is a font, see ssd1306_pack_font_t
+#define SSD1306_ASSET_IMAGE     2           //!< Entry is an image, see ssd1306_pack_image_t
+
+//! @brief Start of a pack, followed by num_entries entries
+typedef struct
+{
+    uint32_t magic;             //!< SSD1306_ASSETS_MAGIC
+    uint16_t version;           //!< SSD1306_ASSETS_VERSION
+    uint16_t num_entries;       //!< Number of entries
+    uint32_t size;              //!< Size of the pack in bytes
+} ssd1306_pack_header_t;
+
+//! @brief Named asset of a pack
+typedef struct
+{
+    char name[SSD1306_ASSET_NAME_SIZE]; //!< Name, NUL terminated
+    uint8_t type;               //!< SSD1306_ASSET_xxx
+    uint8_t reserved[3];
+    uint32_t offset;            //!< Offset of the ssd1306_pack_font_t or ssd1306_pack_image_t
+} ssd1306_pack_entry_t;
+
+//! @brief Font of a pack, fields as in font_info_t, tables are offsets (0 if the font has none)
+typedef struct
+{
+    uint8_t height;
+    uint8_t c;
+    uint8_t char_start;
+    uint8_t char_end;
+    uint8_t flags;
+    uint8_t width;
+    uint16_t stride;
+    uint16_t num_chars;         //!< Entries of the descriptor and box tables, glyphs of FONT_FLAG_MONO fonts
+    uint16_t num_ranges;
+    uint16_t num_kern_lefts;    //!< Left characters of the kerning pairs, as font_kerning_t::num_lefts
+    uint16_t num_kern_pairs;    //!< Entries of the right character and adjustment tables
+    uint16_t fallback;
+    uint16_t reserved;
+    uint32_t bitmap;
+    uint32_t bitmap_size;       //!< Size of the bitmap in bytes
+    uint32_t char_descriptors;
+    uint32_t boxes;
+    uint32_t ranges;
+    uint32_t kern_lefts;        //!< num_kern_lefts + 1 entries
+    uint32_t kern_rights;
+    uint32_t kern_adjust;
+} ssd1306_pack_font_t;
+
+//! @brief Image of a pack
+typedef struct
+{
+    uint8_t width;
+    uint8_t height;
+    uint16_t reserved;
+    uint32_t bitmap;            //!< width * ((height + 7) / 8) bytes, page-major (see #ssd1306_draw_bitmap)
+} ssd1306_pack_image_t;
+/** @} */
+
+
+//! @brief Opened asset pack, see #ssd1306_assets_open
+typedef struct
+{
+    const uint8_t *data;        //!< The pack
+    uint32_t size;              //!< Size of the pack
+    font_info_t *fonts;         //!< Font information of every entry (unused for images)
+    font_kerning_t *kerning;    //!< Kerning of every entry, allocated with the fonts
+    uint32_t handle;            //!< Mapping of the pack, unmapped by #ssd1306_assets_close
+    bool mapped;                //!< Pack was mapped by the driver
+} ssd1306_assets_t;
+
+//! @brief Image of a pack, see #ssd1306_assets_image
+typedef struct
+{
+    uint8_t width;
+    uint8_t height;
+    const uint8_t *bitmap;      //!< Points into the pack
+} ssd1306_asset_image_t;
+
+
+/**
+ * @brief   Open a pack that is in memory already (a const array, a pack read into RAM)
+ * @param   assets  Pack to set up
+ * @param   data    Pack, 4-byte aligned, must stay valid until #ssd1306_assets_close
+ * @param   size    Bytes available at data
+ * @return  true if the pack is valid
+ * @remark  Every table of the pack is checked against its size once, drawing from the fonts trusts them.
+ */
+bool ssd1306_assets_open(ssd1306_assets_t *assets, const void *data, uint32_t size);
+
+#ifdef ESP_PLATFORM
+/**
+ * @brief   Open a pack written to a data partition, the partition is memory mapped
+ * @param   assets  Pack to set up
+ * @param   label   Partition label, e.g. "assets" for "assets, data, 0x40, , 256K" in the partition table
+ * @return  true if the partition exists and holds a valid pack
+ * @remark  Glyphs are read from flash through the cache like built-in fonts, no RAM is used for them. The
+ *          partition is written with "parttool.py write_partition --partition-name assets --input assets.pack"
+ *          or esptool at the partition offset, without building the firmware again.
+ */
+bool ssd1306_assets_open_partition(ssd1306_assets_t *assets, const char *label);
+#else
+/**
+ * @brief   Open a pack file, the file is memory mapped
+ * @param   assets  Pack to set up
+ * @param   path    Pack file
+ * @return  true if the file exists and holds a valid pack
+ */
+bool ssd1306_assets_open_file(ssd1306_assets_t *assets, const char *path);
+#endif
+
+/**
+ * @brief   Close a pack, its fonts and images must not be used any more
+ * @param   assets  Pack opened by one of the ssd1306_assets_open functions
+ */
+void ssd1306_assets_close(ssd1306_assets_t *assets);
+
+/**
+ * @brief   Find a font of a pack by name
+ * @param   assets  Opened pack
+ * @param   name    Font name, e.g. "terminus_8x14_iso8859_1"
+ * @return  Font information for #ssd1306_select_font_info, the console and labels, NULL if the pack has no such font
+ */
+const font_info_t *ssd1306_assets_font(const ssd1306_assets_t *assets, const char *name);
+
+/**
+ * @brief   Select a font of a pack by name for drawing
+ * @param   id      Panel ID
+ * @param   assets  Opened pack
+ * @param   name    Font name
+ * @return  true if the pack has the font, the selected font does not change otherwise
+ */
+bool ssd1306_assets_select_font(uint8_t id, const ssd1306_assets_t *assets, const char *name);
+
+/**
+ * @brief   Find an image of a pack by name
+ * @param   assets  Opened pack
+ * @param   name    Image name
+ * @param   image   Size and bitmap of the image, the bitmap for #ssd1306_draw_bitmap
+ * @return  true if the pack has the image
+ */
+bool ssd1306_assets_image(const ssd1306_assets_t *assets, const char *name, ssd1306_asset_image_t *image);
+
+
+#endif  /* SSD1306_ASSETS_H */
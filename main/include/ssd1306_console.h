@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file    ssd1306_console.h
+  * @brief   Text console on top of the SSD1306 OLED driver
+  *
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE.
+  *
+  */
+
+#ifndef SSD1306_CONSOLE_H
+#define SSD1306_CONSOLE_H
+#include "stdbool.h"
+#include "fonts.h"
+
+
+/**
+ * @brief   Turn a panel into a text console
+ * @param   id      Panel ID, the panel must be initialized
+ * @param   font    Monospace font (FONT_FLAG_MONO), e.g. &_fonts_glcd_5x7_info
+ * @return  true if successful
+ * @remark  The console owns the panel: it selects the font, clears the panel and keeps a grid of as many character
+ *          cells as fit. Only cells whose character or attribute changed are drawn again. On 128x64 panels text
+ *          lines are padded to 8, 16 or 32 rows if that does not cost a line (e.g. Terminus 8x14 gives 4 lines of
+ *          16 rows). New lines then scroll in by moving the display start line, so a line of output sends one text
+ *          line of data to the panel. Other panels and fonts scroll by redrawing the cells that changed.
+ */
+bool ssd1306_console_init(uint8_t id, const font_info_t *font);
+
+/**
+ * @brief   Stop the console and free its memory, the display start line is reset
+ * @param   id      Panel ID
+ */
+void ssd1306_console_term(uint8_t id);
+
+/**
+ * @brief   Write text to the console and refresh the panel
+ * @param   id      Panel ID
+ * @param   str     UTF-8 text
+ * @remark  Control characters: '\\n' starts a new line (and returns the carriage), '\\r' returns the carriage,
+ *          '\\b' moves back, '\\t' moves to the next multiple of 8 columns. Text wraps at the end of a line.
+ *          Supported ANSI escape sequences: ESC [ n A/B/C/D (cursor up, down, right, left), ESC [ row ; col H
+ *          (cursor position, from 1), ESC [ n J (erase screen: 0 to end, 1 to cursor, 2 all), ESC [ n K (erase
+ *          line), ESC [ n m (0 normal, 7 inverse, 27 not inverse) and ESC c (reset). Other sequences are ignored.
+ */
+void ssd1306_console_write(uint8_t id, const char *str);
+
+/**
+ * @brief   Write formatted text to the console
+ * @param   id      Panel ID
+ * @param   format  printf format string
+ * @return  Number of characters printf produced, output beyond CONFIG_OLED_CONSOLE_PRINTF_BUFFER - 1 is cut
+ */
+int ssd1306_console_printf(uint8_t id, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+/**
+ * @brief   Clear the console, move the cursor home and reset attributes
+ * @param   id      Panel ID
+ */
+void ssd1306_console_clear(uint8_t id);
+
+
+#endif  /* SSD1306_CONSOLE_H */
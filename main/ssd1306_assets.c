@@ -0,0 +1,373 @@
+/**
+  ******************************************************************************
+  * @file    ssd1306_assets.c
+  * @brief   Font and image asset packs for the SSD1306 OLED driver, loaded at runtime
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE,
+  *
+  ******************************************************************************
+  */
+
+
+#include <esp_log.h>
+#include "stdlib.h"
+#include "string.h"
+#include "ssd1306.h"
+#include "ssd1306_assets.h"
+#ifdef ESP_PLATFORM
+#include <esp_partition.h>
+#include <esp_spi_flash.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+// Table of n entries of "size" bytes at "offset" lies inside the pack and is aligned, offset 0 is no table
+static bool _table_ok(const ssd1306_assets_t *assets, uint32_t offset, uint32_t n, uint32_t size)
+{
+    if (offset == 0)
+        return n == 0;
+    return !(offset & 3) && (offset <= assets->size) && (n <= (assets->size - offset) / size);
+}
+
+
+// Bytes of a glyph that is not run-length coded
+static uint32_t _glyph_size(const ssd1306_pack_font_t *pf, uint8_t w, uint8_t h)
+{
+    if (pf->flags & FONT_FLAG_PAGES)
+        return (uint32_t)w * ((h + 7) / 8);
+    return (uint32_t)((w + 7) / 8) * h;
+}
+
+
+// Bytes of the run-length code of a glyph of "n" column bytes, UINT32_MAX if it is longer than "avail"
+static uint32_t _rle_size(const uint8_t *code, uint32_t avail, uint32_t n)
+{
+    uint32_t i = 0, run;
+    uint8_t token;
+
+    while (n)
+    {
+        if (i >= avail)
+            return UINT32_MAX;
+        token = code[i++];
+        run = (token & ((token & 0x80) ? 0x3f : 0x7f)) + 1;
+        if (run > n)
+            run = n;
+        // a fill run has its byte, literal bytes are only read as far as the glyph goes
+        if ((token & 0xc0) == 0xc0)
+            ++i;
+        else if ((token & 0x80) == 0)
+            i += run;
+        if (i > avail)
+            return UINT32_MAX;
+        n -= run;
+    }
+    return i;
+}
+
+
+// Check the tables of a font and fill in its font information
+static bool _load_font(ssd1306_assets_t *assets, const ssd1306_pack_font_t *pf, font_info_t *font,
+                       font_kerning_t *kerning)
+{
+    const font_char_desc_t *desc = (const font_char_desc_t *)(assets->data + pf->char_descriptors);
+    const font_glyph_box_t *box = pf->boxes ? (const font_glyph_box_t *)(assets->data + pf->boxes) : NULL;
+    const font_range_t *range = (const font_range_t *)(assets->data + pf->ranges);
+    const uint8_t *font_bitmap = assets->data + pf->bitmap;
+    const font_kern_left_t *left;
+    uint32_t i, size;
+    uint8_t w, h;
+
+    if ((pf->height == 0) || (pf->bitmap == 0) || !_table_ok(assets, pf->bitmap, pf->bitmap_size, 1)
+        || !_table_ok(assets, pf->char_descriptors, pf->char_descriptors ? pf->num_chars : 0,
+                      sizeof(font_char_desc_t))
+        || !_table_ok(assets, pf->boxes, pf->boxes ? pf->num_chars : 0, sizeof(font_glyph_box_t))
+        || !_table_ok(assets, pf->ranges, pf->num_ranges, sizeof(font_range_t))
+        || !_table_ok(assets, pf->kern_lefts, pf->num_kern_pairs ? pf->num_kern_lefts + 1 : 0,
+                      sizeof(font_kern_left_t))
+        || !_table_ok(assets, pf->kern_rights, pf->num_kern_pairs, sizeof(uint16_t))
+        || !_table_ok(assets, pf->kern_adjust, pf->num_kern_pairs, sizeof(int8_t)))
+        return false;
+
+    // the pairs of every left character lie inside the tables
+    if (pf->num_kern_pairs)
+    {
+        left = (const font_kern_left_t *)(assets->data + pf->kern_lefts);
+        if ((left[0].first != 0) || (left[pf->num_kern_lefts].first != pf->num_kern_pairs))
+            return false;
+        for (i = 0; i < pf->num_kern_lefts; ++i)
+            if (left[i].first > left[i + 1].first)
+                return false;
+    }
+
+    // every character the driver can look up has a table entry
+    if (pf->num_ranges)
+    {
+        for (i = 0; i < pf->num_ranges; ++i)
+            if ((range[i].first > range[i].last) || (range[i].index + range[i].last - range[i].first >= pf->num_chars))
+                return false;
+    }
+    else if ((pf->char_start > pf->char_end) || (pf->char_end - pf->char_start + 1 != pf->num_chars))
+    {
+        return false;
+    }
+
+    // every glyph lies inside the bitmap
+    if (pf->flags & FONT_FLAG_MONO)
+    {
+        if (pf->char_descriptors || pf->boxes || (pf->flags & FONT_FLAG_RLE) || (pf->stride == 0)
+            || (pf->stride != _glyph_size(pf, pf->width, pf->height))
+            || (pf->num_chars > pf->bitmap_size / pf->stride))
+            return false;
+    }
+    else
+    {
+        if (pf->char_descriptors == 0)
+            return false;
+        for (i = 0; i < pf->num_chars; ++i)
+        {
+            w = box ? box[i].w : desc[i].width;
+            h = box ? box[i].h : pf->height;
+            if (box && ((box[i].x + w > desc[i].width) || (box[i].y + h > pf->height)))
+                return false;
+            if (desc[i].offset > pf->bitmap_size)
+                return false;
+            // run-length coded glyphs are as long as their code says, it is followed to the last column byte
+            size = pf->bitmap_size - desc[i].offset;
+            if (pf->flags & FONT_FLAG_RLE)
+                size = _rle_size(font_bitmap + desc[i].offset, size, (uint32_t)w * ((h + 7) / 8));
+            else
+                size = (_glyph_size(pf, w, h) <= size) ? 0 : UINT32_MAX;
+            if (size == UINT32_MAX)
+                return false;
+        }
+    }
+
+    memset(font, 0, sizeof(font_info_t));
+    font->height = pf->height;
+    font->c = pf->c;
+    font->char_start = pf->char_start;
+    font->char_end = pf->char_end;
+    font->char_descriptors = pf->char_descriptors ? desc : NULL;
+    font->bitmap = font_bitmap;
+    font->flags = pf->flags;
+    font->width = pf->width;
+    font->stride = pf->stride;
+    font->boxes = box;
+    font->ranges = pf->num_ranges ? range : NULL;
+    font->num_ranges = pf->num_ranges;
+    if (pf->num_kern_pairs)
+    {
+        kerning->num_lefts = pf->num_kern_lefts;
+        kerning->lefts = (const font_kern_left_t *)(assets->data + pf->kern_lefts);
+        kerning->rights = (const uint16_t *)(assets->data + pf->kern_rights);
+        kerning->adjust = (const int8_t *)(assets->data + pf->kern_adjust);
+        font->kerning = kerning;
+    }
+    font->fallback = pf->fallback;
+    return true;
+}
+
+
+bool ssd1306_assets_open(ssd1306_assets_t *assets, const void *data, uint32_t size)
+{
+    const ssd1306_pack_header_t *header = data;
+    const ssd1306_pack_entry_t *entry;
+    const ssd1306_pack_image_t *image;
+    uint16_t i;
+
+    memset(assets, 0, sizeof(ssd1306_assets_t));
+    assets->data = data;
+    assets->size = size;
+    if ((data == NULL) || ((uintptr_t)data & 3) || (size < sizeof(ssd1306_pack_header_t))
+        || (header->magic != SSD1306_ASSETS_MAGIC) || (header->version != SSD1306_ASSETS_VERSION)
+        || (header->size > size))
+        goto assets_open_fail;
+    assets->size = header->size;
+    if (!_table_ok(assets, sizeof(ssd1306_pack_header_t), header->num_entries, sizeof(ssd1306_pack_entry_t)))
+        goto assets_open_fail;
+
+    // font information and kerning of all entries in one block
+    assets->fonts = calloc(header->num_entries ? header->num_entries : 1,
+                           sizeof(font_info_t) + sizeof(font_kerning_t));
+    if (assets->fonts == NULL)
+    {
+        ESP_LOGE(__func__,"Alloc asset fonts failed.");
+        goto assets_open_fail;
+    }
+    assets->kerning = (font_kerning_t *)(assets->fonts + (header->num_entries ? header->num_entries : 1));
+    entry = (const ssd1306_pack_entry_t *)(header + 1);
+    for (i = 0; i < header->num_entries; ++i, ++entry)
+    {
+        if (memchr(entry->name, 0, SSD1306_ASSET_NAME_SIZE) == NULL)
+            goto assets_open_fail;
+        if (entry->type == SSD1306_ASSET_FONT)
+        {
+            if (!_table_ok(assets, entry->offset, 1, sizeof(ssd1306_pack_font_t))
+                || !_load_font(assets, (const ssd1306_pack_font_t *)(assets->data + entry->offset), &assets->fonts[i],
+                              &assets->kerning[i]))
+                goto assets_open_fail;
+        }
+        else if (entry->type == SSD1306_ASSET_IMAGE)
+        {
+            if (!_table_ok(assets, entry->offset, 1, sizeof(ssd1306_pack_image_t)))
+                goto assets_open_fail;
+            image = (const ssd1306_pack_image_t *)(assets->data + entry->offset);
+            if (!_table_ok(assets, image->bitmap, (uint32_t)image->width * ((image->height + 7) / 8), 1))
+                goto assets_open_fail;
+        }
+    }
+    return true;
+
+assets_open_fail:
+    ESP_LOGE(__func__,"Invalid asset pack.");
+    free(assets->fonts);
+    memset(assets, 0, sizeof(ssd1306_assets_t));
+    return false;
+}
+
+
+#ifdef ESP_PLATFORM
+bool ssd1306_assets_open_partition(ssd1306_assets_t *assets, const char *label)
+{
+    const esp_partition_t *part;
+    const void *data;
+    spi_flash_mmap_handle_t handle;
+
+    memset(assets, 0, sizeof(ssd1306_assets_t));
+    part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (part == NULL)
+    {
+        ESP_LOGE(__func__,"No partition %s.", label);
+        return false;
+    }
+    if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &data, &handle) != ESP_OK)
+    {
+        ESP_LOGE(__func__,"Map partition %s failed.", label);
+        return false;
+    }
+    if (!ssd1306_assets_open(assets, data, part->size))
+    {
+        spi_flash_munmap(handle);
+        return false;
+    }
+    assets->handle = handle;
+    assets->mapped = true;
+    return true;
+}
+#else
+bool ssd1306_assets_open_file(ssd1306_assets_t *assets, const char *path)
+{
+    struct stat st;
+    void *data;
+    int fd;
+
+    memset(assets, 0, sizeof(ssd1306_assets_t));
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        ESP_LOGE(__func__,"Cannot open %s.", path);
+        return false;
+    }
+    if ((fstat(fd, &st) != 0) || (st.st_size == 0) || (st.st_size > UINT32_MAX))
+    {
+        close(fd);
+        return false;
+    }
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        ESP_LOGE(__func__,"Map %s failed.", path);
+        return false;
+    }
+    if (!ssd1306_assets_open(assets, data, st.st_size))
+    {
+        munmap(data, st.st_size);
+        return false;
+    }
+    // the whole file was mapped, the pack may be shorter
+    assets->handle = st.st_size;
+    assets->mapped = true;
+    return true;
+}
+#endif
+
+
+void ssd1306_assets_close(ssd1306_assets_t *assets)
+{
+    if (assets->mapped)
+    {
+#ifdef ESP_PLATFORM
+        spi_flash_munmap(assets->handle);
+#else
+        munmap((void *)assets->data, assets->handle);
+#endif
+    }
+    free(assets->fonts);
+    memset(assets, 0, sizeof(ssd1306_assets_t));
+}
+
+
+// Entry of the given type and name, NULL if there is none
+static const ssd1306_pack_entry_t *_find(const ssd1306_assets_t *assets, uint8_t type, const char *name)
+{
+    const ssd1306_pack_header_t *header = (const ssd1306_pack_header_t *)assets->data;
+    const ssd1306_pack_entry_t *entry;
+    uint16_t i;
+
+    if ((header == NULL) || (name == NULL))
+        return NULL;
+    entry = (const ssd1306_pack_entry_t *)(header + 1);
+    for (i = 0; i < header->num_entries; ++i, ++entry)
+        if ((entry->type == type) && (strncmp(entry->name, name, SSD1306_ASSET_NAME_SIZE) == 0))
+            return entry;
+    return NULL;
+}
+
+
+const font_info_t *ssd1306_assets_font(const ssd1306_assets_t *assets, const char *name)
+{
+    const ssd1306_pack_entry_t *entry = _find(assets, SSD1306_ASSET_FONT, name);
+
+    if (entry == NULL)
+        return NULL;
+    return &assets->fonts[entry - (const ssd1306_pack_entry_t *)(assets->data + sizeof(ssd1306_pack_header_t))];
+}
+
+
+bool ssd1306_assets_select_font(uint8_t id, const ssd1306_assets_t *assets, const char *name)
+{
+    const font_info_t *font = ssd1306_assets_font(assets, name);
+
+    if (font == NULL)
+        return false;
+    ssd1306_select_font_info(id, font);
+    return true;
+}
+
+
+bool ssd1306_assets_image(const ssd1306_assets_t *assets, const char *name, ssd1306_asset_image_t *image)
+{
+    const ssd1306_pack_entry_t *entry = _find(assets, SSD1306_ASSET_IMAGE, name);
+    const ssd1306_pack_image_t *pi;
+
+    if (entry == NULL)
+        return false;
+    pi = (const ssd1306_pack_image_t *)(assets->data + entry->offset);
+    image->width = pi->width;
+    image->height = pi->height;
+    image->bitmap = assets->data + pi->bitmap;
+    return true;
+}
@@ -0,0 +1,411 @@
+/**
+  ******************************************************************************
+  * @file    ssd1306_console.c
+  * @brief   Text console on top of the SSD1306 OLED driver
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE.txt file.
+  *
+  * THIS SOFTWARE IS PROVIDED 'AS-IS', WITHOUT ANY EXPRESS OR IMPLIED
+  * WARRANTY.  IN NO EVENT WILL THE AUTHOR(S) BE HELD LIABLE FOR ANY DAMAGES
+  * ARISING FROM THE USE OF THIS SOFTWARE,
+  *
+  ******************************************************************************
+  */
+
+
+#include <esp_log.h>
+#include "stdarg.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "ssd1306.h"
+#include "ssd1306_console.h"
+#include "sdkconfig.h"
+
+
+#ifdef CONFIG_OLED_CONSOLE_PRINTF_BUFFER
+    #define CONSOLE_PRINTF_BUFFER CONFIG_OLED_CONSOLE_PRINTF_BUFFER
+#else
+    #define CONSOLE_PRINTF_BUFFER 128
+#endif
+
+#define CONSOLE_ATTR_INVERSE    0x01    //!< Cell is drawn black on white
+#define CONSOLE_MAX_PARAMS      2       //!< Parameters of an escape sequence that are kept
+#define CONSOLE_RAM_ROWS        64      //!< Rows of display RAM the start line wraps at
+
+
+typedef struct
+{
+    uint16_t code;          // code point, characters above U+FFFF are stored as U+FFFD
+    uint8_t attr;           // CONSOLE_ATTR_xxx
+} console_cell;
+
+typedef enum
+{
+    CONSOLE_TEXT = 0,       // plain text
+    CONSOLE_ESC,            // after ESC
+    CONSOLE_CSI,            // after ESC [
+} console_state;
+
+typedef struct
+{
+    const font_info_t *font;
+    uint8_t cols;           // grid size
+    uint8_t rows;
+    uint8_t pitch;          // pixel rows per text line
+    bool hw_scroll;         // scroll by moving the display start line
+    uint8_t top;            // grid row holding text line 0, always 0 without hw_scroll
+    uint8_t col;            // cursor, col == cols wraps before the next character
+    uint8_t row;
+    uint8_t attr;           // attributes of new characters
+    console_state state;    // escape sequence parser
+    uint8_t param;          // index of the parameter being parsed
+    uint16_t params[CONSOLE_MAX_PARAMS];
+    console_cell *cells;    // wanted contents, rows * cols, in display order
+    console_cell *shown;    // contents of the display buffer
+} console_ctx;
+
+static console_ctx *_consoles[SSD1306_NUM_PANELS] = { NULL };
+
+
+// Cell of text line "row", column "col"
+static inline console_cell *_cell(console_ctx *con, uint8_t row, uint8_t col)
+{
+    return &con->cells[((con->top + row) % con->rows) * con->cols + col];
+}
+
+
+// Blank columns [col0, col1) of text line "row"
+static void _erase(console_ctx *con, uint8_t row, uint8_t col0, uint8_t col1)
+{
+    console_cell *cell = _cell(con, row, 0);
+
+    for (; col0 < col1; ++col0)
+    {
+        cell[col0].code = ' ';
+        cell[col0].attr = 0;
+    }
+}
+
+
+static void _newline(console_ctx *con)
+{
+    con->col = 0;
+    if (con->row + 1 < con->rows)
+    {
+        ++con->row;
+        return;
+    }
+    if (con->hw_scroll)
+    {
+        // text line 0 becomes the last line, the start line follows once it is drawn
+        con->top = (con->top + 1) % con->rows;
+    }
+    else
+    {
+        memmove(con->cells, con->cells + con->cols, (con->rows - 1) * con->cols * sizeof(console_cell));
+    }
+    _erase(con, con->rows - 1, 0, con->cols);
+}
+
+
+// Run a CSI sequence with final byte "cmd"
+static void _csi(console_ctx *con, uint32_t cmd)
+{
+    uint16_t n = con->params[0] ? con->params[0] : 1;
+    uint8_t i;
+
+    // a pending wrap ends with any cursor movement
+    if (con->col >= con->cols)
+        con->col = con->cols - 1;
+
+    switch (cmd)
+    {
+    case 'A':
+        con->row = (n < con->row) ? con->row - n : 0;
+        break;
+    case 'B':
+        con->row = (con->row + n < con->rows) ? con->row + n : con->rows - 1;
+        break;
+    case 'C':
+        con->col = (con->col + n < con->cols) ? con->col + n : con->cols - 1;
+        break;
+    case 'D':
+        con->col = (n < con->col) ? con->col - n : 0;
+        break;
+    case 'H':
+    case 'f':
+        con->row = (n < con->rows) ? n - 1 : con->rows - 1;
+        n = con->params[1] ? con->params[1] : 1;
+        con->col = (n < con->cols) ? n - 1 : con->cols - 1;
+        break;
+    case 'J':
+        for (i = 0; i < con->rows; ++i)
+        {
+            if (((con->params[0] == 0) && (i > con->row)) || ((con->params[0] == 1) && (i < con->row))
+                || (con->params[0] == 2))
+                _erase(con, i, 0, con->cols);
+        }
+        if (con->params[0] == 0)
+            _erase(con, con->row, con->col, con->cols);
+        else if (con->params[0] == 1)
+            _erase(con, con->row, 0, con->col + 1);
+        break;
+    case 'K':
+        if (con->params[0] == 0)
+            _erase(con, con->row, con->col, con->cols);
+        else if (con->params[0] == 1)
+            _erase(con, con->row, 0, con->col + 1);
+        else if (con->params[0] == 2)
+            _erase(con, con->row, 0, con->cols);
+        break;
+    case 'm':
+        for (i = 0; i <= con->param; ++i)
+        {
+            if (con->params[i] == 0)
+                con->attr = 0;
+            else if (con->params[i] == 7)
+                con->attr |= CONSOLE_ATTR_INVERSE;
+            else if (con->params[i] == 27)
+                con->attr &= ~CONSOLE_ATTR_INVERSE;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+
+static void _escape(console_ctx *con, uint32_t code)
+{
+    uint8_t row;
+
+    if (con->state == CONSOLE_ESC)
+    {
+        con->state = CONSOLE_TEXT;
+        if (code == '[')
+        {
+            con->state = CONSOLE_CSI;
+            con->param = 0;
+            memset(con->params, 0, sizeof(con->params));
+        }
+        else if (code == 'c')
+        {
+            con->attr = 0;
+            con->row = 0;
+            con->col = 0;
+            for (row = 0; row < con->rows; ++row)
+                _erase(con, row, 0, con->cols);
+        }
+        return;
+    }
+
+    if ((code >= '0') && (code <= '9'))
+    {
+        if (con->params[con->param] < 1000)
+            con->params[con->param] = con->params[con->param] * 10 + code - '0';
+    }
+    else if (code == ';')
+    {
+        if (con->param + 1 < CONSOLE_MAX_PARAMS)
+            ++con->param;
+    }
+    else if ((code >= 0x40) && (code <= 0x7e))
+    {
+        _csi(con, code);
+        con->state = CONSOLE_TEXT;
+    }
+    else if ((code < 0x20) || (code > 0x7e))
+    {
+        // not a valid sequence, give up on it
+        con->state = CONSOLE_TEXT;
+    }
+}
+
+
+// Draw the cells that changed and send them to the panel, then move the start line
+static void _flush(uint8_t id, console_ctx *con, bool scrolled)
+{
+    uint8_t row, col, x;
+    console_cell *cell = con->cells, *shown = con->shown;
+    bool inverse;
+
+    ssd1306_select_font_info(id, con->font);
+    for (row = 0; row < con->rows; ++row)
+    {
+        for (col = 0, x = 0; col < con->cols; ++col, ++cell, ++shown, x += con->font->width + con->font->c)
+        {
+            if ((cell->code == shown->code) && (cell->attr == shown->attr))
+                continue;
+            inverse = cell->attr & CONSOLE_ATTR_INVERSE;
+            ssd1306_draw_codepoint(id, x, row * con->pitch, cell->code,
+                                   inverse ? SSD1306_COLOR_BLACK : SSD1306_COLOR_WHITE,
+                                   inverse ? SSD1306_COLOR_WHITE : SSD1306_COLOR_BLACK);
+            *shown = *cell;
+        }
+    }
+    ssd1306_refresh(id, false);
+    if (scrolled)
+        ssd1306_set_start_line(id, con->top * con->pitch);
+}
+
+
+bool ssd1306_console_init(uint8_t id, const font_info_t *font)
+{
+    console_ctx *con;
+    uint8_t width = ssd1306_get_width(id), height = ssd1306_get_height(id), pitch;
+    uint16_t i;
+
+    if ((id >= SSD1306_NUM_PANELS) || (width == 0))
+        return false;
+
+    if (ssd1306_band_stats(id, NULL, NULL))
+    {
+        ESP_LOGE(__func__,"Console needs the frame buffer, not page-band mode.");
+        return false;
+    }
+
+    if ((font == NULL) || !(font->flags & FONT_FLAG_MONO) || (font->height == 0))
+    {
+        ESP_LOGE(__func__,"Console needs a monospace font.");
+        return false;
+    }
+
+    ssd1306_console_term(id);
+    con = calloc(1, sizeof(console_ctx));
+    if (con == NULL)
+        goto console_init_fail;
+    con->font = font;
+    con->cols = (width + font->c) / (font->width + font->c);
+
+    // a 64 row panel shows all of the display RAM, lines that divide it can scroll with the start line
+    for (pitch = 8; pitch < font->height; pitch *= 2)
+        ;
+    con->hw_scroll = (height == CONSOLE_RAM_ROWS) && (pitch <= height) && (height / pitch == height / font->height);
+    con->pitch = con->hw_scroll ? pitch : font->height;
+    con->rows = height / con->pitch;
+    if ((con->cols == 0) || (con->rows == 0))
+        goto console_init_fail;
+
+    con->cells = malloc(2 * con->rows * con->cols * sizeof(console_cell));
+    if (con->cells == NULL)
+        goto console_init_fail;
+    con->shown = con->cells + con->rows * con->cols;
+    // a clear panel shows blanks
+    for (i = 0; i < 2 * con->rows * con->cols; ++i)
+    {
+        con->cells[i].code = ' ';
+        con->cells[i].attr = 0;
+    }
+
+    ssd1306_set_start_line(id, 0);
+    ssd1306_clear(id);
+    _consoles[id] = con;
+    return true;
+
+console_init_fail:
+    ESP_LOGE(__func__,"Alloc console failed.");
+    free(con);
+    return false;
+}
+
+
+void ssd1306_console_term(uint8_t id)
+{
+    console_ctx *con = (id < SSD1306_NUM_PANELS) ? _consoles[id] : NULL;
+
+    if (con == NULL)
+        return;
+
+    if (con->top)
+        ssd1306_set_start_line(id, 0);
+    free(con->cells);
+    free(con);
+    _consoles[id] = NULL;
+}
+
+
+void ssd1306_console_write(uint8_t id, const char *str)
+{
+    console_ctx *con = (id < SSD1306_NUM_PANELS) ? _consoles[id] : NULL;
+    console_cell *cell;
+    uint8_t top;
+    uint32_t code;
+
+    if ((con == NULL) || (str == NULL))
+        return;
+
+    top = con->top;
+    while (*str)
+    {
+        if ((unsigned char)*str < 0x80)
+            code = (unsigned char)*str++;
+        else
+            code = ssd1306_utf8_next(&str);
+
+        if (con->state != CONSOLE_TEXT)
+        {
+            _escape(con, code);
+            continue;
+        }
+        switch (code)
+        {
+        case '\n':
+            _newline(con);
+            break;
+        case '\r':
+            con->col = 0;
+            break;
+        case '\b':
+            if (con->col >= con->cols)
+                con->col = con->cols - 1;
+            if (con->col)
+                --con->col;
+            break;
+        case '\t':
+            con->col = (con->col + 8) & ~7;
+            if (con->col >= con->cols)
+                con->col = con->cols - 1;
+            break;
+        case 0x1b:
+            con->state = CONSOLE_ESC;
+            break;
+        default:
+            // other control characters are ignored
+            if ((code < 0x20) || (code == 0x7f))
+                break;
+            if (con->col >= con->cols)
+                _newline(con);
+            cell = _cell(con, con->row, con->col++);
+            cell->code = (code > 0xffff) ? 0xfffd : code;
+            cell->attr = con->attr;
+            break;
+        }
+    }
+    _flush(id, con, con->top != top);
+}
+
+
+int ssd1306_console_printf(uint8_t id, const char *format, ...)
+{
+    char buf[CONSOLE_PRINTF_BUFFER];
+    va_list args;
+    int n;
+
+    va_start(args, format);
+    n = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    if (n >= 0)
+        ssd1306_console_write(id, buf);
+    return n;
+}
+
+
+void ssd1306_console_clear(uint8_t id)
+{
+    // same as ESC c
+    ssd1306_console_write(id, "\x1b" "c");
+}
@@ -25,7 +25,9 @@
 
 #include <driver/i2c.h>
 #include <esp_log.h>
+#include <esp_timer.h>
 #include "fonts.h"
+#include "stdarg.h"
 #include "stddef.h"
 #include "ssd1306.h"
 #include "stdlib.h"
@@ -71,6 +73,50 @@
 #define SSD1306_NONE       0  //!< not used
 #define SSD1306_128x64     1  //!< 128x32 panel
 #define SSD1306_128x32     2  //!< 128x64 panel
+#define SSD1306_SURFACE    3  //!< off-screen surface
+
+#define SSD1306_MAX_WIDTH  128  //!< Widest panel supported, sizes the span scratch buffers
+#define STYLE_MAX_WIDTH     64  //!< Widest glyph drawn with a style, styled glyphs are at most 32 rows high
+
+#if CONFIG_OLED_ROTATION_90
+    #define OLED_ROTATION SSD1306_ROTATE_90
+#elif CONFIG_OLED_ROTATION_180
+    #define OLED_ROTATION SSD1306_ROTATE_180
+#elif CONFIG_OLED_ROTATION_270
+    #define OLED_ROTATION SSD1306_ROTATE_270
+#else
+    #define OLED_ROTATION SSD1306_ROTATE_0
+#endif
+
+#if CONFIG_OLED_MIRROR
+    #define OLED_MIRROR true
+#else
+    #define OLED_MIRROR false
+#endif
+
+#ifdef CONFIG_OLED_NUM_SURFACES
+    #define NUM_SURFACES CONFIG_OLED_NUM_SURFACES
+#else
+    #define NUM_SURFACES 4
+#endif
+
+#ifdef CONFIG_OLED_POLYGON_MAX_VERTICES
+    #define POLYGON_MAX_VERTICES CONFIG_OLED_POLYGON_MAX_VERTICES
+#else
+    #define POLYGON_MAX_VERTICES 16
+#endif
+
+#ifdef CONFIG_OLED_FLOOD_FILL_STACK
+    #define FLOOD_FILL_STACK CONFIG_OLED_FLOOD_FILL_STACK
+#else
+    #define FLOOD_FILL_STACK 64
+#endif
+
+#ifdef CONFIG_OLED_BAND_LIST_SIZE
+    #define BAND_LIST_SIZE CONFIG_OLED_BAND_LIST_SIZE
+#else
+    #define BAND_LIST_SIZE 0
+#endif
 
 
 void _command(uint8_t adress, uint8_t c)
@@ -119,10 +165,226 @@ typedef struct _oled_i2c_ctx
     uint8_t refresh_left;
     uint8_t refresh_right;
     uint8_t refresh_bottom;
+    uint8_t clip_left;      // Glyphs are clipped to [clip_left, clip_right) x [clip_top, clip_bottom), the whole
+    uint8_t clip_top;       // panel unless a text box is drawn, all drawing to the rows of a band being replayed
+    uint8_t clip_right;
+    uint8_t clip_bottom;
     const font_info_t* font;    // current font
+    const uint8_t *pattern;     // current fill pattern, NULL for solid
+    bool own_buffer;            // buffer was allocated by driver
+    struct _glyph_cache *glyph_cache;   // optional glyph cache
+    struct _label_pool *label_pool;     // optional label pool
+    uint8_t style;                      // SSD1306_STYLE_xxx
+    const font_info_t *style_font;      // font the line rows were found for, NULL if not yet
+    uint8_t underline_row;
+    uint8_t strike_row;
+    uint8_t rotation;                   // SSD1306_ROTATE_xxx, buffer holds the panel transposed for 90 and 270
+    bool mirror;                        // picture mirrored left to right
+    struct _band_list *band;            // display list in page-band mode, the buffer then holds one page
+    uint16_t band_offset;               // panel byte held in buffer[0], page * width while a band is replayed
 } oled_i2c_ctx;
 
-oled_i2c_ctx *_ctxs[2] = { NULL };
+oled_i2c_ctx *_ctxs[SSD1306_NUM_PANELS + NUM_SURFACES] = { NULL };
+
+
+// Byte of column x of "page" in the buffer, which only holds the page being replayed in page-band mode
+static inline uint8_t *_buffer_at(const oled_i2c_ctx *ctx, uint8_t page, int16_t x)
+{
+    return ctx->buffer + (page * ctx->width + x - ctx->band_offset);
+}
+
+const uint8_t ssd1306_patterns[SSD1306_PATTERN_COUNT][8] =
+{
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }, // SSD1306_PATTERN_SOLID
+    { 0x77, 0xff, 0xdd, 0xff, 0x77, 0xff, 0xdd, 0xff }, // SSD1306_PATTERN_GREY_87
+    { 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff }, // SSD1306_PATTERN_GREY_75
+    { 0x55, 0xbb, 0x55, 0xee, 0x55, 0xbb, 0x55, 0xee }, // SSD1306_PATTERN_GREY_62
+    { 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa }, // SSD1306_PATTERN_GREY_50
+    { 0x55, 0x22, 0x55, 0x88, 0x55, 0x22, 0x55, 0x88 }, // SSD1306_PATTERN_GREY_37
+    { 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00 }, // SSD1306_PATTERN_GREY_25
+    { 0x11, 0x00, 0x44, 0x00, 0x11, 0x00, 0x44, 0x00 }, // SSD1306_PATTERN_GREY_12
+    { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11 }, // SSD1306_PATTERN_HATCH_H
+    { 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00 }, // SSD1306_PATTERN_HATCH_V
+    { 0x11, 0x22, 0x44, 0x88, 0x11, 0x22, 0x44, 0x88 }, // SSD1306_PATTERN_HATCH_DIAG
+};
+
+
+/**
+ * @name Page-band mode
+ * Draw calls are recorded into a display list instead of drawing into the buffer. The refresh replays the list
+ * once per page into a buffer of one page, clipped to the rows of the page, and sends the page. Replaying calls
+ * the same primitives as drawing into a full buffer, the buffer pointer is moved so that the page lands in the band.
+ * @{
+ */
+
+typedef struct _band_list
+{
+    uint8_t *data;              // records, right after this header
+    uint16_t size;              // bytes available for records
+    uint16_t used;
+    uint16_t dropped;           // records that did not fit since the list was cleared
+    bool replaying;             // draw calls draw into the band instead of being recorded
+    const font_info_t *font;    // font, pattern and style when the list was cleared
+    const uint8_t *pattern;
+    uint8_t style;
+} band_list;
+
+// Display list records, an operation byte followed by its arguments as given in _band_formats
+typedef enum
+{
+    BAND_FONT,
+    BAND_PATTERN,
+    BAND_STYLE,
+    BAND_PIXEL,
+    BAND_HLINE,
+    BAND_VLINE,
+    BAND_FILL_RECTANGLE,
+    BAND_CIRCLE,
+    BAND_FILL_CIRCLE,
+    BAND_POLYGON,
+    BAND_BITMAP,
+    BAND_CODEPOINT,
+    BAND_CHAR_SCALED,
+    BAND_STRING,
+    BAND_STRING_SCALED,
+    BAND_STRING_DIR,
+    BAND_TEXT_BOX,
+    BAND_FILL,                  // solid fill of [x0, x1) x [y0, y1), number fields and labels
+    BAND_TEXT,                  // string in its own font and style on a transparent background
+} band_op;
+
+/*
+ * Arguments of each record: 'b' int8_t (colors as well, SSD1306_COLOR_TRANSPARENT is -1), 'B' uint8_t, 'h' int16_t,
+ * 'w' uint32_t, 'p' pointer (the data must stay valid until the refresh), 's' string and 't' text box (both copied),
+ * 'v' vertices, the previous argument counts them
+ */
+static const char *const _band_formats[] =
+{
+    [BAND_FONT] = "p",
+    [BAND_PATTERN] = "p",
+    [BAND_STYLE] = "B",
+    [BAND_PIXEL] = "bbb",
+    [BAND_HLINE] = "bbBb",
+    [BAND_VLINE] = "bbBb",
+    [BAND_FILL_RECTANGLE] = "bbBBb",
+    [BAND_CIRCLE] = "bbBb",
+    [BAND_FILL_CIRCLE] = "bbBb",
+    [BAND_POLYGON] = "BvBb",
+    [BAND_BITMAP] = "bbBBpB",
+    [BAND_CODEPOINT] = "BBwbb",
+    [BAND_CHAR_SCALED] = "BBwBbb",
+    [BAND_STRING] = "BBsbb",
+    [BAND_STRING_SCALED] = "BBsBbb",
+    [BAND_STRING_DIR] = "BBsBbb",
+    [BAND_TEXT_BOX] = "tsbb",
+    [BAND_FILL] = "hhhhb",
+    [BAND_TEXT] = "pBhhsb",
+};
+
+// Argument of a record as it is replayed
+typedef union
+{
+    int32_t i;
+    uint32_t u;
+    const void *p;
+} band_arg;
+
+
+// Bytes of the arguments in "ap", written to "out" unless it is NULL
+static uint16_t _band_pack(uint8_t *out, const char *format, va_list ap)
+{
+    uint16_t size = 0, n;
+    int16_t h;
+    int32_t i = 0;
+    uint32_t w;
+    const void *p;
+
+    for (; *format; ++format)
+    {
+        switch (*format)
+        {
+        case 'b':
+        case 'B':
+            i = va_arg(ap, int);
+            if (out)
+                out[size] = i;
+            n = 1;
+            break;
+        case 'h':
+            h = va_arg(ap, int);
+            if (out)
+                memcpy(out + size, &h, 2);
+            n = 2;
+            break;
+        case 'w':
+            w = va_arg(ap, uint32_t);
+            if (out)
+                memcpy(out + size, &w, 4);
+            n = 4;
+            break;
+        case 'p':
+            p = va_arg(ap, const void *);
+            if (out)
+                memcpy(out + size, &p, sizeof(p));
+            n = sizeof(p);
+            break;
+        default:
+            // strings, text boxes and vertices are copied
+            p = va_arg(ap, const void *);
+            if (*format == 's')
+                n = strlen(p) + 1;
+            else if (*format == 't')
+                n = sizeof(ssd1306_text_box_t);
+            else
+                n = i * sizeof(ssd1306_point_t);
+            if (out)
+                memcpy(out + size, p, n);
+            break;
+        }
+        size += n;
+    }
+    return size;
+}
+
+
+/*
+ * Record a draw call of a panel in page-band mode, the arguments follow _band_formats[op]. Return false if the call
+ * has to be drawn: the panel has a full buffer or the list is being replayed.
+ */
+static bool _band_record(oled_i2c_ctx *ctx, band_op op, ...)
+{
+    band_list *list = ctx->band;
+    uint16_t size;
+    va_list ap, aq;
+
+    if ((list == NULL) || list->replaying)
+        return false;
+
+    va_start(ap, op);
+    va_copy(aq, ap);
+    size = 1 + _band_pack(NULL, _band_formats[op], aq);
+    va_end(aq);
+    if (size > list->size - list->used)
+    {
+        if (list->dropped++ == 0)
+            ESP_LOGE(__func__,"Display list full, %d bytes.", list->size);
+    }
+    else
+    {
+        list->data[list->used] = op;
+        _band_pack(list->data + list->used + 1, _band_formats[op], ap);
+        list->used += size;
+    }
+    va_end(ap);
+    return true;
+}
+
+
+// Draw the list into the band for one page, it calls the draw functions and is found after them
+static void _band_replay(oled_i2c_ctx *ctx, uint8_t page);
+
+/** @} */
+
 
 void i2c_master_init(uint8_t scl_pin, uint8_t sda_pin)
 {
@@ -138,6 +400,47 @@ void i2c_master_init(uint8_t scl_pin, uint8_t sda_pin)
     i2c_driver_install(I2C_NUM_0, I2C_MODE_MASTER, 0, 0, 0);
 }
 
+
+// Transpose 8 font rows (MSB is leftmost pixel) into 8 column bytes (LSB is top row), Hacker's Delight 7-3
+static void _transpose8(const uint8_t rows[8], uint8_t cols[8])
+{
+    uint32_t x, y, t;
+
+    // rows are loaded bottom-up, so the top row ends up in the least significant bit of every column
+    x = ((uint32_t)rows[7] << 24) | ((uint32_t)rows[6] << 16) | ((uint32_t)rows[5] << 8) | rows[4];
+    y = ((uint32_t)rows[3] << 24) | ((uint32_t)rows[2] << 16) | ((uint32_t)rows[1] << 8) | rows[0];
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    cols[0] = x >> 24; cols[1] = x >> 16; cols[2] = x >> 8; cols[3] = x;
+    cols[4] = y >> 24; cols[5] = y >> 16; cols[6] = y >> 8; cols[7] = y;
+}
+
+
+/*
+ * Send segment remap and COM scan direction for the rotation of a panel. Quarter turns send the buffer
+ * transposed, the controller adds the flips that turn a transposed picture into a rotated one.
+ */
+static void _remap(const oled_i2c_ctx *ctx)
+{
+    // bit 0: columns right to left (SEGREMAP 0xa0), bit 1: rows bottom up (COMSCANINC 0xc0)
+    static const uint8_t flips[4] = { 0x00, 0x01, 0x03, 0x02 };
+    uint8_t f = flips[ctx->rotation];
+
+    // mirroring flips what is left to right in the picture, the panel rows for quarter turns
+    if (ctx->mirror)
+        f ^= (ctx->rotation & 1) ? 0x02 : 0x01;
+    _command(ctx->address, (f & 0x01) ? 0xa0 : 0xa1); // SSD1306_SEGREMAP
+    _command(ctx->address, (f & 0x02) ? 0xc0 : 0xc8); // SSD1306_COMSCANINC / SSD1306_COMSCANDEC
+}
+
+
 bool ssd1306_init(uint8_t id,uint8_t scl_pin, uint8_t sda_pin)
 {
     ESP_LOGD(__func__,"");
@@ -164,12 +467,12 @@ bool ssd1306_init(uint8_t id,uint8_t scl_pin, uint8_t sda_pin)
 #if (PANEL0_TYPE != 0)
   #if (PANEL0_TYPE == SSD1306_128x64)
         ctx->type = SSD1306_128x64;
-        ctx->buffer = malloc(1024); // 128 * 64 / 8
+        ctx->buffer = malloc(BAND_LIST_SIZE ? 128 : 1024); // 128 * 64 / 8, one page in page-band mode
         ctx->width = 128;
         ctx->height = 64;
   #elif (PANEL0_TYPE == SSD1306_128x32)
         ctx->type = SSD1306_128x32;
-        ctx->buffer = malloc(512);  // 128 * 32 / 8
+        ctx->buffer = malloc(BAND_LIST_SIZE ? 128 : 512);  // 128 * 32 / 8
         ctx->width = 128;
         ctx->height = 32;
   #else
@@ -186,6 +489,21 @@ bool ssd1306_init(uint8_t id,uint8_t scl_pin, uint8_t sda_pin)
         goto oled_init_fail;
 #endif
     }
+    ctx->clip_left = 0;
+    ctx->clip_top = 0;
+    ctx->clip_right = ctx->width;
+    ctx->clip_bottom = ctx->height;
+    ctx->font = NULL;
+    ctx->pattern = NULL;
+    ctx->own_buffer = true;
+    ctx->glyph_cache = NULL;
+    ctx->label_pool = NULL;
+    ctx->style = SSD1306_STYLE_NORMAL;
+    ctx->style_font = NULL;
+    ctx->rotation = SSD1306_ROTATE_0;
+    ctx->mirror = OLED_MIRROR;
+    ctx->band = NULL;
+    ctx->band_offset = 0;
     // Panel initialization
     // Try send I2C address check if the panel is connected
     cmd = i2c_cmd_link_create();
@@ -216,8 +534,7 @@ bool ssd1306_init(uint8_t id,uint8_t scl_pin, uint8_t sda_pin)
         _command(ctx->address, 0x40); // SSD1306_SETSTARTLINE line #0
         _command(ctx->address, 0x20); // SSD1306_MEMORYMODE
         _command(ctx->address, 0x00); // 0x0 act like ks0108
-        _command(ctx->address, 0xa1); // SSD1306_SEGREMAP | 1
-        _command(ctx->address, 0xc8); // SSD1306_COMSCANDEC
+        _remap(ctx);                  // SSD1306_SEGREMAP, SSD1306_COMSCANDEC
         _command(ctx->address, 0xda); // SSD1306_SETCOMPINS
         _command(ctx->address, 0x12);
         _command(ctx->address, 0x81); // SSD1306_SETCONTRAST
@@ -246,8 +563,7 @@ bool ssd1306_init(uint8_t id,uint8_t scl_pin, uint8_t sda_pin)
         _command(ctx->address, 0x14); // Charge pump on
         _command(ctx->address, 0x20); // SSD1306_MEMORYMODE
         _command(ctx->address, 0x00); // 0x0 act like ks0108
-        _command(ctx->address, 0xa1); // SSD1306_SEGREMAP | 1
-        _command(ctx->address, 0xc8); // SSD1306_COMSCANDEC
+        _remap(ctx);                  // SSD1306_SEGREMAP, SSD1306_COMSCANDEC
         _command(ctx->address, 0xda); // SSD1306_SETCOMPINS
         _command(ctx->address, 0x02);
         _command(ctx->address, 0x81); // SSD1306_SETCONTRAST
@@ -263,6 +579,16 @@ bool ssd1306_init(uint8_t id,uint8_t scl_pin, uint8_t sda_pin)
     // Save context
     ctx->id = id;
     _ctxs[id] = ctx;
+    // in page-band mode the buffer is one page, a quarter turn would clear a whole transposed frame in it
+    if (BAND_LIST_SIZE && (OLED_ROTATION & 1))
+        ESP_LOGE(__func__,"Page-band mode only turns by 0 or 180 degrees.");
+    else if (OLED_ROTATION != SSD1306_ROTATE_0)
+        ssd1306_set_rotation(id, OLED_ROTATION, OLED_MIRROR);
+    if (BAND_LIST_SIZE && !ssd1306_band_init(id, BAND_LIST_SIZE))
+    {
+        _ctxs[id] = NULL;
+        goto oled_init_fail;
+    }
 
     ssd1306_clear(id);
     ssd1306_refresh(id, true);
@@ -283,6 +609,11 @@ void ssd1306_term(uint8_t id)
     oled_i2c_ctx *ctx = _ctxs[id];
     if (ctx == NULL)
        return;
+    if (ctx->type == SSD1306_SURFACE)
+    {
+        ssd1306_surface_term(id);
+        return;
+    }
 
     _command(ctx->address, 0xae); // SSD_DISPLAYOFF
     _command(ctx->address, 0x8d); // SSD1306_CHARGEPUMP
@@ -290,6 +621,82 @@ void ssd1306_term(uint8_t id)
 
     if (ctx->buffer)
         free(ctx->buffer);
+    free(ctx->glyph_cache);
+    free(ctx->label_pool);
+    free(ctx->band);
+    free(ctx);
+
+    _ctxs[id] = NULL;
+}
+
+
+bool ssd1306_surface_init(uint8_t id, uint8_t width, uint8_t height, uint8_t *buffer)
+{
+    oled_i2c_ctx *ctx = NULL;
+
+    if ((id < SSD1306_NUM_PANELS) || (id >= SSD1306_NUM_PANELS + NUM_SURFACES))
+    {
+        ESP_LOGE(__func__,"Invalid surface ID %d.", id);
+        return false;
+    }
+    if ((width == 0) || (width > SSD1306_MAX_WIDTH) || (height == 0) || (height > 128))
+    {
+        ESP_LOGE(__func__,"Invalid surface size %dx%d.", width, height);
+        return false;
+    }
+
+    // free old surface (if any)
+    ssd1306_surface_term(id);
+
+    ctx = calloc(1, sizeof(oled_i2c_ctx));
+    if (ctx == NULL)
+    {
+        ESP_LOGE(__func__,"Alloc surface context failed.");
+        return false;
+    }
+    ctx->type = SSD1306_SURFACE;
+    ctx->width = width;
+    ctx->height = height;
+    ctx->clip_right = width;
+    ctx->clip_bottom = height;
+    ctx->id = id;
+    if (buffer)
+    {
+        ctx->buffer = buffer;
+    }
+    else
+    {
+        ctx->buffer = calloc(width, (height + 7) / 8);
+        if (ctx->buffer == NULL)
+        {
+            ESP_LOGE(__func__,"Alloc surface buffer failed.");
+            free(ctx);
+            return false;
+        }
+        ctx->own_buffer = true;
+    }
+    // nothing dirty yet
+    ctx->refresh_top = 255;
+    ctx->refresh_left = 255;
+    _ctxs[id] = ctx;
+    return true;
+}
+
+
+void ssd1306_surface_term(uint8_t id)
+{
+    oled_i2c_ctx *ctx;
+
+    if ((id < SSD1306_NUM_PANELS) || (id >= SSD1306_NUM_PANELS + NUM_SURFACES))
+        return;
+    ctx = _ctxs[id];
+    if (ctx == NULL)
+        return;
+
+    if (ctx->own_buffer)
+        free(ctx->buffer);
+    free(ctx->glyph_cache);
+    free(ctx->label_pool);
     free(ctx);
 
     _ctxs[id] = NULL;
@@ -322,13 +729,19 @@ void ssd1306_clear(uint8_t id)
     if (ctx == NULL)
         return;
 
-    if (ctx->type == SSD1306_128x64)
+    if (ctx->band)
     {
-        memset(ctx->buffer, 0, 1024);
+        // the picture starts again from the state it is cleared in
+        ctx->band->used = 0;
+        ctx->band->dropped = 0;
+        ctx->band->font = ctx->font;
+        ctx->band->pattern = ctx->pattern;
+        ctx->band->style = ctx->style;
+        memset(ctx->buffer, 0, ctx->width);
     }
-    else if (ctx->type == SSD1306_128x32)
+    else
     {
-        memset(ctx->buffer, 0, 512);
+        memset(ctx->buffer, 0, ctx->width * ((ctx->height + 7) / 8));
     }
     ctx->refresh_right = ctx->width - 1;
     ctx->refresh_bottom = ctx->height - 1;
@@ -337,115 +750,110 @@ void ssd1306_clear(uint8_t id)
 }
 
 
+// Columns [left, right] of page "page" of a panel turned by a quarter, the buffer holds the panel transposed
+static void _turned_page(const oled_i2c_ctx *ctx, uint8_t page, uint8_t left, uint8_t right, uint8_t *line)
+{
+    uint8_t tile, j, t[8];
+
+    for (tile = left / 8; tile <= right / 8; ++tile)
+    {
+        // buffer page "tile" holds panel columns 8 * tile.., its columns 8 * page.. are the rows of this page
+        _transpose8(ctx->buffer + tile * ctx->width + page * 8, t);
+        for (j = 0; j < 8; ++j)
+            line[tile * 8 + j] = t[7 - j];
+    }
+}
+
+
 void ssd1306_refresh(uint8_t id, bool force)
 {
     oled_i2c_ctx *ctx = _ctxs[id];
     uint8_t i,j;
     uint16_t k;
-    uint8_t page_start, page_end;
+    uint8_t page_start, page_end, left, right;
+    uint8_t line[SSD1306_MAX_WIDTH];
+    const uint8_t *src;
     i2c_cmd_handle_t cmd = NULL;
 
     if (ctx == NULL)
         return;
 
-    if (force)
+    if (ctx->type == SSD1306_SURFACE)
+        return;
+
+    // a band panel keeps no picture to send parts of
+    if (force || ctx->band)
     {
-        if (ctx->type == SSD1306_128x64)
-        {
-            _command(ctx->address, 0x21); // SSD1306_COLUMNADDR
-            _command(ctx->address, 0);    // column start
-            _command(ctx->address, 127);  // column end
-            _command(ctx->address, 0x22); // SSD1306_PAGEADDR
-            _command(ctx->address, 0);    // page start
-            _command(ctx->address, 7);    // page end (8 pages for 64 rows OLED)
-            for (k = 0; k < 1024; k++)
-            {
-                cmd = i2c_cmd_link_create();
-                i2c_master_start(cmd);
-                i2c_master_write_byte(cmd, ctx->address, true);
-                i2c_master_write_byte(cmd, 0x40, true);
-                for (j = 0; j < 16; ++j)
-                {
-                    i2c_master_write_byte(cmd, ctx->buffer[k], true);
-                    ++k;
-                }
-                --k;
-                i2c_master_stop(cmd);
-                i2c_master_cmd_begin(I2C_NUM_0, cmd, 100/portTICK_PERIOD_MS);
-                i2c_cmd_link_delete(cmd);
-            }
-        }
-        else if (ctx->type == SSD1306_128x32)
-        {
-            _command(ctx->address, 0x21); // SSD1306_COLUMNADDR
-            _command(ctx->address, 0);    // column start
-            _command(ctx->address, 127);  // column end
-            _command(ctx->address, 0x22); // SSD1306_PAGEADDR
-            _command(ctx->address, 0);    // page start
-            _command(ctx->address, 3);    // page end (4 pages for 32 rows OLED)
-            for (k = 0; k < 512; k++)
-            {
-                cmd = i2c_cmd_link_create();
-                i2c_master_start(cmd);
-                i2c_master_write_byte(cmd, ctx->address, true);
-                i2c_master_write_byte(cmd, 0x40, true);
-                for (j = 0; j < 16; ++j)
-                {
-                    i2c_master_write_byte(cmd, ctx->buffer[k], true);
-                    ++k;
-                }
-                --k;
-                i2c_master_stop(cmd);
-                i2c_master_cmd_begin(I2C_NUM_0, cmd, 100/portTICK_PERIOD_MS);
-                i2c_cmd_link_delete(cmd);
-            }
-        }
+        ctx->refresh_top = 0;
+        ctx->refresh_left = 0;
+        ctx->refresh_right = ctx->width - 1;
+        ctx->refresh_bottom = ctx->height - 1;
     }
-    else
+    if ((ctx->refresh_top <= ctx->refresh_bottom) && (ctx->refresh_left <= ctx->refresh_right))
     {
-        if ((ctx->refresh_top <= ctx->refresh_bottom) && (ctx->refresh_left <= ctx->refresh_right))
+        if (ctx->rotation & 1)
         {
+            // rows of the picture are columns of the panel and the other way round
+            left = ctx->refresh_top;
+            right = ctx->refresh_bottom;
+            page_start = ctx->refresh_left / 8;
+            page_end = ctx->refresh_right / 8;
+        }
+        else
+        {
+            left = ctx->refresh_left;
+            right = ctx->refresh_right;
             page_start = ctx->refresh_top / 8;
             page_end = ctx->refresh_bottom / 8;
-            _command(ctx->address, 0x21); // SSD1306_COLUMNADDR
-            _command(ctx->address, ctx->refresh_left);    // column start
-            _command(ctx->address, ctx->refresh_right);   // column end
-            _command(ctx->address, 0x22); // SSD1306_PAGEADDR
-            _command(ctx->address, page_start);    // page start
-            _command(ctx->address, page_end); // page end
-            k = 0;
-            for (i = page_start; i <= page_end; ++i)
+        }
+        _command(ctx->address, 0x21); // SSD1306_COLUMNADDR
+        _command(ctx->address, left);    // column start
+        _command(ctx->address, right);   // column end
+        _command(ctx->address, 0x22); // SSD1306_PAGEADDR
+        _command(ctx->address, page_start);    // page start
+        _command(ctx->address, page_end); // page end
+        k = 0;
+        for (i = page_start; i <= page_end; ++i)
+        {
+            if (ctx->rotation & 1)
             {
-                for (j = ctx->refresh_left; j <= ctx->refresh_right; ++j)
-                {
-                    if (k == 0)
-                    {
-	                    cmd = i2c_cmd_link_create();
-	                    i2c_master_start(cmd);
-                        i2c_master_write_byte(cmd, ctx->address, true);
-	                    i2c_master_write_byte(cmd, 0x40, true);
-                    }
-	                i2c_master_write_byte(cmd,ctx->buffer[i * ctx->width + j],true);
-                    ++k;
-                    if (k == 16)
-                    {
-	                    i2c_master_stop(cmd);
-	                    i2c_master_cmd_begin(I2C_NUM_0, cmd, 100/portTICK_PERIOD_MS);
-	                    i2c_cmd_link_delete(cmd);
-                        k = 0;
-                    }
-
-                }
+                _turned_page(ctx, i, left, right, line);
+                src = line;
             }
-            if (k != 0) // for last batch if stop was not sent
+            else if (ctx->band)
             {
-            	if(cmd != NULL) // cmd handle not deleted
-	            {
-		            i2c_master_stop(cmd);
-		            i2c_master_cmd_begin(I2C_NUM_0, cmd, 100/portTICK_PERIOD_MS);
-		            i2c_cmd_link_delete(cmd);
-	            }
+                _band_replay(ctx, i);
+                src = ctx->buffer;
             }
+            else
+            {
+                src = ctx->buffer + i * ctx->width;
+            }
+            for (j = left; j <= right; ++j)
+            {
+                if (k == 0)
+                {
+                    cmd = i2c_cmd_link_create();
+                    i2c_master_start(cmd);
+                    i2c_master_write_byte(cmd, ctx->address, true);
+                    i2c_master_write_byte(cmd, 0x40, true);
+                }
+                i2c_master_write_byte(cmd, src[j], true);
+                ++k;
+                if (k == 16)
+                {
+                    i2c_master_stop(cmd);
+                    i2c_master_cmd_begin(I2C_NUM_0, cmd, 100/portTICK_PERIOD_MS);
+                    i2c_cmd_link_delete(cmd);
+                    k = 0;
+                }
+            }
+        }
+        if (k != 0) // for last batch if stop was not sent
+        {
+            i2c_master_stop(cmd);
+            i2c_master_cmd_begin(I2C_NUM_0, cmd, 100/portTICK_PERIOD_MS);
+            i2c_cmd_link_delete(cmd);
         }
     }
     // reset dirty area
@@ -464,10 +872,13 @@ void ssd1306_draw_pixel(uint8_t id, int8_t x, int8_t y, ssd1306_color_t color)
     if (ctx == NULL)
         return;
 
-    if ((x >= ctx->width) || (x < 0) || (y >= ctx->height) || (y < 0))
+    if (_band_record(ctx, BAND_PIXEL, x, y, color))
         return;
 
-    index = x + (y / 8) * ctx->width;
+    if ((x >= ctx->width) || (x < 0) || (y >= ctx->clip_bottom) || (y < ctx->clip_top))
+        return;
+
+    index = x + (y / 8) * ctx->width - ctx->band_offset;
     switch (color)
     {
     case SSD1306_COLOR_WHITE:
@@ -496,8 +907,10 @@ void ssd1306_draw_hline(uint8_t id, int8_t x, int8_t y, uint8_t w, ssd1306_color
 
     if (ctx == NULL)
         return;
+    if (_band_record(ctx, BAND_HLINE, x, y, w, color))
+        return;
     // boundary check
-    if ((x >= ctx->width) || (x < 0) || (y >= ctx->height) || (y < 0))
+    if ((x >= ctx->width) || (x < 0) || (y >= ctx->clip_bottom) || (y < ctx->clip_top))
         return;
     if (w == 0)
         return;
@@ -505,7 +918,7 @@ void ssd1306_draw_hline(uint8_t id, int8_t x, int8_t y, uint8_t w, ssd1306_color
         w = ctx->width - x;
 
     t = w;
-    index = x + (y / 8) * ctx->width;
+    index = x + (y / 8) * ctx->width - ctx->band_offset;
     mask = 1 << (y & 7);
     switch (color)
     {
@@ -548,16 +961,26 @@ void ssd1306_draw_vline(uint8_t id, int8_t x, int8_t y, uint8_t h, ssd1306_color
 
     if (ctx == NULL)
         return;
+    if (_band_record(ctx, BAND_VLINE, x, y, h, color))
+        return;
     // boundary check
-    if ((x >= ctx->width) || (x < 0) || (y >= ctx->height) || (y < 0))
+    if ((x >= ctx->width) || (x < 0) || (y >= ctx->clip_bottom) || (y < 0))
         return;
     if (h == 0)
         return;
-    if (y + h > ctx->height)
-        h = ctx->height - y;
+    // a band being replayed only holds the rows of its page
+    if (y < ctx->clip_top)
+    {
+        if (y + h <= ctx->clip_top)
+            return;
+        h -= ctx->clip_top - y;
+        y = ctx->clip_top;
+    }
+    if (y + h > ctx->clip_bottom)
+        h = ctx->clip_bottom - y;
 
     t = h;
-    index = x + (y / 8) * ctx->width;
+    index = x + (y / 8) * ctx->width - ctx->band_offset;
     mod = y & 7;
     if (mod) // partial line that does not fit into byte at top
     {
@@ -653,12 +1076,74 @@ void ssd1306_draw_rectangle(uint8_t id, int8_t x, int8_t y, uint8_t w, uint8_t h
 }
 
 
+// Fill [x0, x1) x [y0, y1), clipped to the panel (and text box), return false if nothing is inside. Dirty area is
+// left to the caller.
+static bool _fill_rect(oled_i2c_ctx *ctx, int16_t x0, int16_t y0, int16_t x1, int16_t y1, ssd1306_color_t color,
+                       const uint8_t *pattern)
+{
+    uint8_t *p;
+    uint8_t page, page_end, mask, i;
+
+    // clip to panel
+    if (x0 < ctx->clip_left) x0 = ctx->clip_left;
+    if (y0 < ctx->clip_top) y0 = ctx->clip_top;
+    if (x1 > ctx->clip_right) x1 = ctx->clip_right;
+    if (y1 > ctx->clip_bottom) y1 = ctx->clip_bottom;
+    if ((x0 >= x1) || (y0 >= y1))
+        return false;
+
+    // One byte mask per column and page, pattern costs a single AND
+    page_end = (y1 - 1) / 8;
+    for (page = y0 / 8; page <= page_end; ++page)
+    {
+        mask = 0xff;
+        if (page == y0 / 8)
+            mask &= 0xff << (y0 & 7);
+        if (page == page_end)
+            mask &= 0xff >> (7 - ((y1 - 1) & 7));
+        p = _buffer_at(ctx, page, x0);
+        switch (color)
+        {
+        case SSD1306_COLOR_WHITE:
+            for (i = x0; i < x1; ++i, ++p)
+                *p |= mask & pattern[i & 7];
+            break;
+        case SSD1306_COLOR_BLACK:
+            for (i = x0; i < x1; ++i, ++p)
+                *p &= ~(mask & pattern[i & 7]);
+            break;
+        case SSD1306_COLOR_INVERT:
+            for (i = x0; i < x1; ++i, ++p)
+                *p ^= mask & pattern[i & 7];
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+
 void ssd1306_fill_rectangle(uint8_t id, int8_t x, int8_t y, uint8_t w, uint8_t h, ssd1306_color_t color)
 {
-    // Can be optimized?
-    uint8_t i;
-    for (i = x; i < x + w; ++i)
-        ssd1306_draw_vline(id, i, y, h, color);
+    oled_i2c_ctx *ctx = _ctxs[id];
+    int16_t x0 = x, y0 = y, x1 = x + w, y1 = y + h;
+
+    if (ctx == NULL)
+        return;
+    if (_band_record(ctx, BAND_FILL_RECTANGLE, x, y, w, h, color))
+        return;
+    if (!_fill_rect(ctx, x0, y0, x1, y1, color,
+                    ctx->pattern ? ctx->pattern : ssd1306_patterns[SSD1306_PATTERN_SOLID]))
+        return;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > ctx->width) x1 = ctx->width;
+    if (y1 > ctx->height) y1 = ctx->height;
+    if (ctx->refresh_left > x0) ctx->refresh_left = x0;
+    if (ctx->refresh_right < x1 - 1) ctx->refresh_right = x1 - 1;
+    if (ctx->refresh_top > y0) ctx->refresh_top = y0;
+    if (ctx->refresh_bottom < y1 - 1) ctx->refresh_bottom = y1 - 1;
 }
 
 
@@ -677,6 +1162,9 @@ void ssd1306_draw_circle(uint8_t id, int8_t x0, int8_t y0, uint8_t r, ssd1306_co
     if (r == 0)
         return;
 
+    if (_band_record(ctx, BAND_CIRCLE, x0, y0, r, color))
+        return;
+
     ssd1306_draw_pixel(id, x0 - r, y0,     color);
     ssd1306_draw_pixel(id, x0 + r, y0,     color);
     ssd1306_draw_pixel(id, x0,     y0 - r, color);
@@ -727,15 +1215,18 @@ void ssd1306_fill_circle(uint8_t id, int8_t x0, int8_t y0, uint8_t r, ssd1306_co
     if (r == 0)
         return;
 
-    ssd1306_draw_vline(id, x0, y0 - r, 2 * r + 1, color); // Center vertical line
+    if (_band_record(ctx, BAND_FILL_CIRCLE, x0, y0, r, color))
+        return;
+
+    ssd1306_fill_rectangle(id, x0, y0 - r, 1, 2 * r + 1, color); // Center vertical line
     while (y >= x)
     {
-        ssd1306_draw_vline(id, x0 - x, y0 - y, 2 * y + 1, color);
-        ssd1306_draw_vline(id, x0 + x, y0 - y, 2 * y + 1, color);
+        ssd1306_fill_rectangle(id, x0 - x, y0 - y, 1, 2 * y + 1, color);
+        ssd1306_fill_rectangle(id, x0 + x, y0 - y, 1, 2 * y + 1, color);
         if (color != SSD1306_COLOR_INVERT)
         {
-            ssd1306_draw_vline(id, x0 - y, y0 - x, 2 * x + 1, color);
-            ssd1306_draw_vline(id, x0 + y, y0 - x, 2 * x + 1, color);
+            ssd1306_fill_rectangle(id, x0 - y, y0 - x, 1, 2 * x + 1, color);
+            ssd1306_fill_rectangle(id, x0 + y, y0 - x, 1, 2 * x + 1, color);
         }
         ++x;
         if (radius_err < 0)
@@ -756,14 +1247,14 @@ void ssd1306_fill_circle(uint8_t id, int8_t x0, int8_t y0, uint8_t r, ssd1306_co
         y = 1;
         x = r;
         radius_err = 1 - x;
-        ssd1306_draw_hline(id, x0 + x1, y0, r - x1 + 1, color);
-        ssd1306_draw_hline(id, x0 - r, y0, r - x1 + 1, color);
+        ssd1306_fill_rectangle(id, x0 + x1, y0, r - x1 + 1, 1, color);
+        ssd1306_fill_rectangle(id, x0 - r, y0, r - x1 + 1, 1, color);
         while (x >= y)
         {
-            ssd1306_draw_hline(id, x0 + x1, y0 - y, x - x1 + 1, color);
-            ssd1306_draw_hline(id, x0 + x1, y0 + y, x - x1 + 1, color);
-            ssd1306_draw_hline(id, x0 - x,  y0 - y, x - x1 + 1, color);
-            ssd1306_draw_hline(id, x0 - x,  y0 + y, x - x1 + 1, color);
+            ssd1306_fill_rectangle(id, x0 + x1, y0 - y, x - x1 + 1, 1, color);
+            ssd1306_fill_rectangle(id, x0 + x1, y0 + y, x - x1 + 1, 1, color);
+            ssd1306_fill_rectangle(id, x0 - x,  y0 - y, x - x1 + 1, 1, color);
+            ssd1306_fill_rectangle(id, x0 - x,  y0 + y, x - x1 + 1, 1, color);
             ++y;
             if (radius_err < 0)
             {
@@ -779,123 +1270,2320 @@ void ssd1306_fill_circle(uint8_t id, int8_t x0, int8_t y0, uint8_t r, ssd1306_co
 }
 
 
-void ssd1306_select_font(uint8_t id, uint8_t idx)
+void ssd1306_fill_triangle(uint8_t id, int8_t x0, int8_t y0, int8_t x1, int8_t y1, int8_t x2, int8_t y2,
+                           ssd1306_color_t color)
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
+    ssd1306_point_t points[3] = { { x0, y0 }, { x1, y1 }, { x2, y2 } };
 
-    if (ctx == NULL)
-            return;
-    if (idx < NUM_FONTS)
-        ctx->font = fonts[idx];
+    ssd1306_fill_polygon(id, points, 3, SSD1306_FILL_NON_ZERO, color);
 }
 
 
-// return character width
-uint8_t ssd1306_draw_char(uint8_t id, uint8_t x, uint8_t y, unsigned char c, ssd1306_color_t foreground, ssd1306_color_t background)
+// Polygon edge, only non-horizontal edges are stored
+typedef struct _poly_edge
 {
-    oled_i2c_ctx *ctx = _ctxs[id];
-    uint8_t i, j;
-    const uint8_t *bitmap;
-    uint8_t line=0;
+    int16_t y_top;      // first scanline crossed by the edge
+    int16_t y_bottom;   // first scanline no longer crossed by the edge
+    int16_t x_top;      // x at y_top
+    int16_t dx;         // x_bottom - x_top
+    int16_t dy;         // y_bottom - y_top, always > 0
+    int8_t winding;     // +1 for downward edges, -1 for upward edges
+} poly_edge;
 
-    if (ctx == NULL)
-        return 0;
 
-    if (ctx->font == NULL)
-        return 0;
+// ceil(a / b) for b > 0
+static inline int16_t _ceil_div(int32_t a, int16_t b)
+{
+    return (a >= 0) ? (a + b - 1) / b : -((-a) / b);
+}
+
 
-    // we always have space in the font set
-    if ((c < ctx->font->char_start) || (c > ctx->font->char_end))
-        c = ' ';
-    c = c - ctx->font->char_start;   // c now become index to tables
-    bitmap = ctx->font->bitmap + ctx->font->char_descriptors[c].offset;
-    for (j = 0; j < ctx->font->height; ++j)
+// Apply column masks of one page [left, right] to the display buffer, then clear the masks
+static void _flush_page_masks(oled_i2c_ctx *ctx, uint8_t page, uint8_t *masks, uint8_t left, uint8_t right,
+                              ssd1306_color_t color)
+{
+    const uint8_t *pattern = ctx->pattern ? ctx->pattern : ssd1306_patterns[SSD1306_PATTERN_SOLID];
+    uint8_t *p = _buffer_at(ctx, page, left);
+    uint8_t i;
+
+    for (i = left; i <= right; ++i, ++p)
     {
-        for (i = 0; i < ctx->font->char_descriptors[c].width; ++i)
+        masks[i] &= pattern[i & 7];
+        switch (color)
         {
-            if (i % 8 == 0)
-            {
-                line = bitmap[(ctx->font->char_descriptors[c].width + 7) / 8 * j + i / 8]; // line data
-            }
-            if (line & 0x80)
-            {
-                ssd1306_draw_pixel(id, x + i, y + j, foreground);
-            }
-            else
-            {
-                switch (background)
-                {
-                case SSD1306_COLOR_TRANSPARENT:
-                    // Not drawing for transparent background
-                    break;
-                case SSD1306_COLOR_WHITE:
-                case SSD1306_COLOR_BLACK:
-                    ssd1306_draw_pixel(id, x + i, y + j, background);
-                    break;
-                case SSD1306_COLOR_INVERT:
-                    // I don't know why I need invert background
-                    break;
-                }
-            }
-            line = line << 1;
+        case SSD1306_COLOR_WHITE:
+            *p |= masks[i];
+            break;
+        case SSD1306_COLOR_BLACK:
+            *p &= ~masks[i];
+            break;
+        case SSD1306_COLOR_INVERT:
+            *p ^= masks[i];
+            break;
+        default:break;
         }
+        masks[i] = 0;
     }
-    return (ctx->font->char_descriptors[c].width);
 }
 
 
-uint8_t ssd1306_draw_string(uint8_t id, uint8_t x, uint8_t y, char *str, ssd1306_color_t foreground, ssd1306_color_t background)
+void ssd1306_fill_polygon(uint8_t id, const ssd1306_point_t *points, uint8_t n, ssd1306_fill_rule_t rule,
+                          ssd1306_color_t color)
 {
     oled_i2c_ctx *ctx = _ctxs[id];
-    uint8_t t = x;
+    poly_edge edges[POLYGON_MAX_VERTICES];
+    int16_t cross_x[POLYGON_MAX_VERTICES];
+    int8_t cross_w[POLYGON_MAX_VERTICES];
+    uint8_t masks[SSD1306_MAX_WIDTH];
+    uint8_t num_edges = 0, num_cross, first_edge, i, j, page;
+    int16_t y, y_min = INT16_MAX, y_max = INT16_MIN, xs, xe, x_min = INT16_MAX, x_max = INT16_MIN;
+    int16_t t_x;
+    int8_t t_w, inside;
+    uint8_t dirty_left = 255, dirty_right = 0;
+    const ssd1306_point_t *a, *b;
+    poly_edge e;
 
     if (ctx == NULL)
-        return 0;
+        return;
+    if ((points == NULL) || (n < 3))
+        return;
+    if (n > POLYGON_MAX_VERTICES)
+    {
+        ESP_LOGE(__func__, "Too many vertices (%d > %d).", n, POLYGON_MAX_VERTICES);
+        return;
+    }
+    if ((color != SSD1306_COLOR_WHITE) && (color != SSD1306_COLOR_BLACK) && (color != SSD1306_COLOR_INVERT))
+        return;
+    if (_band_record(ctx, BAND_POLYGON, n, points, rule, color))
+        return;
 
-    if (ctx->font == NULL)
+    // Build edge table, sorted by y_top (insertion sort, n is small)
+    for (i = 0; i < n; ++i)
+    {
+        a = &points[i];
+        b = &points[(i + 1 == n) ? 0 : i + 1];
+        if (a->y == b->y)
+            continue;   // horizontal edges never cross a pixel centre row
+        if (a->y < b->y)
+        {
+            e.y_top = a->y; e.y_bottom = b->y; e.x_top = a->x; e.dx = b->x - a->x; e.winding = 1;
+        }
+        else
+        {
+            e.y_top = b->y; e.y_bottom = a->y; e.x_top = b->x; e.dx = a->x - b->x; e.winding = -1;
+        }
+        e.dy = e.y_bottom - e.y_top;
+        for (j = num_edges; (j > 0) && (edges[j - 1].y_top > e.y_top); --j)
+            edges[j] = edges[j - 1];
+        edges[j] = e;
+        ++num_edges;
+        if (e.y_top < y_min) y_min = e.y_top;
+        if (e.y_bottom > y_max) y_max = e.y_bottom;
+        if (e.x_top < x_min) x_min = e.x_top;
+        if (e.x_top > x_max) x_max = e.x_top;
+        if (e.x_top + e.dx < x_min) x_min = e.x_top + e.dx;
+        if (e.x_top + e.dx > x_max) x_max = e.x_top + e.dx;
+    }
+    if (num_edges == 0)
+        return;
+
+    // Clip to panel (the page of a band being replayed)
+    if (y_min < ctx->clip_top) y_min = ctx->clip_top;
+    if (y_max > ctx->clip_bottom) y_max = ctx->clip_bottom;
+    if (x_min < 0) x_min = 0;
+    if (x_max > ctx->width) x_max = ctx->width;
+    if ((y_min >= y_max) || (x_min >= x_max))
+        return;
+
+    // Each page collects 8 scanlines of spans into per-column bit masks, then writes them out in one pass.
+    // Spans of one scanline never overlap, so every pixel is touched exactly once.
+    memset(masks + x_min, 0, x_max - x_min);
+    first_edge = 0;
+    page = y_min / 8;
+    for (y = y_min; y < y_max; ++y)
+    {
+        // Skip edges that ended above this scanline, collect crossings of active edges sorted by x
+        while ((first_edge < num_edges) && (edges[first_edge].y_bottom <= y))
+            ++first_edge;
+        num_cross = 0;
+        for (i = first_edge; (i < num_edges) && (edges[i].y_top <= y); ++i)
+        {
+            if (edges[i].y_bottom <= y)
+                continue;
+            // Sample at the pixel centre: first pixel at or right of the exact crossing
+            t_x = _ceil_div((int32_t)edges[i].x_top * edges[i].dy + (int32_t)edges[i].dx * (y - edges[i].y_top),
+                            edges[i].dy);
+            t_w = edges[i].winding;
+            for (j = num_cross; (j > 0) && (cross_x[j - 1] > t_x); --j)
+            {
+                cross_x[j] = cross_x[j - 1];
+                cross_w[j] = cross_w[j - 1];
+            }
+            cross_x[j] = t_x;
+            cross_w[j] = t_w;
+            ++num_cross;
+        }
+
+        // Walk crossings left to right, fill [cross_x[i], cross_x[i + 1]) while inside
+        inside = 0;
+        for (i = 0; i + 1 < num_cross; ++i)
+        {
+            if (rule == SSD1306_FILL_EVEN_ODD)
+                inside ^= 1;
+            else
+                inside += cross_w[i];
+            if (inside == 0)
+                continue;
+            xs = (cross_x[i] < x_min) ? x_min : cross_x[i];
+            xe = (cross_x[i + 1] > x_max) ? x_max : cross_x[i + 1];
+            if (xs >= xe)
+                continue;
+            if (dirty_left > xs) dirty_left = xs;
+            if (dirty_right < xe - 1) dirty_right = xe - 1;
+            for (t_x = xs; t_x < xe; ++t_x)
+                masks[t_x] |= 1 << (y & 7);
+        }
+
+        if (((y & 7) == 7) || (y + 1 == y_max))
+        {
+            _flush_page_masks(ctx, page, masks, x_min, x_max - 1, color);
+            ++page;
+        }
+    }
+
+    if (dirty_left > dirty_right)
+        return;
+    if (ctx->refresh_left > dirty_left) ctx->refresh_left = dirty_left;
+    if (ctx->refresh_right < dirty_right) ctx->refresh_right = dirty_right;
+    if (ctx->refresh_top > y_min) ctx->refresh_top = y_min;
+    if (ctx->refresh_bottom < y_max - 1) ctx->refresh_bottom = y_max - 1;
+}
+
+// Read back one pixel from display buffer
+static inline uint8_t _get_pixel(const oled_i2c_ctx *ctx, uint8_t x, uint8_t y)
+{
+    return (ctx->buffer[x + (y / 8) * ctx->width] >> (y & 7)) & 1;
+}
+
+
+bool ssd1306_flood_fill(uint8_t id, int8_t x, int8_t y, ssd1306_color_t color)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    struct { uint8_t x, y; } stack[FLOOD_FILL_STACK];
+    uint16_t sp = 0;
+    uint8_t target, left, right, sx, sy, ny, mask, i;
+    uint8_t dirty_left = 255, dirty_right = 0, dirty_top = 255, dirty_bottom = 0;
+    uint8_t *p;
+    int8_t d;
+    bool complete = true, in_run;
+
+    if (ctx == NULL)
+        return false;
+    if (ctx->band)
+    {
+        ESP_LOGE(__func__,"Flood fill needs the frame buffer.");
+        return false;
+    }
+    if ((x >= ctx->width) || (x < 0) || (y >= ctx->height) || (y < 0))
+        return true;
+
+    target = _get_pixel(ctx, x, y);
+    if (((color == SSD1306_COLOR_WHITE) && target) || ((color == SSD1306_COLOR_BLACK) && !target))
+        return true;
+    if ((color != SSD1306_COLOR_WHITE) && (color != SSD1306_COLOR_BLACK) && (color != SSD1306_COLOR_INVERT))
+        return true;
+
+    // Filled pixels always end up with the opposite of target, so every fill is a toggle and a filled
+    // pixel never matches again.
+    stack[sp].x = x;
+    stack[sp].y = y;
+    ++sp;
+    while (sp)
+    {
+        --sp;
+        sx = stack[sp].x;
+        sy = stack[sp].y;
+        if (_get_pixel(ctx, sx, sy) != target)
+            continue;   // already filled via another seed
+
+        // Extend to a maximal span on this scanline and fill it
+        left = sx;
+        while ((left > 0) && (_get_pixel(ctx, left - 1, sy) == target))
+            --left;
+        right = sx;
+        while ((right + 1 < ctx->width) && (_get_pixel(ctx, right + 1, sy) == target))
+            ++right;
+        mask = 1 << (sy & 7);
+        p = ctx->buffer + (sy / 8) * ctx->width + left;
+        for (i = left; i <= right; ++i, ++p)
+            *p ^= mask;
+        if (dirty_left > left) dirty_left = left;
+        if (dirty_right < right) dirty_right = right;
+        if (dirty_top > sy) dirty_top = sy;
+        if (dirty_bottom < sy) dirty_bottom = sy;
+
+        // Push one seed for every run of target pixels directly above and below the span
+        for (d = -1; d <= 1; d += 2)
+        {
+            if (((d < 0) && (sy == 0)) || ((d > 0) && (sy + 1 >= ctx->height)))
+                continue;
+            ny = sy + d;
+            in_run = false;
+            for (i = left; ; ++i)
+            {
+                if (_get_pixel(ctx, i, ny) == target)
+                {
+                    if (!in_run)
+                    {
+                        if (sp < FLOOD_FILL_STACK)
+                        {
+                            stack[sp].x = i;
+                            stack[sp].y = ny;
+                            ++sp;
+                        }
+                        else
+                        {
+                            complete = false;
+                        }
+                        in_run = true;
+                    }
+                }
+                else
+                {
+                    in_run = false;
+                }
+                if (i == right)
+                    break;
+            }
+        }
+    }
+
+    if (!complete)
+        ESP_LOGW(__func__, "Span stack overflow, fill incomplete.");
+    if (dirty_left <= dirty_right)
+    {
+        if (ctx->refresh_left > dirty_left) ctx->refresh_left = dirty_left;
+        if (ctx->refresh_right < dirty_right) ctx->refresh_right = dirty_right;
+        if (ctx->refresh_top > dirty_top) ctx->refresh_top = dirty_top;
+        if (ctx->refresh_bottom < dirty_bottom) ctx->refresh_bottom = dirty_bottom;
+    }
+    return complete;
+}
+
+
+void ssd1306_select_pattern(uint8_t id, const uint8_t *pattern)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+
+    if (ctx == NULL)
+        return;
+    _band_record(ctx, BAND_PATTERN, pattern);
+    ctx->pattern = pattern;
+}
+
+
+void ssd1306_select_font(uint8_t id, uint8_t idx)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+
+    if (ctx == NULL)
+            return;
+    if ((idx < NUM_FONTS) && fonts[idx])
+    {
+        _band_record(ctx, BAND_FONT, fonts[idx]);
+        ctx->font = fonts[idx];
+    }
+}
+
+
+void ssd1306_select_font_info(uint8_t id, const font_info_t *font)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+
+    if (ctx == NULL)
+        return;
+    _band_record(ctx, BAND_FONT, font);
+    ctx->font = font;
+}
+
+
+void ssd1306_select_style(uint8_t id, uint8_t style)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+
+    if (ctx == NULL)
+        return;
+    _band_record(ctx, BAND_STYLE, style);
+    ctx->style = style;
+}
+
+
+// Apply one glyph byte: "ink" bits get foreground, other "valid" bits get background
+static inline void _glyph_byte(uint8_t *d, uint8_t ink, uint8_t valid, ssd1306_color_t foreground,
+                               ssd1306_color_t background)
+{
+    uint8_t fg = ink & valid, bg = ~ink & valid, set = 0, clr = 0, tgl = 0;
+
+    switch (foreground)
+    {
+    case SSD1306_COLOR_WHITE:  set |= fg; break;
+    case SSD1306_COLOR_BLACK:  clr |= fg; break;
+    case SSD1306_COLOR_INVERT: tgl |= fg; break;
+    default: break;
+    }
+    switch (background)
+    {
+    case SSD1306_COLOR_WHITE: set |= bg; break;
+    case SSD1306_COLOR_BLACK: clr |= bg; break;
+    default: break;    // Not drawing for transparent (or invert) background
+    }
+    *d = ((*d | set) & ~clr) ^ tgl;
+}
+
+
+// Rows of "page" inside the clip rectangle (the panel unless a text box is drawn)
+static inline uint8_t _page_clip(const oled_i2c_ctx *ctx, int16_t page)
+{
+    uint8_t m = 0xff;
+
+    if (page * 8 >= ctx->clip_bottom || page * 8 + 8 <= ctx->clip_top)
+        return 0;
+    if (page * 8 + 8 > ctx->clip_bottom)
+        m = 0xff >> (page * 8 + 8 - ctx->clip_bottom);
+    if (page * 8 < ctx->clip_top)
+        m &= 0xff << (ctx->clip_top - page * 8);
+    return m;
+}
+
+
+/*
+ * Draw one 8-row band of a glyph given as column bytes (LSB is top row), "rows" valid rows, at (x, y).
+ * Every source byte touches at most two destination pages, foreground and background are applied with
+ * byte-wide set/clear/toggle masks. Dirty area is left to the caller.
+ */
+static void _blit_glyph_band(oled_i2c_ctx *ctx, int16_t x, int16_t y, const uint8_t *cols, uint8_t w, uint8_t rows,
+                             ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    int16_t page, x0, x1, i;
+    uint8_t shift, half, valid;
+    uint16_t m;
+    uint8_t *d;
+
+    x0 = (x < ctx->clip_left) ? ctx->clip_left : x;
+    x1 = (x + w > ctx->clip_right) ? ctx->clip_right : x + w;
+    if (x0 >= x1)
+        return;
+
+    page = (y >= 0) ? y / 8 : -((7 - y) / 8);
+    shift = y - page * 8;
+    m = (uint16_t)(0xff >> (8 - rows)) << shift;
+    for (half = 0; half < 2; ++half, ++page)
+    {
+        if ((page < 0) || (page * 8 >= ctx->height))
+            continue;
+        valid = (m >> (half * 8)) & _page_clip(ctx, page);
+        if (valid == 0)
+            continue;
+        d = _buffer_at(ctx, page, x0);
+        for (i = x0; i < x1; ++i, ++d)
+            _glyph_byte(d, ((uint16_t)cols[i - x] << shift) >> (half * 8), valid, foreground, background);
+    }
+}
+
+
+/*
+ * Draw a run-length coded glyph (FONT_FLAG_RLE) at (x, y). Column bytes are applied to the buffer as they are
+ * decoded, band by band, every band touches at most two pages. Dirty area is left to the caller.
+ */
+static void _blit_glyph_rle(oled_i2c_ctx *ctx, int16_t x, int16_t y, const uint8_t *code, uint8_t width,
+                            uint8_t height, ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    uint16_t left = width * ((height + 7) / 8);
+    uint8_t run = 0, token = 0, v = 0, col = 0, band = 0, rows, shift, valid[2] = { 0, 0 };
+    uint8_t *d[2] = { NULL, NULL };
+    int16_t page, half, cx;
+    uint16_t m;
+
+    if (width == 0)
+        return;
+    page = (y >= 0) ? y / 8 : -((7 - y) / 8);
+    shift = y - page * 8;
+    for (; left; --left)
+    {
+        if (run == 0)
+        {
+            token = *code++;
+            run = (token & ((token & 0x80) ? 0x3f : 0x7f)) + 1;
+            v = ((token & 0xc0) == 0xc0) ? *code++ : 0;
+        }
+        if ((token & 0x80) == 0)
+            v = *code++;
+        --run;
+
+        if (col == 0)
+        {
+            // new band: destination pages and the rows of them covered by the band
+            rows = (height - band * 8 < 8) ? height - band * 8 : 8;
+            m = (uint16_t)(0xff >> (8 - rows)) << shift;
+            for (half = 0; half < 2; ++half)
+            {
+                d[half] = NULL;
+                if ((page + half < 0) || ((page + half) * 8 >= ctx->height))
+                    continue;
+                valid[half] = (m >> (half * 8)) & _page_clip(ctx, page + half);
+                if (valid[half])
+                    d[half] = _buffer_at(ctx, page + half, 0);
+            }
+        }
+        cx = x + col;
+        if ((cx >= ctx->clip_left) && (cx < ctx->clip_right))
+        {
+            if (d[0])
+                _glyph_byte(d[0] + cx, v << shift, valid[0], foreground, background);
+            if (d[1])
+                _glyph_byte(d[1] + cx, v >> (8 - shift), valid[1], foreground, background);
+        }
+        if (++col == width)
+        {
+            col = 0;
+            ++band;
+            ++page;
+        }
+    }
+}
+
+
+// Decode "n" column bytes of a run-length coded glyph, starting "skip" bytes into the glyph
+static void _rle_decode(const uint8_t *code, uint16_t skip, uint8_t *out, uint16_t n)
+{
+    uint8_t token, run, v;
+
+    while (n)
+    {
+        token = *code++;
+        run = (token & ((token & 0x80) ? 0x3f : 0x7f)) + 1;
+        v = ((token & 0xc0) == 0xc0) ? *code++ : 0;
+        for (; run && n; --run)
+        {
+            if ((token & 0x80) == 0)
+                v = *code++;
+            if (skip)
+                --skip;
+            else
+            {
+                *out++ = v;
+                --n;
+            }
+        }
+    }
+}
+
+
+// Decode one 8-row band of a glyph into "width" column bytes
+static void _glyph_band_columns(const font_info_t *font, const uint8_t *bitmap, uint8_t width, uint8_t height,
+                                uint8_t band, uint8_t *cols)
+{
+    uint8_t rows, stride, group, r, n;
+    uint8_t row_bytes[8], tmp[8];
+
+    if (font->flags & FONT_FLAG_RLE)
+    {
+        _rle_decode(bitmap, band * width, cols, width);
+        return;
+    }
+    if (font->flags & FONT_FLAG_PAGES)
+    {
+        memcpy(cols, bitmap + band * width, width);
+        return;
+    }
+    rows = (height - band * 8 < 8) ? height - band * 8 : 8;
+    stride = (width + 7) / 8;
+    for (group = 0; group < stride; ++group)
+    {
+        for (r = 0; r < 8; ++r)
+            row_bytes[r] = (r < rows) ? bitmap[(band * 8 + r) * stride + group] : 0;
+        _transpose8(row_bytes, tmp);
+        n = (width - group * 8 < 8) ? width - group * 8 : 8;
+        memcpy(cols + group * 8, tmp, n);
+    }
+}
+
+
+/**
+ * @name Glyph cache
+ * Glyphs are cached as column bytes pre-shifted by (y & 7), one cache slot holds one glyph. All slots have
+ * the size of the largest glyph seen so far, a larger glyph re-partitions (and flushes) the cache.
+ * @{
+ */
+
+typedef struct _glyph_slot
+{
+    const font_info_t *font;    // NULL if slot is free
+    uint32_t used;              // LRU stamp
+    uint16_t index;             // glyph index in font
+    uint8_t shift;              // glyph is shifted down by this many rows
+    uint8_t width;              // glyph width, data is ((height + shift + 7) / 8) pages of width bytes
+} glyph_slot;
+
+typedef struct _glyph_cache
+{
+    uint8_t *slots;             // first slot, right after this header
+    uint16_t budget;            // bytes available for slots
+    uint16_t slot_size;         // bytes per slot including header, 0 before first use
+    uint16_t num_slots;
+    uint32_t clock;             // LRU clock
+    uint32_t hits;
+    uint32_t misses;
+} glyph_cache;
+
+#define GLYPH_SLOT(cache, n) ((glyph_slot *)((cache)->slots + (n) * (cache)->slot_size))
+
+
+// Find or create the cache slot of a glyph, NULL if the glyph does not fit the cache at all
+static glyph_slot *_glyph_cache_get(glyph_cache *cache, const font_info_t *font, uint16_t index,
+                                    const uint8_t *bitmap, uint8_t width, uint8_t height, uint8_t shift)
+{
+    glyph_slot *slot, *victim = NULL;
+    uint16_t i, need;
+    uint8_t band, bands, pages, j, cols[256];
+    uint8_t *data;
+
+    for (i = 0; i < cache->num_slots; ++i)
+    {
+        slot = GLYPH_SLOT(cache, i);
+        if ((slot->font == font) && (slot->index == index) && (slot->shift == shift))
+        {
+            slot->used = ++cache->clock;
+            ++cache->hits;
+            return slot;
+        }
+        if ((victim == NULL) || (slot->font == NULL) || ((victim->font != NULL) && (slot->used < victim->used)))
+            victim = slot;
+    }
+    ++cache->misses;
+
+    // worst case size (shift 7), rounded for alignment of the slot headers
+    need = (sizeof(glyph_slot) + width * ((height + 14) / 8) + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+    if (need > cache->slot_size)
+    {
+        if (need > cache->budget)
+            return NULL;
+        cache->slot_size = need;
+        cache->num_slots = cache->budget / need;
+        for (i = 0; i < cache->num_slots; ++i)
+            GLYPH_SLOT(cache, i)->font = NULL;
+        victim = GLYPH_SLOT(cache, 0);
+    }
+
+    slot = victim;
+    slot->font = font;
+    slot->index = index;
+    slot->shift = shift;
+    slot->width = width;
+    slot->used = ++cache->clock;
+    data = (uint8_t *)(slot + 1);
+    bands = (height + 7) / 8;
+    pages = (height + shift + 7) / 8;
+    memset(data, 0, pages * width);
+    for (band = 0; band < bands; ++band)
+    {
+        _glyph_band_columns(font, bitmap, width, height, band, cols);
+        for (j = 0; j < width; ++j)
+        {
+            data[band * width + j] |= cols[j] << shift;
+            if (band + 1 < pages)
+                data[(band + 1) * width + j] |= cols[j] >> (8 - shift);
+        }
+    }
+    return slot;
+}
+
+
+// Draw a cached glyph, y & 7 must match the slot's shift
+static void _blit_glyph_slot(oled_i2c_ctx *ctx, int16_t x, int16_t y, const glyph_slot *slot, uint8_t height,
+                             ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    const uint8_t *data = (const uint8_t *)(slot + 1);
+    uint8_t pages = (height + slot->shift + 7) / 8, p, valid, w = slot->width;
+    int16_t x0, x1, page, first, i, top, bottom;
+    uint8_t *d;
+
+    x0 = (x < ctx->clip_left) ? ctx->clip_left : x;
+    x1 = (x + w > ctx->clip_right) ? ctx->clip_right : x + w;
+    if (x0 >= x1)
+        return;
+    first = (y >= 0) ? y / 8 : -((7 - y) / 8);
+    for (p = 0; p < pages; ++p)
+    {
+        page = first + p;
+        if (page * 8 >= ctx->height)
+            break;
+        if (page < 0)
+            continue;
+        // glyph rows within this page
+        top = slot->shift - p * 8;
+        bottom = slot->shift + height - p * 8;
+        valid = (top > 0) ? 0xff << top : 0xff;
+        if (bottom < 8)
+            valid &= 0xff >> (8 - bottom);
+        valid &= _page_clip(ctx, page);
+        if (valid == 0)
+            continue;
+        d = _buffer_at(ctx, page, x0);
+        for (i = x0; i < x1; ++i, ++d)
+            _glyph_byte(d, data[p * w + i - x], valid, foreground, background);
+    }
+}
+
+/** @} */
+
+
+// Table index of the glyph of a character, -1 if the font has none
+static int32_t _font_index(const font_info_t *font, uint32_t code)
+{
+    const font_range_t *r;
+    uint16_t lo, hi, mid;
+
+    if (font->ranges == NULL)
+    {
+        if ((code < (unsigned char)font->char_start) || (code > (unsigned char)font->char_end))
+            return -1;
+        return code - (unsigned char)font->char_start;
+    }
+    // the first range is checked before searching, it holds ASCII in all but exotic fonts
+    r = &font->ranges[0];
+    if ((code >= r->first) && (code <= r->last))
+        return r->index + code - r->first;
+    lo = 1;
+    hi = font->num_ranges;
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        r = &font->ranges[mid];
+        if (code < r->first)
+            hi = mid;
+        else if (code > r->last)
+            lo = mid + 1;
+        else
+            return r->index + code - r->first;
+    }
+    return -1;
+}
+
+
+// Table index of the glyph drawn for a character: its own, the fallback of the font or space, -1 if none of them
+static int32_t _glyph_index(const font_info_t *font, uint32_t code)
+{
+    int32_t c = _font_index(font, code);
+
+    if ((c < 0) && font->fallback)
+        c = _font_index(font, font->fallback);
+    if (c < 0)
+        c = _font_index(font, ' ');
+    return c;
+}
+
+
+uint32_t ssd1306_utf8_next(const char **str)
+{
+    const unsigned char *s = (const unsigned char *)*str;
+    uint32_t code;
+    uint8_t n, i;
+
+    if (s[0] < 0x80)
+    {
+        *str += s[0] ? 1 : 0;
+        return s[0];
+    }
+    if ((s[0] & 0xe0) == 0xc0)
+    {
+        code = s[0] & 0x1f;
+        n = 1;
+    }
+    else if ((s[0] & 0xf0) == 0xe0)
+    {
+        code = s[0] & 0x0f;
+        n = 2;
+    }
+    else if ((s[0] & 0xf8) == 0xf0)
+    {
+        code = s[0] & 0x07;
+        n = 3;
+    }
+    else
+        goto utf8_next_invalid;
+    for (i = 1; i <= n; ++i)
+    {
+        if ((s[i] & 0xc0) != 0x80)
+            goto utf8_next_invalid;
+        code = (code << 6) | (s[i] & 0x3f);
+    }
+    // reject overlong forms, surrogates and code points beyond Unicode
+    if ((code < ((n == 1) ? 0x80u : (n == 2) ? 0x800u : 0x10000u)) || ((code >= 0xd800) && (code <= 0xdfff))
+        || (code > 0x10ffff))
+        goto utf8_next_invalid;
+    *str += n + 1;
+    return code;
+
+utf8_next_invalid:
+    // not UTF-8, take the byte as Latin-1 (or whatever 8-bit set the font uses)
+    *str += 1;
+    return s[0];
+}
+
+
+// Add [x0, x1) x [y0, y1), clipped like glyphs, to the dirty area
+static void _dirty_rect(oled_i2c_ctx *ctx, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    if (x0 < ctx->clip_left) x0 = ctx->clip_left;
+    if (y0 < ctx->clip_top) y0 = ctx->clip_top;
+    if (x1 > ctx->clip_right) x1 = ctx->clip_right;
+    if (y1 > ctx->clip_bottom) y1 = ctx->clip_bottom;
+    if ((x0 >= x1) || (y0 >= y1))
+        return;
+    if (ctx->refresh_left > x0) ctx->refresh_left = x0;
+    if (ctx->refresh_right < x1 - 1) ctx->refresh_right = x1 - 1;
+    if (ctx->refresh_top > y0) ctx->refresh_top = y0;
+    if (ctx->refresh_bottom < y1 - 1) ctx->refresh_bottom = y1 - 1;
+}
+
+
+// Fill the part of a w x h cell at (x, y) outside its glyph box, box coordinates are multiplied by "scale"
+static void _fill_around_box(oled_i2c_ctx *ctx, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                             const font_glyph_box_t *box, uint8_t scale, ssd1306_color_t color)
+{
+    const uint8_t *solid = ssd1306_patterns[SSD1306_PATTERN_SOLID];
+    int16_t bx = x + box->x * scale, by = y + box->y * scale;
+    int16_t bx1 = bx + box->w * scale, by1 = by + box->h * scale;
+
+    _fill_rect(ctx, x, y, x + w, by, color, solid);
+    _fill_rect(ctx, x, by1, x + w, y + h, color, solid);
+    _fill_rect(ctx, x, by, bx, by1, color, solid);
+    _fill_rect(ctx, bx1, by, x + w, by1, color, solid);
+}
+
+
+// Advance of a character, missing characters are drawn as the fallback glyph or space
+static uint8_t _char_width(const font_info_t *font, uint32_t code)
+{
+    int32_t c = _glyph_index(font, code);
+
+    if (c < 0)
+        return 0;
+    return (font->flags & FONT_FLAG_MONO) ? font->width : font->char_descriptors[c].width;
+}
+
+
+// Kerning of two adjacent characters, 0 if the font has no pair for them
+static int8_t _kern(const font_info_t *font, uint32_t left, uint32_t right)
+{
+    const font_kerning_t *kerning = font->kerning;
+    int32_t lo = 0, hi, mid;
+
+    if ((kerning == NULL) || (left > 0xffff) || (right > 0xffff))
+        return 0;
+
+    // the left character first, then its right characters
+    hi = (int32_t)kerning->num_lefts - 1;
+    while (lo <= hi)
+    {
+        mid = (lo + hi) / 2;
+        if (kerning->lefts[mid].left == left)
+            break;
+        if (kerning->lefts[mid].left < left)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    if (lo > hi)
+        return 0;
+    lo = kerning->lefts[mid].first;
+    hi = (int32_t)kerning->lefts[mid + 1].first - 1;
+    while (lo <= hi)
+    {
+        mid = (lo + hi) / 2;
+        if (kerning->rights[mid] == right)
+            return kerning->adjust[mid];
+        if (kerning->rights[mid] < right)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    return 0;
+}
+
+
+/**
+ * @name Text styles
+ * A styled glyph is decoded into one 32-bit word per column (bit n is row n of the cell), so bold, contour and
+ * lines take a few word operations per column. Column 0 of the buffer is left of the cell, the cell follows and
+ * the last column is right of it, both outer columns are in the space between characters.
+ * @{
+ */
+
+// Decode glyph "c" of a font into cell columns, the cell must be at most STYLE_MAX_WIDTH x 32
+static void _glyph_cell_columns(const font_info_t *font, int32_t c, uint32_t *cols)
+{
+    const font_glyph_box_t *box;
+    const uint8_t *bitmap;
+    uint8_t band, bands, i, x = 0, y = 0, width, height = font->height;
+    uint8_t tmp[STYLE_MAX_WIDTH];
+
+    if (font->flags & FONT_FLAG_MONO)
+    {
+        bitmap = font->bitmap + c * font->stride;
+        width = font->width;
+    }
+    else
+    {
+        bitmap = font->bitmap + font->char_descriptors[c].offset;
+        width = font->char_descriptors[c].width;
+    }
+    memset(cols, 0, width * sizeof(uint32_t));
+    if (font->boxes)
+    {
+        box = &font->boxes[c];
+        x = box->x;
+        y = box->y;
+        width = box->w;
+        height = box->h;
+    }
+    bands = (width && height) ? (height + 7) / 8 : 0;
+    for (band = 0; band < bands; ++band)
+    {
+        _glyph_band_columns(font, bitmap, width, height, band, tmp);
+        for (i = 0; i < width; ++i)
+            cols[x + i] |= (uint32_t)tmp[i] << (y + band * 8);
+    }
+}
+
+
+// Rows with ink in the glyph of "code", 0 if the font has none
+static uint32_t _glyph_ink_rows(const font_info_t *font, uint32_t code)
+{
+    uint32_t cols[STYLE_MAX_WIDTH], rows = 0;
+    int32_t c = _font_index(font, code);
+    uint8_t i, width;
+
+    if ((c < 0) || (font->height > 32))
+        return 0;
+    width = (font->flags & FONT_FLAG_MONO) ? font->width : font->char_descriptors[c].width;
+    if (width > STYLE_MAX_WIDTH)
+        return 0;
+    _glyph_cell_columns(font, c, cols);
+    for (i = 0; i < width; ++i)
+        rows |= cols[i];
+    return rows;
+}
+
+
+// Find underline and strike-through rows of the current font from the glyphs of 'H' and 'x'
+static void _style_rows(oled_i2c_ctx *ctx)
+{
+    const font_info_t *font = ctx->font;
+    uint32_t h = _glyph_ink_rows(font, 'H'), x = _glyph_ink_rows(font, 'x');
+    uint8_t base = h ? 31 - __builtin_clz(h) : font->height - 1;
+
+    ctx->underline_row = (base + 1 < font->height) ? base + 1 : font->height - 1;
+    if (x == 0)
+        x = h;
+    ctx->strike_row = x ? (__builtin_ctz(x) + 31 - __builtin_clz(x)) / 2 : font->height / 2;
+    ctx->style_font = font;
+}
+
+
+/*
+ * Panel rectangle r = { x0, y0, x1, y1 } of [u0, u1) along a line of text and rows [v0, v1) of its cells. The line
+ * is "len" long and its cells "h" high, (x, y) is the top-left corner of the line as drawn in direction "dir".
+ */
+static void _run_rect(ssd1306_text_dir_t dir, int16_t x, int16_t y, uint16_t len, uint8_t h, int16_t u0, int16_t u1,
+                      int16_t v0, int16_t v1, int16_t *r)
+{
+    switch (dir)
+    {
+    case SSD1306_TEXT_90:
+        r[0] = x + h - v1; r[1] = y + u0; r[2] = x + h - v0; r[3] = y + u1;
+        break;
+    case SSD1306_TEXT_180:
+        r[0] = x + len - u1; r[1] = y + h - v1; r[2] = x + len - u0; r[3] = y + h - v0;
+        break;
+    case SSD1306_TEXT_270:
+        r[0] = x + v0; r[1] = y + len - u1; r[2] = x + v1; r[3] = y + len - u0;
+        break;
+    case SSD1306_TEXT_RTL:
+        r[0] = x + len - u1; r[1] = y + v0; r[2] = x + len - u0; r[3] = y + v1;
+        break;
+    default:
+        r[0] = x + u0; r[1] = y + v0; r[2] = x + u1; r[3] = y + v1;
+        break;
+    }
+}
+
+
+// Underline and strike-through over [u, u + w) of a text line (see _run_rect), e.g. the space between two characters
+static void _style_lines(oled_i2c_ctx *ctx, ssd1306_text_dir_t dir, int16_t x, int16_t y, uint16_t len, int16_t u,
+                         uint8_t w, ssd1306_color_t foreground)
+{
+    const uint8_t *solid = ssd1306_patterns[SSD1306_PATTERN_SOLID];
+    int16_t r[4];
+
+    if (!(ctx->style & (SSD1306_STYLE_UNDERLINE | SSD1306_STYLE_STRIKE)) || (w == 0)
+        || (foreground == SSD1306_COLOR_TRANSPARENT))
+        return;
+    if (ctx->style_font != ctx->font)
+        _style_rows(ctx);
+    if (ctx->style & SSD1306_STYLE_UNDERLINE)
+    {
+        _run_rect(dir, x, y, len, ctx->font->height, u, u + w, ctx->underline_row, ctx->underline_row + 1, r);
+        if (_fill_rect(ctx, r[0], r[1], r[2], r[3], foreground, solid))
+            _dirty_rect(ctx, r[0], r[1], r[2], r[3]);
+    }
+    // an INVERT line must not be toggled twice
+    if ((ctx->style & SSD1306_STYLE_STRIKE)
+        && !((ctx->style & SSD1306_STYLE_UNDERLINE) && (ctx->strike_row == ctx->underline_row)))
+    {
+        _run_rect(dir, x, y, len, ctx->font->height, u, u + w, ctx->strike_row, ctx->strike_row + 1, r);
+        if (_fill_rect(ctx, r[0], r[1], r[2], r[3], foreground, solid))
+            _dirty_rect(ctx, r[0], r[1], r[2], r[3]);
+    }
+}
+
+
+// A column and the rows above and below its pixels
+static inline uint32_t _grow_rows(uint32_t col)
+{
+    return col | (col << 1) | (col >> 1);
+}
+
+
+// Apply the selected style to the cell columns cols[1..advance], cols[0] and cols[advance + 1] are next to the cell
+static void _style_cell(oled_i2c_ctx *ctx, uint32_t *cols, uint8_t advance)
+{
+    const font_info_t *font = ctx->font;
+    uint32_t mask, prev, cur, next;
+    uint8_t i, last = advance + 1;
+
+    mask = (font->height < 32) ? ((uint32_t)1 << font->height) - 1 : 0xffffffff;
+    if (ctx->style & SSD1306_STYLE_BOLD)
+    {
+        // into the blank first column of the cell if there is one (Terminus), otherwise to the right
+        if ((cols[1] == 0) && (advance > 1))
+            for (i = 1; i < advance; ++i)
+                cols[i] |= cols[i + 1];
+        else
+            for (i = last; i > 0; --i)
+                cols[i] |= cols[i - 1];
+    }
+    if (ctx->style & SSD1306_STYLE_OUTLINE)
+    {
+        // pixels next to the glyph (8 neighbours) that are not part of it
+        prev = 0;
+        cur = _grow_rows(cols[0]);
+        for (i = 0; i <= last; ++i)
+        {
+            next = (i < last) ? _grow_rows(cols[i + 1]) : 0;
+            cols[i] = (prev | cur | next) & ~cols[i] & mask;
+            prev = cur;
+            cur = next;
+        }
+    }
+    if (ctx->style & (SSD1306_STYLE_UNDERLINE | SSD1306_STYLE_STRIKE))
+    {
+        if (ctx->style_font != font)
+            _style_rows(ctx);
+        mask = 0;
+        if (ctx->style & SSD1306_STYLE_UNDERLINE)
+            mask |= (uint32_t)1 << ctx->underline_row;
+        if (ctx->style & SSD1306_STYLE_STRIKE)
+            mask |= (uint32_t)1 << ctx->strike_row;
+        for (i = 1; i <= advance; ++i)
+            cols[i] |= mask;
+    }
+}
+
+
+// Draw rows [first, first + h) of "w" column words (bit n is row n) at (x, y), h is at most 32 - first
+static void _blit_words(oled_i2c_ctx *ctx, int16_t x, int16_t y, const uint32_t *cols, uint8_t w, uint8_t first,
+                        uint8_t h, ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    uint8_t band, rows, i, bytes[STYLE_MAX_WIDTH + 2];
+
+    // _blit_glyph_band only reads the "w" bytes filled in below
+    if (w == 0)
+        return;
+    for (band = 0; band * 8 < h; ++band)
+    {
+        rows = (h - band * 8 < 8) ? h - band * 8 : 8;
+        for (i = 0; i < w; ++i)
+            bytes[i] = cols[i] >> (first + band * 8);
+        _blit_glyph_band(ctx, x, y + band * 8, bytes, w, rows, foreground, background);
+    }
+}
+
+
+// Draw glyph "c" of the current font at (x, y) with the selected style, "advance" is its cell width
+static void _draw_glyph_styled(oled_i2c_ctx *ctx, int16_t x, int16_t y, int32_t c, uint8_t advance,
+                               ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    const font_info_t *font = ctx->font;
+    uint32_t cols[STYLE_MAX_WIDTH + 2];
+    uint8_t last = advance + 1;
+    bool gap = font->c > 0;
+
+    cols[0] = 0;
+    cols[last] = 0;
+    _glyph_cell_columns(font, c, cols + 1);
+    _style_cell(ctx, cols, advance);
+
+    // the cell gets background, the columns next to it only ink and only if the font has space between characters
+    _blit_words(ctx, x, y, cols + 1, advance, 0, font->height, foreground, background);
+    if (gap)
+    {
+        _blit_words(ctx, x - 1, y, cols, 1, 0, font->height, foreground, SSD1306_COLOR_TRANSPARENT);
+        _blit_words(ctx, x + advance, y, cols + last, 1, 0, font->height, foreground, SSD1306_COLOR_TRANSPARENT);
+    }
+    _dirty_rect(ctx, x - gap, y, x + advance + gap, y + font->height);
+}
+
+/** @} */
+
+
+/**
+ * @name Turned text
+ * Glyphs are decoded into column words like styled glyphs and turned as a whole: half a turn reverses columns and
+ * rows, quarter turns transpose 8x8 tiles with _transpose8. The turned cell is drawn with the band blit, so clipping,
+ * colors and the dirty area work as for upright glyphs.
+ * @{
+ */
+
+// Rows of a column word in reverse order, row h - 1 becomes row 0
+static inline uint32_t _flip_rows(uint32_t col, uint8_t h)
+{
+    col = ((col >> 1) & 0x55555555) | ((col & 0x55555555) << 1);
+    col = ((col >> 2) & 0x33333333) | ((col & 0x33333333) << 2);
+    col = ((col >> 4) & 0x0f0f0f0f) | ((col & 0x0f0f0f0f) << 4);
+    return __builtin_bswap32(col) >> (32 - h);
+}
+
+
+/*
+ * Turn "n" column words of "h" rows a quarter clockwise or counter-clockwise into "h" column words of "n" rows,
+ * n and h at most 32. Row r of the cell becomes column h - 1 - r (clockwise) or r, column i becomes row i or n - 1 - i.
+ */
+static void _turn_cell(const uint32_t *cols, uint8_t n, uint8_t h, bool clockwise, uint32_t *out)
+{
+    uint8_t group, band, j, r, tile[8], t[8];
+    int16_t row, shift;
+
+    memset(out, 0, h * sizeof(uint32_t));
+    for (group = 0; group * 8 < n; ++group)
+    {
+        // t[r] holds cell row band * 8 + 7 - r, bit j is column group * 8 + j (column group * 8 + 7 - j reversed)
+        shift = clockwise ? group * 8 : n - 8 - group * 8;
+        for (band = 0; band * 8 < h; ++band)
+        {
+            for (j = 0; j < 8; ++j)
+                tile[clockwise ? j : 7 - j] = (group * 8 + j < n) ? cols[group * 8 + j] >> (band * 8) : 0;
+            _transpose8(tile, t);
+            for (r = 0; r < 8; ++r)
+            {
+                row = band * 8 + 7 - r;
+                if ((row >= h) || (t[r] == 0))
+                    continue;
+                out[clockwise ? h - 1 - row : row] |= (shift >= 0) ? (uint32_t)t[r] << shift : (uint32_t)(t[r] >> -shift);
+            }
+        }
+    }
+}
+
+
+/*
+ * Draw glyph "c" of the current font turned by "dir" (90, 180 or 270 degrees) with the turned cell at (x, y),
+ * "advance" is the width of the cell before turning. The selected style is applied before turning.
+ */
+static void _draw_glyph_turned(oled_i2c_ctx *ctx, int16_t x, int16_t y, int32_t c, uint8_t advance,
+                               ssd1306_text_dir_t dir, ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    const font_info_t *font = ctx->font;
+    uint32_t cols[STYLE_MAX_WIDTH + 2], turned[STYLE_MAX_WIDTH + 2];
+    uint8_t h = font->height, last = advance + 1, i;
+    bool gap = ctx->style && (font->c > 0);
+
+    cols[0] = 0;
+    cols[last] = 0;
+    _glyph_cell_columns(font, c, cols + 1);
+    if (ctx->style)
+        _style_cell(ctx, cols, advance);
+
+    if (dir == SSD1306_TEXT_180)
+    {
+        // the column right of the cell ends up left of it
+        for (i = 0; i <= last; ++i)
+            turned[last - i] = _flip_rows(cols[i], h);
+        _blit_words(ctx, x, y, turned + 1, advance, 0, h, foreground, background);
+        if (gap)
+        {
+            _blit_words(ctx, x - 1, y, turned, 1, 0, h, foreground, SSD1306_COLOR_TRANSPARENT);
+            _blit_words(ctx, x + advance, y, turned + last, 1, 0, h, foreground, SSD1306_COLOR_TRANSPARENT);
+        }
+        _dirty_rect(ctx, x - gap, y, x + advance + gap, y + h);
+        return;
+    }
+
+    // h columns of advance + 2 rows, the first and the last row are above and below the cell
+    _turn_cell(cols, advance + 2, h, dir == SSD1306_TEXT_90, turned);
+    _blit_words(ctx, x, y, turned, h, 1, advance, foreground, background);
+    if (gap)
+    {
+        _blit_words(ctx, x, y - 1, turned, h, 0, 1, foreground, SSD1306_COLOR_TRANSPARENT);
+        _blit_words(ctx, x, y + advance, turned, h, last, 1, foreground, SSD1306_COLOR_TRANSPARENT);
+    }
+    _dirty_rect(ctx, x, y - gap, x + h, y + advance + gap);
+}
+
+/** @} */
+
+
+// Draw a character of the current font (not NULL) at (x, y), which may be off the panel, return its advance
+static uint8_t _draw_codepoint(oled_i2c_ctx *ctx, int16_t x, int16_t y, uint32_t code, ssd1306_color_t foreground,
+                               ssd1306_color_t background)
+{
+    int32_t c;
+    uint8_t band, bands, rows, group, r, width, height, stride, advance;
+    uint8_t row_bytes[8], cols[8];
+    const uint8_t *bitmap;
+    const font_glyph_box_t *box;
+    glyph_slot *slot = NULL;
+    int16_t gx = x, gy = y;
+    bool opaque = (background == SSD1306_COLOR_WHITE) || (background == SSD1306_COLOR_BLACK);
+
+    // characters missing in the font are drawn as the fallback glyph or space
+    c = _glyph_index(ctx->font, code);
+    if (c < 0)
+        return 0;
+    if (ctx->font->flags & FONT_FLAG_MONO)
+    {
+        bitmap = ctx->font->bitmap + c * ctx->font->stride;
+        width = ctx->font->width;
+    }
+    else
+    {
+        bitmap = ctx->font->bitmap + ctx->font->char_descriptors[c].offset;
+        width = ctx->font->char_descriptors[c].width;
+    }
+    height = ctx->font->height;
+    advance = width;
+    if ((foreground == SSD1306_COLOR_TRANSPARENT) && !opaque)
+        return advance;
+    // styled glyphs may reach into the space next to the cell
+    if ((x > ctx->clip_right) || (x + advance < ctx->clip_left) || (y >= ctx->clip_bottom)
+        || (y + height <= ctx->clip_top))
+        return advance;
+    if (ctx->style && (height <= 32) && (advance <= STYLE_MAX_WIDTH))
+    {
+        _draw_glyph_styled(ctx, x, y, c, advance, foreground, background);
+        return advance;
+    }
+    if ((x == ctx->clip_right) || (x + advance == ctx->clip_left))
+        return advance;
+
+    if (ctx->font->boxes)
+    {
+        // only the ink box is stored, background of the rest of the cell is filled here
+        box = &ctx->font->boxes[c];
+        if (opaque)
+            _fill_around_box(ctx, x, y, advance, height, box, 1, background);
+        gx += box->x;
+        gy += box->y;
+        width = box->w;
+        height = box->h;
+        if ((width == 0) || (height == 0))
+            goto draw_codepoint_finish;
+    }
+
+    if (ctx->glyph_cache)
+        slot = _glyph_cache_get(ctx->glyph_cache, ctx->font, c, bitmap, width, height, gy & 7);
+    if (slot)
+    {
+        _blit_glyph_slot(ctx, gx, gy, slot, height, foreground, background);
+        goto draw_codepoint_finish;
+    }
+
+    if (ctx->font->flags & FONT_FLAG_RLE)
+    {
+        _blit_glyph_rle(ctx, gx, gy, bitmap, width, height, foreground, background);
+        goto draw_codepoint_finish;
+    }
+
+    bands = (height + 7) / 8;
+    for (band = 0; band < bands; ++band)
+    {
+        rows = (height - band * 8 < 8) ? height - band * 8 : 8;
+        if (ctx->font->flags & FONT_FLAG_PAGES)
+        {
+            // page-native glyph: column bytes can be used as they are
+            _blit_glyph_band(ctx, gx, gy + band * 8, bitmap + band * width, width, rows, foreground, background);
+            continue;
+        }
+        // row-major glyph: transpose 8 rows x 8 columns at a time
+        stride = (width + 7) / 8;
+        for (group = 0; group < stride; ++group)
+        {
+            for (r = 0; r < 8; ++r)
+                row_bytes[r] = (r < rows) ? bitmap[(band * 8 + r) * stride + group] : 0;
+            _transpose8(row_bytes, cols);
+            _blit_glyph_band(ctx, gx + group * 8, gy + band * 8, cols,
+                             (width - group * 8 < 8) ? width - group * 8 : 8, rows, foreground, background);
+        }
+    }
+
+draw_codepoint_finish:
+    // update dirty area once for the whole glyph, the full cell if the background was drawn
+    if (opaque)
+        _dirty_rect(ctx, x, y, x + advance, y + ctx->font->height);
+    else
+        _dirty_rect(ctx, gx, gy, gx + width, gy + height);
+    return advance;
+}
+
+
+// return character width
+uint8_t ssd1306_draw_char(uint8_t id, uint8_t x, uint8_t y, unsigned char c, ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    return ssd1306_draw_codepoint(id, x, y, c, foreground, background);
+}
+
+
+uint8_t ssd1306_draw_codepoint(uint8_t id, uint8_t x, uint8_t y, uint32_t code, ssd1306_color_t foreground,
+                               ssd1306_color_t background)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+
+    if (ctx == NULL)
+        return 0;
+
+    if (ctx->font == NULL)
+        return 0;
+
+    if (_band_record(ctx, BAND_CODEPOINT, x, y, code, foreground, background))
+        return _char_width(ctx->font, code);
+    return _draw_codepoint(ctx, x, y, code, foreground, background);
+}
+
+
+// Every bit of a nibble repeated 2, 3 or 4 times, so one source column byte expands to "scale" bytes
+static const uint16_t _bit_expand[3][16] =
+{
+    { 0x0000, 0x0003, 0x000c, 0x000f, 0x0030, 0x0033, 0x003c, 0x003f,
+      0x00c0, 0x00c3, 0x00cc, 0x00cf, 0x00f0, 0x00f3, 0x00fc, 0x00ff },   // 2x
+    { 0x0000, 0x0007, 0x0038, 0x003f, 0x01c0, 0x01c7, 0x01f8, 0x01ff,
+      0x0e00, 0x0e07, 0x0e38, 0x0e3f, 0x0fc0, 0x0fc7, 0x0ff8, 0x0fff },   // 3x
+    { 0x0000, 0x000f, 0x00f0, 0x00ff, 0x0f00, 0x0f0f, 0x0ff0, 0x0fff,
+      0xf000, 0xf00f, 0xf0f0, 0xf0ff, 0xff00, 0xff0f, 0xfff0, 0xffff },   // 4x
+};
+
+
+// Draw a character of the current font magnified 2..4 times at (x, y), return its advance
+static uint16_t _draw_codepoint_scaled(oled_i2c_ctx *ctx, int16_t x, int16_t y, uint32_t code, uint8_t scale,
+                                       ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    const font_info_t *font = ctx->font;
+    const uint16_t *expand = _bit_expand[scale - 2];
+    const font_glyph_box_t *box;
+    const uint8_t *bitmap;
+    uint8_t src[256], cols[256];
+    uint8_t band, bands, rows, k, i, j, first, n, width, height;
+    uint16_t advance;
+    uint32_t e;
+    int32_t c;
+    int16_t gx = x, gy = y;
+    bool opaque = (background == SSD1306_COLOR_WHITE) || (background == SSD1306_COLOR_BLACK);
+
+    c = _glyph_index(font, code);
+    if (c < 0)
+        return 0;
+    if (font->flags & FONT_FLAG_MONO)
+    {
+        bitmap = font->bitmap + c * font->stride;
+        width = font->width;
+    }
+    else
+    {
+        bitmap = font->bitmap + font->char_descriptors[c].offset;
+        width = font->char_descriptors[c].width;
+    }
+    height = font->height;
+    advance = width * scale;
+    if ((foreground == SSD1306_COLOR_TRANSPARENT) && !opaque)
+        return advance;
+    if ((x >= ctx->clip_right) || (x + advance <= ctx->clip_left) || (y >= ctx->clip_bottom)
+        || (y + height * scale <= ctx->clip_top))
+        return advance;
+
+    if (font->boxes)
+    {
+        box = &font->boxes[c];
+        if (opaque)
+            _fill_around_box(ctx, x, y, advance, height * scale, box, scale, background);
+        gx += box->x * scale;
+        gy += box->y * scale;
+        width = box->w;
+        height = box->h;
+    }
+
+    // a source band of 8 rows becomes "scale" bands, every column is repeated "scale" times
+    bands = (width && height) ? (height + 7) / 8 : 0;
+    for (band = 0; band < bands; ++band)
+    {
+        _glyph_band_columns(font, bitmap, width, height, band, src);
+        rows = ((height - band * 8 < 8) ? height - band * 8 : 8) * scale;
+        for (k = 0; k * 8 < rows; ++k)
+        {
+            // in pieces the band blit can take
+            for (first = 0; first < width; first += n)
+            {
+                n = (width - first < 255 / scale) ? width - first : 255 / scale;
+                for (i = 0; i < n; ++i)
+                {
+                    e = expand[src[first + i] & 0x0f] | ((uint32_t)expand[src[first + i] >> 4] << (4 * scale));
+                    for (j = 0; j < scale; ++j)
+                        cols[i * scale + j] = e >> (k * 8);
+                }
+                _blit_glyph_band(ctx, gx + first * scale, gy + (band * 8 * scale) + k * 8, cols, n * scale,
+                                 (rows - k * 8 < 8) ? rows - k * 8 : 8, foreground, background);
+            }
+        }
+    }
+
+    if (opaque)
+        _dirty_rect(ctx, x, y, x + advance, y + font->height * scale);
+    else
+        _dirty_rect(ctx, gx, gy, gx + width * scale, gy + height * scale);
+    return advance;
+}
+
+
+uint16_t ssd1306_draw_char_scaled(uint8_t id, uint8_t x, uint8_t y, uint32_t code, uint8_t scale,
+                                  ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+
+    if (ctx == NULL)
+        return 0;
+
+    if ((ctx->font == NULL) || (scale == 0) || (scale > 4))
+        return 0;
+
+    if (_band_record(ctx, BAND_CHAR_SCALED, x, y, code, scale, foreground, background))
+        return _char_width(ctx->font, code) * scale;
+    if (scale == 1)
+        return _draw_codepoint(ctx, x, y, code, foreground, background);
+    return _draw_codepoint_scaled(ctx, x, y, code, scale, foreground, background);
+}
+
+
+uint16_t ssd1306_draw_string_scaled(uint8_t id, uint8_t x, uint8_t y, const char *str, uint8_t scale,
+                                    ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    uint16_t w = 0;
+    uint32_t code, prev = 0;
+    bool recorded;
+
+    if (ctx == NULL)
+        return 0;
+
+    if ((ctx->font == NULL) || (str == NULL) || (scale == 0) || (scale > 4))
+        return 0;
+
+    // a recorded string is only measured
+    recorded = _band_record(ctx, BAND_STRING_SCALED, x, y, str, scale, foreground, background);
+    while (*str)
+    {
+        if ((unsigned char)*str < 0x80)
+            code = (unsigned char)*str++;
+        else
+            code = ssd1306_utf8_next(&str);
+        if (prev)
+            w += (ctx->font->c + _kern(ctx->font, prev, code)) * scale;
+        prev = code;
+        if (recorded || (x + w >= ctx->clip_right))
+            w += _char_width(ctx->font, code) * scale;
+        else if (scale == 1)
+            w += _draw_codepoint(ctx, x + w, y, code, foreground, background);
+        else
+            w += _draw_codepoint_scaled(ctx, x + w, y, code, scale, foreground, background);
+    }
+    return w;
+}
+
+
+bool ssd1306_glyph_cache_init(uint8_t id, uint16_t size)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    glyph_cache *cache;
+
+    if (ctx == NULL)
+        return false;
+
+    ssd1306_glyph_cache_term(id);
+    if (size <= sizeof(glyph_cache))
+        return false;
+    cache = calloc(1, size);
+    if (cache == NULL)
+    {
+        ESP_LOGE(__func__,"Alloc glyph cache failed.");
+        return false;
+    }
+    cache->slots = (uint8_t *)(cache + 1);
+    cache->budget = size - sizeof(glyph_cache);
+    ctx->glyph_cache = cache;
+    return true;
+}
+
+
+void ssd1306_glyph_cache_term(uint8_t id)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+
+    if (ctx == NULL)
+        return;
+    free(ctx->glyph_cache);
+    ctx->glyph_cache = NULL;
+}
+
+
+void ssd1306_glyph_cache_stats(uint8_t id, uint32_t *hits, uint32_t *misses)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    glyph_cache *cache = ctx ? ctx->glyph_cache : NULL;
+
+    if (hits)
+        *hits = cache ? cache->hits : 0;
+    if (misses)
+        *misses = cache ? cache->misses : 0;
+}
+
+
+// Number of characters of a UTF-8 string
+static uint16_t _utf8_length(const char *str)
+{
+    uint16_t n = 0;
+
+    while (*str)
+    {
+        if ((unsigned char)*str < 0x80)
+            ++str;
+        else
+            ssd1306_utf8_next(&str);
+        ++n;
+    }
+    return n;
+}
+
+
+/*
+ * Lay out a string in the current font, each character follows the previous one after "c" plus kerning. With
+ * "draw" the characters are drawn at (x, y) as well, measuring and drawing take the same single pass. Return the
+ * width of the string.
+ */
+static uint16_t _layout_string(oled_i2c_ctx *ctx, int16_t x, int16_t y, const char *str,
+                               ssd1306_color_t foreground, ssd1306_color_t background, bool draw)
+{
+    const font_info_t *font = ctx->font;
+    int16_t w = 0, end = x, space;
+    uint32_t code, prev = 0;
+    uint8_t advance;
+    // kerned characters may overlap, the background only goes where the previous character ended
+    bool fill = draw && font->kerning
+                && ((background == SSD1306_COLOR_WHITE) || (background == SSD1306_COLOR_BLACK));
+
+    while (*str)
+    {
+        // ASCII does not need the decoder
+        if ((unsigned char)*str < 0x80)
+            code = (unsigned char)*str++;
+        else
+            code = ssd1306_utf8_next(&str);
+        if (prev)
+        {
+            space = font->c + _kern(font, prev, code);
+            if (draw && (space > 0))
+                _style_lines(ctx, SSD1306_TEXT_LTR, x, y, 0, w, space, foreground);
+            w += space;
+        }
+        prev = code;
+        // characters right of the panel are only measured
+        if (!draw || (x + w >= ctx->clip_right))
+        {
+            w += _char_width(font, code);
+            continue;
+        }
+        if (fill)
+        {
+            advance = _char_width(font, code);
+            if (_fill_rect(ctx, (x + w > end) ? x + w : end, y, x + w + advance, y + font->height, background,
+                           ssd1306_patterns[SSD1306_PATTERN_SOLID]))
+                _dirty_rect(ctx, (x + w > end) ? x + w : end, y, x + w + advance, y + font->height);
+            _draw_codepoint(ctx, x + w, y, code, foreground, SSD1306_COLOR_TRANSPARENT);
+        }
+        else
+        {
+            advance = _draw_codepoint(ctx, x + w, y, code, foreground, background);
+        }
+        w += advance;
+        end = x + w;
+    }
+    return (w > 0) ? w : 0;
+}
+
+
+uint16_t ssd1306_draw_string(uint8_t id, uint8_t x, uint8_t y, const char *str, ssd1306_color_t foreground,
+                             ssd1306_color_t background)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+
+    if (ctx == NULL)
+        return 0;
+
+    if (ctx->font == NULL)
+        return 0;
+
+    if (str == NULL)
+        return 0;
+
+    if (_band_record(ctx, BAND_STRING, x, y, str, foreground, background))
+        return _layout_string(ctx, 0, 0, str, SSD1306_COLOR_TRANSPARENT, SSD1306_COLOR_TRANSPARENT, false);
+    return _layout_string(ctx, x, y, str, foreground, background, true);
+}
+
+
+/*
+ * Draw a string of width "len" in direction "dir" other than left to right, (x, y) is the top-left corner of the
+ * line. The characters follow each other as in _layout_string, _run_rect places them on the panel.
+ */
+static void _layout_run(oled_i2c_ctx *ctx, int16_t x, int16_t y, const char *str, uint16_t len,
+                        ssd1306_text_dir_t dir, ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    const font_info_t *font = ctx->font;
+    int16_t w = 0, end = 0, space, r[4];
+    uint32_t code, prev = 0;
+    uint8_t advance, max;
+    int32_t c;
+    bool opaque = (background == SSD1306_COLOR_WHITE) || (background == SSD1306_COLOR_BLACK);
+    // kerned characters may overlap, the background only goes where the previous character ended
+    bool fill = opaque && font->kerning;
+
+    // quarter turns keep the columns next to the cell in a 32-bit column word
+    max = ((dir == SSD1306_TEXT_90) || (dir == SSD1306_TEXT_270)) ? 30 : STYLE_MAX_WIDTH;
+    while (*str)
+    {
+        if ((unsigned char)*str < 0x80)
+            code = (unsigned char)*str++;
+        else
+            code = ssd1306_utf8_next(&str);
+        if (prev)
+        {
+            // pairs are kerned in the order they have on the panel
+            space = font->c + ((dir == SSD1306_TEXT_RTL) ? _kern(font, code, prev) : _kern(font, prev, code));
+            if (space > 0)
+                _style_lines(ctx, dir, x, y, len, w, space, foreground);
+            w += space;
+        }
+        prev = code;
+        c = _glyph_index(font, code);
+        if (c < 0)
+            continue;
+        advance = (font->flags & FONT_FLAG_MONO) ? font->width : font->char_descriptors[c].width;
+        if (fill && (w + advance > end))
+        {
+            _run_rect(dir, x, y, len, font->height, (w > end) ? w : end, w + advance, 0, font->height, r);
+            if (_fill_rect(ctx, r[0], r[1], r[2], r[3], background, ssd1306_patterns[SSD1306_PATTERN_SOLID]))
+                _dirty_rect(ctx, r[0], r[1], r[2], r[3]);
+        }
+        _run_rect(dir, x, y, len, font->height, w, w + advance, 0, font->height, r);
+        w += advance;
+        end = w;
+        // styled glyphs may reach one pixel beyond the cell
+        if ((r[0] > ctx->clip_right) || (r[2] < ctx->clip_left) || (r[1] > ctx->clip_bottom)
+            || (r[3] < ctx->clip_top) || ((foreground == SSD1306_COLOR_TRANSPARENT) && !opaque))
+            continue;
+        if (dir == SSD1306_TEXT_RTL)
+            _draw_codepoint(ctx, r[0], r[1], code, foreground, fill ? SSD1306_COLOR_TRANSPARENT : background);
+        else if ((advance <= max) && (font->height <= 32))
+            _draw_glyph_turned(ctx, r[0], r[1], c, advance, dir, foreground,
+                               fill ? SSD1306_COLOR_TRANSPARENT : background);
+    }
+}
+
+
+uint16_t ssd1306_draw_string_dir(uint8_t id, uint8_t x, uint8_t y, const char *str, ssd1306_text_dir_t dir,
+                                 ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    uint16_t len;
+
+    if (ctx == NULL)
+        return 0;
+
+    if ((ctx->font == NULL) || (str == NULL))
+        return 0;
+
+    if (_band_record(ctx, BAND_STRING_DIR, x, y, str, dir, foreground, background))
+        return _layout_string(ctx, 0, 0, str, SSD1306_COLOR_TRANSPARENT, SSD1306_COLOR_TRANSPARENT, false);
+    if (dir == SSD1306_TEXT_LTR)
+        return _layout_string(ctx, x, y, str, foreground, background, true);
+    // the first character of a right-to-left, upside down or upwards line is drawn at its far end
+    len = _layout_string(ctx, 0, 0, str, SSD1306_COLOR_TRANSPARENT, SSD1306_COLOR_TRANSPARENT, false);
+    _layout_run(ctx, x, y, str, len, dir, foreground, background);
+    return len;
+}
+
+
+// return width of string
+uint16_t ssd1306_measure_string(uint8_t id, const char *str)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    uint16_t n;
+
+    if (ctx == NULL)
+        return 0;
+
+    if (ctx->font == NULL)
+        return 0;
+
+    if ((ctx->font->flags & FONT_FLAG_MONO) && (ctx->font->kerning == NULL))
+    {
+        // count characters, not bytes
+        n = _utf8_length(str);
+        return n ? n * ctx->font->width + (n - 1) * ctx->font->c : 0;
+    }
+    return _layout_string(ctx, 0, 0, str, SSD1306_COLOR_TRANSPARENT, SSD1306_COLOR_TRANSPARENT, false);
+}
+
+
+// Next character of a UTF-8 string, does not advance past the terminating 0
+static inline uint32_t _text_next(const char **str)
+{
+    if ((unsigned char)**str >= 0x80)
+        return ssd1306_utf8_next(str);
+    return **str ? (unsigned char)*(*str)++ : 0;
+}
+
+
+/*
+ * Find the end of the line starting at "str": the next newline, or with "wrap" the last space before the text gets
+ * wider than "max" (inside a word if it has no space). Return the end, "next" is set to the start of the next
+ * line, "width" to the width of the line without trailing spaces.
+ */
+static const char *_text_line(const font_info_t *font, const char *str, uint16_t max, bool wrap, const char **next,
+                              uint16_t *width)
+{
+    const char *p = str, *q, *brk = NULL, *brk_next = NULL;
+    uint16_t w = 0, brk_w = 0;
+    int16_t add;
+    uint32_t code, prev = 0;
+    bool space = false;
+
+    for (;;)
+    {
+        q = p;
+        code = _text_next(&p);
+        if ((code == 0) || (code == '\n'))
+        {
+            *width = space ? brk_w : w;
+            *next = p;
+            return space ? brk : q;
+        }
+        add = _char_width(font, code) + ((q != str) ? font->c + _kern(font, prev, code) : 0);
+        prev = code;
+        if (code == ' ')
+        {
+            // a line may end at the first space of a run and the next one starts after the run
+            if (!space)
+            {
+                brk = q;
+                brk_w = w;
+            }
+            brk_next = p;
+            space = true;
+        }
+        else
+        {
+            // spaces never wrap, they hang off the end of the line
+            if (wrap && (w + add > max) && (q != str))
+            {
+                if (brk && (brk != str))
+                {
+                    *width = brk_w;
+                    *next = brk_next;
+                    return brk;
+                }
+                *width = w;
+                *next = q;
+                return q;
+            }
+            space = false;
+        }
+        w += add;
+    }
+}
+
+
+// Shorten [str, end) to fit into "max" together with an ellipsis "ellipsis" pixels wide, drop trailing spaces
+static const char *_text_cut(const font_info_t *font, const char *str, const char *end, uint16_t max,
+                             uint16_t ellipsis, uint16_t *width)
+{
+    const char *p = str, *q, *ink = str;
+    uint16_t w = 0, ink_w = 0;
+    int16_t add;
+    uint32_t code, prev = 0;
+
+    while (p < end)
+    {
+        q = p;
+        code = _text_next(&p);
+        add = _char_width(font, code) + ((q != str) ? font->c + _kern(font, prev, code) : 0);
+        prev = code;
+        if (w + add + font->c + ellipsis > max)
+            break;
+        w += add;
+        if (code != ' ')
+        {
+            ink = p;
+            ink_w = w;
+        }
+    }
+    *width = ink_w;
+    return ink;
+}
+
+
+// Lay out a text box, draw the lines inside the clip rectangle if "draw", return the height of the text
+static uint16_t _text_box(oled_i2c_ctx *ctx, const ssd1306_text_box_t *box, const char *str,
+                          ssd1306_color_t foreground, ssd1306_color_t background, bool draw)
+{
+    const font_info_t *font = ctx->font;
+    const char *end, *next, *p;
+    uint16_t width, dots = 0, height = 0, pitch = font->height + box->line_spacing;
+    int16_t x, y = box->y - box->scroll, space;
+    uint32_t ellipsis = 0x2026, code, prev;
+    uint8_t n;
+    bool cut, last;
+
+    if (box->ellipsis)
+    {
+        // "..." if the font has no ellipsis character
+        if (_font_index(font, ellipsis) < 0)
+            ellipsis = '.';
+        dots = _char_width(font, ellipsis);
+        if (ellipsis == '.')
+            dots = 3 * dots + 2 * font->c;
+    }
+
+    while (*str)
+    {
+        end = _text_line(font, str, box->w, box->wrap, &next, &width);
+        cut = box->ellipsis && (width > box->w);
+        // with an ellipsis text stops at the last line that fits completely
+        last = box->ellipsis && *next && (y + pitch + font->height > box->y + box->h);
+        if (last)
+            cut = true;
+
+        if (draw && (y < ctx->clip_bottom) && (y + font->height > ctx->clip_top))
+        {
+            if (cut)
+            {
+                end = _text_cut(font, str, end, box->w, dots, &width);
+                width += (width ? font->c : 0) + dots;
+            }
+            x = box->x;
+            if (box->align == SSD1306_ALIGN_CENTER)
+                x += ((int16_t)box->w - width) / 2;
+            else if (box->align == SSD1306_ALIGN_RIGHT)
+                x += (int16_t)box->w - width;
+            for (p = str, prev = 0; (p < end) && (x < ctx->clip_right); prev = code)
+            {
+                code = _text_next(&p);
+                if (prev)
+                {
+                    space = font->c + _kern(font, prev, code);
+                    if (space > 0)
+                        _style_lines(ctx, SSD1306_TEXT_LTR, x, y, 0, 0, space, foreground);
+                    x += space;
+                }
+                x += _draw_codepoint(ctx, x, y, code, foreground, background);
+            }
+            // the ellipsis is not kerned
+            for (n = cut ? ((ellipsis == '.') ? 3 : 1) : 0; n; --n, prev = ellipsis)
+            {
+                if (prev)
+                {
+                    _style_lines(ctx, SSD1306_TEXT_LTR, x, y, 0, 0, font->c, foreground);
+                    x += font->c;
+                }
+                x += _draw_codepoint(ctx, x, y, ellipsis, foreground, background);
+            }
+        }
+
+        height += (height ? box->line_spacing : 0) + font->height;
+        y += pitch;
+        str = next;
+        if (last)
+            break;
+    }
+    return height;
+}
+
+
+uint16_t ssd1306_draw_text_box(uint8_t id, const ssd1306_text_box_t *box, const char *str,
+                               ssd1306_color_t foreground, ssd1306_color_t background)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    uint8_t clip[4];
+    int16_t x0, y0, x1, y1;
+    uint16_t height;
+
+    if (ctx == NULL)
+        return 0;
+
+    if ((ctx->font == NULL) || (box == NULL) || (str == NULL))
+        return 0;
+
+    if (_band_record(ctx, BAND_TEXT_BOX, box, str, foreground, background))
+        return _text_box(ctx, box, str, foreground, background, false);
+    x0 = (box->x > ctx->clip_left) ? box->x : ctx->clip_left;
+    y0 = (box->y > ctx->clip_top) ? box->y : ctx->clip_top;
+    x1 = (box->x + box->w < ctx->clip_right) ? box->x + box->w : ctx->clip_right;
+    y1 = (box->y + box->h < ctx->clip_bottom) ? box->y + box->h : ctx->clip_bottom;
+    if ((x0 >= x1) || (y0 >= y1))
+        return _text_box(ctx, box, str, foreground, background, false);
+
+    clip[0] = ctx->clip_left;
+    clip[1] = ctx->clip_top;
+    clip[2] = ctx->clip_right;
+    clip[3] = ctx->clip_bottom;
+    ctx->clip_left = x0;
+    ctx->clip_top = y0;
+    ctx->clip_right = x1;
+    ctx->clip_bottom = y1;
+
+    // an opaque background clears the whole box once, glyphs then only draw their ink
+    if (((background == SSD1306_COLOR_WHITE) || (background == SSD1306_COLOR_BLACK))
+        && _fill_rect(ctx, x0, y0, x1, y1, background, ssd1306_patterns[SSD1306_PATTERN_SOLID]))
+    {
+        _dirty_rect(ctx, x0, y0, x1, y1);
+        background = SSD1306_COLOR_TRANSPARENT;
+    }
+    height = _text_box(ctx, box, str, foreground, background, true);
+
+    ctx->clip_left = clip[0];
+    ctx->clip_top = clip[1];
+    ctx->clip_right = clip[2];
+    ctx->clip_bottom = clip[3];
+    return height;
+}
+
+
+uint16_t ssd1306_measure_text_box(uint8_t id, const ssd1306_text_box_t *box, const char *str)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+
+    if (ctx == NULL)
+        return 0;
+
+    if ((ctx->font == NULL) || (box == NULL) || (str == NULL))
         return 0;
 
-    if (str == NULL)
-        return 0;
+    return _text_box(ctx, box, str, SSD1306_COLOR_TRANSPARENT, SSD1306_COLOR_TRANSPARENT, false);
+}
+
+
+// Fill [x0, x1) x [y0, y1) with a solid color and mark it dirty, or record that for a band
+static void _fill_solid(oled_i2c_ctx *ctx, int16_t x0, int16_t y0, int16_t x1, int16_t y1, ssd1306_color_t color)
+{
+    if (_band_record(ctx, BAND_FILL, x0, y0, x1, y1, color))
+        return;
+    if (_fill_rect(ctx, x0, y0, x1, y1, color, ssd1306_patterns[SSD1306_PATTERN_SOLID]))
+        _dirty_rect(ctx, x0, y0, x1, y1);
+}
+
+
+// Draw a string in the given font and style on a transparent background, or record that for a band
+static void _draw_text(oled_i2c_ctx *ctx, const font_info_t *font, uint8_t style, int16_t x, int16_t y,
+                       const char *str, ssd1306_color_t foreground)
+{
+    const font_info_t *prev_font = ctx->font;
+    uint8_t prev_style = ctx->style;
+
+    if (_band_record(ctx, BAND_TEXT, font, style, x, y, str, foreground))
+        return;
+    ctx->font = font;
+    ctx->style = style;
+    _layout_string(ctx, x, y, str, foreground, SSD1306_COLOR_TRANSPARENT, true);
+    ctx->font = prev_font;
+    ctx->style = prev_style;
+}
+
+
+bool ssd1306_number_field_init(ssd1306_number_field_t *field, int8_t x, int8_t y, const font_info_t *font,
+                               uint8_t digits, uint8_t decimals)
+{
+    uint8_t i, w;
+
+    if ((field == NULL) || (font == NULL))
+        return false;
+
+    if ((decimals >= digits) || (digits + (decimals ? 1 : 0) > SSD1306_NUMBER_FIELD_MAX_CELLS))
+        return false;
+
+    field->x = x;
+    field->y = y;
+    field->font = font;
+    field->cells = digits + (decimals ? 1 : 0);
+    field->decimals = decimals;
+    field->cell_width = _char_width(font, '-');
+    for (i = '0'; i <= '9'; ++i)
+    {
+        w = _char_width(font, i);
+        if (w > field->cell_width)
+            field->cell_width = w;
+    }
+    field->point_width = decimals ? _char_width(font, '.') : 0;
+    field->width = digits * field->cell_width + field->point_width + (field->cells - 1) * font->c;
+    field->foreground = SSD1306_COLOR_TRANSPARENT;
+    field->background = SSD1306_COLOR_TRANSPARENT;
+    ssd1306_number_field_invalidate(field);
+    return true;
+}
+
+
+void ssd1306_number_field_invalidate(ssd1306_number_field_t *field)
+{
+    if (field)
+        memset(field->shown, 0, sizeof(field->shown));
+}
+
+
+// Right aligned characters of a value, '.' in the point cell
+static void _format_number(const ssd1306_number_field_t *field, int32_t value, char *text)
+{
+    uint32_t v = (value < 0) ? 0 - (uint32_t)value : (uint32_t)value;
+    uint8_t point = field->decimals ? field->cells - field->decimals - 1 : field->cells;
+    int8_t i;
+
+    for (i = field->cells - 1; i >= 0; --i)
+    {
+        if (i == point)
+            text[i] = '.';
+        // digits after the point and the one in front of it are always shown
+        else if (v || (i >= point - 1))
+        {
+            text[i] = '0' + v % 10;
+            v /= 10;
+        }
+        else
+            break;
+    }
+    if ((value < 0) && (i >= 0))
+        text[i--] = '-';
+    else if (value < 0)
+        v = 1;
+    if (v)
+    {
+        for (i = 0; i < field->cells; ++i)
+            text[i] = (i == point) ? '.' : '-';
+        return;
+    }
+    for (; i >= 0; --i)
+        text[i] = ' ';
+}
+
+
+bool ssd1306_number_field_draw(uint8_t id, ssd1306_number_field_t *field, int32_t value,
+                               ssd1306_color_t foreground, ssd1306_color_t background, ssd1306_rect_t *dirty)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    char text[SSD1306_NUMBER_FIELD_MAX_CELLS], cell[2] = { 0, 0 };
+    int16_t x, x0 = 0, x1 = 0, end;
+    uint8_t i, w, h;
+    bool opaque = (background == SSD1306_COLOR_WHITE) || (background == SSD1306_COLOR_BLACK), drawn = false;
+
+    if (dirty)
+        dirty->w = 0;
+
+    if ((ctx == NULL) || (field == NULL) || (field->font == NULL))
+        return false;
+
+    if ((field->foreground != foreground) || (field->background != background))
+    {
+        ssd1306_number_field_invalidate(field);
+        field->foreground = foreground;
+        field->background = background;
+    }
+
+    _format_number(field, value, text);
+
+    h = field->font->height;
+    for (i = 0, x = field->x; i < field->cells; ++i, x += w + field->font->c)
+    {
+        w = (text[i] == '.') ? field->point_width : field->cell_width;
+        if (text[i] == field->shown[i])
+            continue;
+        // glyph centred in its cell, the rest of the cell (and the gap to the next one) is background
+        end = x + w + ((i + 1 < field->cells) ? field->font->c : 0);
+        if (opaque)
+            _fill_solid(ctx, x, field->y, end, field->y + h, background);
+        // the field has its own font
+        cell[0] = text[i];
+        _draw_text(ctx, field->font, ctx->style, x + (w - _char_width(field->font, text[i])) / 2, field->y, cell,
+                   foreground);
+        field->shown[i] = text[i];
+        if (!drawn)
+            x0 = x;
+        x1 = end;
+        drawn = true;
+    }
+
+    if (!drawn)
+        return false;
+    if (dirty)
+    {
+        dirty->x = x0;
+        dirty->y = field->y;
+        dirty->w = x1 - x0;
+        dirty->h = h;
+    }
+    return true;
+}
+
+
+/**
+ * @name Label pool
+ * Label bitmaps are allocated one after the other, a label that does not fit any more empties the pool. Every
+ * emptied pool starts a new generation, labels rendered in an older generation are rendered again when drawn.
+ * @{
+ */
+
+typedef struct _label_pool
+{
+    uint8_t *data;              // first bitmap, right after this header
+    uint16_t size;              // bytes available for bitmaps
+    uint16_t used;
+    uint32_t generation;
+    ssd1306_label_stats_t stats;
+} label_pool;
+
+// Generations are unique across pools, a label drawn on another panel is never taken as rendered
+static uint32_t _label_generation = 0;
+
+
+static void _label_pool_flush(label_pool *pool)
+{
+    pool->used = 0;
+    if (++_label_generation == 0)
+        ++_label_generation;
+    pool->generation = _label_generation;
+}
+
+
+// FNV-1a hash of a string
+static uint32_t _label_hash(const char *str)
+{
+    uint32_t hash = 2166136261u;
 
     while (*str)
+        hash = (hash ^ (unsigned char)*str++) * 16777619u;
+    return hash;
+}
+
+
+// Draw a label's text at (x, y) with the label font, return the number of characters
+static uint16_t _label_text(oled_i2c_ctx *ctx, const ssd1306_label_t *label, int16_t x, int16_t y,
+                            ssd1306_color_t foreground)
+{
+    // labels do not take the style of the panel, cached bitmaps could not follow it
+    _draw_text(ctx, label->font, SSD1306_STYLE_NORMAL, x, y, label->text, foreground);
+    return _utf8_length(label->text);
+}
+
+
+// Render a label into the pool, false if it does not fit
+static bool _label_render(label_pool *pool, ssd1306_label_t *label, uint16_t width, uint32_t hash)
+{
+    oled_i2c_ctx bitmap;
+    uint16_t size = width * ((label->font->height + 7) / 8);
+
+    if ((width > SSD1306_MAX_WIDTH) || (size > pool->size))
+        return false;
+    if (pool->used + size > pool->size)
     {
-       x += ssd1306_draw_char(id, x, y, *str, foreground, background);
-       ++str;
-       if (*str)
-           x += ctx->font->c;
+        _label_pool_flush(pool);
+        ++pool->stats.flushes;
     }
 
-    return (x - t);
+    // the bitmap is drawn like a surface that is not registered
+    memset(&bitmap, 0, sizeof(bitmap));
+    bitmap.type = SSD1306_SURFACE;
+    bitmap.buffer = pool->data + pool->used;
+    bitmap.width = width;
+    bitmap.height = label->font->height;
+    bitmap.clip_right = width;
+    bitmap.clip_bottom = label->font->height;
+    memset(bitmap.buffer, 0, size);
+    label->glyphs = _label_text(&bitmap, label, 0, 0, SSD1306_COLOR_WHITE);
+
+    label->generation = pool->generation;
+    label->hash = hash;
+    label->rendered_font = label->font;
+    label->offset = pool->used;
+    label->width = width;
+    pool->used += size;
+    return true;
+}
+
+/** @} */
+
+
+bool ssd1306_label_pool_init(uint8_t id, uint16_t size)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    label_pool *pool;
+
+    if (ctx == NULL)
+        return false;
+
+    ssd1306_label_pool_term(id);
+    if (size <= sizeof(label_pool))
+        return false;
+    pool = calloc(1, size);
+    if (pool == NULL)
+    {
+        ESP_LOGE(__func__,"Alloc label pool failed.");
+        return false;
+    }
+    pool->data = (uint8_t *)(pool + 1);
+    pool->size = size - sizeof(label_pool);
+    _label_pool_flush(pool);
+    ctx->label_pool = pool;
+    return true;
 }
 
 
-// return width of string
-uint8_t ssd1306_measure_string(uint8_t id, char *str)
+void ssd1306_label_pool_term(uint8_t id)
 {
     oled_i2c_ctx *ctx = _ctxs[id];
-    uint8_t w = 0;
-    unsigned char c;
 
     if (ctx == NULL)
+        return;
+    free(ctx->label_pool);
+    ctx->label_pool = NULL;
+}
+
+
+void ssd1306_label_pool_stats(uint8_t id, ssd1306_label_stats_t *stats)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    label_pool *pool = ctx ? ctx->label_pool : NULL;
+
+    if (stats == NULL)
+        return;
+    if (pool)
+        *stats = pool->stats;
+    else
+        memset(stats, 0, sizeof(*stats));
+}
+
+
+void ssd1306_label_init(ssd1306_label_t *label, int8_t x, int8_t y, const font_info_t *font, const char *text)
+{
+    if (label == NULL)
+        return;
+
+    memset(label, 0, sizeof(*label));
+    label->x = x;
+    label->y = y;
+    label->font = font;
+    label->text = text;
+}
+
+
+uint16_t ssd1306_label_draw(uint8_t id, ssd1306_label_t *label, ssd1306_color_t foreground,
+                            ssd1306_color_t background)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    const font_info_t *font;
+    label_pool *pool;
+    uint16_t width = 0, glyphs;
+    uint32_t hash = 0;
+    int64_t start;
+    bool cached = false;
+
+    if ((ctx == NULL) || (label == NULL) || (label->font == NULL) || (label->text == NULL))
         return 0;
+    // a band panel has no pixels to copy bitmaps into, its labels are recorded as text
+    pool = ctx->band ? NULL : ctx->label_pool;
 
-    if (ctx->font == NULL)
+    if (pool)
+    {
+        hash = _label_hash(label->text);
+        if ((label->generation == pool->generation) && (label->hash == hash) && (label->rendered_font == label->font))
+        {
+            ++pool->stats.hits;
+            pool->stats.glyphs_saved += label->glyphs;
+            cached = true;
+            width = label->width;
+        }
+    }
+    if (!cached)
+    {
+        font = ctx->font;
+        ctx->font = label->font;
+        width = _layout_string(ctx, 0, 0, label->text, SSD1306_COLOR_TRANSPARENT, SSD1306_COLOR_TRANSPARENT, false);
+        ctx->font = font;
+    }
+    if (width == 0)
         return 0;
 
-    while (*str)
+    start = esp_timer_get_time();
+    if (!cached && pool)
     {
-        c = *str;
-        // we always have space in the font set
-        if ((c < ctx->font->char_start) || (c > ctx->font->char_end))
-            c = ' ';
-        c = c - ctx->font->char_start;   // c now become index to tables
-        w += ctx->font->char_descriptors[c].width;
-        ++str;
-       if (*str)
-           w += ctx->font->c;
+        cached = _label_render(pool, label, width, hash);
+        if (cached)
+        {
+            ++pool->stats.renders;
+            pool->stats.glyphs_rendered += label->glyphs;
+            pool->stats.render_us += esp_timer_get_time() - start;
+            start = esp_timer_get_time();
+        }
     }
-    return w;
+
+    if ((background != SSD1306_COLOR_TRANSPARENT)
+        && !(cached && (foreground == SSD1306_COLOR_WHITE) && (background == SSD1306_COLOR_BLACK)))
+        _fill_solid(ctx, label->x, label->y, label->x + width, label->y + label->font->height, background);
+    if (!cached)
+    {
+        // too wide or too large for the pool
+        glyphs = _label_text(ctx, label, label->x, label->y, foreground);
+        if (pool)
+        {
+            ++pool->stats.uncached;
+            pool->stats.glyphs_rendered += glyphs;
+            pool->stats.render_us += esp_timer_get_time() - start;
+        }
+        return width;
+    }
+
+    // white on black replaces everything, other colors go over the filled background
+    if ((foreground == SSD1306_COLOR_WHITE) && (background == SSD1306_COLOR_BLACK))
+        ssd1306_draw_bitmap(id, label->x, label->y, width, label->font->height, pool->data + label->offset,
+                            SSD1306_ROP_COPY);
+    else if (foreground != SSD1306_COLOR_TRANSPARENT)
+        ssd1306_draw_bitmap(id, label->x, label->y, width, label->font->height, pool->data + label->offset,
+                            (foreground == SSD1306_COLOR_WHITE) ? SSD1306_ROP_OR :
+                            (foreground == SSD1306_COLOR_BLACK) ? SSD1306_ROP_ANDNOT : SSD1306_ROP_XOR);
+    pool->stats.blit_us += esp_timer_get_time() - start;
+    return width;
 }
 
 
@@ -934,6 +3622,9 @@ void ssd1306_invert_display(uint8_t id, bool invert)
     if (ctx == NULL)
         return;
 
+    if (ctx->type == SSD1306_SURFACE)
+        return;
+
     if (invert)
         _command(ctx->address, 0xa7); // SSD1306_INVERTDISPLAY
     else
@@ -942,25 +3633,393 @@ void ssd1306_invert_display(uint8_t id, bool invert)
 }
 
 
-void ssd1306_update_buffer(uint8_t id, uint8_t* data, uint16_t length)
+void ssd1306_set_start_line(uint8_t id, uint8_t line)
 {
     oled_i2c_ctx *ctx = _ctxs[id];
 
     if (ctx == NULL)
         return;
 
-    if (ctx->type == SSD1306_128x64)
+    if (ctx->type == SSD1306_SURFACE)
+        return;
+
+    _command(ctx->address, 0x40 | (line & 0x3f)); // SSD1306_SETSTARTLINE
+}
+
+
+bool ssd1306_set_rotation(uint8_t id, ssd1306_rotation_t rotation, bool mirror)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    uint8_t w;
+
+    if (ctx == NULL)
+        return false;
+
+    if ((ctx->type == SSD1306_SURFACE) || (rotation > SSD1306_ROTATE_270))
+        return false;
+    if (ctx->band && (rotation & 1))
     {
-        memcpy(ctx->buffer, data, (length < 1024) ? length : 1024);
+        ESP_LOGE(__func__,"Page-band mode only turns by 0 or 180 degrees.");
+        return false;
+    }
 
+    if ((rotation & 1) != (ctx->rotation & 1))
+    {
+        // width and height swap, the picture has to be drawn again
+        w = ctx->width;
+        ctx->width = ctx->height;
+        ctx->height = w;
+        ctx->clip_left = 0;
+        ctx->clip_top = 0;
+        ctx->clip_right = ctx->width;
+        ctx->clip_bottom = ctx->height;
+        memset(ctx->buffer, 0, ctx->width * ((ctx->height + 7) / 8));
     }
-    else if (ctx->type == SSD1306_128x32)
+    ctx->rotation = rotation;
+    ctx->mirror = mirror;
+    _remap(ctx);
+    // the segment remap only applies to data written from now on, the next refresh sends the whole panel
+    ctx->refresh_top = 0;
+    ctx->refresh_left = 0;
+    ctx->refresh_right = ctx->width - 1;
+    ctx->refresh_bottom = ctx->height - 1;
+    return true;
+}
+
+
+void ssd1306_update_buffer(uint8_t id, uint8_t* data, uint16_t length)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    uint16_t size;
+
+    if (ctx == NULL)
+        return;
+
+    if (ctx->band)
     {
-        memcpy(ctx->buffer, data, (length < 512) ? length : 512);
+        ESP_LOGE(__func__,"No frame buffer in page-band mode.");
+        return;
     }
+    size = ctx->width * ((ctx->height + 7) / 8);
+    memcpy(ctx->buffer, data, (length < size) ? length : size);
     ctx->refresh_right = ctx->width - 1;
     ctx->refresh_bottom = ctx->height - 1;
     ctx->refresh_top = 0;
     ctx->refresh_left = 0;
 }
 
+
+void ssd1306_draw_bitmap(uint8_t id, int8_t x, int8_t y, uint8_t w, uint8_t h, const uint8_t *bitmap,
+                         ssd1306_rop_t rop)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    int16_t x0, x1, top, y0, y1;
+    int8_t page;
+    uint8_t src_page, src_pages, shift, col, half;
+    uint16_t v, m;
+    uint8_t *d;
+    const uint8_t *s;
+    uint8_t dv, dm;
+
+    if (ctx == NULL)
+        return;
+    if ((bitmap == NULL) || (w == 0) || (h == 0))
+        return;
+    if (_band_record(ctx, BAND_BITMAP, x, y, w, h, bitmap, rop))
+        return;
+
+    // clip columns and rows to destination (the page of a band being replayed)
+    x0 = (x < 0) ? 0 : x;
+    x1 = (x + w > ctx->width) ? ctx->width : x + w;
+    y0 = (y < ctx->clip_top) ? ctx->clip_top : y;
+    y1 = (y + h > ctx->clip_bottom) ? ctx->clip_bottom : y + h;
+    if ((x0 >= x1) || (y0 >= y1))
+        return;
+
+    src_pages = (h + 7) / 8;
+    for (src_page = 0; src_page < src_pages; ++src_page)
+    {
+        top = y + src_page * 8;
+        if ((top + 8 <= y0) || (top >= y1))
+            continue;
+        // source byte lands in destination pages "page" and "page + 1", shifted down by "shift"
+        page = (top >= 0) ? top / 8 : -((7 - top) / 8);
+        shift = top - page * 8;
+        // rows of this source byte that are part of the bitmap and inside the destination
+        m = 0xff;
+        if (h - src_page * 8 < 8)
+            m = 0xff >> (8 - (h - src_page * 8));
+        m <<= shift;
+        for (half = 0; half < 2; ++half, ++page)
+        {
+            if ((page < 0) || (page * 8 >= y1))
+                continue;
+            dm = (m >> (half * 8)) & 0xff;
+            if (page * 8 < y0)
+                dm &= 0xff << (y0 - page * 8);
+            if (page * 8 + 8 > y1)
+                dm &= 0xff >> (page * 8 + 8 - y1);
+            if (dm == 0)
+                continue;
+            s = bitmap + src_page * w + (x0 - x);
+            d = _buffer_at(ctx, page, x0);
+            for (col = x0; col < x1; ++col, ++s, ++d)
+            {
+                v = (uint16_t)*s << shift;
+                dv = (v >> (half * 8)) & 0xff;
+                switch (rop)
+                {
+                case SSD1306_ROP_COPY:
+                    *d = (*d & ~dm) | (dv & dm);
+                    break;
+                case SSD1306_ROP_OR:
+                    *d |= dv & dm;
+                    break;
+                case SSD1306_ROP_AND:
+                    *d &= dv | ~dm;
+                    break;
+                case SSD1306_ROP_XOR:
+                    *d ^= dv & dm;
+                    break;
+                case SSD1306_ROP_ANDNOT:
+                    *d &= ~(dv & dm);
+                    break;
+                }
+            }
+        }
+    }
+    if (ctx->refresh_left > x0) ctx->refresh_left = x0;
+    if (ctx->refresh_right < x1 - 1) ctx->refresh_right = x1 - 1;
+    if (ctx->refresh_top > y0) ctx->refresh_top = y0;
+    if (ctx->refresh_bottom < y1 - 1) ctx->refresh_bottom = y1 - 1;
+}
+
+
+void ssd1306_composite(uint8_t dst_id, int8_t x, int8_t y, uint8_t src_id, ssd1306_rop_t rop)
+{
+    oled_i2c_ctx *src = _ctxs[src_id];
+
+    if (src == NULL)
+        return;
+
+    ssd1306_draw_bitmap(dst_id, x, y, src->width, src->height, src->buffer, rop);
+}
+
+
+bool ssd1306_band_init(uint8_t id, uint16_t size)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    band_list *list;
+    uint8_t *buffer;
+
+    if ((ctx == NULL) || (ctx->type == SSD1306_SURFACE) || (size == 0))
+        return false;
+    if (ctx->rotation & 1)
+    {
+        ESP_LOGE(__func__,"Page-band mode only turns by 0 or 180 degrees.");
+        return false;
+    }
+
+    list = malloc(sizeof(band_list) + size);
+    if (list == NULL)
+    {
+        ESP_LOGE(__func__,"Alloc display list failed.");
+        return false;
+    }
+    memset(list, 0, sizeof(band_list));
+    list->data = (uint8_t *)(list + 1);
+    list->size = size;
+    // the frame buffer shrinks to one page, a failed shrink leaves it as it is
+    buffer = realloc(ctx->buffer, ctx->width);
+    if (buffer)
+        ctx->buffer = buffer;
+    free(ctx->band);
+    ctx->band = list;
+    ssd1306_clear(id);
+    return true;
+}
+
+
+bool ssd1306_band_term(uint8_t id)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+    uint8_t *buffer;
+
+    if ((ctx == NULL) || (ctx->band == NULL))
+        return false;
+
+    buffer = realloc(ctx->buffer, ctx->width * ((ctx->height + 7) / 8));
+    if (buffer == NULL)
+    {
+        ESP_LOGE(__func__,"Alloc OLED buffer failed.");
+        return false;
+    }
+    ctx->buffer = buffer;
+    free(ctx->band);
+    ctx->band = NULL;
+    ssd1306_clear(id);
+    return true;
+}
+
+
+bool ssd1306_band_stats(uint8_t id, uint16_t *used, uint16_t *dropped)
+{
+    oled_i2c_ctx *ctx = _ctxs[id];
+
+    if (used)
+        *used = 0;
+    if (dropped)
+        *dropped = 0;
+    if ((ctx == NULL) || (ctx->band == NULL))
+        return false;
+    if (used)
+        *used = ctx->band->used;
+    if (dropped)
+        *dropped = ctx->band->dropped;
+    return true;
+}
+
+
+// Decode the arguments of a record, return the next record
+static const uint8_t *_band_args(const uint8_t *p, const char *format, band_arg *args)
+{
+    int16_t h;
+
+    for (; *format; ++format, ++args)
+    {
+        switch (*format)
+        {
+        case 'b':
+            args->i = (int8_t)*p++;
+            break;
+        case 'B':
+            args->i = *p++;
+            break;
+        case 'h':
+            memcpy(&h, p, 2);
+            args->i = h;
+            p += 2;
+            break;
+        case 'w':
+            memcpy(&args->u, p, 4);
+            p += 4;
+            break;
+        case 'p':
+            memcpy(&args->p, p, sizeof(args->p));
+            p += sizeof(args->p);
+            break;
+        case 's':
+            args->p = p;
+            p += strlen((const char *)p) + 1;
+            break;
+        case 't':
+            args->p = p;
+            p += sizeof(ssd1306_text_box_t);
+            break;
+        case 'v':
+            args->p = p;
+            p += args[-1].i * sizeof(ssd1306_point_t);
+            break;
+        }
+    }
+    return p;
+}
+
+
+static void _band_replay(oled_i2c_ctx *ctx, uint8_t page)
+{
+    band_list *list = ctx->band;
+    const font_info_t *font = ctx->font;
+    const uint8_t *pattern = ctx->pattern;
+    uint8_t style = ctx->style, id = ctx->id;
+    const uint8_t *p, *end;
+    band_arg a[6];
+    ssd1306_text_box_t box;
+    band_op op;
+
+    memset(ctx->buffer, 0, ctx->width);
+    // the draw functions address the whole panel, the rows of this page land in the band
+    ctx->band_offset = page * ctx->width;
+    ctx->clip_top = page * 8;
+    ctx->clip_bottom = page * 8 + 8;
+    ctx->font = list->font;
+    ctx->pattern = list->pattern;
+    ctx->style = list->style;
+    list->replaying = true;
+
+    for (p = list->data, end = list->data + list->used; p < end; )
+    {
+        op = *p++;
+        p = _band_args(p, _band_formats[op], a);
+        switch (op)
+        {
+        case BAND_FONT:
+            ctx->font = a[0].p;
+            break;
+        case BAND_PATTERN:
+            ctx->pattern = a[0].p;
+            break;
+        case BAND_STYLE:
+            ctx->style = a[0].i;
+            break;
+        case BAND_PIXEL:
+            ssd1306_draw_pixel(id, a[0].i, a[1].i, a[2].i);
+            break;
+        case BAND_HLINE:
+            ssd1306_draw_hline(id, a[0].i, a[1].i, a[2].i, a[3].i);
+            break;
+        case BAND_VLINE:
+            ssd1306_draw_vline(id, a[0].i, a[1].i, a[2].i, a[3].i);
+            break;
+        case BAND_FILL_RECTANGLE:
+            ssd1306_fill_rectangle(id, a[0].i, a[1].i, a[2].i, a[3].i, a[4].i);
+            break;
+        case BAND_CIRCLE:
+            ssd1306_draw_circle(id, a[0].i, a[1].i, a[2].i, a[3].i);
+            break;
+        case BAND_FILL_CIRCLE:
+            ssd1306_fill_circle(id, a[0].i, a[1].i, a[2].i, a[3].i);
+            break;
+        case BAND_POLYGON:
+            ssd1306_fill_polygon(id, a[1].p, a[0].i, a[2].i, a[3].i);
+            break;
+        case BAND_BITMAP:
+            ssd1306_draw_bitmap(id, a[0].i, a[1].i, a[2].i, a[3].i, a[4].p, a[5].i);
+            break;
+        case BAND_CODEPOINT:
+            ssd1306_draw_codepoint(id, a[0].i, a[1].i, a[2].u, a[3].i, a[4].i);
+            break;
+        case BAND_CHAR_SCALED:
+            ssd1306_draw_char_scaled(id, a[0].i, a[1].i, a[2].u, a[3].i, a[4].i, a[5].i);
+            break;
+        case BAND_STRING:
+            ssd1306_draw_string(id, a[0].i, a[1].i, a[2].p, a[3].i, a[4].i);
+            break;
+        case BAND_STRING_SCALED:
+            ssd1306_draw_string_scaled(id, a[0].i, a[1].i, a[2].p, a[3].i, a[4].i, a[5].i);
+            break;
+        case BAND_STRING_DIR:
+            ssd1306_draw_string_dir(id, a[0].i, a[1].i, a[2].p, a[3].i, a[4].i, a[5].i);
+            break;
+        case BAND_TEXT_BOX:
+            // the copy in the list may not be aligned
+            memcpy(&box, a[0].p, sizeof(box));
+            ssd1306_draw_text_box(id, &box, a[1].p, a[2].i, a[3].i);
+            break;
+        case BAND_FILL:
+            _fill_solid(ctx, a[0].i, a[1].i, a[2].i, a[3].i, a[4].i);
+            break;
+        case BAND_TEXT:
+            _draw_text(ctx, a[0].p, a[1].i, a[2].i, a[3].i, a[4].p, a[5].i);
+            break;
+        }
+    }
+
+    list->replaying = false;
+    ctx->band_offset = 0;
+    ctx->clip_top = 0;
+    ctx->clip_bottom = ctx->height;
+    ctx->font = font;
+    ctx->pattern = pattern;
+    ctx->style = style;
+}
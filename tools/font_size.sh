@@ -0,0 +1,39 @@
+#!/bin/sh
+#
+# Flash used by each font linked into an application
+#
+#   tools/font_size.sh build/<project>.elf
+#
+# Sums the sizes of the _fonts_<name>_bitmaps/_descriptors/_boxes/_ranges/_kern_*/_kerning/_info symbols per font.
+# Set NM to use another nm (default: xtensa-esp32-elf-nm, or nm if that is not installed).
+#
+
+if [ $# -ne 1 ] || [ ! -f "$1" ]; then
+    echo "usage: $0 <elf>" >&2
+    exit 2
+fi
+
+if [ -z "$NM" ]; then
+    if command -v xtensa-esp32-elf-nm >/dev/null 2>&1; then
+        NM=xtensa-esp32-elf-nm
+    else
+        NM=nm
+    fi
+fi
+
+"$NM" -S --radix=d "$1" | awk '
+    $4 ~ /^_fonts_.*_(bitmaps|descriptors|boxes|ranges|kern_lefts|kern_rights|kern_adjust|kerning|info)$/ {
+        name = $4
+        sub(/^_fonts_/, "", name)
+        sub(/_(bitmaps|descriptors|boxes|ranges|kern_lefts|kern_rights|kern_adjust|kerning|info)$/, "", name)
+        size[name] += $2
+        total += $2
+    }
+    END {
+        n = 0
+        for (name in size) {
+            printf "%-32s %8d bytes\n", name, size[name]
+            ++n
+        }
+        printf "%-32s %8d bytes (%d fonts)\n", "total", total, n
+    }' | sort -k2 -n
@@ -0,0 +1,235 @@
+/**
+  ******************************************************************************
+  * @file    bdf.c
+  * @brief   Host-side font compiler, Glyph Bitmap Distribution Format (BDF 2.1) reader and writer
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE file.
+  *
+  */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fontc.h"
+
+
+static int _hex(int c)
+{
+    if ((c >= '0') && (c <= '9')) return c - '0';
+    if ((c >= 'a') && (c <= 'f')) return c - 'a' + 10;
+    if ((c >= 'A') && (c <= 'F')) return c - 'A' + 10;
+    return -1;
+}
+
+
+/*
+ * Glyphs are placed into fixed height cells: the cell spans FONT_ASCENT rows above and FONT_DESCENT rows below
+ * the baseline (or the font bounding box if the properties are missing), glyph width is DWIDTH. Ink outside
+ * of the cell is clipped.
+ */
+int bdf_read(const char *path, font_t *font)
+{
+    FILE *f;
+    char line[1024], name[64], *base, *dot;
+    int fbb_w = 0, fbb_h = 0, fbb_x = 0, fbb_y = 0, ascent = -1, descent = -1;
+    int encoding = -1, dwidth = -1, bbx_w = 0, bbx_h = 0, bbx_x = 0, bbx_y = 0;
+    int row = -1, x, y, i, v, lineno = 0, clipped = 0;
+    bool in_font = false;
+    glyph_t *g = NULL;
+
+    f = fopen(path, "r");
+    if (f == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+
+    // default name from file name
+    base = strrchr(path, '/');
+    snprintf(name, sizeof(name), "%s", base ? base + 1 : path);
+    dot = strrchr(name, '.');
+    if (dot)
+        *dot = 0;
+    font_init(font, name, 0);
+
+    while (fgets(line, sizeof(line), f))
+    {
+        ++lineno;
+        line[strcspn(line, "\r\n")] = 0;
+        if (row >= 0)
+        {
+            // bitmap row of current glyph
+            if (strcmp(line, "ENDCHAR") == 0)
+            {
+                row = -1;
+                g = NULL;
+                continue;
+            }
+            if ((g != NULL) && (row < bbx_h))
+            {
+                y = font->ascent - (bbx_y + bbx_h) + row;
+                for (i = 0; i < bbx_w; ++i)
+                {
+                    v = _hex(line[i / 4]);
+                    if (v < 0)
+                        break;
+                    if (!((v >> (3 - (i & 3))) & 1))
+                        continue;
+                    x = bbx_x + i;
+                    if ((x < 0) || (x >= g->width) || (y < 0) || (y >= font->height))
+                    {
+                        ++clipped;
+                        continue;
+                    }
+                    g->pix[y * g->width + x] = 1;
+                }
+            }
+            ++row;
+            continue;
+        }
+
+        if (strncmp(line, "STARTFONT", 9) == 0)
+            in_font = true;
+        else if (strncmp(line, "COMMENT", 7) == 0)
+        {
+            strncat(font->comment, line[7] ? line + 8 : "", sizeof(font->comment) - strlen(font->comment) - 2);
+            strcat(font->comment, "\n");
+        }
+        else if (sscanf(line, "FONTBOUNDINGBOX %d %d %d %d", &fbb_w, &fbb_h, &fbb_x, &fbb_y) == 4)
+            ;
+        else if (sscanf(line, "FONT_ASCENT %d", &ascent) == 1)
+            ;
+        else if (sscanf(line, "FONT_DESCENT %d", &descent) == 1)
+            ;
+        else if (strncmp(line, "CHARS ", 6) == 0)
+        {
+            if (ascent < 0)
+                ascent = fbb_h + fbb_y;
+            if (descent < 0)
+                descent = -fbb_y;
+            if ((ascent < 0) || (descent < 0) || (ascent + descent == 0) || (ascent + descent > 255))
+            {
+                fprintf(stderr, "%s:%d: unsupported cell height %d\n", path, lineno, ascent + descent);
+                goto bdf_read_fail;
+            }
+            font->height = ascent + descent;
+            font->ascent = ascent;
+        }
+        else if (strncmp(line, "STARTCHAR", 9) == 0)
+        {
+            encoding = -1;
+            dwidth = -1;
+            bbx_w = bbx_h = bbx_x = bbx_y = 0;
+        }
+        else if (sscanf(line, "ENCODING %d", &encoding) == 1)
+            ;
+        else if (sscanf(line, "DWIDTH %d", &dwidth) == 1)
+            ;
+        else if (sscanf(line, "BBX %d %d %d %d", &bbx_w, &bbx_h, &bbx_x, &bbx_y) == 4)
+            ;
+        else if (strcmp(line, "BITMAP") == 0)
+        {
+            if (font->height == 0)
+            {
+                fprintf(stderr, "%s:%d: BITMAP before CHARS\n", path, lineno);
+                goto bdf_read_fail;
+            }
+            if (dwidth < 0)
+                dwidth = bbx_w;
+            if (dwidth > 255)
+            {
+                fprintf(stderr, "%s:%d: glyph too wide (%d)\n", path, lineno, dwidth);
+                goto bdf_read_fail;
+            }
+            g = NULL;
+            if (encoding >= 0)  // unencoded glyphs are skipped
+            {
+                g = font_add_glyph(font, encoding, dwidth);
+                if (g == NULL)
+                    goto bdf_read_fail;
+            }
+            row = 0;
+        }
+    }
+    fclose(f);
+    if (!in_font || (font->num_glyphs == 0))
+    {
+        fprintf(stderr, "%s: no glyphs found\n", path);
+        font_free(font);
+        return -1;
+    }
+    if (clipped)
+        fprintf(stderr, "%s: %d pixels outside of glyph cells clipped\n", path, clipped);
+    font_sort(font);
+    return 0;
+
+bdf_read_fail:
+    fclose(f);
+    font_free(font);
+    return -1;
+}
+
+
+int bdf_write(FILE *out, const font_t *font)
+{
+    uint32_t i;
+    const glyph_t *g;
+    uint8_t max_w = 0, x, y, v;
+    int descent = font->height - font->ascent;
+    const char *p, *nl;
+
+    for (i = 0; i < font->num_glyphs; ++i)
+        if (font->glyphs[i].width > max_w)
+            max_w = font->glyphs[i].width;
+
+    fprintf(out, "STARTFONT 2.1\n");
+    for (p = font->comment; *p; p = nl + 1)
+    {
+        nl = strchr(p, '\n');
+        if (nl == NULL)
+            break;
+        fprintf(out, "COMMENT %.*s\n", (int)(nl - p), p);
+    }
+    fprintf(out, "FONT %s\n", font->name);
+    fprintf(out, "SIZE %d 75 75\n", font->height);
+    fprintf(out, "FONTBOUNDINGBOX %d %d 0 %d\n", max_w, font->height, -descent);
+    fprintf(out, "STARTPROPERTIES 2\n");
+    fprintf(out, "FONT_ASCENT %d\n", font->ascent);
+    fprintf(out, "FONT_DESCENT %d\n", descent);
+    fprintf(out, "ENDPROPERTIES\n");
+    fprintf(out, "CHARS %u\n", font->num_glyphs);
+    for (i = 0; i < font->num_glyphs; ++i)
+    {
+        g = &font->glyphs[i];
+        fprintf(out, "STARTCHAR U+%04X\n", g->code);
+        fprintf(out, "ENCODING %u\n", g->code);
+        fprintf(out, "SWIDTH %d 0\n", g->width * 1000 / font->height);
+        fprintf(out, "DWIDTH %d 0\n", g->width);
+        if (g->width == 0)
+        {
+            fprintf(out, "BBX 0 0 0 0\nBITMAP\nENDCHAR\n");
+            continue;
+        }
+        fprintf(out, "BBX %d %d 0 %d\n", g->width, font->height, -descent);
+        fprintf(out, "BITMAP\n");
+        for (y = 0; y < font->height; ++y)
+        {
+            v = 0;
+            for (x = 0; x < g->width; ++x)
+            {
+                v |= g->pix[y * g->width + x] << (7 - (x & 7));
+                if (((x & 7) == 7) || (x + 1 == g->width))
+                {
+                    fprintf(out, "%02X", v);
+                    v = 0;
+                }
+            }
+            fprintf(out, "\n");
+        }
+        fprintf(out, "ENDCHAR\n");
+    }
+    fprintf(out, "ENDFONT\n");
+    return 0;
+}
@@ -0,0 +1,110 @@
+/**
+  ******************************************************************************
+  * @file    bench.c
+  * @brief   Host-side font compiler, flash size and decode time of the font layouts
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE file.
+  *
+  */
+
+#define _POSIX_C_SOURCE 199309L
+#include <string.h>
+#include <time.h>
+#include "fontc.h"
+
+
+static double _now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+/*
+ * Time decoding every glyph of the tables into column bytes, in ns per glyph. The sink keeps the
+ * compiler from dropping the work.
+ */
+static double _decode_time(const font_t *font, const tables_t *t, bool rle, uint32_t *sink)
+{
+    uint8_t glyph[255 * 32];
+    uint16_t i;
+    uint64_t glyphs = 0;
+    size_t size;
+    double start, elapsed;
+    uint32_t rounds = 0;
+
+    start = _now();
+    do
+    {
+        for (i = 0; i < t->num_chars; ++i)
+        {
+            if (t->desc[i].width == 0)
+                continue;
+            size = (size_t)t->desc[i].width * ((font->height + 7) / 8);
+            if (rle)
+                rle_decode(t->bitmap + t->desc[i].offset, glyph, size);
+            else
+                memcpy(glyph, t->bitmap + t->desc[i].offset, size);
+            *sink += glyph[size / 2];
+            ++glyphs;
+        }
+        ++rounds;
+        elapsed = _now() - start;
+    } while ((elapsed < 0.05) || (rounds < 10));
+    return glyphs ? elapsed * 1e9 / glyphs : 0;
+}
+
+
+// Compare plain page-native and run-length coded tables of the builtin fonts (all of them if name is NULL)
+int bench_fonts(const char *name)
+{
+    const builtin_font_t *b;
+    emit_opts_t pages = { .pages = true }, rle = { .pages = true, .rle = true };
+    tables_t tp, tr;
+    font_t font;
+    size_t i, src_total = 0, raw_total = 0, rle_total = 0, src, desc;
+    uint32_t sink = 0;
+    double tp_ns, tr_ns;
+
+    printf("%-32s %8s %8s %8s %7s %9s %9s\n", "font", "source", "pages", "rle", "saved", "copy ns", "rle ns");
+    for (i = 0; i < num_builtin_fonts; ++i)
+    {
+        b = &builtin_fonts[i];
+        if (name && strcmp(name, b->name))
+            continue;
+        if (builtin_load(b, &font, -1))
+        {
+            fprintf(stderr, "%s: cannot decode font\n", b->name);
+            return 1;
+        }
+        memset(&tr, 0, sizeof(tr));
+        if (tables_build(&font, &pages, NULL, &tp) || tables_build(&font, &rle, NULL, &tr))
+        {
+            tables_free(&tp);
+            tables_free(&tr);
+            font_free(&font);
+            return 1;
+        }
+        desc = (size_t)tp.num_chars * TARGET_DESC_SIZE + TARGET_INFO_SIZE;
+        tp_ns = _decode_time(&font, &tp, false, &sink);
+        tr_ns = _decode_time(&font, &tr, true, &sink);
+        src = b->bitmap_size + b->num_descriptors * TARGET_DESC_SIZE + TARGET_INFO_SIZE;
+        printf("%-32s %8zu %8zu %8zu %6.1f%% %9.1f %9.1f\n", b->name, src, tp.bitmap_size + desc,
+               tr.bitmap_size + desc, 100.0 - 100.0 * (tr.bitmap_size + desc) / (tp.bitmap_size + desc), tp_ns, tr_ns);
+        src_total += src;
+        raw_total += tp.bitmap_size + desc;
+        rle_total += tr.bitmap_size + desc;
+        tables_free(&tp);
+        tables_free(&tr);
+        font_free(&font);
+    }
+    if (raw_total)
+        printf("%-32s %8zu %8zu %8zu %6.1f%%\n", "total", src_total, raw_total, rle_total,
+               100.0 - 100.0 * rle_total / raw_total);
+    return (sink == 0xffffffff) ? 1 : 0;
+}
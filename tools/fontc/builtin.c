@@ -0,0 +1,332 @@
+/**
+  ******************************************************************************
+  * @file    builtin.c
+  * @brief   Host-side font compiler, font tables shipped in main/fonts
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE file.
+  *
+  */
+
+#include <string.h>
+#include "fontc.h"
+#include "font_bitocra_4x7_ascii.h"
+#include "font_bitocra_6x11_iso8859_1.h"
+#include "font_bitocra_7x13_iso8859_1.h"
+#include "font_glcd_5x7.h"
+#include "font_roboto_8pt.h"
+#include "font_roboto_10pt.h"
+#include "font_terminus_6x12_iso8859_1.h"
+#include "font_terminus_8x14_iso8859_1.h"
+#include "font_terminus_10x18_iso8859_1.h"
+#include "font_terminus_11x22_iso8859_1.h"
+#include "font_terminus_12x24_iso8859_1.h"
+#include "font_terminus_14x28_iso8859_1.h"
+#include "font_terminus_16x32_iso8859_1.h"
+#include "font_terminus_bold_8x14_iso8859_1.h"
+#include "font_terminus_bold_10x18_iso8859_1.h"
+#include "font_terminus_bold_11x22_iso8859_1.h"
+#include "font_terminus_bold_12x24_iso8859_1.h"
+#include "font_terminus_bold_14x28_iso8859_1.h"
+#include "font_terminus_bold_16x32_iso8859_1.h"
+#include "font_terminus_6x12_koi8_r.h"
+#include "font_terminus_8x14_koi8_r.h"
+#include "font_terminus_14x28_koi8_r.h"
+#include "font_terminus_16x32_koi8_r.h"
+#include "font_terminus_bold_8x14_koi8_r.h"
+#include "font_terminus_bold_14x28_koi8_r.h"
+#include "font_terminus_bold_16x32_koi8_r.h"
+#include "font_terminus_8x14_unicode.h"
+
+
+#define BUILTIN(n) { #n, &_fonts_##n##_info, sizeof(_fonts_##n##_bitmaps), \
+                     sizeof(_fonts_##n##_descriptors) / sizeof(font_char_desc_t) }
+#define BUILTIN_MONO(n) { #n, &_fonts_##n##_info, sizeof(_fonts_##n##_bitmaps), 0 }
+
+const builtin_font_t builtin_fonts[] =
+{
+    BUILTIN_MONO(bitocra_4x7_ascii),
+    BUILTIN_MONO(bitocra_6x11_iso8859_1),
+    BUILTIN_MONO(bitocra_7x13_iso8859_1),
+    BUILTIN_MONO(glcd_5x7),
+    BUILTIN(roboto_8pt),
+    BUILTIN(roboto_10pt),
+    BUILTIN_MONO(terminus_6x12_iso8859_1),
+    BUILTIN_MONO(terminus_8x14_iso8859_1),
+    BUILTIN_MONO(terminus_10x18_iso8859_1),
+    BUILTIN_MONO(terminus_11x22_iso8859_1),
+    BUILTIN_MONO(terminus_12x24_iso8859_1),
+    BUILTIN_MONO(terminus_14x28_iso8859_1),
+    BUILTIN_MONO(terminus_16x32_iso8859_1),
+    BUILTIN_MONO(terminus_bold_8x14_iso8859_1),
+    BUILTIN_MONO(terminus_bold_10x18_iso8859_1),
+    BUILTIN_MONO(terminus_bold_11x22_iso8859_1),
+    BUILTIN_MONO(terminus_bold_12x24_iso8859_1),
+    BUILTIN_MONO(terminus_bold_14x28_iso8859_1),
+    BUILTIN_MONO(terminus_bold_16x32_iso8859_1),
+    BUILTIN_MONO(terminus_6x12_koi8_r),
+    BUILTIN_MONO(terminus_8x14_koi8_r),
+    BUILTIN_MONO(terminus_14x28_koi8_r),
+    BUILTIN_MONO(terminus_16x32_koi8_r),
+    BUILTIN_MONO(terminus_bold_8x14_koi8_r),
+    BUILTIN_MONO(terminus_bold_14x28_koi8_r),
+    BUILTIN_MONO(terminus_bold_16x32_koi8_r),
+    BUILTIN_MONO(terminus_8x14_unicode),
+};
+
+const size_t num_builtin_fonts = sizeof(builtin_fonts) / sizeof(builtin_fonts[0]);
+
+
+const builtin_font_t *builtin_find(const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < num_builtin_fonts; ++i)
+        if (strcmp(builtin_fonts[i].name, name) == 0)
+            return &builtin_fonts[i];
+    return NULL;
+}
+
+
+size_t builtin_num_chars(const builtin_font_t *b)
+{
+    if ((b->info->flags & FONT_FLAG_MONO) && b->info->stride)
+        return b->bitmap_size / b->info->stride;
+    return b->num_descriptors;
+}
+
+
+// Descriptor of glyph i, computed for monospace fonts
+static font_char_desc_t _desc(const builtin_font_t *b, size_t i)
+{
+    font_char_desc_t d;
+
+    if (b->info->flags & FONT_FLAG_MONO)
+    {
+        d.width = b->info->width;
+        d.offset = i * b->info->stride;
+        return d;
+    }
+    return b->info->char_descriptors[i];
+}
+
+
+// Character code of glyph i
+static uint32_t _code(const font_info_t *info, size_t i)
+{
+    uint16_t r;
+
+    if (info->ranges == NULL)
+        return (uint8_t)info->char_start + i;
+    for (r = 0; r + 1 < info->num_ranges; ++r)
+        if (i < info->ranges[r + 1].index)
+            break;
+    return info->ranges[r].first + i - info->ranges[r].index;
+}
+
+
+static size_t _raw_size(const font_info_t *info, uint8_t width, uint8_t height)
+{
+    if (info->flags & FONT_FLAG_PAGES)
+        return (size_t)width * ((height + 7) / 8);
+    return (size_t)((width + 7) / 8) * height;
+}
+
+
+// Stored part of the cell of glyph i
+static font_glyph_box_t _box(const builtin_font_t *b, size_t i, const font_char_desc_t *d)
+{
+    font_glyph_box_t cell = { 0, 0, d->width, b->info->height };
+
+    return b->info->boxes ? b->info->boxes[i] : cell;
+}
+
+
+// Bytes used by a glyph, SIZE_MAX if it runs past the end of the bitmap or its cell
+static size_t _glyph_size(const builtin_font_t *b, size_t i, const font_char_desc_t *d)
+{
+    const font_info_t *info = b->info;
+    font_glyph_box_t box = _box(b, i, d);
+    size_t size;
+
+    if ((d->offset > b->bitmap_size) || (box.x + box.w > d->width) || (box.y + box.h > info->height))
+        return SIZE_MAX;
+    size = _raw_size(info, box.w, box.h);
+    if ((info->flags & FONT_FLAG_RLE) && size)
+        return rle_length(info->bitmap + d->offset, b->bitmap_size - d->offset, size);
+    return (d->offset + size > b->bitmap_size) ? SIZE_MAX : size;
+}
+
+
+// Check font information against the tables it points to, return number of errors
+int builtin_verify(const builtin_font_t *b, FILE *log)
+{
+    const font_info_t *info = b->info;
+    uint8_t start = info->char_start, end = info->char_end;
+    size_t i, size, next = 0, num_chars = builtin_num_chars(b);
+    font_char_desc_t d;
+    int errors = 0;
+
+    if (info->height == 0)
+    {
+        fprintf(log, "%s: height is 0\n", b->name);
+        ++errors;
+    }
+    if (info->ranges)
+    {
+        for (i = 0, next = 0; i < info->num_ranges; ++i)
+        {
+            if ((info->ranges[i].first > info->ranges[i].last) || (info->ranges[i].index != next)
+                || (i && (info->ranges[i].first <= info->ranges[i - 1].last)))
+            {
+                fprintf(log, "%s: range %zu (0x%04x..0x%04x at %d) is out of order\n", b->name, i,
+                        info->ranges[i].first, info->ranges[i].last, info->ranges[i].index);
+                ++errors;
+            }
+            next = info->ranges[i].index + info->ranges[i].last - info->ranges[i].first + 1;
+        }
+        if ((info->num_ranges == 0) || (next != num_chars))
+        {
+            fprintf(log, "%s: ranges cover %zu characters, %zu %s\n", b->name, next, num_chars,
+                    (info->flags & FONT_FLAG_MONO) ? "glyphs in bitmap" : "descriptors");
+            ++errors;
+        }
+        next = 0;
+    }
+    else if (start > end)
+    {
+        fprintf(log, "%s: char_start 0x%02x > char_end 0x%02x\n", b->name, start, end);
+        ++errors;
+    }
+    else if ((size_t)(end - start + 1) != num_chars)
+    {
+        fprintf(log, "%s: char_start..char_end covers %d characters, %zu %s\n", b->name, end - start + 1,
+                num_chars, (info->flags & FONT_FLAG_MONO) ? "glyphs in bitmap" : "descriptors");
+        ++errors;
+    }
+    for (i = 0; info->kerning && (i < info->kerning->num_lefts); ++i)
+    {
+        const font_kern_left_t *l = info->kerning->lefts;
+        uint16_t j;
+
+        if (((i == 0) && (l[0].first != 0)) || (l[i + 1].first <= l[i].first)
+            || ((i + 1 < info->kerning->num_lefts) && (l[i + 1].left <= l[i].left)))
+        {
+            fprintf(log, "%s: kerning of left character %zu is out of order\n", b->name, i);
+            ++errors;
+            break;
+        }
+        for (j = l[i].first + 1; (j < l[i + 1].first) && (info->kerning->rights[j] > info->kerning->rights[j - 1]); ++j)
+            ;
+        if (j < l[i + 1].first)
+        {
+            fprintf(log, "%s: kerning pair %u is out of order\n", b->name, j);
+            ++errors;
+            break;
+        }
+    }
+    if (info->fallback)
+    {
+        for (i = 0; (i < num_chars) && (_code(info, i) != info->fallback); ++i)
+            ;
+        if (i == num_chars)
+        {
+            fprintf(log, "%s: fallback character 0x%04x is missing\n", b->name, info->fallback);
+            ++errors;
+        }
+    }
+    if (info->c > 8)
+    {
+        fprintf(log, "%s: suspicious character spacing c = %d\n", b->name, info->c);
+        ++errors;
+    }
+    if ((info->flags & FONT_FLAG_RLE) && !(info->flags & FONT_FLAG_PAGES))
+    {
+        fprintf(log, "%s: FONT_FLAG_RLE without FONT_FLAG_PAGES\n", b->name);
+        ++errors;
+    }
+    if ((info->flags & FONT_FLAG_MONO) && ((info->flags & FONT_FLAG_RLE) || (info->char_descriptors != NULL)
+                                           || (info->boxes != NULL)
+                                           || (info->stride != _raw_size(info, info->width, info->height))
+                                           || (b->bitmap_size != num_chars * info->stride)))
+    {
+        fprintf(log, "%s: inconsistent monospace font (width %d, stride %d, bitmap %zu)\n", b->name,
+                info->width, info->stride, b->bitmap_size);
+        ++errors;
+    }
+    for (i = 0; i < num_chars; ++i)
+    {
+        d = _desc(b, i);
+        size = _glyph_size(b, i, &d);
+        if (size == SIZE_MAX)
+        {
+            fprintf(log, "%s: glyph %zu exceeds bitmap (offset %u, bitmap %zu)\n", b->name, i,
+                    d.offset, b->bitmap_size);
+            ++errors;
+        }
+        else if (d.offset > next)
+        {
+            // Earlier offsets are glyphs shared with an identical one, only gaps are suspicious
+            fprintf(log, "%s: glyph %zu at offset %u, expected %zu\n", b->name, i, d.offset, next);
+        }
+        if (d.offset + size > next)
+            next = d.offset + size;
+    }
+    return errors;
+}
+
+
+// Decode a built-in font into the model. char_start < 0 takes the characters from the font information.
+int builtin_load(const builtin_font_t *b, font_t *font, int char_start)
+{
+    const font_info_t *info = b->info;
+    font_char_desc_t desc, *d = &desc;
+    const uint8_t *bitmap;
+    glyph_t *g;
+    size_t i, j;
+    uint8_t x, y, stride, glyph[255 * 32];
+    font_glyph_box_t box;
+
+    font_init(font, b->name, info->height);
+    font->c = info->c;
+
+    for (i = 0; i < builtin_num_chars(b); ++i)
+    {
+        desc = _desc(b, i);
+        if (_glyph_size(b, i, d) == SIZE_MAX)
+            return -1;
+        g = font_add_glyph(font, (char_start < 0) ? _code(info, i) : (uint32_t)char_start + i, d->width);
+        if (g == NULL)
+            return -1;
+        box = _box(b, i, d);
+        bitmap = info->bitmap + d->offset;
+        if ((info->flags & FONT_FLAG_RLE) && box.w && box.h)
+        {
+            rle_decode(bitmap, glyph, _raw_size(info, box.w, box.h));
+            bitmap = glyph;
+        }
+        stride = (box.w + 7) / 8;
+        for (y = 0; y < box.h; ++y)
+        {
+            for (x = 0; x < box.w; ++x)
+            {
+                if (info->flags & FONT_FLAG_PAGES)
+                    g->pix[(box.y + y) * d->width + box.x + x] = (bitmap[(y / 8) * box.w + x] >> (y & 7)) & 1;
+                else
+                    g->pix[(box.y + y) * d->width + box.x + x] = (bitmap[y * stride + x / 8] >> (7 - (x & 7))) & 1;
+            }
+        }
+    }
+    font_sort(font);
+    // pairs and the fallback name characters by code, they only apply where the codes are those of the font
+    for (i = 0; (char_start < 0) && info->kerning && (i < info->kerning->num_lefts); ++i)
+        for (j = info->kerning->lefts[i].first; j < info->kerning->lefts[i + 1].first; ++j)
+            if (font_add_kern_pair(font, info->kerning->lefts[i].left, info->kerning->rights[j],
+                                   info->kerning->adjust[j]))
+                return -1;
+    if (char_start < 0)
+        font->fallback = info->fallback;
+    return 0;
+}
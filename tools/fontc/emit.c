@@ -0,0 +1,876 @@
+/**
+  ******************************************************************************
+  * @file    emit.c
+  * @brief   Host-side font compiler, C header emitter
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE file.
+  *
+  */
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fontc.h"
+
+
+static size_t _glyph_size(uint8_t width, uint8_t height, bool pages)
+{
+    if (pages)
+        return (size_t)width * ((height + 7) / 8);
+    return (size_t)((width + 7) / 8) * height;
+}
+
+
+// Part of the cell of character i that is stored: its ink box, or the whole cell
+static font_glyph_box_t _stored_box(const font_t *font, const tables_t *t, uint16_t i)
+{
+    font_glyph_box_t cell = { 0, 0, t->glyph[i] ? t->glyph[i]->width : t->mono_width, font->height };
+
+    return t->boxes ? t->box[i] : cell;
+}
+
+
+// Smallest box containing all ink of a glyph, all zero for blank glyphs
+static font_glyph_box_t _ink_box(const font_t *font, const glyph_t *g)
+{
+    font_glyph_box_t box = { 0, 0, 0, 0 };
+    int x, y, x0 = g->width, y0 = font->height, x1 = -1, y1 = -1;
+
+    for (y = 0; y < font->height; ++y)
+    {
+        for (x = 0; x < g->width; ++x)
+        {
+            if (!g->pix[y * g->width + x])
+                continue;
+            if (x < x0) x0 = x;
+            if (x > x1) x1 = x;
+            if (y < y0) y0 = y;
+            if (y > y1) y1 = y;
+        }
+    }
+    if (x1 >= 0)
+    {
+        box.x = x0;
+        box.y = y0;
+        box.w = x1 - x0 + 1;
+        box.h = y1 - y0 + 1;
+    }
+    return box;
+}
+
+
+static void _encode_glyph(const glyph_t *g, const font_glyph_box_t *box, bool pages, uint8_t *out)
+{
+    uint8_t x, y, stride = (box->w + 7) / 8;
+
+    for (y = 0; y < box->h; ++y)
+    {
+        for (x = 0; x < box->w; ++x)
+        {
+            if (!g->pix[(box->y + y) * g->width + box->x + x])
+                continue;
+            if (pages)
+                out[(y / 8) * box->w + x] |= 1 << (y & 7);
+            else
+                out[y * stride + x / 8] |= 0x80 >> (x & 7);
+        }
+    }
+}
+
+
+// Table index the driver finds for a character, -1 if the ranges do not cover it
+static int32_t _range_index(const tables_t *t, uint32_t code)
+{
+    uint16_t i;
+
+    for (i = 0; i < t->num_ranges; ++i)
+        if ((code >= t->range[i].first) && (code <= t->range[i].last))
+            return t->range[i].index + code - t->range[i].first;
+    return -1;
+}
+
+
+// Decode tables the way the driver does and compare every pixel with the source glyphs
+static int _verify_tables(const font_t *font, const tables_t *t, const emit_opts_t *opts)
+{
+    uint16_t i;
+    uint8_t x, y, v, stride, glyph[255 * 32];
+    size_t size, cell = opts->mono ? _glyph_size(t->mono_width, font->height, opts->pages) : 0;
+    bool pages = opts->pages || opts->rle, rle = opts->rle;
+    const uint8_t *b;
+    const glyph_t *g;
+    font_glyph_box_t box;
+    int32_t index;
+
+    for (i = 0; i < t->num_chars; ++i)
+    {
+        // the entry the driver finds for the character must be this one
+        index = t->num_ranges ? _range_index(t, t->code[i]) : (int32_t)(t->code[i] - t->char_start);
+        if (cell ? ((size_t)index * cell != t->desc[i].offset) : (index != i))
+        {
+            fprintf(stderr, "%s: character 0x%02x is not found at entry %d\n", font->name, t->code[i], i);
+            return -1;
+        }
+        g = t->glyph[i];
+        if (g == NULL)
+        {
+            if (t->desc[i].width != t->mono_width)
+                return -1;
+            continue;
+        }
+        box = _stored_box(font, t, i);
+        size = _glyph_size(box.w, box.h, pages);
+        if ((t->desc[i].width != g->width) || (box.x + box.w > g->width) || (box.y + box.h > font->height))
+            return -1;
+        if (rle && size)
+        {
+            if ((t->desc[i].offset >= t->bitmap_size)
+                || (t->desc[i].offset + rle_decode(t->bitmap + t->desc[i].offset, glyph, size) > t->bitmap_size))
+                return -1;
+            b = glyph;
+        }
+        else if (!rle && (t->desc[i].offset + size > t->bitmap_size))
+            return -1;
+        else
+            b = t->bitmap + t->desc[i].offset;
+        stride = (box.w + 7) / 8;
+        for (y = 0; y < font->height; ++y)
+        {
+            for (x = 0; x < g->width; ++x)
+            {
+                v = 0;
+                if ((x >= box.x) && (x < box.x + box.w) && (y >= box.y) && (y < box.y + box.h))
+                {
+                    if (pages)
+                        v = (b[((y - box.y) / 8) * box.w + x - box.x] >> ((y - box.y) & 7)) & 1;
+                    else
+                        v = (b[(y - box.y) * stride + (x - box.x) / 8] >> (7 - ((x - box.x) & 7))) & 1;
+                }
+                if (v != g->pix[y * g->width + x])
+                {
+                    fprintf(stderr, "%s: verification failed for character 0x%02x\n", font->name, g->code);
+                    return -1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+
+// Replace page-native glyphs with their run-length code
+static int _compress_tables(const font_t *font, tables_t *t)
+{
+    uint16_t i;
+    size_t size, raw, offset = 0;
+    uint8_t *code;
+    font_glyph_box_t box;
+
+    // worst case is one literal token per glyph and per 128 bytes
+    code = malloc(t->bitmap_size + t->bitmap_size / 128 + t->num_chars + 1);
+    if (code == NULL)
+        return -1;
+    for (i = 0; i < t->num_chars; ++i)
+    {
+        box = _stored_box(font, t, i);
+        size = t->glyph[i] ? _glyph_size(box.w, box.h, true) : 0;
+        raw = t->desc[i].offset;
+        t->desc[i].offset = offset;
+        offset += size ? rle_encode(t->bitmap + raw, size, code + offset) : 0;
+    }
+    free(t->bitmap);
+    t->bitmap = code;
+    t->bitmap_size = offset;
+    return 0;
+}
+
+
+// Offset of the bytes of an earlier identical glyph, SIZE_MAX if there is none
+static size_t _pool_find(const pool_t *pool, const uint8_t *data, size_t size)
+{
+    uint32_t i;
+
+    for (i = 0; i < pool->num_blobs; ++i)
+        if ((pool->blob_size[i] == size) && (memcmp(pool->data + pool->blob_offset[i], data, size) == 0))
+            return pool->blob_offset[i];
+    return SIZE_MAX;
+}
+
+
+// Offset of the glyph bytes in the pool, appended unless share finds identical bytes. SIZE_MAX if out of memory.
+size_t pool_add(pool_t *pool, const uint8_t *data, size_t size, bool share)
+{
+    size_t offset;
+    uint32_t *o, *n;
+    uint8_t *d;
+
+    if (size == 0)
+        return pool->size;
+    offset = share ? _pool_find(pool, data, size) : SIZE_MAX;
+    if (offset != SIZE_MAX)
+        return offset;
+    if (pool->size + size > pool->capacity)
+    {
+        d = realloc(pool->data, 2 * (pool->size + size));
+        if (d == NULL)
+            return SIZE_MAX;
+        pool->data = d;
+        pool->capacity = 2 * (pool->size + size);
+    }
+    o = realloc(pool->blob_offset, (pool->num_blobs + 1) * sizeof(uint32_t));
+    if (o != NULL)
+        pool->blob_offset = o;
+    n = realloc(pool->blob_size, (pool->num_blobs + 1) * sizeof(uint32_t));
+    if (n != NULL)
+        pool->blob_size = n;
+    if ((o == NULL) || (n == NULL))
+        return SIZE_MAX;
+    memcpy(pool->data + pool->size, data, size);
+    pool->blob_offset[pool->num_blobs] = pool->size;
+    pool->blob_size[pool->num_blobs++] = size;
+    pool->size += size;
+    return pool->size - size;
+}
+
+
+void pool_free(pool_t *pool)
+{
+    free(pool->data);
+    free(pool->blob_offset);
+    free(pool->blob_size);
+    memset(pool, 0, sizeof(*pool));
+}
+
+
+/*
+ * Monospace glyphs are found by their index, they can only share the cells of other fonts in the pool through
+ * ranges that point to those cells. Every new range costs TARGET_RANGE_SIZE, a cell is only shared if that
+ * is cheaper than storing it again.
+ */
+static int _share_cells(const font_t *font, tables_t *t, const emit_opts_t *opts, pool_t *pool, const uint8_t *raw)
+{
+    uint16_t i;
+    size_t stride = _glyph_size(t->mono_width, font->height, opts->pages), cells, found, offset;
+    uint32_t cell, prev = 0;
+    font_range_t *r = NULL;
+    bool next, at_end;
+
+    t->num_ranges = 0;
+    for (i = 0; i < t->num_chars; ++i)
+    {
+        cells = pool->size / stride;
+        next = (r != NULL) && (t->code[i] == r->last + 1u);
+        at_end = next && (prev + 1 == cells);
+        if (next && !at_end && (memcmp(pool->data + (prev + 1) * stride, raw + t->desc[i].offset, stride) == 0))
+            offset = (prev + 1) * stride;
+        else
+        {
+            found = _pool_find(pool, raw + t->desc[i].offset, stride);
+            if ((found != SIZE_MAX) && (!at_end || (stride > 2 * TARGET_RANGE_SIZE)))
+                offset = found;
+            else
+                offset = pool_add(pool, raw + t->desc[i].offset, stride, false);
+            if (offset == SIZE_MAX)
+                return -1;
+        }
+        cell = offset / stride;
+        if (cell < cells)
+            ++t->shared_glyphs;
+        if (!next || (cell != prev + 1))
+        {
+            if (t->num_ranges == FONTC_MAX_RANGES)
+            {
+                fprintf(stderr, "%s: more than %d character ranges\n", font->name, FONTC_MAX_RANGES);
+                return -1;
+            }
+            r = &t->range[t->num_ranges++];
+            r->first = t->code[i];
+            r->index = cell;
+        }
+        r->last = t->code[i];
+        prev = cell;
+        t->desc[i].offset = offset;
+    }
+    // a single range starting with the first cell needs no range table
+    if ((t->num_ranges == 1) && (t->range[0].index == 0) && (t->char_end <= 0xff) && !opts->ranges)
+        t->num_ranges = 0;
+    return 0;
+}
+
+
+/*
+ * Move the glyphs into a pool, identical glyphs share their bytes. Without a pool shared with other fonts
+ * only glyphs with descriptors are deduplicated, within the font.
+ */
+static int _share_tables(const font_t *font, tables_t *t, const emit_opts_t *opts, pool_t *pool)
+{
+    uint16_t i;
+    size_t size, offset, before;
+    uint8_t *raw = t->bitmap;
+    pool_t own;
+
+    if (opts->mono && (pool == NULL))
+        return 0;
+    memset(&own, 0, sizeof(own));
+    if (opts->mono)
+    {
+        if (_share_cells(font, t, opts, pool, raw))
+            return -1;
+    }
+    else
+    {
+        if (pool == NULL)
+            pool = &own;
+        for (i = 0; i < t->num_chars; ++i)
+        {
+            // offsets are still consecutive here
+            size = ((i + 1 < t->num_chars) ? t->desc[i + 1].offset : t->bitmap_size) - t->desc[i].offset;
+            before = pool->size;
+            offset = pool_add(pool, raw + t->desc[i].offset, size, true);
+            if (offset == SIZE_MAX)
+            {
+                pool_free(&own);
+                return -1;
+            }
+            if (size && (pool->size == before))
+                ++t->shared_glyphs;
+            t->desc[i].offset = offset;
+        }
+    }
+    if (pool->size > 0xffff + 1)
+    {
+        fprintf(stderr, "%s: bitmap too large for 16-bit offsets (%zu bytes)\n", font->name, pool->size);
+        pool_free(&own);
+        return -1;
+    }
+    free(raw);
+    t->bitmap = pool->data;
+    t->bitmap_size = pool->size;
+    if (pool == &own)
+    {
+        // the font keeps the bitmap, only the blob list goes
+        own.data = NULL;
+        pool_free(&own);
+    }
+    else
+        t->shared = true;
+    return 0;
+}
+
+
+/*
+ * Assign table entries to the characters. Without ranges the table covers char_start..char_end. With ranges a
+ * gap between characters is filled with empty entries if they take less space than starting a new range.
+ */
+static int _build_ranges(const font_t *font, const emit_opts_t *opts, tables_t *t)
+{
+    uint32_t i, code;
+    uint16_t n = 0;
+    size_t entry;
+    font_range_t *r = NULL;
+
+    t->char_start = font->glyphs[0].code;
+    t->char_end = font->glyphs[font->num_glyphs - 1].code;
+    if (!opts->ranges && (t->char_end <= 0xff))
+    {
+        t->num_chars = t->char_end - t->char_start + 1;
+        for (i = 0; i < t->num_chars; ++i)
+            t->code[i] = t->char_start + i;
+        for (i = 0; i < font->num_glyphs; ++i)
+            t->glyph[font->glyphs[i].code - t->char_start] = &font->glyphs[i];
+        return 0;
+    }
+
+    if (opts->mono)
+        entry = _glyph_size(t->mono_width, font->height, opts->pages || opts->rle);
+    else
+        entry = TARGET_DESC_SIZE + (opts->boxes ? TARGET_BOX_SIZE : 0);
+    for (i = 0; i < font->num_glyphs; ++i)
+    {
+        code = font->glyphs[i].code;
+        if ((r != NULL) && ((code - r->last - 1) * entry <= TARGET_RANGE_SIZE))
+        {
+            while ((uint32_t)r->last + 1 < code)
+            {
+                if (n == FONTC_MAX_CHARS)
+                    goto build_ranges_full;
+                t->code[n++] = ++r->last;
+            }
+            r->last = code;
+        }
+        else
+        {
+            if (t->num_ranges == FONTC_MAX_RANGES)
+            {
+                fprintf(stderr, "%s: more than %d character ranges\n", font->name, FONTC_MAX_RANGES);
+                return -1;
+            }
+            r = &t->range[t->num_ranges++];
+            r->first = r->last = code;
+            r->index = n;
+        }
+        if (n == FONTC_MAX_CHARS)
+            goto build_ranges_full;
+        t->glyph[n] = &font->glyphs[i];
+        t->code[n++] = code;
+    }
+    t->num_chars = n;
+    return 0;
+
+build_ranges_full:
+    fprintf(stderr, "%s: more than %d table entries\n", font->name, FONTC_MAX_CHARS);
+    return -1;
+}
+
+
+// A kerning pair is only worth its bytes if the font has both characters
+bool tables_kern_pair_used(const font_t *font, const kern_pair_t *k)
+{
+    return (k->left <= 0xffff) && (k->right <= 0xffff) && font_find_glyph(font, k->left)
+           && font_find_glyph(font, k->right);
+}
+
+
+// Bytes of the kerning of a font on the target, its tables and font_kerning_t
+size_t tables_kerning_size(const tables_t *t)
+{
+    if (t->num_kern_pairs == 0)
+        return 0;
+    return TARGET_KERNING_SIZE + (size_t)(t->num_kern_lefts + 1) * TARGET_KERN_LEFT_SIZE
+           + (size_t)t->num_kern_pairs * TARGET_KERN_SIZE;
+}
+
+
+int tables_build(const font_t *font, const emit_opts_t *opts, pool_t *pool, tables_t *t)
+{
+    uint32_t i;
+    uint32_t left = 0;
+    size_t offset = 0;
+    const glyph_t *g;
+    font_glyph_box_t box;
+    bool pages = opts->pages || opts->rle;
+
+    memset(t, 0, sizeof(*t));
+    if (font->num_glyphs == 0)
+    {
+        fprintf(stderr, "%s: no glyphs\n", font->name);
+        return -1;
+    }
+    if (font->glyphs[font->num_glyphs - 1].code > 0xffff)
+    {
+        fprintf(stderr, "%s: character 0x%x is outside of the Basic Multilingual Plane, use -r to select a range\n",
+                font->name, font->glyphs[font->num_glyphs - 1].code);
+        return -1;
+    }
+    if (opts->mono)
+    {
+        t->mono_width = font->glyphs[0].width;
+        for (i = 1; i < font->num_glyphs; ++i)
+        {
+            if (font->glyphs[i].width != t->mono_width)
+            {
+                fprintf(stderr, "%s: not monospace, character 0x%02x is %d pixels wide, 0x%02x is %d\n", font->name,
+                        font->glyphs[0].code, t->mono_width, font->glyphs[i].code, font->glyphs[i].width);
+                return -1;
+            }
+        }
+        if (t->mono_width == 0)
+        {
+            fprintf(stderr, "%s: monospace glyphs must not be empty\n", font->name);
+            return -1;
+        }
+    }
+
+    // characters missing in the source get an empty descriptor, or a blank cell in monospace fonts
+    if (_build_ranges(font, opts, t))
+        return -1;
+    for (i = 0; (i < t->num_chars) && opts->boxes; ++i)
+        if (t->glyph[i])
+            t->box[i] = _ink_box(font, t->glyph[i]);
+    t->boxes = opts->boxes;
+    for (i = 0; i < t->num_chars; ++i)
+    {
+        box = _stored_box(font, t, i);
+        offset += _glyph_size(box.w, box.h, pages);
+    }
+    if (offset > 0xffff + 1)
+    {
+        fprintf(stderr, "%s: bitmap too large for 16-bit offsets (%zu bytes)\n", font->name, offset);
+        return -1;
+    }
+    t->bitmap_size = offset;
+    t->bitmap = calloc(offset + 1, 1);
+    if (t->bitmap == NULL)
+        return -1;
+
+    offset = 0;
+    for (i = 0; i < t->num_chars; ++i)
+    {
+        g = t->glyph[i];
+        t->desc[i].offset = offset;
+        box = _stored_box(font, t, i);
+        if (g == NULL)
+        {
+            t->desc[i].width = t->mono_width;
+            offset += _glyph_size(box.w, box.h, pages);
+            continue;
+        }
+        t->desc[i].width = g->width;
+        _encode_glyph(g, &box, pages, t->bitmap + offset);
+        offset += _glyph_size(box.w, box.h, pages);
+    }
+    // pairs are sorted by left character, every new one starts a group
+    for (i = 0, t->num_kern_pairs = 0, t->num_kern_lefts = 0; i < font->num_kern_pairs; ++i)
+    {
+        if (!tables_kern_pair_used(font, &font->kern_pairs[i]))
+            continue;
+        if ((t->num_kern_pairs == 0) || (font->kern_pairs[i].left != left))
+            ++t->num_kern_lefts;
+        left = font->kern_pairs[i].left;
+        ++t->num_kern_pairs;
+    }
+    if (t->num_kern_pairs > 0xffff)
+    {
+        fprintf(stderr, "%s: more than 65535 kerning pairs\n", font->name);
+        return -1;
+    }
+    if (opts->rle && _compress_tables(font, t))
+        return -1;
+    if (_share_tables(font, t, opts, pool))
+        return -1;
+    return _verify_tables(font, t, opts);
+}
+
+
+void tables_free(tables_t *t)
+{
+    if (!t->shared)
+        free(t->bitmap);
+    t->bitmap = NULL;
+}
+
+
+static void _char_comment(char *buf, size_t size, uint32_t code)
+{
+    if (isgraph((int)code) && (code != '\\') && (code != '*') && (code != '/') && (code < 0x80))
+        snprintf(buf, size, "%c", (char)code);
+    else if (code > 0xff)
+        snprintf(buf, size, "U+%04X", code);
+    else
+        snprintf(buf, size, "\\x%02x", code);
+}
+
+
+static void _upper(char *dst, const char *src, size_t size)
+{
+    size_t i;
+
+    for (i = 0; (i + 1 < size) && src[i]; ++i)
+        dst[i] = toupper((unsigned char)src[i]);
+    dst[i] = 0;
+}
+
+
+// Bytes of table entry i, with the glyph drawn in a comment
+static void _emit_glyph(FILE *out, const font_t *font, const tables_t *t, uint16_t i, const emit_opts_t *opts)
+{
+    const glyph_t *g = t->glyph[i];
+    font_glyph_box_t box = _stored_box(font, t, i);
+    const uint8_t *b = t->bitmap + t->desc[i].offset;
+    uint8_t x, y, page, stride = (box.w + 7) / 8;
+    size_t size = _glyph_size(box.w, box.h, opts->pages), n;
+    char ch[12], where[48] = "";
+
+    _char_comment(ch, sizeof(ch), t->code[i]);
+    if (t->boxes)
+        snprintf(where, sizeof(where), ", box: %dx%d at %d,%d", box.w, box.h, box.x, box.y);
+    if (g == NULL)
+        snprintf(where, sizeof(where), ", blank");
+    if (!opts->pages)
+    {
+        fprintf(out, "\n    /* Index: 0x%02x, char: %s, offset: 0x%04x%s */\n", i, ch, t->desc[i].offset, where);
+        for (y = 0; y < box.h; ++y)
+        {
+            fprintf(out, "   ");
+            for (x = 0; x < stride; ++x)
+                fprintf(out, " 0x%02x,", b[y * stride + x]);
+            fprintf(out, " /* ");
+            for (x = 0; x < box.w; ++x)
+                fputc((g && g->pix[(box.y + y) * g->width + box.x + x]) ? '#' : '.', out);
+            fprintf(out, " */\n");
+        }
+        return;
+    }
+    fprintf(out, "\n    /* Index: 0x%02x, char: %s, offset: 0x%04x%s\n", i, ch, t->desc[i].offset, where);
+    for (y = 0; g && (y < font->height); ++y)
+    {
+        fprintf(out, "     * ");
+        for (x = 0; x < g->width; ++x)
+            fputc(g->pix[y * g->width + x] ? '#' : '.', out);
+        fprintf(out, "\n");
+    }
+    fprintf(out, "     */\n");
+    if (opts->rle)
+    {
+        size = rle_length(b, t->bitmap_size - t->desc[i].offset, size);
+        for (n = 0; n < size; ++n)
+            fprintf(out, "%s 0x%02x,%s", (n % 16) ? "" : "   ", b[n], ((n % 16 == 15) || (n + 1 == size)) ? "\n" : "");
+        return;
+    }
+    for (page = 0; page < (box.h + 7) / 8; ++page)
+    {
+        fprintf(out, "   ");
+        for (x = 0; x < box.w; ++x)
+            fprintf(out, " 0x%02x,", b[page * box.w + x]);
+        fprintf(out, "\n");
+    }
+}
+
+
+// Everything but the bitmap: boxes, descriptors, ranges and the font information
+static void _emit_tables(FILE *out, const font_t *font, const tables_t *t, const emit_opts_t *opts,
+                         const char *bitmap_name)
+{
+    uint32_t i, n, last = 0;
+    char ch[12], ch2[12];
+
+    if (t->boxes)
+    {
+        fprintf(out, "static const font_glyph_box_t _fonts_%s_boxes[] = {\n", font->name);
+        for (i = 0; i < t->num_chars; ++i)
+        {
+            _char_comment(ch, sizeof(ch), t->code[i]);
+            fprintf(out, "    { %2d, %2d, %2d, %2d }, /* Index: 0x%02x, char: %s */\n", t->box[i].x, t->box[i].y,
+                    t->box[i].w, t->box[i].h, i, ch);
+        }
+        fprintf(out, "};\n\n");
+    }
+
+    if (!opts->mono)
+    {
+        fprintf(out, "static const font_char_desc_t _fonts_%s_descriptors[] = {\n", font->name);
+        for (i = 0; i < t->num_chars; ++i)
+        {
+            _char_comment(ch, sizeof(ch), t->code[i]);
+            fprintf(out, "    { 0x%02x, 0x%04x }, /* Index: 0x%02x, char: %s */\n", t->desc[i].width, t->desc[i].offset,
+                    i, ch);
+        }
+        fprintf(out, "};\n\n");
+    }
+
+    if (t->num_ranges)
+    {
+        fprintf(out, "static const font_range_t _fonts_%s_ranges[] = {\n", font->name);
+        for (i = 0; i < t->num_ranges; ++i)
+            fprintf(out, "    { 0x%04x, 0x%04x, %4d },\n", t->range[i].first, t->range[i].last, t->range[i].index);
+        fprintf(out, "};\n\n");
+    }
+
+    if (t->num_kern_pairs)
+    {
+        // one entry per left character, then right character and adjustment of every pair in the same order
+        fprintf(out, "static const font_kern_left_t _fonts_%s_kern_lefts[] = {\n", font->name);
+        for (i = 0, n = 0; i < font->num_kern_pairs; ++i)
+        {
+            if (!tables_kern_pair_used(font, &font->kern_pairs[i]))
+                continue;
+            if ((n == 0) || (font->kern_pairs[i].left != font->kern_pairs[last].left))
+            {
+                _char_comment(ch, sizeof(ch), font->kern_pairs[i].left);
+                fprintf(out, "    { 0x%04x, %4u }, /* %s */\n", font->kern_pairs[i].left, n, ch);
+            }
+            last = i;
+            ++n;
+        }
+        fprintf(out, "    { 0xffff, %4u },\n", n);
+        fprintf(out, "};\n\n");
+        fprintf(out, "static const uint16_t _fonts_%s_kern_rights[] = {\n", font->name);
+        for (i = 0; i < font->num_kern_pairs; ++i)
+        {
+            if (!tables_kern_pair_used(font, &font->kern_pairs[i]))
+                continue;
+            _char_comment(ch, sizeof(ch), font->kern_pairs[i].left);
+            _char_comment(ch2, sizeof(ch2), font->kern_pairs[i].right);
+            fprintf(out, "    0x%04x, /* %s %s */\n", font->kern_pairs[i].right, ch, ch2);
+        }
+        fprintf(out, "};\n\n");
+        fprintf(out, "static const int8_t _fonts_%s_kern_adjust[] = {\n", font->name);
+        for (i = 0, n = 0; i < font->num_kern_pairs; ++i)
+        {
+            if (!tables_kern_pair_used(font, &font->kern_pairs[i]))
+                continue;
+            fprintf(out, "%s%2d,", (n % 16) ? " " : "    ", font->kern_pairs[i].adjust);
+            if ((++n % 16) == 0)
+                fprintf(out, "\n");
+        }
+        fprintf(out, (n % 16) ? "\n};\n\n" : "};\n\n");
+        fprintf(out, "static const font_kerning_t _fonts_%s_kerning =\n", font->name);
+        fprintf(out, "{\n");
+        fprintf(out, "    .num_lefts        = %u, /* Left characters */\n", t->num_kern_lefts);
+        fprintf(out, "    .lefts            = _fonts_%s_kern_lefts, /* Pairs of each left character */\n",
+                font->name);
+        fprintf(out, "    .rights           = _fonts_%s_kern_rights, /* Right character of each pair */\n",
+                font->name);
+        fprintf(out, "    .adjust           = _fonts_%s_kern_adjust, /* Added to the space of each pair */\n",
+                font->name);
+        fprintf(out, "};\n\n");
+    }
+
+    fprintf(out, "const font_info_t _fonts_%s_info =\n", font->name);
+    fprintf(out, "{\n");
+    fprintf(out, "    .height           = %d, /* Character height */\n", font->height);
+    fprintf(out, "    .c                = %d, /* C */\n", font->c);
+    if (!t->num_ranges)
+    {
+        fprintf(out, "    .char_start       = %d, /* Start character */\n", t->char_start);
+        fprintf(out, "    .char_end         = %d, /* End character */\n", t->char_end);
+    }
+    if (opts->mono)
+        fprintf(out, "    .char_descriptors = NULL, /* No descriptors, see FONT_FLAG_MONO */\n");
+    else
+        fprintf(out, "    .char_descriptors = _fonts_%s_descriptors, /* Character descriptor array */\n", font->name);
+    fprintf(out, "    .bitmap           = _fonts_%s_bitmaps, /* Character bitmap array */\n", bitmap_name);
+    if (opts->rle)
+        fprintf(out, "    .flags            = FONT_FLAG_PAGES | FONT_FLAG_RLE, /* Flags */\n");
+    else if (opts->pages && opts->mono)
+        fprintf(out, "    .flags            = FONT_FLAG_PAGES | FONT_FLAG_MONO, /* Flags */\n");
+    else if (opts->pages)
+        fprintf(out, "    .flags            = FONT_FLAG_PAGES, /* Flags */\n");
+    else if (opts->mono)
+        fprintf(out, "    .flags            = FONT_FLAG_MONO, /* Flags */\n");
+    if (opts->mono)
+    {
+        fprintf(out, "    .width            = %d, /* Glyph width */\n", t->mono_width);
+        fprintf(out, "    .stride           = %zu, /* Bytes per glyph */\n",
+                _glyph_size(t->mono_width, font->height, opts->pages));
+    }
+    if (t->boxes)
+        fprintf(out, "    .boxes            = _fonts_%s_boxes, /* Ink box of each character */\n", font->name);
+    if (t->num_ranges)
+    {
+        fprintf(out, "    .ranges           = _fonts_%s_ranges, /* Code point ranges */\n", font->name);
+        fprintf(out, "    .num_ranges       = %d, /* Number of ranges */\n", t->num_ranges);
+    }
+    if (t->num_kern_pairs)
+    {
+        fprintf(out, "    .kerning          = &_fonts_%s_kerning, /* %u kerning pairs */\n", font->name,
+                t->num_kern_pairs);
+    }
+    if (font->fallback)
+        fprintf(out, "    .fallback         = 0x%04x, /* Drawn for missing characters */\n", font->fallback);
+    fprintf(out, "};\n\n");
+}
+
+
+/*
+ * Write the fonts into one header. With opts->pool all fonts share one bitmap array, identical glyphs are
+ * stored once; a glyph is written where it first occurs, later users only point to it.
+ */
+int emit_header(FILE *out, const font_t *fonts, size_t num_fonts, const emit_opts_t *opts, size_report_t *report)
+{
+    tables_t *t;
+    const font_t *font;
+    pool_t pool;
+    size_t k, pos = 0, size;
+    uint16_t i;
+    const char *p, *nl, *name = opts->pool ? opts->pool : fonts[0].name;
+    char guard[80];
+    font_glyph_box_t box;
+    int result = -1;
+
+    memset(&pool, 0, sizeof(pool));
+    memset(report, 0, sizeof(*report));
+    t = calloc(num_fonts, sizeof(tables_t));
+    if (t == NULL)
+        return -1;
+    for (k = 0; k < num_fonts; ++k)
+        if (tables_build(&fonts[k], opts, opts->pool ? &pool : NULL, &t[k]))
+            goto emit_header_free;
+    _upper(guard, name, sizeof(guard));
+
+    fprintf(out, "/**\n");
+    fprintf(out, " * This file contains generated binary font data.\n");
+    fprintf(out, " *\n");
+    for (k = 0; k < num_fonts; ++k)
+    {
+        font = &fonts[k];
+        fprintf(out, " * Font:    %s\n", font->name);
+        fprintf(out, " * Height:  %d\n", font->height);
+        fprintf(out, " * Layout:  %s%s%s\n", opts->rle ? "page-native, run-length coded" : opts->pages ? "page-native" : "row-major",
+                opts->mono ? ", monospace" : "", opts->boxes ? ", ink boxes" : "");
+        if (t[k].num_ranges)
+            fprintf(out, (t[k].char_end > 0xff) ? " * %d characters in %d ranges (U+%04X..U+%04X)\n"
+                                                 : " * %d characters in %d ranges (%d..%d)\n",
+                    font->num_glyphs, t[k].num_ranges, t[k].char_start, t[k].char_end);
+        else
+            fprintf(out, " * %d characters (%d..%d)\n", t[k].num_chars, t[k].char_start, t[k].char_end);
+        if (t[k].num_kern_pairs)
+            fprintf(out, " * %u kerning pair%s of %u left character%s\n", t[k].num_kern_pairs,
+                    (t[k].num_kern_pairs == 1) ? "" : "s", t[k].num_kern_lefts, (t[k].num_kern_lefts == 1) ? "" : "s");
+        if (t[k].shared_glyphs)
+            fprintf(out, " * %u glyph%s identical to an earlier one, stored once\n", t[k].shared_glyphs,
+                    (t[k].shared_glyphs == 1) ? "" : "s");
+        fprintf(out, " *\n");
+    }
+    for (p = fonts[0].comment; (nl = strchr(p, '\n')) != NULL; p = nl + 1)
+        fprintf(out, (nl == p) ? " *\n" : " * %.*s\n", (int)(nl - p), p);
+    if (fonts[0].comment[0])
+        fprintf(out, " *\n");
+    if (opts->source)
+        fprintf(out, " * Source:  %s\n", opts->source);
+    fprintf(out, " * Generated by tools/fontc, do not edit. Command:\n");
+    fprintf(out, " *     %s\n", opts->command ? opts->command : "fontc");
+    fprintf(out, " */\n");
+    fprintf(out, "#ifndef _EXTRAS_FONTS_FONT_%s_H_\n", guard);
+    fprintf(out, "#define _EXTRAS_FONTS_FONT_%s_H_\n\n", guard);
+
+    fprintf(out, "static const uint8_t _fonts_%s_bitmaps[] = {\n", name);
+    for (k = 0; k < num_fonts; ++k)
+    {
+        if (opts->pool)
+            t[k].bitmap = pool.data;
+        for (i = 0; i < t[k].num_chars; ++i)
+        {
+            box = _stored_box(&fonts[k], &t[k], i);
+            size = _glyph_size(box.w, box.h, opts->pages);
+            if (opts->rle && size)
+                size = rle_length(t[k].bitmap + t[k].desc[i].offset, t[k].bitmap_size - t[k].desc[i].offset, size);
+            if ((size == 0) || (t[k].desc[i].offset != pos))
+                continue;
+            _emit_glyph(out, &fonts[k], &t[k], i, opts);
+            pos += size;
+        }
+    }
+    if (pos != (opts->pool ? pool.size : t[0].bitmap_size))
+    {
+        fprintf(stderr, "%s: %zu bitmap bytes written, %zu expected\n", name, pos,
+                opts->pool ? pool.size : t[0].bitmap_size);
+        goto emit_header_free;
+    }
+    if (pos == 0)
+        fprintf(out, "    0x00,\n");
+    fprintf(out, "};\n\n");
+
+    for (k = 0; k < num_fonts; ++k)
+    {
+        _emit_tables(out, &fonts[k], &t[k], opts, name);
+        report->descriptors += opts->mono ? 0 : (size_t)t[k].num_chars * TARGET_DESC_SIZE;
+        report->boxes += t[k].boxes ? (size_t)t[k].num_chars * TARGET_BOX_SIZE : 0;
+        report->ranges += (size_t)t[k].num_ranges * TARGET_RANGE_SIZE;
+        report->kerning += tables_kerning_size(&t[k]);
+        report->info += TARGET_INFO_SIZE;
+    }
+    fprintf(out, "#endif /* _EXTRAS_FONTS_FONT_%s_H_ */\n", guard);
+    report->bitmap = pos ? pos : 1;
+    result = 0;
+
+emit_header_free:
+    for (k = 0; k < num_fonts; ++k)
+        tables_free(&t[k]);
+    free(t);
+    pool_free(&pool);
+    return result;
+}
@@ -0,0 +1,302 @@
+/**
+  ******************************************************************************
+  * @file    font.c
+  * @brief   Host-side font compiler, in-memory font model
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE file.
+  *
+  */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fontc.h"
+
+
+void font_init(font_t *font, const char *name, uint8_t height)
+{
+    memset(font, 0, sizeof(*font));
+    snprintf(font->name, sizeof(font->name), "%s", name);
+    font->height = height;
+    font->ascent = height;
+}
+
+
+void font_free(font_t *font)
+{
+    uint32_t i;
+
+    for (i = 0; i < font->num_glyphs; ++i)
+        free(font->glyphs[i].pix);
+    free(font->glyphs);
+    font->glyphs = NULL;
+    font->num_glyphs = 0;
+    free(font->kern_pairs);
+    font->kern_pairs = NULL;
+    font->num_kern_pairs = 0;
+}
+
+
+// Append a blank glyph, call font_sort() once all glyphs are added
+glyph_t *font_add_glyph(font_t *font, uint32_t code, uint8_t width)
+{
+    glyph_t *g;
+
+    g = realloc(font->glyphs, (font->num_glyphs + 1) * sizeof(glyph_t));
+    if (g == NULL)
+        return NULL;
+    font->glyphs = g;
+    g = &font->glyphs[font->num_glyphs];
+    g->code = code;
+    g->width = width;
+    g->pix = calloc((size_t)width * font->height + 1, 1);
+    if (g->pix == NULL)
+        return NULL;
+    ++font->num_glyphs;
+    return g;
+}
+
+
+glyph_t *font_find_glyph(const font_t *font, uint32_t code)
+{
+    uint32_t lo = 0, hi = font->num_glyphs, mid;
+
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (font->glyphs[mid].code == code)
+            return &font->glyphs[mid];
+        if (font->glyphs[mid].code < code)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return NULL;
+}
+
+
+static int _cmp_glyph(const void *a, const void *b)
+{
+    const glyph_t *ga = a, *gb = b;
+
+    return (ga->code > gb->code) - (ga->code < gb->code);
+}
+
+
+// Sort by code, drop duplicates (first one wins)
+void font_sort(font_t *font)
+{
+    uint32_t i, n = 0;
+
+    qsort(font->glyphs, font->num_glyphs, sizeof(glyph_t), _cmp_glyph);
+    for (i = 0; i < font->num_glyphs; ++i)
+    {
+        if ((n > 0) && (font->glyphs[n - 1].code == font->glyphs[i].code))
+        {
+            free(font->glyphs[i].pix);
+            continue;
+        }
+        font->glyphs[n++] = font->glyphs[i];
+    }
+    font->num_glyphs = n;
+}
+
+
+void font_keep_range(font_t *font, uint32_t first, uint32_t last)
+{
+    uint32_t i, n = 0;
+    kern_pair_t *k;
+
+    for (i = 0; i < font->num_glyphs; ++i)
+    {
+        if ((font->glyphs[i].code < first) || (font->glyphs[i].code > last))
+        {
+            free(font->glyphs[i].pix);
+            continue;
+        }
+        font->glyphs[n++] = font->glyphs[i];
+    }
+    font->num_glyphs = n;
+
+    for (i = 0, n = 0; i < font->num_kern_pairs; ++i)
+    {
+        k = &font->kern_pairs[i];
+        if ((k->left >= first) && (k->left <= last) && (k->right >= first) && (k->right <= last))
+            font->kern_pairs[n++] = *k;
+    }
+    font->num_kern_pairs = n;
+}
+
+
+static bool _in_set(const uint8_t *set, uint32_t code)
+{
+    return (code <= 0xffff) && ((set[code / 8] >> (code & 7)) & 1);
+}
+
+
+// Keep only the characters of a set of SUBSET_SIZE bytes (see subset_read)
+void font_keep_set(font_t *font, const uint8_t *set)
+{
+    uint32_t i, n = 0;
+    kern_pair_t *k;
+
+    for (i = 0; i < font->num_glyphs; ++i)
+    {
+        if (!_in_set(set, font->glyphs[i].code))
+        {
+            free(font->glyphs[i].pix);
+            continue;
+        }
+        font->glyphs[n++] = font->glyphs[i];
+    }
+    font->num_glyphs = n;
+
+    for (i = 0, n = 0; i < font->num_kern_pairs; ++i)
+    {
+        k = &font->kern_pairs[i];
+        if (_in_set(set, k->left) && _in_set(set, k->right))
+            font->kern_pairs[n++] = *k;
+    }
+    font->num_kern_pairs = n;
+}
+
+
+bool font_glyph_blank(const font_t *font, const glyph_t *g)
+{
+    size_t i;
+
+    for (i = 0; i < (size_t)g->width * font->height; ++i)
+        if (g->pix[i])
+            return false;
+    return true;
+}
+
+
+// Unicode of KOI8-R 0x80..0xff
+static const uint16_t _koi8_r[128] =
+{
+    0x2500, 0x2502, 0x250c, 0x2510, 0x2514, 0x2518, 0x251c, 0x2524,
+    0x252c, 0x2534, 0x253c, 0x2580, 0x2584, 0x2588, 0x258c, 0x2590,
+    0x2591, 0x2592, 0x2593, 0x2320, 0x25a0, 0x2219, 0x221a, 0x2248,
+    0x2264, 0x2265, 0x00a0, 0x2321, 0x00b0, 0x00b2, 0x00b7, 0x00f7,
+    0x2550, 0x2551, 0x2552, 0x0451, 0x2553, 0x2554, 0x2555, 0x2556,
+    0x2557, 0x2558, 0x2559, 0x255a, 0x255b, 0x255c, 0x255d, 0x255e,
+    0x255f, 0x2560, 0x2561, 0x0401, 0x2562, 0x2563, 0x2564, 0x2565,
+    0x2566, 0x2567, 0x2568, 0x2569, 0x256a, 0x256b, 0x256c, 0x00a9,
+    0x044e, 0x0430, 0x0431, 0x0446, 0x0434, 0x0435, 0x0444, 0x0433,
+    0x0445, 0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e,
+    0x043f, 0x044f, 0x0440, 0x0441, 0x0442, 0x0443, 0x0436, 0x0432,
+    0x044c, 0x044b, 0x0437, 0x0448, 0x044d, 0x0449, 0x0447, 0x044a,
+    0x042e, 0x0410, 0x0411, 0x0426, 0x0414, 0x0415, 0x0424, 0x0413,
+    0x0425, 0x0418, 0x0419, 0x041a, 0x041b, 0x041c, 0x041d, 0x041e,
+    0x041f, 0x042f, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412,
+    0x042c, 0x042b, 0x0417, 0x0428, 0x042d, 0x0429, 0x0427, 0x042a,
+};
+
+
+// Map 8-bit character codes of the given set to Unicode. Latin-1 codes are Unicode already.
+int font_recode(font_t *font, const char *charset)
+{
+    uint32_t i;
+
+    if ((strcmp(charset, "latin1") == 0) || (strcmp(charset, "iso8859-1") == 0))
+        return 0;
+    if (strcmp(charset, "koi8-r") != 0)
+        return -1;
+    for (i = 0; i < font->num_glyphs; ++i)
+        if ((font->glyphs[i].code >= 0x80) && (font->glyphs[i].code <= 0xff))
+            font->glyphs[i].code = _koi8_r[font->glyphs[i].code - 0x80];
+    font_sort(font);
+    for (i = 0; i < font->num_kern_pairs; ++i)
+    {
+        if ((font->kern_pairs[i].left >= 0x80) && (font->kern_pairs[i].left <= 0xff))
+            font->kern_pairs[i].left = _koi8_r[font->kern_pairs[i].left - 0x80];
+        if ((font->kern_pairs[i].right >= 0x80) && (font->kern_pairs[i].right <= 0xff))
+            font->kern_pairs[i].right = _koi8_r[font->kern_pairs[i].right - 0x80];
+    }
+    font_sort_kern_pairs(font);
+    if ((font->fallback >= 0x80) && (font->fallback <= 0xff))
+        font->fallback = _koi8_r[font->fallback - 0x80];
+    return 0;
+}
+
+
+// Move the glyphs of src that dst does not have into dst, src is freed. Kerning pairs of src are dropped.
+int font_merge(font_t *dst, font_t *src)
+{
+    uint32_t i, n = dst->num_glyphs;
+    font_t sorted;
+    glyph_t *g;
+
+    if (src->height != dst->height)
+    {
+        fprintf(stderr, "%s: height %d does not match %s (%d)\n", src->name, src->height, dst->name, dst->height);
+        font_free(src);
+        return -1;
+    }
+    for (i = 0; i < src->num_glyphs; ++i)
+    {
+        // only the sorted part of dst is searched, glyphs of src are unique
+        sorted = *dst;
+        sorted.num_glyphs = n;
+        if (font_find_glyph(&sorted, src->glyphs[i].code))
+            continue;
+        g = realloc(dst->glyphs, (dst->num_glyphs + 1) * sizeof(glyph_t));
+        if (g == NULL)
+        {
+            font_free(src);
+            return -1;
+        }
+        dst->glyphs = g;
+        dst->glyphs[dst->num_glyphs++] = src->glyphs[i];
+        src->glyphs[i].pix = NULL;
+    }
+    font_free(src);
+    font_sort(dst);
+    return 0;
+}
+
+
+// Append a kerning pair, call font_sort_kern_pairs() once all pairs are added
+int font_add_kern_pair(font_t *font, uint32_t left, uint32_t right, int8_t adjust)
+{
+    kern_pair_t *k;
+
+    k = realloc(font->kern_pairs, (font->num_kern_pairs + 1) * sizeof(kern_pair_t));
+    if (k == NULL)
+        return -1;
+    font->kern_pairs = k;
+    k += font->num_kern_pairs++;
+    k->left = left;
+    k->right = right;
+    k->adjust = adjust;
+    return 0;
+}
+
+
+static int _cmp_kern_pair(const void *a, const void *b)
+{
+    const kern_pair_t *ka = a, *kb = b;
+
+    if (ka->left != kb->left)
+        return (ka->left > kb->left) ? 1 : -1;
+    return (ka->right > kb->right) - (ka->right < kb->right);
+}
+
+
+// Sort by left, then right code, drop duplicate pairs
+void font_sort_kern_pairs(font_t *font)
+{
+    uint32_t i, n = 0;
+
+    qsort(font->kern_pairs, font->num_kern_pairs, sizeof(kern_pair_t), _cmp_kern_pair);
+    for (i = 0; i < font->num_kern_pairs; ++i)
+    {
+        if ((n > 0) && (_cmp_kern_pair(&font->kern_pairs[n - 1], &font->kern_pairs[i]) == 0))
+            continue;
+        font->kern_pairs[n++] = font->kern_pairs[i];
+    }
+    font->num_kern_pairs = n;
+}
@@ -0,0 +1,423 @@
+/**
+  ******************************************************************************
+  * @file    fontc.c
+  * @brief   Host-side font compiler: turns BDF fonts and the existing font tables into verified
+  *          tables for the SSD1306 driver
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE file.
+  *
+  */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fontc.h"
+
+
+static void _usage(FILE *f)
+{
+    fprintf(f,
+        "usage: fontc [options] <input> [[--charset <set>] <input> ...]\n"
+        "  <input>            BDF file, or builtin:<name> for a table from main/fonts. Further inputs add the\n"
+        "                     characters the font does not have yet.\n"
+        "  --charset <set>    character set of the following inputs: latin1 (default, same as Unicode) or koi8-r\n"
+        "  -o <file>          output file (default: stdout)\n"
+        "  -n <name>          symbol name, tables are emitted as _fonts_<name>_xxx\n"
+        "  -r <first>-<last>  keep only characters first..last (decimal or 0x hex)\n"
+        "  -c <pixels>        space between adjacent characters\n"
+        "  -s <pixels>        add an empty space character of this width if the font has none\n"
+        "  --subset <file>    keep only the characters of file (text, or the string literals of C sources) and\n"
+        "                     space, may be given several times\n"
+        "  --fallback <code>  character drawn for characters missing in the font (decimal or 0x hex), kept by\n"
+        "                     --subset\n"
+        "  --kern <pixels>    kern letters, digits and punctuation by the glyph shapes, pairs that differ from the\n"
+        "                     usual spacing by at least this many pixels\n"
+        "  --comment <file>   copy the text of file (license, origin) into the header comment\n"
+        "  --start <code>     first character of a builtin font, repairs broken font information\n"
+        "  --rows             emit row-major glyphs (default: page-native, FONT_FLAG_PAGES)\n"
+        "  --rle              emit run-length coded page-native glyphs (FONT_FLAG_RLE)\n"
+        "  --mono             emit a monospace font without descriptors (FONT_FLAG_MONO)\n"
+        "  --bbox             store only the ink box of every glyph\n"
+        "  --ranges           emit code point ranges, implied by characters above 0xff\n"
+        "  --pool <name>      emit every input as a font of its own, sharing the bitmap _fonts_<name>_bitmaps\n"
+        "  --bdf              write BDF instead of a C header\n"
+        "  --pack             write an asset pack (see ssd1306_assets.h) instead of a C header, every input is a\n"
+        "                     font of its own\n"
+        "  --image <file>     add a PBM image to the asset pack, named after the file\n"
+        "  --list             list builtin fonts\n"
+        "  --verify           verify all builtin fonts\n"
+        "  --bench [<name>]   compare size and decode time of plain and run-length coded builtin fonts\n"
+        "  -q                 do not print the size report\n");
+}
+
+
+static int _verify_all(void)
+{
+    size_t i;
+    int errors = 0, e;
+
+    for (i = 0; i < num_builtin_fonts; ++i)
+    {
+        e = builtin_verify(&builtin_fonts[i], stderr);
+        printf("%-32s %s\n", builtin_fonts[i].name, e ? "FAILED" : "ok");
+        errors += e;
+    }
+    return errors ? 1 : 0;
+}
+
+
+static void _list(void)
+{
+    size_t i;
+    const font_info_t *info;
+
+    for (i = 0; i < num_builtin_fonts; ++i)
+    {
+        info = builtin_fonts[i].info;
+        printf("%-32s height %2d, %3zu characters, %6zu bytes bitmap\n", builtin_fonts[i].name, info->height,
+               builtin_num_chars(&builtin_fonts[i]), builtin_fonts[i].bitmap_size);
+    }
+}
+
+
+static bool _parse_range(const char *s, uint32_t *first, uint32_t *last)
+{
+    char *end;
+
+    *first = strtoul(s, &end, 0);
+    if (*end != '-')
+        return false;
+    *last = strtoul(end + 1, &end, 0);
+    return (*end == 0) && (*first <= *last);
+}
+
+
+static int _read_comment(const char *path, char *comment, size_t size)
+{
+    FILE *f;
+    size_t n;
+
+    f = fopen(path, "r");
+    if (f == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    n = fread(comment, 1, size - 1, f);
+    comment[n] = 0;
+    fclose(f);
+    if ((n > 0) && (comment[n - 1] != '\n') && (n + 1 < size))
+        strcat(comment, "\n");
+    return 0;
+}
+
+
+// Load one input, the size of builtin fonts is added to *source_size
+static int _load(const char *input, const char *charset, int start, font_t *font, size_t *source_size)
+{
+    const builtin_font_t *builtin;
+
+    if (strncmp(input, "builtin:", 8) == 0)
+    {
+        builtin = builtin_find(input + 8);
+        if (builtin == NULL)
+        {
+            fprintf(stderr, "unknown builtin font %s, see --list\n", input + 8);
+            return -1;
+        }
+        if (builtin_verify(builtin, stderr) && (start < 0))
+            fprintf(stderr, "%s: font information is inconsistent, consider --start and -c\n", builtin->name);
+        if (builtin_load(builtin, font, start))
+        {
+            fprintf(stderr, "%s: cannot decode font\n", builtin->name);
+            return -1;
+        }
+        *source_size += builtin->bitmap_size + builtin->num_descriptors * TARGET_DESC_SIZE + TARGET_INFO_SIZE;
+    }
+    else if (bdf_read(input, font))
+    {
+        return -1;
+    }
+    if (font_recode(font, charset))
+    {
+        fprintf(stderr, "unknown character set %s\n", charset);
+        font_free(font);
+        return -1;
+    }
+    return 0;
+}
+
+
+int main(int argc, char **argv)
+{
+    const char *input[8], *charset[8], *output = NULL, *name = NULL, *set = "latin1", *comment = NULL;
+    size_t num_inputs = 0, k;
+    uint32_t first = 0, last = UINT32_MAX;
+    int c = -1, space = -1, start = -1, kern = 0, fallback = -1, i;
+    bool bdf = false, quiet = false, pack = false;
+    char command[1024] = "fontc", sources[512] = "";
+    emit_opts_t opts = { .pages = true };
+    size_report_t report;
+    size_t source_size = 0, total;
+    font_t fonts[8], more, *font;
+    size_t num_fonts = 0, num_images = 0;
+    image_t images[8];
+    uint8_t *subset = NULL;
+    glyph_t *g;
+    FILE *out = stdout;
+
+    for (i = 1; i < argc; ++i)
+    {
+        // command line is recorded in the generated header, paths kept as given
+        strncat(command, " ", sizeof(command) - strlen(command) - 1);
+        strncat(command, argv[i], sizeof(command) - strlen(command) - 1);
+    }
+
+    for (i = 1; i < argc; ++i)
+    {
+        if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc))
+            output = argv[++i];
+        else if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+            name = argv[++i];
+        else if ((strcmp(argv[i], "-r") == 0) && (i + 1 < argc))
+        {
+            if (!_parse_range(argv[++i], &first, &last))
+            {
+                fprintf(stderr, "invalid range %s\n", argv[i]);
+                return 2;
+            }
+        }
+        else if ((strcmp(argv[i], "-c") == 0) && (i + 1 < argc))
+            c = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+            space = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--subset") == 0) && (i + 1 < argc))
+        {
+            if ((subset == NULL) && ((subset = calloc(SUBSET_SIZE, 1)) == NULL))
+                goto fontc_fail;
+            if (subset_read(argv[++i], subset))
+                goto fontc_fail;
+        }
+        else if ((strcmp(argv[i], "--fallback") == 0) && (i + 1 < argc))
+            fallback = strtol(argv[++i], NULL, 0);
+        else if ((strcmp(argv[i], "--kern") == 0) && (i + 1 < argc))
+            kern = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--start") == 0) && (i + 1 < argc))
+            start = strtol(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--rows") == 0)
+            opts.pages = false;
+        else if (strcmp(argv[i], "--rle") == 0)
+            opts.rle = true;
+        else if (strcmp(argv[i], "--mono") == 0)
+            opts.mono = true;
+        else if (strcmp(argv[i], "--bbox") == 0)
+            opts.boxes = true;
+        else if (strcmp(argv[i], "--ranges") == 0)
+            opts.ranges = true;
+        else if ((strcmp(argv[i], "--comment") == 0) && (i + 1 < argc))
+            comment = argv[++i];
+        else if ((strcmp(argv[i], "--pool") == 0) && (i + 1 < argc))
+            opts.pool = argv[++i];
+        else if ((strcmp(argv[i], "--charset") == 0) && (i + 1 < argc))
+            set = argv[++i];
+        else if (strcmp(argv[i], "--bdf") == 0)
+            bdf = true;
+        else if (strcmp(argv[i], "--pack") == 0)
+            pack = true;
+        else if ((strcmp(argv[i], "--image") == 0) && (i + 1 < argc)
+                 && (num_images < sizeof(images) / sizeof(images[0])))
+        {
+            if (pbm_read(argv[++i], &images[num_images]))
+                goto fontc_fail;
+            ++num_images;
+        }
+        else if (strcmp(argv[i], "-q") == 0)
+            quiet = true;
+        else if (strcmp(argv[i], "--list") == 0)
+        {
+            _list();
+            return 0;
+        }
+        else if (strcmp(argv[i], "--verify") == 0)
+            return _verify_all();
+        else if (strcmp(argv[i], "--bench") == 0)
+            return bench_fonts((i + 1 < argc) ? argv[i + 1] : NULL);
+        else if ((argv[i][0] == '-') || (num_inputs == sizeof(input) / sizeof(input[0])))
+        {
+            _usage(stderr);
+            return 2;
+        }
+        else
+        {
+            charset[num_inputs] = set;
+            input[num_inputs++] = argv[i];
+        }
+    }
+    if (num_inputs == 0)
+    {
+        _usage(stderr);
+        return 2;
+    }
+    if (opts.rle && !opts.pages)
+    {
+        fprintf(stderr, "--rle needs the page-native layout, drop --rows\n");
+        return 2;
+    }
+    if (opts.boxes && opts.mono)
+    {
+        fprintf(stderr, "--bbox and --mono cannot be combined, glyph boxes differ in size\n");
+        return 2;
+    }
+    if (opts.rle && opts.mono)
+    {
+        fprintf(stderr, "--rle and --mono cannot be combined, run-length coded glyphs differ in size\n");
+        return 2;
+    }
+
+    if (opts.pool && (name || bdf))
+    {
+        fprintf(stderr, "--pool keeps the names of the inputs and writes a C header, drop -n and --bdf\n");
+        return 2;
+    }
+    if (pack && (opts.pool || bdf || !output || (name && (num_inputs > 1))))
+    {
+        fprintf(stderr, "--pack writes every input as a font of its own to a file, use -o and drop --pool, --bdf"
+                " and -n with several inputs\n");
+        return 2;
+    }
+    if ((fallback == 0) || (fallback > 0xffff))
+    {
+        fprintf(stderr, "--fallback needs a code point from 1 to 0xffff\n");
+        return 2;
+    }
+    if (num_images && !pack)
+    {
+        fprintf(stderr, "--image needs --pack\n");
+        return 2;
+    }
+
+    // load, later inputs only add missing characters unless every input becomes a font of its own
+    for (k = 0; k < num_inputs; ++k)
+    {
+        if (_load(input[k], charset[k], k ? -1 : start, (opts.pool || pack) ? &fonts[num_fonts] : &more, &source_size))
+            goto fontc_fail;
+        if (opts.pool || pack)
+            ++num_fonts;
+        else if (k == 0)
+            fonts[num_fonts++] = more;
+        else if (font_merge(&fonts[0], &more))
+            goto fontc_fail;
+    }
+
+    // transform
+    if (comment && _read_comment(comment, fonts[0].comment, sizeof(fonts[0].comment)))
+        goto fontc_fail;
+    if (subset)
+    {
+        // space and the fallback are always needed, sparse subsets are cheaper with ranges than with gaps
+        subset[' ' / 8] |= 1 << (' ' & 7);
+        if (fallback > 0)
+            subset[fallback / 8] |= 1 << (fallback & 7);
+        opts.ranges = true;
+    }
+    for (k = 0; k < num_fonts; ++k)
+    {
+        font = &fonts[k];
+        if (name)
+            snprintf(font->name, sizeof(font->name), "%s", name);
+        if (c >= 0)
+            font->c = c;
+        font_keep_range(font, first, last);
+        if (subset)
+            font_keep_set(font, subset);
+        if (fallback > 0)
+            font->fallback = fallback;
+        if (font->fallback && (font_find_glyph(font, font->fallback) == NULL))
+        {
+            fprintf(stderr, "%s: fallback character 0x%04x is missing\n", font->name, font->fallback);
+            goto fontc_fail;
+        }
+        if ((space >= 0) && (font_find_glyph(font, ' ') == NULL) && (first <= ' ') && (last >= ' '))
+        {
+            g = font_add_glyph(font, ' ', space);
+            if (g == NULL)
+                goto fontc_fail;
+            font_sort(font);
+        }
+        if ((kern > 0) && (kern_auto(font, (kern < 255) ? kern : 255, quiet ? NULL : stderr) < 0))
+            goto fontc_fail;
+    }
+
+    // emit
+    if (output)
+    {
+        out = fopen(output, pack ? "wb" : "w");
+        if (out == NULL)
+        {
+            perror(output);
+            return 1;
+        }
+    }
+    for (k = 0; k < num_inputs; ++k)
+        snprintf(sources + strlen(sources), sizeof(sources) - strlen(sources), "%s%s", k ? ", " : "", input[k]);
+    opts.source = sources;
+    opts.command = command;
+    if (bdf)
+    {
+        bdf_write(out, &fonts[0]);
+    }
+    else if (pack ? pack_write(out, fonts, num_fonts, images, num_images, &opts, &report)
+                  : emit_header(out, fonts, num_fonts, &opts, &report))
+    {
+        if (output)
+        {
+            fclose(out);
+            remove(output);
+        }
+        goto fontc_fail;
+    }
+    if (output)
+        fclose(out);
+
+    if (!quiet && !bdf)
+    {
+        total = report.bitmap + report.descriptors + report.boxes + report.ranges + report.kerning + report.images
+                + report.info;
+        for (k = 0; k < num_fonts; ++k)
+            fprintf(stderr, "%s: %u glyphs, height %d, %s\n", fonts[k].name, fonts[k].num_glyphs, fonts[k].height,
+                    opts.rle ? "page-native, run-length coded" : opts.pages ? "page-native" : "row-major");
+        fprintf(stderr, "  bitmap       %6zu bytes\n", report.bitmap);
+        fprintf(stderr, "  descriptors  %6zu bytes\n", report.descriptors);
+        if (report.boxes)
+            fprintf(stderr, "  boxes        %6zu bytes\n", report.boxes);
+        if (report.ranges)
+            fprintf(stderr, "  ranges       %6zu bytes\n", report.ranges);
+        if (report.kerning)
+            fprintf(stderr, "  kerning      %6zu bytes\n", report.kerning);
+        if (report.images)
+            fprintf(stderr, "  images       %6zu bytes\n", report.images);
+        fprintf(stderr, "  info         %6zu bytes\n", report.info);
+        fprintf(stderr, "  total        %6zu bytes\n", total);
+        if (report.pack)
+            fprintf(stderr, "  pack file    %6zu bytes\n", report.pack);
+        if (source_size)
+            fprintf(stderr, "  source       %6zu bytes (%+.1f %%)\n", source_size,
+                    100.0 * ((double)total - (double)source_size) / (double)source_size);
+    }
+    for (k = 0; k < num_fonts; ++k)
+        font_free(&fonts[k]);
+    for (k = 0; k < num_images; ++k)
+        free(images[k].pix);
+    free(subset);
+    return 0;
+
+fontc_fail:
+    for (k = 0; k < num_fonts; ++k)
+        font_free(&fonts[k]);
+    for (k = 0; k < num_images; ++k)
+        free(images[k].pix);
+    free(subset);
+    return 1;
+}
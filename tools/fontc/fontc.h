@@ -0,0 +1,211 @@
+/**
+  ******************************************************************************
+  * @file    fontc.h
+  * @brief   Host-side font compiler, shared declarations
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE file.
+  *
+  */
+
+#ifndef FONTC_H
+#define FONTC_H
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "fonts.h"
+
+
+/**
+ * @name Sizes of driver structures on the target (ESP32, 32-bit pointers)
+ * @{
+ */
+#define TARGET_DESC_SIZE    4   //!< sizeof(font_char_desc_t)
+#define TARGET_INFO_SIZE    36  //!< sizeof(font_info_t)
+#define TARGET_BOX_SIZE     4   //!< sizeof(font_glyph_box_t)
+#define TARGET_RANGE_SIZE   6   //!< sizeof(font_range_t)
+#define TARGET_KERNING_SIZE 16  //!< sizeof(font_kerning_t)
+#define TARGET_KERN_LEFT_SIZE 4 //!< sizeof(font_kern_left_t)
+#define TARGET_KERN_SIZE    3   //!< Right character and adjustment of a kerning pair
+/** @} */
+
+#define FONTC_MAX_CHARS     4096    //!< Table entries per font, including gaps inside of ranges
+#define FONTC_MAX_RANGES    256     //!< Code point ranges per font
+#define SUBSET_SIZE         (0x10000 / 8)   //!< Bytes of a character set, one bit per code point below 0x10000
+
+
+//! @brief One glyph of a font being compiled
+typedef struct
+{
+    uint32_t code;      //!< Character code
+    uint8_t width;      //!< Glyph width (advance) in pixel
+    uint8_t *pix;       //!< width * height pixels, row-major, one byte per pixel (0 or 1)
+} glyph_t;
+
+
+//! @brief Kerning pair of a font being compiled
+typedef struct
+{
+    uint32_t left;      //!< Code of the left character
+    uint32_t right;     //!< Code of the right character
+    int8_t adjust;      //!< Added to the space between them
+} kern_pair_t;
+
+
+//! @brief Font being compiled, glyphs are kept sorted by code
+typedef struct
+{
+    char name[64];      //!< Symbol name, tables are emitted as _fonts_<name>_xxx
+    uint8_t height;     //!< Cell height
+    uint8_t ascent;     //!< Rows above the baseline (BDF import/export only)
+    uint8_t c;          //!< Space between adjacent characters
+    char comment[1024]; //!< Free text (license, origin), one line per '\n'
+    uint32_t num_glyphs;
+    glyph_t *glyphs;
+    uint32_t num_kern_pairs;
+    kern_pair_t *kern_pairs;    //!< Sorted by left, then right code
+    uint32_t fallback;  //!< Code drawn for characters the font does not have, 0 for space
+} font_t;
+
+
+//! @brief Image for an asset pack
+typedef struct
+{
+    char name[64];      //!< Name of the pack entry
+    uint8_t width;
+    uint8_t height;
+    uint8_t *pix;       //!< width * height pixels, row-major, one byte per pixel (0 or 1)
+} image_t;
+
+
+//! @brief Existing font table linked into the compiler
+typedef struct
+{
+    const char *name;               //!< Name, same as in _fonts_<name>_info
+    const font_info_t *info;        //!< Font information
+    size_t bitmap_size;             //!< sizeof(_fonts_<name>_bitmaps)
+    size_t num_descriptors;         //!< Entries in _fonts_<name>_descriptors, 0 for FONT_FLAG_MONO fonts
+} builtin_font_t;
+
+
+//! @brief Emitter options
+typedef struct
+{
+    bool pages;             //!< Page-native layout (FONT_FLAG_PAGES)
+    bool rle;               //!< Run-length coded page-native layout (FONT_FLAG_PAGES | FONT_FLAG_RLE)
+    bool mono;              //!< Monospace font without descriptors (FONT_FLAG_MONO)
+    bool boxes;             //!< Store only the ink box of every glyph (font_info_t::boxes)
+    bool ranges;            //!< Code point ranges (font_info_t::ranges), implied by characters above 0xff
+    const char *pool;       //!< Name of the bitmap array shared by all fonts of the header, NULL for one font
+    const char *source;     //!< Description of input, written into the header comment
+    const char *command;    //!< Command line, written into the header comment
+} emit_opts_t;
+
+
+//! @brief Bitmap bytes shared by the glyphs of one or more fonts, identical glyphs are stored once
+typedef struct
+{
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+    uint32_t num_blobs;
+    uint32_t *blob_offset;      //!< Start of every distinct glyph in data
+    uint32_t *blob_size;
+} pool_t;
+
+
+//! @brief Tables in driver format, built before anything is written
+typedef struct
+{
+    uint32_t char_start;
+    uint32_t char_end;
+    uint16_t num_chars;         //!< Table entries
+    uint8_t mono_width;         //!< Glyph width of monospace tables, 0 otherwise
+    uint16_t num_ranges;        //!< 0 for a single range without range table (char_start..char_end)
+    font_range_t range[FONTC_MAX_RANGES];
+    uint32_t code[FONTC_MAX_CHARS];             //!< Character code of each table entry
+    font_char_desc_t desc[FONTC_MAX_CHARS];
+    bool boxes;                                 //!< Glyphs are stored as their ink box
+    font_glyph_box_t box[FONTC_MAX_CHARS];
+    const glyph_t *glyph[FONTC_MAX_CHARS];      //!< NULL for characters missing in the source
+    uint8_t *bitmap;            //!< Own bitmap, or the data of the pool the tables were built into
+    size_t bitmap_size;
+    bool shared;                //!< Bitmap belongs to a pool
+    uint32_t shared_glyphs;     //!< Glyphs that use the bytes of an identical glyph
+    uint32_t num_kern_pairs;    //!< Kerning pairs of characters the font has
+    uint32_t num_kern_lefts;    //!< Left characters of those pairs
+} tables_t;
+
+
+//! @brief Size of the emitted tables in bytes on the target
+typedef struct
+{
+    size_t bitmap;
+    size_t descriptors;
+    size_t boxes;
+    size_t ranges;
+    size_t kerning;
+    size_t images;      //!< Image bitmaps of an asset pack
+    size_t info;
+    size_t pack;        //!< Size of an asset pack including alignment, 0 for headers
+} size_report_t;
+
+
+// font.c
+void font_init(font_t *font, const char *name, uint8_t height);
+void font_free(font_t *font);
+glyph_t *font_add_glyph(font_t *font, uint32_t code, uint8_t width);
+glyph_t *font_find_glyph(const font_t *font, uint32_t code);
+void font_sort(font_t *font);
+void font_keep_range(font_t *font, uint32_t first, uint32_t last);
+void font_keep_set(font_t *font, const uint8_t *set);
+bool font_glyph_blank(const font_t *font, const glyph_t *g);
+int font_recode(font_t *font, const char *charset);
+int font_merge(font_t *dst, font_t *src);
+int font_add_kern_pair(font_t *font, uint32_t left, uint32_t right, int8_t adjust);
+void font_sort_kern_pairs(font_t *font);
+
+// kern.c
+int kern_auto(font_t *font, uint8_t min_adjust, FILE *log);
+
+// builtin.c
+extern const builtin_font_t builtin_fonts[];
+extern const size_t num_builtin_fonts;
+const builtin_font_t *builtin_find(const char *name);
+size_t builtin_num_chars(const builtin_font_t *b);
+int builtin_verify(const builtin_font_t *b, FILE *log);
+int builtin_load(const builtin_font_t *b, font_t *font, int char_start);
+
+// bdf.c
+int bdf_read(const char *path, font_t *font);
+int bdf_write(FILE *out, const font_t *font);
+
+// emit.c
+size_t pool_add(pool_t *pool, const uint8_t *data, size_t size, bool share);
+void pool_free(pool_t *pool);
+int tables_build(const font_t *font, const emit_opts_t *opts, pool_t *pool, tables_t *t);
+void tables_free(tables_t *t);
+bool tables_kern_pair_used(const font_t *font, const kern_pair_t *k);
+size_t tables_kerning_size(const tables_t *t);
+int emit_header(FILE *out, const font_t *fonts, size_t num_fonts, const emit_opts_t *opts, size_report_t *report);
+
+// pack.c
+int pack_write(FILE *out, const font_t *fonts, size_t num_fonts, const image_t *images, size_t num_images,
+               const emit_opts_t *opts, size_report_t *report);
+int pbm_read(const char *path, image_t *image);
+
+// subset.c
+int subset_read(const char *path, uint8_t *set);
+
+// rle.c
+size_t rle_encode(const uint8_t *in, size_t n, uint8_t *out);
+size_t rle_decode(const uint8_t *code, uint8_t *out, size_t n);
+size_t rle_length(const uint8_t *code, size_t avail, size_t n);
+
+// bench.c
+int bench_fonts(const char *name);
+
+#endif /* FONTC_H */
@@ -0,0 +1,157 @@
+/**
+  ******************************************************************************
+  * @file    kern.c
+  * @brief   Host-side font compiler, automatic kerning of proportional fonts
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE file.
+  *
+  */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fontc.h"
+
+
+//! Characters kerned automatically: letters, digits and the punctuation found next to them
+#define KERN_CHARS      "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz.,:;-'\""
+#define KERN_NONE       255     //!< Row without ink
+
+
+//! @brief Blank columns left and right of the ink of every row of a glyph
+typedef struct
+{
+    const glyph_t *glyph;
+    uint8_t left[256];
+    uint8_t right[256];
+} profile_t;
+
+
+static void _profile(const font_t *font, const glyph_t *g, profile_t *p)
+{
+    uint8_t x, y;
+
+    p->glyph = g;
+    for (y = 0; y < font->height; ++y)
+    {
+        p->left[y] = KERN_NONE;
+        p->right[y] = KERN_NONE;
+        for (x = 0; x < g->width; ++x)
+        {
+            if (!g->pix[y * g->width + x])
+                continue;
+            if (p->left[y] == KERN_NONE)
+                p->left[y] = x;
+            p->right[y] = g->width - 1 - x;
+        }
+    }
+}
+
+
+/*
+ * Narrowest gap between the ink of two glyphs placed "c" apart, KERN_NONE if they have no rows in common. Ink in
+ * the row above or below counts as well, so glyphs moved closer do not touch diagonally either.
+ */
+static int _gap(const font_t *font, const profile_t *l, const profile_t *r)
+{
+    int y, dy, gap = KERN_NONE, g;
+
+    for (y = 0; y < font->height; ++y)
+    {
+        if (l->right[y] == KERN_NONE)
+            continue;
+        for (dy = -1; dy <= 1; ++dy)
+        {
+            if ((y + dy < 0) || (y + dy >= font->height) || (r->left[y + dy] == KERN_NONE))
+                continue;
+            g = l->right[y] + font->c + r->left[y + dy];
+            if (g < gap)
+                gap = g;
+        }
+    }
+    return gap;
+}
+
+
+static bool _alnum(uint32_t code)
+{
+    return ((code >= '0') && (code <= '9')) || ((code >= 'A') && (code <= 'Z')) || ((code >= 'a') && (code <= 'z'));
+}
+
+
+/*
+ * Kern the letters, digits and common punctuation of a font by their shapes. The gap most pairs of letters and
+ * digits have is taken as the spacing the font was designed for. Pairs whose gap is at least "min_adjust" pixels
+ * wider (diagonals as in "AV", "T" over lower case letters, punctuation after "r") move closer to it, pairs that
+ * much narrower move apart. Smaller differences are left alone, they would cost a pair each for a pixel that is
+ * rarely missed. Pairs already in the font are replaced, "log" may be NULL. Returns the number of pairs, or -1 on
+ * error.
+ */
+int kern_auto(font_t *font, uint8_t min_adjust, FILE *log)
+{
+    profile_t *p;
+    uint32_t n = 0, i, j, count[KERN_NONE + 1];
+    int gap, normal = 0, adjust;
+    const glyph_t *g;
+    const char *ch;
+
+    p = calloc(strlen(KERN_CHARS), sizeof(profile_t));
+    if (p == NULL)
+        return -1;
+    for (ch = KERN_CHARS; *ch; ++ch)
+    {
+        g = font_find_glyph(font, (unsigned char)*ch);
+        if ((g == NULL) || font_glyph_blank(font, g))
+            continue;
+        _profile(font, g, &p[n++]);
+    }
+
+    // the most common gap between letters and digits
+    memset(count, 0, sizeof(count));
+    for (i = 0; i < n; ++i)
+        for (j = 0; j < n; ++j)
+            if (_alnum(p[i].glyph->code) && _alnum(p[j].glyph->code))
+                ++count[_gap(font, &p[i], &p[j])];
+    for (i = 1; i < KERN_NONE; ++i)
+        if (count[i] > count[normal])
+            normal = i;
+    if (count[normal] == 0)
+    {
+        if (log)
+            fprintf(log, "%s: no letters or digits to kern\n", font->name);
+        free(p);
+        return 0;
+    }
+
+    free(font->kern_pairs);
+    font->kern_pairs = NULL;
+    font->num_kern_pairs = 0;
+    for (i = 0; i < n; ++i)
+    {
+        for (j = 0; j < n; ++j)
+        {
+            gap = _gap(font, &p[i], &p[j]);
+            if (gap == KERN_NONE)
+                continue;
+            adjust = normal - gap;
+            if ((adjust > -min_adjust) && (adjust < min_adjust))
+                continue;
+            if (adjust > 127)
+                adjust = 127;
+            if (adjust < -127)
+                adjust = -127;
+            if (font_add_kern_pair(font, p[i].glyph->code, p[j].glyph->code, adjust))
+            {
+                free(p);
+                return -1;
+            }
+        }
+    }
+    free(p);
+    font_sort_kern_pairs(font);
+    if (log)
+        fprintf(log, "%s: %u kerning pairs, normal gap %d\n", font->name, font->num_kern_pairs, normal);
+    return font->num_kern_pairs;
+}
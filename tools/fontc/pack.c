@@ -0,0 +1,373 @@
+/**
+  ******************************************************************************
+  * @file    pack.c
+  * @brief   Host-side font compiler, asset packs of fonts and images loaded by the driver at runtime
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE file.
+  *
+  */
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fontc.h"
+#include "ssd1306_assets.h"
+
+
+#define PACK_HEADER_SIZE    12  //!< sizeof(ssd1306_pack_header_t)
+#define PACK_ENTRY_SIZE     40  //!< sizeof(ssd1306_pack_entry_t)
+#define PACK_FONT_SIZE      52  //!< sizeof(ssd1306_pack_font_t)
+#define PACK_IMAGE_SIZE     8   //!< sizeof(ssd1306_pack_image_t)
+
+
+//! @brief Pack being built, little-endian whatever the host is
+typedef struct
+{
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+} buffer_t;
+
+
+// Append n zero bytes, return their offset or SIZE_MAX if out of memory
+static size_t _grow(buffer_t *b, size_t n)
+{
+    size_t offset = b->size, capacity;
+    uint8_t *d;
+
+    if (b->size + n > b->capacity)
+    {
+        capacity = (b->size + n) * 2 + 256;
+        d = realloc(b->data, capacity);
+        if (d == NULL)
+            return SIZE_MAX;
+        b->data = d;
+        b->capacity = capacity;
+    }
+    memset(b->data + b->size, 0, n);
+    b->size += n;
+    return offset;
+}
+
+
+// Start a table at the next multiple of 4, as the driver reads it in place
+static size_t _table(buffer_t *b, size_t n)
+{
+    if ((b->size & 3) && (_grow(b, 4 - (b->size & 3)) == SIZE_MAX))
+        return SIZE_MAX;
+    return _grow(b, n);
+}
+
+
+static void _u16(buffer_t *b, size_t offset, uint16_t v)
+{
+    b->data[offset] = v & 0xff;
+    b->data[offset + 1] = v >> 8;
+}
+
+
+static void _u32(buffer_t *b, size_t offset, uint32_t v)
+{
+    _u16(b, offset, v & 0xffff);
+    _u16(b, offset + 2, v >> 16);
+}
+
+
+// Font entry and its tables, in the layout of ssd1306_pack_font_t and the driver structures
+static int _pack_font(buffer_t *b, const font_t *font, const emit_opts_t *opts, size_t at, size_report_t *report)
+{
+    tables_t *t;
+    size_t f, o, r, a;
+    uint32_t i, n, last = 0;
+    int result = -1;
+
+    t = calloc(1, sizeof(tables_t));
+    if ((t == NULL) || tables_build(font, opts, NULL, t))
+        goto pack_font_finish;
+
+    f = _table(b, PACK_FONT_SIZE);
+    if (f == SIZE_MAX)
+        goto pack_font_finish;
+    _u32(b, at, f);
+    b->data[f] = font->height;
+    b->data[f + 1] = font->c;
+    b->data[f + 2] = t->num_ranges ? 0 : t->char_start;
+    b->data[f + 3] = t->num_ranges ? 0 : t->char_end;
+    if (opts->rle)
+        b->data[f + 4] = FONT_FLAG_PAGES | FONT_FLAG_RLE;
+    else
+        b->data[f + 4] = (opts->pages ? FONT_FLAG_PAGES : 0) | (opts->mono ? FONT_FLAG_MONO : 0);
+    if (opts->mono)
+    {
+        b->data[f + 5] = t->mono_width;
+        _u16(b, f + 6, opts->pages ? t->mono_width * ((font->height + 7) / 8)
+                                   : ((t->mono_width + 7) / 8) * font->height);
+    }
+    _u16(b, f + 8, t->num_chars);
+    _u16(b, f + 10, t->num_ranges);
+    _u16(b, f + 12, t->num_kern_lefts);
+    _u16(b, f + 14, t->num_kern_pairs);
+    _u16(b, f + 16, font->fallback);
+
+    o = _table(b, t->bitmap_size);
+    if (o == SIZE_MAX)
+        goto pack_font_finish;
+    memcpy(b->data + o, t->bitmap, t->bitmap_size);
+    _u32(b, f + 20, o);
+    _u32(b, f + 24, t->bitmap_size);
+    report->bitmap += t->bitmap_size;
+
+    if (!opts->mono)
+    {
+        o = _table(b, (size_t)t->num_chars * TARGET_DESC_SIZE);
+        if (o == SIZE_MAX)
+            goto pack_font_finish;
+        _u32(b, f + 28, o);
+        for (i = 0; i < t->num_chars; ++i, o += TARGET_DESC_SIZE)
+        {
+            b->data[o] = t->desc[i].width;
+            _u16(b, o + 2, t->desc[i].offset);
+        }
+        report->descriptors += (size_t)t->num_chars * TARGET_DESC_SIZE;
+    }
+    if (t->boxes)
+    {
+        o = _table(b, (size_t)t->num_chars * TARGET_BOX_SIZE);
+        if (o == SIZE_MAX)
+            goto pack_font_finish;
+        _u32(b, f + 32, o);
+        for (i = 0; i < t->num_chars; ++i, o += TARGET_BOX_SIZE)
+        {
+            b->data[o] = t->box[i].x;
+            b->data[o + 1] = t->box[i].y;
+            b->data[o + 2] = t->box[i].w;
+            b->data[o + 3] = t->box[i].h;
+        }
+        report->boxes += (size_t)t->num_chars * TARGET_BOX_SIZE;
+    }
+    if (t->num_ranges)
+    {
+        o = _table(b, (size_t)t->num_ranges * TARGET_RANGE_SIZE);
+        if (o == SIZE_MAX)
+            goto pack_font_finish;
+        _u32(b, f + 36, o);
+        for (i = 0; i < t->num_ranges; ++i, o += TARGET_RANGE_SIZE)
+        {
+            _u16(b, o, t->range[i].first);
+            _u16(b, o + 2, t->range[i].last);
+            _u16(b, o + 4, t->range[i].index);
+        }
+        report->ranges += (size_t)t->num_ranges * TARGET_RANGE_SIZE;
+    }
+    if (t->num_kern_pairs)
+    {
+        // left characters with the index of their first pair, then right characters and adjustments
+        o = _table(b, (size_t)(t->num_kern_lefts + 1) * TARGET_KERN_LEFT_SIZE);
+        r = _table(b, (size_t)t->num_kern_pairs * 2);
+        a = _table(b, t->num_kern_pairs);
+        if ((o == SIZE_MAX) || (r == SIZE_MAX) || (a == SIZE_MAX))
+            goto pack_font_finish;
+        _u32(b, f + 40, o);
+        _u32(b, f + 44, r);
+        _u32(b, f + 48, a);
+        for (i = 0, n = 0; i < font->num_kern_pairs; ++i)
+        {
+            if (!tables_kern_pair_used(font, &font->kern_pairs[i]))
+                continue;
+            if ((n == 0) || (font->kern_pairs[i].left != font->kern_pairs[last].left))
+            {
+                _u16(b, o, font->kern_pairs[i].left);
+                _u16(b, o + 2, n);
+                o += TARGET_KERN_LEFT_SIZE;
+            }
+            last = i;
+            _u16(b, r + n * 2, font->kern_pairs[i].right);
+            b->data[a + n++] = (uint8_t)font->kern_pairs[i].adjust;
+        }
+        _u16(b, o, 0xffff);
+        _u16(b, o + 2, n);
+        report->kerning += tables_kerning_size(t) - TARGET_KERNING_SIZE;
+    }
+    report->info += PACK_ENTRY_SIZE + PACK_FONT_SIZE;
+    result = 0;
+
+pack_font_finish:
+    if (t)
+        tables_free(t);
+    free(t);
+    return result;
+}
+
+
+// Image entry and its page-major bitmap
+static int _pack_image(buffer_t *b, const image_t *image, size_t at, size_report_t *report)
+{
+    size_t f, o;
+    uint32_t x, y;
+
+    f = _table(b, PACK_IMAGE_SIZE);
+    if (f == SIZE_MAX)
+        return -1;
+    _u32(b, at, f);
+    b->data[f] = image->width;
+    b->data[f + 1] = image->height;
+    o = _table(b, (size_t)image->width * ((image->height + 7) / 8));
+    if (o == SIZE_MAX)
+        return -1;
+    _u32(b, f + 4, o);
+    for (y = 0; y < image->height; ++y)
+        for (x = 0; x < image->width; ++x)
+            if (image->pix[y * image->width + x])
+                b->data[o + (y / 8) * image->width + x] |= 1 << (y & 7);
+    report->images += (size_t)image->width * ((image->height + 7) / 8);
+    report->info += PACK_ENTRY_SIZE + PACK_IMAGE_SIZE;
+    return 0;
+}
+
+
+// Entry name, checked for length
+static int _name(buffer_t *b, size_t at, const char *name)
+{
+    if (strlen(name) >= SSD1306_ASSET_NAME_SIZE)
+    {
+        fprintf(stderr, "%s: name longer than %d characters, use -n\n", name, SSD1306_ASSET_NAME_SIZE - 1);
+        return -1;
+    }
+    memcpy(b->data + at, name, strlen(name));
+    return 0;
+}
+
+
+/*
+ * Write fonts and images into an asset pack (see ssd1306_assets.h). The entries are written first, the fonts and
+ * images follow in the order given, every table aligned to 4 bytes.
+ */
+int pack_write(FILE *out, const font_t *fonts, size_t num_fonts, const image_t *images, size_t num_images,
+               const emit_opts_t *opts, size_report_t *report)
+{
+    buffer_t b = { NULL, 0, 0 };
+    size_t k, at;
+    int result = -1;
+
+    memset(report, 0, sizeof(*report));
+    if (_grow(&b, PACK_HEADER_SIZE + (num_fonts + num_images) * PACK_ENTRY_SIZE) == SIZE_MAX)
+        goto pack_write_finish;
+    _u32(&b, 0, SSD1306_ASSETS_MAGIC);
+    _u16(&b, 4, SSD1306_ASSETS_VERSION);
+    _u16(&b, 6, num_fonts + num_images);
+    for (k = 0; k < num_fonts; ++k)
+    {
+        at = PACK_HEADER_SIZE + k * PACK_ENTRY_SIZE;
+        if (_name(&b, at, fonts[k].name))
+            goto pack_write_finish;
+        b.data[at + SSD1306_ASSET_NAME_SIZE] = SSD1306_ASSET_FONT;
+        if (_pack_font(&b, &fonts[k], opts, at + SSD1306_ASSET_NAME_SIZE + 4, report))
+            goto pack_write_finish;
+    }
+    for (k = 0; k < num_images; ++k)
+    {
+        at = PACK_HEADER_SIZE + (num_fonts + k) * PACK_ENTRY_SIZE;
+        if (_name(&b, at, images[k].name))
+            goto pack_write_finish;
+        b.data[at + SSD1306_ASSET_NAME_SIZE] = SSD1306_ASSET_IMAGE;
+        if (_pack_image(&b, &images[k], at + SSD1306_ASSET_NAME_SIZE + 4, report))
+            goto pack_write_finish;
+    }
+    _u32(&b, 8, b.size);
+    report->info += PACK_HEADER_SIZE;
+    report->pack = b.size;
+    if (fwrite(b.data, 1, b.size, out) == b.size)
+        result = 0;
+
+pack_write_finish:
+    free(b.data);
+    return result;
+}
+
+
+// Next token of a PBM header, comments skipped
+static int _pbm_number(FILE *f)
+{
+    int ch, n = 0;
+
+    do
+    {
+        ch = fgetc(f);
+        if (ch == '#')
+            while ((ch != '\n') && (ch != EOF))
+                ch = fgetc(f);
+    } while (isspace(ch));
+    if (!isdigit(ch))
+        return -1;
+    for (; isdigit(ch); ch = fgetc(f))
+        n = n * 10 + ch - '0';
+    return n;
+}
+
+
+/*
+ * Read a black and white image from a PBM file, plain (P1) or raw (P4). Black pixels are ink. The image is
+ * named after the file, without directory and extension.
+ */
+int pbm_read(const char *path, image_t *image)
+{
+    FILE *f;
+    char magic[3] = "";
+    const char *base, *dot;
+    int w, h, x, y, ch = 0;
+
+    memset(image, 0, sizeof(*image));
+    f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    if (fread(magic, 1, 2, f) != 2)
+        goto pbm_read_fail;
+    w = _pbm_number(f);
+    h = _pbm_number(f);
+    if ((strcmp(magic, "P1") && strcmp(magic, "P4")) || (w <= 0) || (w > 255) || (h <= 0) || (h > 255))
+        goto pbm_read_fail;
+    image->width = w;
+    image->height = h;
+    image->pix = calloc((size_t)w * h, 1);
+    if (image->pix == NULL)
+        goto pbm_read_fail;
+    for (y = 0; y < h; ++y)
+    {
+        for (x = 0; x < w; ++x)
+        {
+            if (magic[1] == '1')
+            {
+                ch = _pbm_number(f);
+                if (ch < 0)
+                    goto pbm_read_fail;
+                image->pix[y * w + x] = ch ? 1 : 0;
+                continue;
+            }
+            // P4 rows are padded to whole bytes, MSB first
+            if ((x & 7) == 0)
+                ch = fgetc(f);
+            if (ch == EOF)
+                goto pbm_read_fail;
+            image->pix[y * w + x] = (ch >> (7 - (x & 7))) & 1;
+        }
+    }
+    fclose(f);
+
+    base = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    dot = strrchr(base, '.');
+    snprintf(image->name, sizeof(image->name), "%.*s", dot ? (int)(dot - base) : (int)strlen(base), base);
+    return 0;
+
+pbm_read_fail:
+    fprintf(stderr, "%s: not a PBM image of at most 255 x 255 pixels\n", path);
+    free(image->pix);
+    image->pix = NULL;
+    fclose(f);
+    return -1;
+}
@@ -0,0 +1,99 @@
+/**
+  ******************************************************************************
+  * @file    rle.c
+  * @brief   Host-side font compiler, run-length coding of page-native glyphs (FONT_FLAG_RLE)
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE file.
+  *
+  */
+
+#include "fontc.h"
+
+
+static size_t _run(const uint8_t *in, size_t n, size_t max)
+{
+    size_t i;
+
+    for (i = 1; (i < n) && (i < max) && (in[i] == in[0]); ++i)
+        ;
+    return i;
+}
+
+
+/*
+ * Greedy coder: zero runs of 2 or more and other runs of 3 or more get their own token, everything else
+ * is collected into literal runs. Output is never larger than n + (n + 127) / 128 bytes.
+ */
+size_t rle_encode(const uint8_t *in, size_t n, uint8_t *out)
+{
+    size_t i = 0, o = 0, lit = 0, run;
+
+    while (i < n)
+    {
+        run = _run(in + i, n - i, 64);
+        if (((in[i] == 0) && (run >= 2)) || (run >= 3))
+        {
+            if (in[i] == 0)
+                out[o++] = 0x80 | (run - 1);
+            else
+            {
+                out[o++] = 0xc0 | (run - 1);
+                out[o++] = in[i];
+            }
+            i += run;
+            continue;
+        }
+        // literal run up to the next coded run
+        for (lit = 1; (i + lit < n) && (lit < 128); ++lit)
+        {
+            run = _run(in + i + lit, n - i - lit, 3);
+            if (((in[i + lit] == 0) && (run >= 2)) || (run >= 3))
+                break;
+        }
+        out[o++] = lit - 1;
+        for (; lit; --lit)
+            out[o++] = in[i++];
+    }
+    return o;
+}
+
+
+size_t rle_decode(const uint8_t *code, uint8_t *out, size_t n)
+{
+    const uint8_t *start = code;
+    uint8_t token, run, v;
+
+    while (n)
+    {
+        token = *code++;
+        run = (token & ((token & 0x80) ? 0x3f : 0x7f)) + 1;
+        v = ((token & 0xc0) == 0xc0) ? *code++ : 0;
+        for (; run && n; --run, --n)
+            *out++ = (token & 0x80) ? v : *code++;
+    }
+    return code - start;
+}
+
+
+// Size of the code of "n" bytes, SIZE_MAX if the code does not fit into "avail" bytes
+size_t rle_length(const uint8_t *code, size_t avail, size_t n)
+{
+    size_t o = 0, run;
+    uint8_t token;
+
+    while (n)
+    {
+        if (o >= avail)
+            return SIZE_MAX;
+        token = code[o++];
+        run = (token & ((token & 0x80) ? 0x3f : 0x7f)) + 1;
+        if (run > n)
+            run = n;
+        o += ((token & 0xc0) == 0xc0) ? 1 : (token & 0x80) ? 0 : run;
+        n -= run;
+    }
+    return (o <= avail) ? o : SIZE_MAX;
+}
@@ -0,0 +1,169 @@
+/**
+  ******************************************************************************
+  * @file    subset.c
+  * @brief   Host-side font compiler, characters an application uses, read from its strings
+  ******************************************************************************
+  * @copyright
+  *
+  * Use of this source code is governed by a BSD-style license that can be
+  * found in the LICENSE file.
+  *
+  */
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fontc.h"
+
+
+// Add the characters of UTF-8 text to the set, bytes that are not UTF-8 count as Latin-1 (as in the driver)
+static void _add_text(const uint8_t *s, size_t n, uint8_t *set)
+{
+    uint32_t code;
+    size_t i = 0, len, k;
+
+    while (i < n)
+    {
+        code = s[i];
+        len = (code >= 0xf0) ? 4 : (code >= 0xe0) ? 3 : (code >= 0xc0) ? 2 : 1;
+        if ((len > 1) && (i + len <= n))
+        {
+            code &= 0x3f >> (len - 1);
+            for (k = 1; (k < len) && ((s[i + k] & 0xc0) == 0x80); ++k)
+                code = (code << 6) | (s[i + k] & 0x3f);
+            if (k < len)
+            {
+                code = s[i];
+                len = 1;
+            }
+        }
+        else
+        {
+            len = 1;
+        }
+        if ((code >= 0x20) && (code <= 0xffff))
+            set[code / 8] |= 1 << (code & 7);
+        i += len;
+    }
+}
+
+
+// "#include" directive at src[i], with or without spaces after the "#"
+static bool _is_include(const uint8_t *src, size_t n, size_t i)
+{
+    for (++i; (i < n) && ((src[i] == ' ') || (src[i] == '\t')); ++i)
+        ;
+    return (n - i >= 7) && (memcmp(src + i, "include", 7) == 0);
+}
+
+
+// Contents of the C string and character literals of a source file, escapes resolved; returns its length
+static size_t _literals(const uint8_t *src, size_t n, uint8_t *out)
+{
+    size_t i = 0, len = 0, k;
+    uint8_t quote = 0, v;
+    bool bol = true;
+
+    while (i < n)
+    {
+        if (!quote)
+        {
+            // comments and #include lines are skipped, they are not shown on the panel; other directives
+            // keep their literals (#define LABEL "TEMP")
+            if ((bol && (src[i] == '#') && _is_include(src, n, i))
+                || ((src[i] == '/') && (i + 1 < n) && (src[i + 1] == '/')))
+                while ((i < n) && (src[i] != '\n'))
+                    ++i;
+            else if ((src[i] == '/') && (i + 1 < n) && (src[i + 1] == '*'))
+                for (i += 2; (i + 1 < n) && !((src[i] == '*') && (src[i + 1] == '/')); ++i)
+                    ;
+            else if ((src[i] == '"') || (src[i] == '\''))
+                quote = src[i];
+            if ((i < n) && !isspace(src[i]))
+                bol = false;
+            else if ((i < n) && (src[i] == '\n'))
+                bol = true;
+            ++i;
+            continue;
+        }
+        if (src[i] == quote)
+        {
+            quote = 0;
+            ++i;
+            continue;
+        }
+        if ((src[i] != '\\') || (i + 1 >= n))
+        {
+            out[len++] = src[i++];
+            continue;
+        }
+        // escape sequence, control characters are dropped
+        ++i;
+        if (src[i] == 'x')
+        {
+            for (++i, v = 0; (i < n) && isxdigit(src[i]); ++i)
+                v = (v << 4) | (isdigit(src[i]) ? src[i] - '0' : (tolower(src[i]) - 'a' + 10));
+            out[len++] = v;
+        }
+        else if ((src[i] >= '0') && (src[i] <= '7'))
+        {
+            for (k = 0, v = 0; (k < 3) && (i < n) && (src[i] >= '0') && (src[i] <= '7'); ++k, ++i)
+                v = (v << 3) | (src[i] - '0');
+            out[len++] = v;
+        }
+        else
+        {
+            if (strchr("\\\"'?", src[i]))
+                out[len++] = src[i];
+            ++i;
+        }
+    }
+    return len;
+}
+
+
+/*
+ * Add the characters used by an application to a set of SUBSET_SIZE bytes, one bit per code point of the Basic
+ * Multilingual Plane. C and C++ sources (.c, .h, .cpp, .hpp) contribute the contents of their string and
+ * character literals, any other file all of its text, e.g. a list of UI strings or simply "0123456789.-%".
+ */
+int subset_read(const char *path, uint8_t *set)
+{
+    FILE *f;
+    uint8_t *data, *text;
+    size_t n;
+    long size;
+    const char *ext = strrchr(path, '.');
+
+    f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    if ((fseek(f, 0, SEEK_END) != 0) || ((size = ftell(f)) < 0) || (fseek(f, 0, SEEK_SET) != 0))
+    {
+        fclose(f);
+        return -1;
+    }
+    data = malloc(2 * (size_t)size + 1);
+    if (data == NULL)
+    {
+        fclose(f);
+        return -1;
+    }
+    n = fread(data, 1, size, f);
+    fclose(f);
+
+    if (ext && (!strcmp(ext, ".c") || !strcmp(ext, ".h") || !strcmp(ext, ".cpp") || !strcmp(ext, ".hpp")))
+    {
+        text = data + size;
+        _add_text(text, _literals(data, n, text), set);
+    }
+    else
+    {
+        _add_text(data, n, set);
+    }
+    free(data);
+    return 0;
+}